@@ -0,0 +1,1901 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "adsl.h"
+
+// Minimal perfect hash of the PI syndromes of all 1-bit and 2-bit error patterns over the 24 bytes of an ADS-L packet:
+// 192 single plus 18336 double bit patterns, all syndromes distinct as the 24-bit PI has a Hamming distance of 6 over this length.
+// Syndrome => Bucket = SyndromeHash(Syndr)>>20, Slot = SyndromeHash(Syndr^(Disp[Bucket]*0x9E3779B9))%18528,
+// the slot holds the bit indices: (Bit1<<8)|Bit2, Bit2=0xFF for a single bit error. Generated with hash-and-displace,
+// the largest buckets first, the displacement is the first seed which puts all syndromes of the bucket into free slots.
+// Generated by utils/adsl_syndrome_gen from adsl.h: do not edit, regenerate after a change of the PI or of the hash.
+
+const uint16_t ADSL_SyndromeDisp[ADSL_Packet::SyndromeBuckets] = {
+ 0x00EA, 0x0007, 0x00DD, 0x0037, 0x0013, 0x000E, 0x0018, 0x0000, 0x008E, 0x001E, 0x0003, 0x0075,
+ 0x0000, 0x002C, 0x0004, 0x0015, 0x006C, 0x0001, 0x006E, 0x0156, 0x0001, 0x000B, 0x0000, 0x0008,
+ 0x00B9, 0x0017, 0x0163, 0x0000, 0x0000, 0x00AC, 0x009F, 0x0000, 0x0072, 0x0001, 0x007D, 0x0000,
+ 0x0011, 0x0025, 0x0010, 0x0000, 0x0098, 0x0000, 0x00B4, 0x0069, 0x0005, 0x0001, 0x0000, 0x002F,
+ 0x000C, 0x0003, 0x0053, 0x0031, 0x00F2, 0x0090, 0x0002, 0x0160, 0x0080, 0x00B3, 0x002D, 0x0013,
+ 0x0002, 0x0018, 0x002D, 0x00C1, 0x0000, 0x0000, 0x0003, 0x0022, 0x0000, 0x009A, 0x0000, 0x0003,
+ 0x001F, 0x000F, 0x0051, 0x0000, 0x0003, 0x0054, 0x0035, 0x00D1, 0x000E, 0x0008, 0x0001, 0x0003,
+ 0x0030, 0x013F, 0x0013, 0x00A1, 0x00E5, 0x0007, 0x0000, 0x0016, 0x0007, 0x0025, 0x0040, 0x0055,
+ 0x004A, 0x003F, 0x0001, 0x0008, 0x0000, 0x000A, 0x000C, 0x00F5, 0x0002, 0x0000, 0x0009, 0x0024,
+ 0x0001, 0x030A, 0x0063, 0x0028, 0x0000, 0x006B, 0x0125, 0x02A2, 0x0000, 0x00B2, 0x0079, 0x0281,
+ 0x0182, 0x0087, 0x003D, 0x0031, 0x0004, 0x007C, 0x0000, 0x00A1, 0x0136, 0x0177, 0x007B, 0x0000,
+ 0x0061, 0x001A, 0x00CF, 0x005D, 0x001C, 0x000A, 0x0086, 0x0003, 0x00C4, 0x0002, 0x00D5, 0x0009,
+ 0x0000, 0x00EB, 0x0003, 0x0000, 0x0001, 0x0011, 0x0001, 0x0000, 0x0000, 0x0000, 0x00E3, 0x0006,
+ 0x0004, 0x0001, 0x0000, 0x0018, 0x0099, 0x0091, 0x004E, 0x0003, 0x0003, 0x00A9, 0x0004, 0x0000,
+ 0x0011, 0x0002, 0x001E, 0x022F, 0x0008, 0x0009, 0x0003, 0x0051, 0x003C, 0x0040, 0x00DD, 0x01AA,
+ 0x0000, 0x004A, 0x0001, 0x0000, 0x0000, 0x00B3, 0x0001, 0x00A2, 0x00CF, 0x0055, 0x0038, 0x0007,
+ 0x006A, 0x00EE, 0x0002, 0x005D, 0x0007, 0x002E, 0x0009, 0x001C, 0x000A, 0x0028, 0x0000, 0x0005,
+ 0x0024, 0x01A7, 0x002F, 0x016B, 0x0000, 0x0005, 0x0004, 0x0005, 0x0000, 0x0007, 0x0020, 0x0003,
+ 0x001F, 0x0074, 0x0289, 0x008D, 0x0000, 0x0057, 0x0000, 0x0000, 0x0012, 0x0000, 0x0000, 0x0075,
+ 0x0023, 0x001B, 0x0007, 0x0083, 0x0006, 0x0004, 0x0436, 0x0002, 0x0001, 0x0138, 0x0000, 0x01BD,
+ 0x001F, 0x0002, 0x03D4, 0x0004, 0x0047, 0x0115, 0x01AA, 0x0182, 0x0002, 0x0078, 0x0000, 0x0009,
+ 0x002E, 0x014E, 0x0000, 0x0057, 0x007C, 0x00B3, 0x0001, 0x000A, 0x002E, 0x00C9, 0x000B, 0x0000,
+ 0x0044, 0x0102, 0x003B, 0x0000, 0x0258, 0x005F, 0x0002, 0x00E4, 0x0000, 0x00AA, 0x0039, 0x000C,
+ 0x0118, 0x0043, 0x000A, 0x0000, 0x0000, 0x0009, 0x0112, 0x0019, 0x0000, 0x005D, 0x0001, 0x0000,
+ 0x006C, 0x0012, 0x000C, 0x0001, 0x0097, 0x0000, 0x000B, 0x000B, 0x004E, 0x0000, 0x0001, 0x005A,
+ 0x0001, 0x0015, 0x001A, 0x0003, 0x0000, 0x007D, 0x004F, 0x0000, 0x0000, 0x019C, 0x0023, 0x0004,
+ 0x0639, 0x0001, 0x0008, 0x0006, 0x0140, 0x01AA, 0x0002, 0x0081, 0x0000, 0x0000, 0x0003, 0x0225,
+ 0x0036, 0x0002, 0x0158, 0x0001, 0x0013, 0x0001, 0x0006, 0x0003, 0x0065, 0x012A, 0x001E, 0x0013,
+ 0x0010, 0x0149, 0x0041, 0x009D, 0x002E, 0x007F, 0x0008, 0x002F, 0x0021, 0x0004, 0x000F, 0x01AA,
+ 0x001F, 0x0048, 0x0002, 0x0004, 0x0011, 0x0006, 0x0010, 0x001C, 0x0001, 0x0063, 0x0135, 0x0014,
+ 0x0000, 0x00CB, 0x0040, 0x0019, 0x0014, 0x04C1, 0x0008, 0x006F, 0x0025, 0x0046, 0x0000, 0x006C,
+ 0x0096, 0x0000, 0x000E, 0x00A3, 0x0080, 0x0085, 0x0006, 0x0000, 0x0051, 0x0022, 0x026E, 0x0035,
+ 0x0006, 0x0016, 0x0020, 0x0181, 0x00B4, 0x005C, 0x0059, 0x0050, 0x0001, 0x0014, 0x0059, 0x012C,
+ 0x000F, 0x0000, 0x0003, 0x0008, 0x0000, 0x0065, 0x023E, 0x0081, 0x000F, 0x0002, 0x00C6, 0x039A,
+ 0x0025, 0x006B, 0x00C6, 0x0016, 0x0000, 0x010E, 0x000E, 0x002B, 0x0006, 0x000B, 0x0019, 0x001F,
+ 0x0000, 0x06A8, 0x0002, 0x0017, 0x0003, 0x000F, 0x006D, 0x0027, 0x0049, 0x000F, 0x0002, 0x002D,
+ 0x0001, 0x02C8, 0x0011, 0x0004, 0x0004, 0x0099, 0x0083, 0x0002, 0x0012, 0x0222, 0x0146, 0x0026,
+ 0x0001, 0x0001, 0x0211, 0x0003, 0x00C3, 0x0000, 0x00A3, 0x003F, 0x000B, 0x0002, 0x0026, 0x0000,
+ 0x0137, 0x0017, 0x001B, 0x0001, 0x0000, 0x0002, 0x0001, 0x0123, 0x0025, 0x0005, 0x0001, 0x0013,
+ 0x001C, 0x0064, 0x012E, 0x008D, 0x0015, 0x003A, 0x0026, 0x0071, 0x0001, 0x0005, 0x00AA, 0x0004,
+ 0x0026, 0x0000, 0x0002, 0x000C, 0x0105, 0x01A1, 0x000E, 0x0001, 0x0000, 0x0026, 0x0003, 0x0048,
+ 0x004E, 0x02EA, 0x0001, 0x0027, 0x0001, 0x0001, 0x015F, 0x0000, 0x0002, 0x0000, 0x0010, 0x0051,
+ 0x0000, 0x00F1, 0x0007, 0x0031, 0x0000, 0x0003, 0x001F, 0x0000, 0x0000, 0x0040, 0x001F, 0x0032,
+ 0x0034, 0x0007, 0x0029, 0x0000, 0x0065, 0x02C8, 0x00E5, 0x005D, 0x0004, 0x0262, 0x0002, 0x0000,
+ 0x0034, 0x0009, 0x0371, 0x00AE, 0x0005, 0x0014, 0x0128, 0x0000, 0x0000, 0x0001, 0x0076, 0x0003,
+ 0x0002, 0x0138, 0x003B, 0x0003, 0x001C, 0x0084, 0x0010, 0x0003, 0x0006, 0x00C5, 0x0033, 0x0006,
+ 0x00D5, 0x0000, 0x0008, 0x00C8, 0x00D4, 0x0006, 0x002D, 0x00E6, 0x0040, 0x004E, 0x0108, 0x0053,
+ 0x0004, 0x0014, 0x0000, 0x005B, 0x0025, 0x004D, 0x0073, 0x0000, 0x0008, 0x0114, 0x0000, 0x0061,
+ 0x001F, 0x0003, 0x0000, 0x0031, 0x0004, 0x0022, 0x0000, 0x000E, 0x003C, 0x0004, 0x00E2, 0x0005,
+ 0x0013, 0x0087, 0x0001, 0x0001, 0x0085, 0x000B, 0x0056, 0x0003, 0x0009, 0x0004, 0x0000, 0x000A,
+ 0x0246, 0x010F, 0x0000, 0x002B, 0x0009, 0x0000, 0x004B, 0x0002, 0x001D, 0x009F, 0x01AF, 0x0003,
+ 0x0000, 0x000A, 0x0007, 0x0059, 0x0025, 0x0011, 0x006F, 0x0005, 0x004E, 0x002A, 0x0120, 0x0000,
+ 0x0004, 0x00A0, 0x001C, 0x0051, 0x00F7, 0x0183, 0x0000, 0x0004, 0x0003, 0x00C5, 0x0000, 0x0009,
+ 0x00A6, 0x0059, 0x000E, 0x0000, 0x0004, 0x001D, 0x005C, 0x00DD, 0x0010, 0x0083, 0x005C, 0x0021,
+ 0x0026, 0x0572, 0x0003, 0x021E, 0x00A5, 0x0076, 0x0000, 0x0005, 0x0006, 0x0006, 0x01F4, 0x0005,
+ 0x0034, 0x0006, 0x013E, 0x006C, 0x0001, 0x0022, 0x0009, 0x0073, 0x0000, 0x0026, 0x0001, 0x0012,
+ 0x003C, 0x0007, 0x0002, 0x000A, 0x000F, 0x0013, 0x00BF, 0x00A6, 0x0011, 0x001C, 0x00B0, 0x001C,
+ 0x000B, 0x0163, 0x0014, 0x003B, 0x0160, 0x0002, 0x000C, 0x0010, 0x0074, 0x0166, 0x0027, 0x0030,
+ 0x0002, 0x0006, 0x0088, 0x005B, 0x0018, 0x001A, 0x00D0, 0x0000, 0x0178, 0x027B, 0x0001, 0x0005,
+ 0x0086, 0x000A, 0x0026, 0x0018, 0x0016, 0x0004, 0x0085, 0x0038, 0x0000, 0x0004, 0x0026, 0x0000,
+ 0x001C, 0x001D, 0x0000, 0x0026, 0x0055, 0x0036, 0x0000, 0x0006, 0x000F, 0x0015, 0x006E, 0x006A,
+ 0x0099, 0x0041, 0x0112, 0x000D, 0x0090, 0x004D, 0x001F, 0x0003, 0x0001, 0x0007, 0x006E, 0x0047,
+ 0x002C, 0x0001, 0x0259, 0x0000, 0x0001, 0x0023, 0x0076, 0x012B, 0x0040, 0x001F, 0x0002, 0x0004,
+ 0x000F, 0x0421, 0x0002, 0x0000, 0x000C, 0x0048, 0x00D1, 0x0007, 0x002C, 0x0004, 0x022D, 0x0002,
+ 0x0001, 0x0002, 0x0163, 0x0105, 0x0055, 0x00ED, 0x0078, 0x00E8, 0x0005, 0x00CD, 0x0050, 0x001A,
+ 0x0226, 0x005F, 0x0029, 0x000C, 0x006F, 0x0002, 0x0002, 0x0005, 0x009E, 0x001A, 0x0002, 0x0029,
+ 0x0054, 0x0064, 0x0072, 0x0033, 0x02D9, 0x0005, 0x0002, 0x006C, 0x002A, 0x008E, 0x004A, 0x0096,
+ 0x0019, 0x0001, 0x0153, 0x011E, 0x0036, 0x0004, 0x0248, 0x0000, 0x0023, 0x0089, 0x0043, 0x00F4,
+ 0x0003, 0x01F3, 0x0018, 0x00BD, 0x0045, 0x0259, 0x00C7, 0x01E2, 0x000D, 0x000D, 0x0115, 0x0017,
+ 0x00A6, 0x055A, 0x0042, 0x0004, 0x005D, 0x0008, 0x0033, 0x0162, 0x0001, 0x000D, 0x00B5, 0x0003,
+ 0x000F, 0x015B, 0x00F2, 0x0054, 0x0048, 0x0003, 0x001D, 0x009E, 0x000C, 0x0004, 0x0024, 0x028C,
+ 0x0071, 0x002B, 0x0004, 0x00A2, 0x0000, 0x0012, 0x0047, 0x0000, 0x0001, 0x0002, 0x0023, 0x01A0,
+ 0x000D, 0x0003, 0x009B, 0x0037, 0x001E, 0x00B1, 0x0003, 0x0235, 0x0260, 0x002E, 0x000E, 0x0002,
+ 0x0015, 0x0023, 0x005D, 0x0000, 0x015C, 0x0093, 0x0008, 0x005B, 0x0000, 0x0004, 0x00B1, 0x0000,
+ 0x0004, 0x001E, 0x001B, 0x0003, 0x003F, 0x0003, 0x0124, 0x0130, 0x008D, 0x0014, 0x0001, 0x0001,
+ 0x0005, 0x0001, 0x0015, 0x0003, 0x0001, 0x0001, 0x0039, 0x002A, 0x047B, 0x01A2, 0x0121, 0x0384,
+ 0x0236, 0x001B, 0x0029, 0x0000, 0x0033, 0x0004, 0x0096, 0x0000, 0x0001, 0x0094, 0x000D, 0x004D,
+ 0x00F8, 0x0006, 0x0009, 0x007A, 0x0010, 0x001B, 0x0137, 0x006C, 0x004D, 0x00AA, 0x0011, 0x0009,
+ 0x001F, 0x0005, 0x0017, 0x0000, 0x001F, 0x000F, 0x00D1, 0x0238, 0x0000, 0x016F, 0x000C, 0x02A9,
+ 0x0000, 0x0003, 0x008E, 0x0014, 0x0000, 0x0007, 0x000F, 0x0039, 0x0008, 0x000D, 0x0006, 0x0010,
+ 0x0043, 0x0053, 0x0000, 0x003D, 0x0005, 0x0022, 0x0005, 0x000F, 0x000E, 0x003D, 0x0363, 0x0025,
+ 0x0011, 0x0002, 0x0000, 0x0299, 0x0226, 0x0046, 0x0004, 0x0014, 0x0073, 0x0021, 0x006B, 0x0098,
+ 0x0190, 0x0002, 0x000E, 0x0043, 0x003E, 0x000D, 0x0013, 0x0008, 0x0001, 0x0039, 0x009F, 0x0001,
+ 0x0006, 0x0005, 0x0001, 0x01EB, 0x0003, 0x01A4, 0x00F1, 0x018C, 0x0008, 0x0000, 0x0001, 0x0000,
+ 0x0000, 0x0083, 0x011E, 0x010F, 0x032E, 0x001A, 0x00C4, 0x0078, 0x0143, 0x001D, 0x004F, 0x0029,
+ 0x002E, 0x0104, 0x000A, 0x000A, 0x0011, 0x00BF, 0x0000, 0x0002, 0x022D, 0x0003, 0x006E, 0x0031,
+ 0x0002, 0x0020, 0x0056, 0x0000, 0x00E6, 0x0000, 0x0040, 0x00CA, 0x017E, 0x0008, 0x0039, 0x0145,
+ 0x00E1, 0x0000, 0x006A, 0x0119, 0x004A, 0x000A, 0x002D, 0x0000, 0x0006, 0x02EB, 0x0000, 0x0000,
+ 0x0009, 0x002C, 0x0002, 0x00FD, 0x0006, 0x0034, 0x0002, 0x002F, 0x0083, 0x0023, 0x0001, 0x0009,
+ 0x0000, 0x000B, 0x0002, 0x0168, 0x0009, 0x003E, 0x001F, 0x000B, 0x0089, 0x0067, 0x0001, 0x0024,
+ 0x0308, 0x00D2, 0x0119, 0x0000, 0x0005, 0x0049, 0x0003, 0x0002, 0x0000, 0x000C, 0x0005, 0x0078,
+ 0x00B7, 0x0009, 0x01C1, 0x0006, 0x001E, 0x013B, 0x0016, 0x0012, 0x0000, 0x0000, 0x008F, 0x0050,
+ 0x01D2, 0x004D, 0x0024, 0x0005, 0x0055, 0x0492, 0x0000, 0x0012, 0x0102, 0x0018, 0x0051, 0x01AF,
+ 0x0306, 0x02A3, 0x000C, 0x0011, 0x001D, 0x0000, 0x0038, 0x0201, 0x0023, 0x0000, 0x001F, 0x01DF,
+ 0x0135, 0x021A, 0x011F, 0x00D6, 0x001D, 0x0040, 0x008E, 0x0000, 0x00A1, 0x0004, 0x0057, 0x01F6,
+ 0x0001, 0x01BF, 0x00AB, 0x0019, 0x012A, 0x0057, 0x016C, 0x0457, 0x0035, 0x0000, 0x0001, 0x0403,
+ 0x0003, 0x0019, 0x001F, 0x0000, 0x0056, 0x0009, 0x0008, 0x0005, 0x0001, 0x0012, 0x0176, 0x0000,
+ 0x00F2, 0x000D, 0x007D, 0x0003, 0x0141, 0x007F, 0x0001, 0x0008, 0x0008, 0x0000, 0x0071, 0x0004,
+ 0x0078, 0x0049, 0x00CE, 0x0002, 0x0001, 0x00A5, 0x000C, 0x000E, 0x0257, 0x0040, 0x01C9, 0x0033,
+ 0x0005, 0x0187, 0x0037, 0x00F8, 0x0137, 0x00E4, 0x000A, 0x002D, 0x000D, 0x01A4, 0x004C, 0x0003,
+ 0x0042, 0x0002, 0x0064, 0x0102, 0x0002, 0x0963, 0x0003, 0x0002, 0x001A, 0x0056, 0x0065, 0x03AE,
+ 0x0057, 0x005C, 0x00A2, 0x01BF, 0x000E, 0x0012, 0x01EB, 0x009F, 0x0033, 0x01D8, 0x018B, 0x001F,
+ 0x002E, 0x0088, 0x0119, 0x0007, 0x000A, 0x000B, 0x0054, 0x0001, 0x0091, 0x0014, 0x0005, 0x0130,
+ 0x015F, 0x000F, 0x0000, 0x0592, 0x0006, 0x010D, 0x0000, 0x0231, 0x001D, 0x0079, 0x0626, 0x0003,
+ 0x000B, 0x0019, 0x0000, 0x00F2, 0x00A4, 0x0000, 0x0035, 0x012D, 0x032A, 0x00A1, 0x0000, 0x002D,
+ 0x0005, 0x0003, 0x0064, 0x003E, 0x0035, 0x0002, 0x0013, 0x0140, 0x0310, 0x004F, 0x0342, 0x029E,
+ 0x0018, 0x0004, 0x002E, 0x0001, 0x0385, 0x0942, 0x0001, 0x0040, 0x00FD, 0x026A, 0x000F, 0x000E,
+ 0x01EA, 0x018B, 0x0017, 0x001E, 0x0041, 0x0026, 0x0001, 0x0068, 0x01C9, 0x0091, 0x0002, 0x024C,
+ 0x0000, 0x0016, 0x0055, 0x000E, 0x0110, 0x03AC, 0x0006, 0x0004, 0x001A, 0x000F, 0x001E, 0x0028,
+ 0x0035, 0x0000, 0x0008, 0x001E, 0x0214, 0x007B, 0x00BF, 0x0013, 0x0000, 0x0090, 0x0033, 0x025D,
+ 0x0000, 0x0000, 0x0000, 0x01FB, 0x0307, 0x0159, 0x022E, 0x01BA, 0x0003, 0x0110, 0x0000, 0x0BE1,
+ 0x000E, 0x012A, 0x0274, 0x004B, 0x0010, 0x0038, 0x0005, 0x0003, 0x01E5, 0x0019, 0x0042, 0x02E7,
+ 0x001D, 0x0016, 0x0007, 0x00C1, 0x0004, 0x00E7, 0x0006, 0x0063, 0x002B, 0x001F, 0x00DE, 0x0000,
+ 0x0004, 0x0001, 0x000F, 0x0082, 0x0020, 0x0049, 0x01BD, 0x009A, 0x0000, 0x0041, 0x0002, 0x004A,
+ 0x00E0, 0x0001, 0x0000, 0x004B, 0x019B, 0x00A6, 0x0000, 0x0000, 0x0010, 0x0003, 0x0000, 0x0013,
+ 0x012F, 0x000A, 0x0030, 0x005C, 0x0003, 0x0009, 0x002A, 0x003C, 0x0050, 0x0030, 0x0096, 0x0006,
+ 0x0014, 0x0410, 0x000E, 0x0005, 0x0044, 0x0072, 0x0197, 0x000D, 0x0010, 0x0418, 0x0367, 0x0289,
+ 0x001A, 0x0000, 0x0009, 0x0538, 0x0000, 0x01F3, 0x020F, 0x0045, 0x0300, 0x0415, 0x002F, 0x0149,
+ 0x01FB, 0x0000, 0x0220, 0x0051, 0x000B, 0x017D, 0x0359, 0x0001, 0x0212, 0x0075, 0x0176, 0x005C,
+ 0x0000, 0x01DE, 0x004C, 0x0012, 0x0154, 0x002D, 0x0046, 0x0325, 0x0021, 0x0012, 0x00C4, 0x011C,
+ 0x0074, 0x00D8, 0x0061, 0x0043, 0x02F5, 0x000A, 0x0003, 0x0090, 0x008A, 0x028D, 0x008F, 0x000F,
+ 0x000C, 0x003A, 0x026E, 0x0006, 0x0003, 0x001F, 0x0004, 0x0141, 0x00B1, 0x0086, 0x0121, 0x00CE,
+ 0x0083, 0x0002, 0x0008, 0x001E, 0x0014, 0x0011, 0x0004, 0x004D, 0x0001, 0x006D, 0x00F2, 0x0007,
+ 0x00DB, 0x0003, 0x00D0, 0x0000, 0x0050, 0x00D5, 0x0035, 0x001F, 0x0000, 0x0451, 0x0001, 0x007D,
+ 0x0059, 0x0003, 0x0000, 0x007F, 0x001F, 0x007F, 0x02EE, 0x0008, 0x0181, 0x099E, 0x0007, 0x000F,
+ 0x0007, 0x00C8, 0x00D7, 0x0006, 0x0067, 0x0012, 0x0009, 0x074D, 0x0019, 0x0005, 0x001D, 0x012D,
+ 0x0004, 0x0002, 0x0062, 0x0009, 0x00E3, 0x0006, 0x0039, 0x001E, 0x0064, 0x0002, 0x029A, 0x0011,
+ 0x00A3, 0x013E, 0x0232, 0x0027, 0x0193, 0x0000, 0x0003, 0x0055, 0x0144, 0x0001, 0x0004, 0x0446,
+ 0x0132, 0x0005, 0x0273, 0x002A, 0x00FE, 0x00B0, 0x0002, 0x00A1, 0x0405, 0x01B8, 0x0010, 0x01DB,
+ 0x0063, 0x003E, 0x00CD, 0x0001, 0x0035, 0x0000, 0x01B7, 0x00B5, 0x0066, 0x0116, 0x004B, 0x0001,
+ 0x0017, 0x0000, 0x000C, 0x0012, 0x0210, 0x0532, 0x01A4, 0x0029, 0x0002, 0x0028, 0x001D, 0x0005,
+ 0x009A, 0x0000, 0x0043, 0x031E, 0x009F, 0x0071, 0x0000, 0x001E, 0x0001, 0x010F, 0x0067, 0x00A5,
+ 0x048D, 0x0011, 0x000B, 0x0003, 0x0002, 0x0AED, 0x0232, 0x0526, 0x0003, 0x0006, 0x0115, 0x0000,
+ 0x0000, 0x0002, 0x01E3, 0x0002, 0x0003, 0x0071, 0x0021, 0x001E, 0x0058, 0x0003, 0x0000, 0x04D7,
+ 0x0000, 0x007F, 0x000A, 0x0088, 0x0001, 0x0036, 0x001E, 0x0302, 0x000C, 0x0000, 0x00B8, 0x0000,
+ 0x0026, 0x0001, 0x000F, 0x0030, 0x0144, 0x01F6, 0x0030, 0x004F, 0x0234, 0x0083, 0x005F, 0x0001,
+ 0x007D, 0x01E3, 0x01B4, 0x00B5, 0x0310, 0x0000, 0x0294, 0x0030, 0x004A, 0x0003, 0x0042, 0x0412,
+ 0x01DE, 0x006F, 0x005B, 0x01A0, 0x004F, 0x0689, 0x06CF, 0x0097, 0x001C, 0x00C4, 0x0021, 0x0061,
+ 0x037A, 0x0002, 0x0130, 0x012D, 0x0004, 0x0005, 0x0071, 0x02D8, 0x0028, 0x0008, 0x0117, 0x000D,
+ 0x0007, 0x01EC, 0x003C, 0x01B2, 0x0097, 0x0011, 0x02AD, 0x0030, 0x000F, 0x0020, 0x0605, 0x0007,
+ 0x004A, 0x0008, 0x0005, 0x0000, 0x02E4, 0x0012, 0x0337, 0x01C1, 0x00FF, 0x0004, 0x0023, 0x0072,
+ 0x0034, 0x003C, 0x002C, 0x015D, 0x0013, 0x0003, 0x0011, 0x0000, 0x040E, 0x0017, 0x000C, 0x0002,
+ 0x0039, 0x0023, 0x000C, 0x0000, 0x000E, 0x000F, 0x0008, 0x013E, 0x0059, 0x002C, 0x0000, 0x0135,
+ 0x0003, 0x0038, 0x002A, 0x0006, 0x0055, 0x00E2, 0x003C, 0x0001, 0x00E0, 0x0013, 0x002B, 0x005B,
+ 0x0079, 0x000A, 0x0033, 0x010E, 0x0066, 0x033D, 0x0007, 0x061A, 0x00B6, 0x0159, 0x0002, 0x0002,
+ 0x05FD, 0x0009, 0x000C, 0x0035, 0x00BF, 0x0057, 0x002E, 0x0004, 0x0012, 0x042D, 0x0381, 0x0003,
+ 0x0001, 0x0120, 0x0077, 0x0223, 0x00AC, 0x003F, 0x0006, 0x000E, 0x0268, 0x0086, 0x0046, 0x002E,
+ 0x0000, 0x0000, 0x0007, 0x004C, 0x00F9, 0x0005, 0x0139, 0x0001, 0x02FA, 0x0034, 0x050C, 0x00B3,
+ 0x0005, 0x0413, 0x0000, 0x0018, 0x0003, 0x013E, 0x001A, 0x0002, 0x0049, 0x0001, 0x0239, 0x0000,
+ 0x0009, 0x01CF, 0x004D, 0x000F, 0x01F3, 0x0000, 0x02E9, 0x013C, 0x00A9, 0x0008, 0x0B7A, 0x0011,
+ 0x000D, 0x0004, 0x0000, 0x007C, 0x002A, 0x0081, 0x00E6, 0x02F2, 0x021B, 0x0032, 0x000E, 0x000F,
+ 0x0003, 0x002B, 0x0180, 0x023C, 0x0039, 0x0106, 0x00A3, 0x0212, 0x0027, 0x001D, 0x002E, 0x004E,
+ 0x008F, 0x0C9C, 0x0016, 0x0087, 0x0001, 0x0022, 0x00F8, 0x0001, 0x002D, 0x0025, 0x0006, 0x0011,
+ 0x0238, 0x009E, 0x0000, 0x0022, 0x0000, 0x0011, 0x00B1, 0x0019, 0x0001, 0x0003, 0x0083, 0x000A,
+ 0x0004, 0x0014, 0x0199, 0x00BA, 0x00FF, 0x006A, 0x0522, 0x0014, 0x0464, 0x0000, 0x026B, 0x0006,
+ 0x00E9, 0x0232, 0x0006, 0x0006, 0x019B, 0x0011, 0x0000, 0x0030, 0x0135, 0x0478, 0x01FB, 0x0051,
+ 0x020C, 0x0951, 0x0019, 0x075D, 0x0000, 0x0008, 0x006A, 0x008F, 0x000D, 0x000C, 0x000F, 0x06BB,
+ 0x0002, 0x0030, 0x046E, 0x0560, 0x0000, 0x01F6, 0x06B3, 0x0002, 0x0321, 0x000D, 0x052D, 0x0130,
+ 0x0078, 0x00A0, 0x008E, 0x01FA, 0x0066, 0x0003, 0x0007, 0x03F5, 0x0147, 0x00A5, 0x0000, 0x0000,
+ 0x0001, 0x0080, 0x0000, 0x0004, 0x002C, 0x0202, 0x002A, 0x0758, 0x0000, 0x0000, 0x0003, 0x0016,
+ 0x000C, 0x0008, 0x0075, 0x0030, 0x0001, 0x0445, 0x0346, 0x0004, 0x0CE1, 0x01FD, 0x00A9, 0x0094,
+ 0x03B6, 0x000A, 0x0001, 0x0001, 0x0000, 0x01CE, 0x0009, 0x0001, 0x0128, 0x0004, 0x01E6, 0x0000,
+ 0x0000, 0x0001, 0x0000, 0x014B, 0x0007, 0x006B, 0x0025, 0x005D, 0x0087, 0x0040, 0x0003, 0x0004,
+ 0x0009, 0x01A5, 0x0027, 0x0002, 0x0096, 0x024A, 0x0004, 0x0002, 0x016D, 0x0C4C, 0x0122, 0x000C,
+ 0x0060, 0x0281, 0x0005, 0x025A, 0x0002, 0x0539, 0x0068, 0x0110, 0x0087, 0x0041, 0x0023, 0x0151,
+ 0x0161, 0x0033, 0x00D6, 0x0012, 0x001D, 0x0096, 0x003D, 0x002A, 0x0038, 0x0002, 0x0002, 0x0003,
+ 0x0000, 0x00F1, 0x00AF, 0x00E8, 0x029D, 0x0117, 0x0593, 0x0000, 0x0019, 0x000D, 0x0005, 0x00E9,
+ 0x000D, 0x0000, 0x00EE, 0x0075, 0x000E, 0x00D0, 0x0007, 0x08E5, 0x004B, 0x0002, 0x0095, 0x000E,
+ 0x06AE, 0x001D, 0x0002, 0x0010, 0x03C2, 0x03A9, 0x0034, 0x000D, 0x0004, 0x00AC, 0x110B, 0x006B,
+ 0x0058, 0x0178, 0x0D84, 0x00DB, 0x08E6, 0x090C, 0x0000, 0x0059, 0x02F5, 0x015B, 0x0161, 0x0001,
+ 0x0002, 0x0015, 0x0088, 0x0005, 0x00A5, 0x0146, 0x00E7, 0x0001, 0x00E1, 0x0000, 0x0124, 0x0032,
+ 0x023A, 0x0006, 0x0008, 0x0051, 0x0035, 0x0020, 0x00C4, 0x0032, 0x001A, 0x00B8, 0x000C, 0x0003,
+ 0x0001, 0x006F, 0x0007, 0x0022, 0x0003, 0x0006, 0x0010, 0x0033, 0x00DE, 0x0409, 0x0024, 0x0057,
+ 0x0001, 0x00BF, 0x0004, 0x0088, 0x0025, 0x001B, 0x0003, 0x0003, 0x01EB, 0x0010, 0x001C, 0x0102,
+ 0x00F9, 0x0000, 0x0057, 0x0056, 0x046B, 0x010D, 0x0005, 0x0105, 0x00AF, 0x027E, 0x002C, 0x0080,
+ 0x0047, 0x0002, 0x0004, 0x003C, 0x004B, 0x0008, 0x05CF, 0x0023, 0x0004, 0x0090, 0x0005, 0x0005,
+ 0x0044, 0x000D, 0x0004, 0x03E6, 0x0002, 0x0010, 0x001A, 0x001B, 0x0023, 0x001B, 0x0001, 0x001B,
+ 0x008C, 0x0003, 0x064C, 0x007D, 0x002F, 0x013D, 0x004E, 0x00E4, 0x0009, 0x0004, 0x00E0, 0x0024,
+ 0x0025, 0x00F8, 0x0034, 0x02E1, 0x0005, 0x003D, 0x0001, 0x0142, 0x0375, 0x035D, 0x0003, 0x008E,
+ 0x08A0, 0x00F0, 0x0021, 0x02BB, 0x005B, 0x025F, 0x0174, 0x00A5, 0x010A, 0x0076, 0x003F, 0x000C,
+ 0x0011, 0x0067, 0x0160, 0x0086, 0x0019, 0x0002, 0x000C, 0x0007, 0x0010, 0x0035, 0x0001, 0x01CE,
+ 0x0023, 0x0665, 0x0013, 0x0068, 0x00C6, 0x0001, 0x0058, 0x04DB, 0x0059, 0x0005, 0x0012, 0x02A9,
+ 0x0004, 0x0036, 0x0246, 0x0069, 0x0002, 0x00C9, 0x0050, 0x00E2, 0x06CA, 0x0003, 0x0026, 0x00D0,
+ 0x0056, 0x00B7, 0x0012, 0x0005, 0x0005, 0x0065, 0x0000, 0x0C14, 0x0044, 0x0000, 0x00A1, 0x0004,
+ 0x009B, 0x000E, 0x00A9, 0x0201, 0x0AAF, 0x00B3, 0x014D, 0x0009, 0x00FB, 0x0002, 0x000D, 0x0000,
+ 0x0000, 0x0012, 0x031F, 0x002A, 0x02B5, 0x0397, 0x0026, 0x0003, 0x0010, 0x00C2, 0x0153, 0x01F0,
+ 0x02EA, 0x000B, 0x0001, 0x0079, 0x0018, 0x041D, 0x0000, 0x0588, 0x0071, 0x00DC, 0x000A, 0x0B3E,
+ 0x0641, 0x002D, 0x0008, 0x0001, 0x00C7, 0x0028, 0x0004, 0x002A, 0x01E0, 0x0000, 0x0041, 0x01C0,
+ 0x008E, 0x00AA, 0x0017, 0x0058, 0x0051, 0x0008, 0x00D4, 0x0002, 0x01E1, 0x0078, 0x0010, 0x091F,
+ 0x0013, 0x0015, 0x0010, 0x004C, 0x0005, 0x00D6, 0x000C, 0x0000, 0x1207, 0x0000, 0x0042, 0x0000,
+ 0x0000, 0x00A9, 0x0000, 0x000B, 0x003D, 0x00A9, 0x0026, 0x0009, 0x029C, 0x0082, 0x0007, 0x0010,
+ 0x0000, 0x0002, 0x005A, 0x0565, 0x000F, 0x0129, 0x00D1, 0x0019, 0x012F, 0x000A, 0x003F, 0x0002,
+ 0x0000, 0x0035, 0x0100, 0x0126, 0x001E, 0x0056, 0x0000, 0x00BA, 0x0018, 0x0188, 0x0011, 0x001D,
+ 0x0181, 0x001E, 0x0014, 0x0167, 0x021E, 0x003F, 0x001A, 0x0019, 0x0000, 0x03DD, 0x0424, 0x0001,
+ 0x00DB, 0x0096, 0x0000, 0x0064, 0x002D, 0x0177, 0x0003, 0x0062, 0x0002, 0x024D, 0x00C3, 0x0067,
+ 0x0189, 0x0003, 0x03FB, 0x001C, 0x0172, 0x000D, 0x002C, 0x000A, 0x014A, 0x0054, 0x0003, 0x007A,
+ 0x021D, 0x006B, 0x0004, 0x03FB, 0x00B3, 0x00D2, 0x0018, 0x010D, 0x081A, 0x0083, 0x0126, 0x0066,
+ 0x0008, 0x0003, 0x0548, 0x01B2, 0x0003, 0x0ABB, 0x07C4, 0x040F, 0x0060, 0x02EF, 0x0401, 0x0012,
+ 0x0009, 0x02AC, 0x065E, 0x0456, 0x0001, 0x00AF, 0x0049, 0x000E, 0x0031, 0x0052, 0x00A0, 0x0A0C,
+ 0x0000, 0x0023, 0x00BE, 0x000A, 0x0003, 0x0D67, 0x008D, 0x0008, 0x0063, 0x0013, 0x0006, 0x00F8,
+ 0x0022, 0x00B6, 0x00C6, 0x0083, 0x003C, 0x03C9, 0x0061, 0x0094, 0x0022, 0x0000, 0x0050, 0x0005,
+ 0x0066, 0x08EE, 0x0560, 0x0006, 0x0BF5, 0x0017, 0x016E, 0x0F75, 0x04D0, 0x0C04, 0x0030, 0x0010,
+ 0x00B3, 0x0001, 0x0998, 0x07E6, 0x0005, 0x00D0, 0x08F6, 0x0169, 0x0004, 0x0018, 0x012F, 0x003D,
+ 0x0083, 0x0B22, 0x0184, 0x0001, 0x03B1, 0x0005, 0x00E5, 0x0040, 0x0002, 0x000A, 0x01C8, 0x01D5,
+ 0x038C, 0x0133, 0x0135, 0x003B, 0x028A, 0x0212, 0x002A, 0x0740, 0x0220, 0x004B, 0x03A0, 0x0002,
+ 0x0003, 0x0040, 0x0387, 0x0001, 0x0019, 0x0075, 0x01B0, 0x0420, 0x0000, 0x0061, 0x0125, 0x0002,
+ 0x0C60, 0x0229, 0x032E, 0x0067, 0x0090, 0x0010, 0x040C, 0x0012, 0x0398, 0x00FB, 0x001A, 0x0780,
+ 0x000C, 0x0C83, 0x0002, 0x0000, 0x0075, 0x005E, 0x0025, 0x0002, 0x00F3, 0x005C, 0x0488, 0x0100,
+ 0x001A, 0x0005, 0x003C, 0x071A, 0x0006, 0x0024, 0x0080, 0x018C, 0x0000, 0x002B, 0x000D, 0x09BD,
+ 0x0012, 0x0000, 0x057A, 0x02EB, 0x0006, 0x0064, 0x0262, 0x001A, 0x014F, 0x005A, 0x001B, 0x0165,
+ 0x0003, 0x000D, 0x001F, 0x013B, 0x0322, 0x0002, 0x00B4, 0x0001, 0x023A, 0x000A, 0x0002, 0x004D,
+ 0x0000, 0x0D3C, 0x0151, 0x0294, 0x0880, 0x00F3, 0x00E3, 0x007B, 0x00BE, 0x0012, 0x008A, 0x0005,
+ 0x001D, 0x0374, 0x0418, 0x00B0, 0x000B, 0x0099, 0x0006, 0x0081, 0x0003, 0x0003, 0x0004, 0x0002,
+ 0x052E, 0x023F, 0x0032, 0x0033, 0x0005, 0x009A, 0x0025, 0x022C, 0x1429, 0x01C3, 0x0000, 0x0025,
+ 0x0582, 0x0E6B, 0x0024, 0x0007, 0x0046, 0x001C, 0x013E, 0x0024, 0x00BC, 0x0000, 0x03EC, 0x0011,
+ 0x00A5, 0x057A, 0x00D5, 0x03B7, 0x0015, 0x011B, 0x0039, 0x00DA, 0x0B7C, 0x0005, 0x0013, 0x005A,
+ 0x01DE, 0x04CC, 0x007D, 0x0000, 0x0001, 0x0016, 0x0048, 0x0174, 0x01E6, 0x0032, 0x001B, 0x02CD,
+ 0x001A, 0x0000, 0x01F7, 0x03B8, 0x0053, 0x0022, 0x0AC1, 0x014D, 0x0061, 0x0DFE, 0x009C, 0x0329,
+ 0x0714, 0x01FB, 0x00AC, 0x0011, 0x0000, 0x0151, 0x000A, 0x000B, 0x0011, 0x0028, 0x0006, 0x00B5,
+ 0x0076, 0x0214, 0x0040, 0x0000, 0x0567, 0x0051, 0x0018, 0x0318, 0x001C, 0x001D, 0x000A, 0x001F,
+ 0x0000, 0x0205, 0x0004, 0x0002, 0x0271, 0x0355, 0x0000, 0x0000, 0x01A9, 0x0001, 0x0061, 0x04A9,
+ 0x000B, 0x0042, 0x00B7, 0x0015, 0x0112, 0x0631, 0x0178, 0x0452, 0x0261, 0x0130, 0x039A, 0x0094,
+ 0x0409, 0x0116, 0x0010, 0x0153, 0x0001, 0x0000, 0x0001, 0x0098, 0x03B6, 0x000D, 0x0257, 0x025B,
+ 0x0624, 0x0000, 0x0021, 0x0226, 0x0004, 0x0001, 0x000E, 0x0005, 0x011F, 0x1AB2, 0x0770, 0x0000,
+ 0x004F, 0x0000, 0x0741, 0x000C, 0x0013, 0x0037, 0x017F, 0x0010, 0x00BD, 0x0451, 0x0048, 0x0004,
+ 0x0009, 0x002D, 0x0004, 0x0000, 0x0054, 0x00BB, 0x0000, 0x0119, 0x0203, 0x0095, 0x002E, 0x0008,
+ 0x0001, 0x010F, 0x00EE, 0x0005, 0x001C, 0x0092, 0x0032, 0x001F, 0x000A, 0x00BA, 0x0078, 0x030C,
+ 0x0032, 0x01AE, 0x0000, 0x0034, 0x000B, 0x0002, 0x0323, 0x0915, 0x0000, 0x0008, 0x0630, 0x09E5,
+ 0x00C6, 0x0089, 0x01F9, 0x000E, 0x0009, 0x036A, 0x0005, 0x0001, 0x012C, 0x069B, 0x0040, 0x02CD,
+ 0x097B, 0x00D8, 0x0001, 0x0004, 0x000A, 0x0001, 0x038C, 0x0042, 0x0002, 0x0000, 0x003D, 0x0003,
+ 0x0001, 0x0183, 0x0034, 0x013A, 0x003F, 0x0000, 0x0003, 0x0041, 0x0709, 0x016A, 0x0067, 0x0003,
+ 0x0074, 0x0562, 0x000F, 0x04F5, 0x0020, 0x0007, 0x0148, 0x0027, 0x0DF7, 0x011B, 0x0019, 0x0042,
+ 0x0004, 0x0000, 0x0067, 0x0000, 0x0057, 0x0084, 0x009C, 0x018E, 0x00A5, 0x0025, 0x0156, 0x00D8,
+ 0x0006, 0x013E, 0x07A4, 0x01B6, 0x0099, 0x00F3, 0x068A, 0x0154, 0x040E, 0x01C1, 0x0526, 0x0008,
+ 0x0C9C, 0x123D, 0x00D3, 0x0166, 0x055A, 0x003D, 0x0858, 0x00E8, 0x0168, 0x02EE, 0x0012, 0x0055,
+ 0x0101, 0x0126, 0x0012, 0x01DB, 0x00CD, 0x0028, 0x000C, 0x0055, 0x000A, 0x000E, 0x0000, 0x0000,
+ 0x001A, 0x0037, 0x0024, 0x04AF, 0x08D9, 0x07D8, 0x0BC8, 0x0176, 0x0061, 0x000F, 0x0143, 0x0098,
+ 0x006D, 0x0118, 0x00D7, 0x0249, 0x02A3, 0x02D0, 0x05B9, 0x0000, 0x026B, 0x00B4, 0x00D8, 0x0B23,
+ 0x0049, 0x0005, 0x000D, 0x0055, 0x0EBB, 0x02CE, 0x06E3, 0x0024, 0x0008, 0x0006, 0x0000, 0x000C,
+ 0x02B5, 0x0000, 0x0000, 0x0039, 0x0000, 0x0406, 0x0DA6, 0x0100, 0x0029, 0x0003, 0x0114, 0x001B,
+ 0x0A2F, 0x0172, 0x0014, 0x08CC, 0x092A, 0x01D1, 0x05F4, 0x00C7, 0x001A, 0x001B, 0x0019, 0x0025,
+ 0x0002, 0x0065, 0x0003, 0x0003, 0x002D, 0x0008, 0x000B, 0x01BC, 0x0053, 0x0197, 0x0004, 0x0000,
+ 0x02E9, 0x0002, 0x031B, 0x00DB, 0x0124, 0x0078, 0x00AD, 0x0FF9, 0x0001, 0x029A, 0x01EC, 0x0179,
+ 0x0057, 0x0000, 0x0071, 0x001E, 0x000A, 0x0000, 0x00A1, 0x0004, 0x01AF, 0x0187, 0x0239, 0x0000,
+ 0x0170, 0x002E, 0x0060, 0x03C1, 0x005B, 0x02B2, 0x009E, 0x01B1, 0x129B, 0x03FB, 0x1BF6, 0x0001,
+ 0x012B, 0x0030, 0x0873, 0x0009, 0x001D, 0x0848, 0x0002, 0x0836, 0x034E, 0x034E, 0x0003, 0x0004,
+ 0x0E91, 0x0126, 0x0113, 0x000A, 0x02D8, 0x003E, 0x0038, 0x00A8, 0x009B, 0x0489, 0x0000, 0x004B,
+ 0x0003, 0x007D, 0x000A, 0x0000, 0x01BC, 0x002D, 0x046F, 0x027B, 0x0776, 0x019D, 0x0002, 0x0012,
+ 0x013B, 0x0001, 0x0002, 0x0005, 0x006C, 0x0001, 0x0013, 0x0178, 0x006E, 0x0072, 0x0038, 0x003C,
+ 0x00AB, 0x0486, 0x00BF, 0x036F, 0x0007, 0x0165, 0x0003, 0x0A31, 0x004B, 0x01A5, 0x0A23, 0x0044,
+ 0x0AFB, 0x0006, 0x0108, 0x1322, 0x0021, 0x002C, 0x0004, 0x0001, 0x00BE, 0x0297, 0x0050, 0x004D,
+ 0x003F, 0x0035, 0x0949, 0x0324, 0x0000, 0x0004, 0x00C1, 0x0005, 0x0016, 0x017D, 0x001B, 0x1849,
+ 0x0024, 0x0347, 0x002B, 0x0195, 0x0190, 0x0017, 0x00F9, 0x0019, 0x0000, 0x0009, 0x0700, 0x07FE,
+ 0x0001, 0x0048, 0x0E1C, 0x03B9, 0x0000, 0x0061, 0x01A1, 0x0195, 0x00A0, 0x01C9, 0x0000, 0x007A,
+ 0x0020, 0x002F, 0x1493, 0x001D, 0x007C, 0x0000, 0x0024, 0x0139, 0x004E, 0x0003, 0x0072, 0x02CF,
+ 0x0007, 0x0297, 0x0025, 0x00F7, 0x00A9, 0x0153, 0x00C2, 0x0214, 0x0002, 0x0009, 0x081E, 0x0000,
+ 0x02E1, 0x003C, 0x07F4, 0x000D, 0x000B, 0x01A1, 0x001E, 0x02D7, 0x0000, 0x001B, 0x0001, 0x0503,
+ 0x0006, 0x0749, 0x00A8, 0x0001, 0x0265, 0x0000, 0x0121, 0x03E6, 0x02B5, 0x0097, 0x0933, 0x002E,
+ 0x0906, 0x00A3, 0x038E, 0x020D, 0x0000, 0x0000, 0x02A8, 0x034A, 0x159F, 0x0021, 0x0094, 0x0005,
+ 0x0110, 0x0003, 0x0001, 0x0057, 0x01F8, 0x0015, 0x0012, 0x0000, 0x0000, 0x003F, 0x019E, 0x02B7,
+ 0x0012, 0x0085, 0x0005, 0x0003, 0x001F, 0x0033, 0x07AF, 0x0507, 0x004B, 0x092E, 0x26EB, 0x0035,
+ 0x1689, 0x0422, 0x000F, 0x002D, 0x023B, 0x002B, 0x07C4, 0x0000, 0x022F, 0x0000, 0x01CE, 0x00DE,
+ 0x00CB, 0x0031, 0x0091, 0x006B, 0x0AE7, 0x0E99, 0x0001, 0x0175, 0x00E3, 0x008A, 0x0017, 0x0022,
+ 0x0005, 0x04C9, 0x0000, 0x0791, 0x0016, 0x00CD, 0x0049, 0x0027, 0x09F6, 0x0464, 0x015E, 0x0000,
+ 0x0089, 0x0424, 0x0000, 0x0037, 0x0F67, 0x0004, 0x0029, 0x0000, 0x03DB, 0x05C3, 0x0075, 0x000D,
+ 0x0187, 0x0034, 0x0002, 0x0250, 0x002A, 0x0001, 0x0059, 0x0000, 0x0037, 0x065A, 0x01E6, 0x0015,
+ 0x0526, 0x0085, 0x039E, 0x004A, 0x089C, 0x0040, 0x000B, 0x192E, 0x01DF, 0x0062, 0x004A, 0x06CA,
+ 0x0006, 0x161E, 0x0056, 0x0009, 0x0270, 0x01D2, 0x0786, 0x0426, 0x001A, 0x001C, 0x0000, 0x0236,
+ 0x0003, 0x0000, 0x0002, 0x00CF, 0x0001, 0x0006, 0x19EA, 0x00D2, 0x0887, 0x001B, 0x0030, 0x048B,
+ 0x0414, 0x004A, 0x02F7, 0x0700, 0x01AD, 0x14D2, 0x01A6, 0x0008, 0x04CB, 0x049F, 0x0006, 0x0048,
+ 0x063C, 0x01F5, 0x0723, 0x03E4, 0x0454, 0x001A, 0x06C3, 0x0276, 0x0821, 0x01D2, 0x00BF, 0x060E,
+ 0x00F6, 0x016C, 0x00EB, 0x0058, 0x001A, 0x000C, 0x0002, 0x07D1, 0x01F7, 0x026F, 0x0158, 0x00DD,
+ 0x09EB, 0x001A, 0x0003, 0x042D, 0x06E4, 0x051F, 0x00E6, 0x0302, 0x006B, 0x00F1, 0x0079, 0x0087,
+ 0x0015, 0x0001, 0x05BC, 0x08B2, 0x1EEF, 0x109C, 0x0272, 0x0687, 0x003F, 0x07A9, 0x07DF, 0x00B5,
+ 0x01C6, 0x002A, 0x19E2, 0x0006, 0x0213, 0x0013, 0x0000, 0x0000, 0x0008, 0x012B, 0x002F, 0x007C,
+ 0x000A, 0x0AFA, 0x001B, 0x0305, 0x0002, 0x0000, 0x0142, 0x032E, 0x0150, 0x0008, 0x1515, 0x002A,
+ 0x0003, 0x0075, 0x00AD, 0x0001, 0x1AFF, 0x0014, 0x0188, 0x0CD3, 0x03C4, 0x02BC, 0x0158, 0x0108,
+ 0x061F, 0x1DF9, 0x003D, 0x0009, 0x0125, 0x22F6, 0x01F5, 0x0060, 0x00AB, 0x0045, 0x00D9, 0x0007,
+ 0x0000, 0x0001, 0x143C, 0x0003, 0x0182, 0x0045, 0x212A, 0x014D, 0x06FD, 0x0023, 0x1904, 0x00D2,
+ 0x0140, 0x011F, 0x0016, 0x0308, 0x02F0, 0x04AD, 0x0035, 0x003F, 0x0035, 0x0001, 0x0001, 0x0007,
+ 0x0004, 0x0319, 0x0D85, 0x000A, 0x07CA, 0x00D9, 0x1035, 0x0468, 0x0000, 0x0063, 0x0000, 0x0001,
+ 0x0006, 0x0001, 0x00AA, 0x0E73, 0x09DA, 0x09FF, 0x003F, 0x0051, 0x002A, 0x019C, 0x0003, 0x0183,
+ 0x0393, 0x0013, 0x1841, 0x00AA, 0x0094, 0x005F, 0x0023, 0x001A, 0x2308, 0x00D5, 0x0C91, 0x00FC,
+ 0x0000, 0x0000, 0x000C, 0x0FF5, 0x0219, 0x0060, 0x0006, 0x0000, 0x00E0, 0x1730, 0x0117, 0x000A,
+ 0x034E, 0x02ED, 0x0013, 0x06C5, 0x0000, 0x03BE, 0x0023, 0x0462, 0x02A0, 0x0012, 0x06E2, 0x00C8,
+ 0x017E, 0x0020, 0x0012, 0x0020, 0x019B, 0x0006, 0x04CE, 0x0001, 0x0002, 0x00D3, 0x000A, 0x008C,
+ 0x0034, 0x0009, 0x02C1, 0x03F6, 0x0A5B, 0x018D, 0x02E5, 0x008F, 0x00EF, 0x000B, 0x0480, 0x0490,
+ 0x0000, 0x04FC, 0x00DC, 0x0525, 0x0389, 0x0096, 0x0090, 0x0038, 0x062F, 0x000D, 0x007D, 0x0000,
+ 0x001F, 0x0001, 0x0AEB, 0x06BF, 0x0002, 0x05E4, 0x04F4, 0x0029, 0x00E4, 0x0000, 0x020F, 0x0078,
+ 0x00FE, 0x000E, 0x0003, 0x0066, 0x0052, 0x029D, 0x133E, 0x0014, 0x0018, 0x0001, 0x06A1, 0x1E2D,
+ 0x0000, 0x00C0, 0x0B60, 0x0008, 0x0006, 0x0018, 0x006E, 0x0001, 0x0745, 0x08AC, 0x0012, 0x0295,
+ 0x0042, 0x0142, 0x0258, 0x212F, 0x0024, 0x0CAF, 0x00ED, 0x0000, 0x0637, 0x000D, 0x0EE1, 0x00B0,
+ 0x03BF, 0x032C, 0x0046, 0x01D6, 0x01BF, 0x012C, 0x0103, 0x02F4, 0x0005, 0x0005, 0x0000, 0x0001,
+ 0x0D6F, 0x0A71, 0x0005, 0x018E, 0x0009, 0x0509, 0x0162, 0x0003, 0x1D45, 0x0008, 0x0009, 0x0128,
+ 0x019B, 0x0003, 0x000B, 0x0A82, 0x0017, 0x001B, 0x0839, 0x2B9D, 0x0050, 0x01DA, 0x14C0, 0x0069,
+ 0x002F, 0x13C7, 0x02B6, 0x0017, 0x0608, 0x0000, 0x0007, 0x0138, 0x0204, 0x001E, 0x0060, 0x00B9,
+ 0x0004, 0x0008, 0x008C, 0x0141, 0x0001, 0x0001, 0x0005, 0x0434, 0x0067, 0x00AB, 0x000A, 0x0000,
+ 0x0412, 0x0BFF, 0x0002, 0x00EB, 0x0003, 0x0018, 0x0007, 0x000E, 0x001C, 0x000E, 0x000F, 0x00BE,
+ 0x0050, 0x0010, 0x0084, 0x0002, 0x033A, 0x00D6, 0x0137, 0x03B9, 0x0001, 0x0020, 0x0007, 0x0356,
+ 0x0E84, 0x0038, 0x001C, 0x0051, 0x002E, 0x01AD, 0x0235, 0x12CD, 0x0002, 0x06E8, 0x01A8, 0x0001,
+ 0x0E2A, 0x018A, 0x0065, 0x0DEA, 0x0180, 0x0046, 0x0012, 0x0009, 0x013D, 0x0121, 0x0040, 0x17E7,
+ 0x0016, 0x1958, 0x0022, 0x0005, 0x03A4, 0x0005, 0x0003, 0x070B, 0x0169, 0x0004, 0x0001, 0x0009,
+ 0x0EE2, 0x0001, 0x000B, 0x0005, 0x000B, 0x0006, 0x003B, 0x0054, 0x00A0, 0x3BC3, 0x03BB, 0x0043,
+ 0x11FB, 0x0003, 0x028C, 0x0061, 0x017E, 0x0000, 0x001C, 0x0A15, 0x002C, 0x03B1, 0x0043, 0x009B,
+ 0x092D, 0x0011, 0x000B, 0x074E, 0x00E4, 0x008A, 0x283B, 0x004E, 0x070D, 0x0056, 0x0A01, 0x0010,
+ 0x09FC, 0x0001, 0x0000, 0x03C0, 0x0727, 0x0974, 0x0000, 0x0005, 0x004C, 0x0F60, 0x0774, 0x0005,
+ 0x00BB, 0x003C, 0x03F0, 0x066F, 0x00ED, 0x0080, 0x0176, 0x0001, 0x0031, 0x0038, 0x0042, 0x0190,
+ 0x010B, 0x048D, 0x0002, 0x0D9B, 0x006F, 0x040A, 0x0013, 0x0386, 0x0004, 0x0093, 0x2642, 0x11B4,
+ 0x003E, 0x00C9, 0x066F, 0x000D, 0x008A, 0x0060, 0x001C, 0x0000, 0x0004, 0x0014, 0x0025, 0x0050,
+ 0x0597, 0x0381, 0x0712, 0x0004, 0x0000, 0x001A, 0x0A0B, 0x0036, 0x0040, 0x2711, 0x0000, 0x0704,
+ 0x03EE, 0x021A, 0x0A36, 0x09DE, 0x01D0, 0x028C, 0x0039, 0x009B, 0x007B, 0x0B2C, 0x02DF, 0x0019,
+ 0x02BB, 0x0001, 0x0001, 0x0428, 0x04B4, 0x0004, 0x0468, 0x0D8E, 0x2FC9, 0x0FF2, 0x2FAD, 0x0020,
+ 0x0012, 0x0030, 0x0009, 0x0064, 0x221D, 0x0086, 0x04D5, 0x00B7, 0x0000, 0x0000, 0x006B, 0x0038,
+ 0x0949, 0x0019, 0x0000, 0x0001, 0x0087, 0x188D, 0x09B9, 0x0018, 0x0000, 0x0004, 0x0005, 0x01C2,
+ 0x0001, 0x0007, 0x0259, 0x06BD, 0x002A, 0x000E, 0x0007, 0x00BA, 0x01C4, 0x0001, 0x002F, 0x0E7F,
+ 0x000F, 0x0025, 0x0B61, 0x0045, 0x0015, 0x0395, 0x03EA, 0x0006, 0x0011, 0x00AE, 0x0000, 0x03FC,
+ 0x0218, 0x0051, 0x0000, 0x017F, 0x3EA5, 0x0002, 0x0013, 0x0613, 0x0004, 0x0000, 0x0093, 0x000E,
+ 0x0035, 0x00A9, 0x00F0, 0x15E2, 0x003C, 0x0900, 0x0003, 0x0000, 0x003D, 0x00F5, 0x002D, 0x0009,
+ 0x0009, 0x006F, 0x276C, 0x01DE, 0x0000, 0x0684, 0x0027, 0x06EC, 0x00D2, 0x000E, 0x004B, 0x00EC,
+ 0x021B, 0x07DD, 0x0014, 0x0000, 0x00F8, 0x00A1, 0x1021, 0x0025, 0x0034, 0x0000, 0x1631, 0x1638,
+ 0x0830, 0x02A0, 0x0001, 0x2590, 0x0022, 0x0186, 0x0CA5, 0x00E1, 0x012C, 0x10EE, 0x05A5, 0x001A,
+ 0x1354, 0x340C, 0x38E0, 0x0000, 0x000F, 0x000D, 0x5110, 0x06B7, 0x00A7, 0x0021, 0x001A, 0x0530,
+ 0x6304, 0x001F, 0x0024, 0x0A91, 0x0439, 0x161B, 0x0601, 0x01F8, 0x0001, 0x0002, 0x0000, 0x0B3C,
+ 0x0993, 0x0134, 0x0013, 0x29DE, 0x0A03, 0x0029, 0x000C, 0x0006, 0x04A4, 0x0020, 0x008E, 0x0743,
+ 0x0022, 0x14DA, 0x0004, 0x0059, 0x06E5, 0x04AC, 0x0A09, 0x00B2, 0x06B5, 0x325B, 0x121A, 0x0022,
+ 0x0000, 0x0031, 0x003A, 0x00E3, 0x000A, 0x05F7, 0x06BD, 0x002F, 0x004D, 0x0E91, 0x0804, 0x0003,
+ 0x0245, 0x0000, 0x0D84, 0x0000, 0x011B, 0x0000, 0x000E, 0x0137, 0x0052, 0x0032, 0x0088, 0x0016,
+ 0x000C, 0x0055, 0x0504, 0x0007, 0x0020, 0x086B, 0x0193, 0x09C2, 0x00D2, 0x0AB7, 0x02CF, 0x0004,
+ 0x157E, 0x004C, 0x1AE0, 0x0001, 0x05CC, 0x0000, 0x0000, 0x04FB, 0x0D4B, 0x104E, 0x0162, 0x3B53,
+ 0x00AD, 0x0011, 0x0061, 0x31BA, 0x0004, 0x001E, 0x0B92, 0x0CE0, 0x011F, 0x1965, 0x0083, 0x0515,
+ 0x0000, 0x1440, 0x0007, 0x2A40, 0x135F, 0x0002, 0x4334, 0x0041, 0x0048, 0x0020, 0x0006, 0x022F,
+ 0x000A, 0x0026, 0x0084, 0x0000, 0x0BD6, 0x005E, 0x003A, 0x0000, 0x0093, 0x0033, 0x026C, 0x011D,
+ 0x0276, 0x0051, 0x021D, 0x0000, 0x03A1, 0x0177, 0x0089, 0x1D1E, 0x0009, 0x001D, 0x000F, 0x009E,
+ 0x0010, 0x0531, 0x0004, 0x0001, 0x008B, 0x02E2, 0x01F0, 0x0001, 0x072C, 0x0BF1, 0x003A, 0x14A6,
+ 0x0004, 0x05C2, 0x00E6, 0x01D1, 0x0104, 0x0A8D, 0x0AC9, 0x0762, 0x0F00, 0x0613, 0x0000, 0x251F,
+ 0x0035, 0x0046, 0x0000, 0x0C2E, 0x00D4, 0x0078, 0x0193, 0x0038, 0x00BE, 0x0A69, 0x0007, 0x0020,
+ 0x0078, 0x0006, 0x09DF, 0x000F, 0x2CF8, 0x0000, 0x3714, 0x04F7, 0x0006, 0x002C, 0x1C6E, 0x0A14,
+ 0x005A, 0x47C4, 0x007D, 0x0009, 0x0105, 0x000C, 0x001D, 0x1558, 0x0820, 0x0011, 0x0012, 0x0E00,
+ 0x011A, 0x0000, 0x0004, 0x0025, 0x0000, 0x0388, 0x00A8, 0x0082, 0x02CD, 0x0001, 0x5D05, 0x0E5C,
+ 0x0000, 0x0301, 0x0516, 0x0004, 0x0003, 0x02FB, 0x08AC, 0x0004, 0x0004, 0x0007, 0x0067, 0x0000,
+ 0x0007, 0x00E9, 0x03C0, 0x02D4, 0x000F, 0x001E, 0x01BA, 0x4B37, 0x0089, 0x00BE, 0x00A9, 0x3967,
+ 0x0125, 0x0056, 0x000D, 0x0003 } ;
+
+const uint16_t ADSL_SyndromeHash[ADSL_Packet::SyndromeSlots] = {
+ 0x1C5A, 0x057A, 0x5F6D, 0x162D, 0x2D46, 0x7CB8, 0x2EBC, 0x75B4, 0x5C83, 0x9CBA, 0x6CB9, 0x4F52,
+ 0x1E33, 0x03A3, 0x2378, 0x729E, 0x3A93, 0x061D, 0x21A7, 0x0F8E, 0x1C60, 0x0550, 0x2628, 0x969A,
+ 0x3F97, 0x6998, 0x1519, 0x384F, 0x1470, 0x8FB6, 0x3EA2, 0x73BC, 0x5885, 0x4345, 0x3A78, 0x5C84,
+ 0x348A, 0x0FBE, 0x3188, 0x16B9, 0x52AF, 0x9BB1, 0x6FA6, 0x2392, 0x5E72, 0x465F, 0x0041, 0x2B44,
+ 0x49A6, 0x30FF, 0x2F4A, 0x2092, 0x89AB, 0x86A8, 0x5771, 0x3E91, 0x8195, 0x7DA5, 0x32B6, 0x3780,
+ 0x4261, 0x0173, 0x1F6F, 0x2F57, 0x1B5C, 0x7594, 0x07AB, 0x496B, 0x045D, 0x1BBD, 0x4551, 0x0449,
+ 0x3885, 0x6DA2, 0x4B6C, 0x87A0, 0x0E1C, 0x81AF, 0x4363, 0x67AD, 0x58A8, 0x3B7A, 0x4E75, 0x09B7,
+ 0x131C, 0x0A20, 0x0FB9, 0x127F, 0x294D, 0x5661, 0x586F, 0x0218, 0x3685, 0x164A, 0x0F67, 0x029D,
+ 0x096C, 0x46A8, 0xA0BF, 0x6178, 0x30B4, 0x11A8, 0x6E76, 0x0250, 0x3394, 0x1395, 0x4F8D, 0x1650,
+ 0x172D, 0x0E14, 0x6CB3, 0x10B6, 0x006F, 0x4E70, 0x4DA7, 0x2E70, 0x0895, 0x3566, 0x5D98, 0x1734,
+ 0x2084, 0x95AF, 0x393A, 0x3549, 0x3244, 0x31B6, 0x3B67, 0x6C76, 0x0836, 0x5666, 0x2779, 0x739D,
+ 0x6D7A, 0x0791, 0x5359, 0x8BAA, 0x357E, 0x336A, 0x7195, 0x5E9C, 0xA6B5, 0x4AAC, 0x878E, 0x1E29,
+ 0x228C, 0x1892, 0x0E89, 0x6783, 0x2279, 0x576F, 0x40B7, 0x0252, 0x3B63, 0x2DA0, 0xA1B6, 0x037D,
+ 0x1BBF, 0x1635, 0x9DA8, 0x5456, 0x4FA4, 0x1B62, 0x1090, 0x23A7, 0x4E99, 0x0B45, 0x2A78, 0x1B5F,
+ 0x84A1, 0x0B6C, 0x31A8, 0x0E8F, 0x0143, 0x2986, 0x0F7D, 0x4183, 0x0D57, 0x2673, 0x055D, 0x2F6B,
+ 0x396D, 0x3358, 0x0153, 0x89A7, 0x25A1, 0x21AF, 0x888E, 0x4074, 0x0991, 0x32A6, 0x1353, 0x0AAC,
+ 0x087B, 0x6B76, 0x5598, 0x0B7E, 0x4F64, 0x7A85, 0x0D5F, 0x1D55, 0x2CA7, 0x1F56, 0x8AA3, 0x44B4,
+ 0x798B, 0x31A5, 0x1027, 0x1851, 0x8BB4, 0x8AA6, 0x798D, 0x031F, 0x5863, 0x082B, 0x1948, 0x0623,
+ 0x4D83, 0x088D, 0x3597, 0x8598, 0x4E96, 0x484E, 0x202F, 0x2D42, 0x678E, 0x7F98, 0x2BA5, 0x86B3,
+ 0x91A3, 0x3A7C, 0x0C2E, 0x5B6D, 0x659B, 0x4F6C, 0x206D, 0x0E3C, 0x0E83, 0x5A8A, 0x0362, 0x567E,
+ 0x2F31, 0x3451, 0x41A5, 0x0F68, 0x539E, 0x6D94, 0x718A, 0x2394, 0x1693, 0x3980, 0x091A, 0x2B4A,
+ 0x069A, 0x0C92, 0x80BB, 0x1EFF, 0x96B4, 0x4C8A, 0x7892, 0x0985, 0x245D, 0x5F7E, 0x5AB2, 0x0627,
+ 0x9CB2, 0x3397, 0x3FA0, 0x2557, 0x50BB, 0x0729, 0x0E69, 0x75B9, 0x0244, 0x3A65, 0x425B, 0x378E,
+ 0x8FBA, 0x5988, 0x0D64, 0x90A6, 0x1682, 0x8C9D, 0x1598, 0x8299, 0x0614, 0x3AB7, 0x089B, 0x4888,
+ 0xA0A5, 0x0C35, 0x2D37, 0x040C, 0x4AA7, 0x3BA8, 0x1B9B, 0x3BAA, 0x0A27, 0x799F, 0x225B, 0x2E5D,
+ 0x10B8, 0x34BC, 0x3B8A, 0x1924, 0x0E9E, 0x0760, 0x6476, 0x1D70, 0x223E, 0x07AD, 0x0781, 0x6AB7,
+ 0x748E, 0x6D79, 0x3C64, 0x3C8A, 0x0A95, 0x087A, 0x09A4, 0x6B85, 0x2A3C, 0x639C, 0x78B1, 0x8C8E,
+ 0x64B7, 0x026E, 0x3848, 0x117B, 0x8EB9, 0x3765, 0x6698, 0x60A7, 0x0E10, 0x092B, 0x31B7, 0x50A4,
+ 0x0B3D, 0x0B2F, 0x1E9D, 0x666D, 0x1B58, 0x698E, 0x2038, 0x3A8B, 0x0394, 0x3D8B, 0x215E, 0x080B,
+ 0x65BB, 0x0C6E, 0x4FB7, 0x6596, 0x15B9, 0x527C, 0x0998, 0x047E, 0x5C6C, 0x3A3E, 0x5D9B, 0x20AA,
+ 0x0F8B, 0x112B, 0x67B1, 0x010A, 0x4CB1, 0x449C, 0x10B3, 0xB5B9, 0x575C, 0x6B8A, 0x54AE, 0x2DB8,
+ 0x4AB8, 0x0613, 0x7698, 0x0818, 0xB2BF, 0x3466, 0x7FBE, 0x2AAC, 0xA8BD, 0x1238, 0x7993, 0x2881,
+ 0x2E44, 0xA9AD, 0x60B6, 0x80A6, 0x217C, 0x2E64, 0x81B6, 0x4493, 0x0CA1, 0x2D66, 0x969B, 0x12BA,
+ 0x6786, 0x3F67, 0x0F2F, 0x3B5F, 0x1429, 0x7CBF, 0x1F24, 0x1427, 0x7894, 0x1742, 0x45AA, 0x26B6,
+ 0x2C5E, 0x5F74, 0x6CAC, 0x0519, 0x0B50, 0x3550, 0x757F, 0x2032, 0x6C97, 0x506B, 0x10A8, 0x0108,
+ 0x809B, 0xB5B6, 0xA5B7, 0x09AB, 0x789F, 0x7794, 0x5B63, 0x0D63, 0x22BF, 0x0751, 0x51AA, 0x59AD,
+ 0x7880, 0x1B4A, 0x1FA6, 0x68B5, 0x4D7A, 0x3582, 0x6886, 0x41B4, 0x6E71, 0x83A6, 0x91BE, 0x9697,
+ 0xA0B0, 0x4E83, 0x2E3A, 0x52BC, 0x2E83, 0x1E4B, 0x5D62, 0x4351, 0x1ABC, 0x7D7F, 0x5371, 0x3B99,
+ 0x3869, 0x17B0, 0x1F73, 0x324C, 0x1A6E, 0x2984, 0x138C, 0x477C, 0x11AE, 0x229D, 0x648E, 0x8286,
+ 0x2C49, 0x1E2B, 0x4E55, 0x0267, 0x043C, 0x395C, 0x123E, 0x3D81, 0x2B3E, 0x7A7E, 0x8794, 0x35BD,
+ 0x0582, 0x0920, 0x5685, 0x1B50, 0x557E, 0x0BA0, 0x73BB, 0x1B41, 0x4F9A, 0x97B9, 0xA4A5, 0x75AE,
+ 0x178A, 0x697F, 0x2CA9, 0x77BC, 0x6E7C, 0x6292, 0x181C, 0x03BD, 0x0261, 0x2C96, 0x0828, 0x1473,
+ 0x78B2, 0x467B, 0x48A8, 0x565F, 0x2E9D, 0x02A1, 0x7EA9, 0x041D, 0x019A, 0x173C, 0x1E6F, 0x2231,
+ 0x03A2, 0x3390, 0x14B3, 0x7BBA, 0x5269, 0x1EA4, 0x98A8, 0x6090, 0x4255, 0x2D4D, 0x396A, 0x82B8,
+ 0x105D, 0xA5BA, 0x02BF, 0x7C7F, 0x5D63, 0x1D78, 0x2D55, 0x5083, 0x3BA3, 0x042F, 0x2264, 0x0A4C,
+ 0x82AC, 0x42AE, 0x779D, 0x0280, 0x262A, 0x8CFF, 0x284A, 0x35B9, 0x1171, 0x0B28, 0x5D6E, 0x3252,
+ 0xB3BD, 0x5160, 0x6EBF, 0x1582, 0xA3BF, 0x4E5C, 0x3497, 0x6899, 0x6F7E, 0x037E, 0x3FA2, 0x588A,
+ 0x1B6A, 0x30B7, 0x4475, 0x0677, 0xA6BF, 0x238E, 0x0AFF, 0x7A88, 0x3EBC, 0x7A92, 0x3398, 0x0E16,
+ 0x0C6A, 0x7690, 0x6DB3, 0x2364, 0x1487, 0x124C, 0x3D7D, 0x066D, 0x4A79, 0x6FB0, 0x2848, 0x52A5,
+ 0x8BB0, 0x247B, 0xA1A8, 0x336B, 0x0E7F, 0x41A1, 0x3143, 0x6A8D, 0x576B, 0x033D, 0x1E9E, 0x457C,
+ 0x2851, 0x6E8A, 0x2148, 0x5758, 0x738A, 0x1B77, 0x08A5, 0xAEBC, 0x0B7B, 0x7482, 0x4657, 0x1626,
+ 0x7E83, 0x076D, 0x7E80, 0x62B0, 0x0E33, 0x1FA8, 0x158F, 0x7DBD, 0xAAAF, 0x0B80, 0xABAD, 0x7CA3,
+ 0x3098, 0x116E, 0x2B91, 0x32AF, 0x156D, 0x8D97, 0x5970, 0x027C, 0x959A, 0x6EB6, 0x0871, 0x478F,
+ 0x00A9, 0x146C, 0x2966, 0x579A, 0x094C, 0x63BB, 0xB1B7, 0x66BF, 0x3D8C, 0x4684, 0x8283, 0x789E,
+ 0x0FA2, 0x09AA, 0x9CA3, 0x5D67, 0x0959, 0x5EBF, 0x36AA, 0x979C, 0x8796, 0x447C, 0x6A6F, 0x91A0,
+ 0x3F76, 0x2755, 0x404F, 0x7989, 0x6599, 0x3455, 0x0D9C, 0x068D, 0x24AD, 0x458F, 0x282C, 0x3EA4,
+ 0x2870, 0x305D, 0x0A22, 0x6C8A, 0x0225, 0x94B3, 0x3483, 0x23B0, 0x16FF, 0x3F45, 0xADBF, 0x0020,
+ 0x569F, 0x0877, 0x4F72, 0x6F9A, 0x346B, 0x30A9, 0x768A, 0x5A9D, 0x2658, 0x758A, 0x1623, 0x0353,
+ 0x0365, 0x2E85, 0x1D90, 0x2369, 0x4485, 0xB8B9, 0x37BB, 0x6774, 0x2799, 0x1253, 0x4472, 0x50B7,
+ 0x2E80, 0x7AB5, 0x0419, 0x1B91, 0x27B3, 0x33A9, 0x1C7C, 0x9499, 0x495C, 0x1746, 0x668D, 0x0F1E,
+ 0x1662, 0x2C79, 0x7CBB, 0x3F88, 0x4A5D, 0x3179, 0x303D, 0x265E, 0x6894, 0x4877, 0x8487, 0x0A3C,
+ 0x0057, 0x5471, 0x1621, 0x70AC, 0x93B2, 0x5084, 0x598B, 0x54A5, 0x5C97, 0x4C75, 0x688A, 0x2FA0,
+ 0x1568, 0x30BB, 0xA7BF, 0x7499, 0x888B, 0x4DA0, 0x8EBD, 0x41FF, 0x1E57, 0x0A34, 0x4B7D, 0x316A,
+ 0x0C1C, 0x0548, 0x171C, 0x98FF, 0x32BD, 0x8193, 0x147F, 0x34A5, 0x9EAC, 0x20A9, 0x868C, 0x5FAA,
+ 0x8392, 0x128D, 0x4275, 0x5681, 0x76B7, 0x6580, 0x5672, 0x426D, 0x7EBE, 0x476D, 0x024C, 0x0C28,
+ 0x6EAF, 0x3B92, 0x1C9B, 0x3494, 0x8BA0, 0x4967, 0x133E, 0x3576, 0x2999, 0x0B44, 0x11B9, 0x1C8E,
+ 0x1D42, 0x0AB6, 0x1E3F, 0x9FAC, 0x3640, 0x7D86, 0x7494, 0x428F, 0x7FA5, 0x3BA6, 0x2495, 0x3FB2,
+ 0x769B, 0x2C4F, 0x6072, 0x46AD, 0x1272, 0x93A0, 0x0B18, 0x375C, 0x57AE, 0x34A6, 0x3ABE, 0x329C,
+ 0x1932, 0x3A5D, 0x4292, 0x1B6C, 0x6A7C, 0x1E3C, 0x4D9D, 0x1E35, 0x878C, 0x2796, 0x7296, 0x2166,
+ 0x0D31, 0x0946, 0x3FA9, 0x7988, 0x088C, 0x1F8B, 0x292E, 0x5A90, 0x0F13, 0x0FA7, 0x27AC, 0x8BA1,
+ 0x61A4, 0x6486, 0x4E73, 0x12B6, 0x1694, 0x0E25, 0x7F97, 0x323A, 0x52BB, 0x0F48, 0x1C1E, 0x0343,
+ 0x4663, 0x4246, 0x084B, 0x0074, 0x62BD, 0x1C7A, 0x4F7B, 0x1FA9, 0x135C, 0x006B, 0x7276, 0x0463,
+ 0x0C9F, 0x0E4A, 0x3297, 0x4091, 0x2181, 0x04BB, 0x56BB, 0x5FBD, 0x148D, 0x0C98, 0x0E1D, 0x4199,
+ 0x113E, 0x2468, 0x1929, 0x83A8, 0x9AB7, 0xA1A3, 0x112F, 0x0597, 0x2337, 0x6EB1, 0x3D8F, 0x3ABF,
+ 0x10AD, 0x62A4, 0x7F85, 0x379D, 0x6DFF, 0x6779, 0x5A6F, 0x85B0, 0x6889, 0x4690, 0x2342, 0x323B,
+ 0x3BBB, 0x1E87, 0x0065, 0xA9B9, 0x3DA6, 0x1A26, 0x032D, 0x61B5, 0x1A7F, 0x1A7B, 0x0EA3, 0x4975,
+ 0x2C58, 0x10A2, 0x81BD, 0x3A69, 0x223A, 0x7AB4, 0x226D, 0x2567, 0x9FB3, 0x57A6, 0x10BB, 0x4D94,
+ 0x2386, 0x929D, 0x4F5E, 0x06A2, 0x5480, 0x95A1, 0x14A3, 0xA2B2, 0x1B74, 0x50A0, 0x0E3D, 0x4A8B,
+ 0x6668, 0x4452, 0x48A6, 0x5867, 0x5188, 0x4264, 0x0B59, 0x0D0F, 0x63A3, 0x111D, 0x4142, 0x1065,
+ 0x1F29, 0x4DB3, 0x8C95, 0x184A, 0x3077, 0x6F77, 0x03B2, 0x5B69, 0x062C, 0x1A65, 0x4855, 0x6ABB,
+ 0x5B9B, 0x012E, 0x03A7, 0x69B6, 0x2F43, 0x546A, 0x6AAA, 0x4971, 0x54B2, 0x93AD, 0x0F47, 0x0970,
+ 0x0F3C, 0x6291, 0x1233, 0x27A7, 0x69A7, 0x436C, 0xA2A3, 0x3772, 0x3A40, 0x1790, 0x7B83, 0x7694,
+ 0x485F, 0x51B1, 0x5CBD, 0x2375, 0x39A9, 0x2568, 0x2CA5, 0x30A6, 0x7DA9, 0x6B7C, 0x068A, 0x4DB9,
+ 0x65A3, 0x838D, 0x0E4D, 0x6469, 0x4458, 0x095B, 0x2340, 0x7DB6, 0x0276, 0x0D7A, 0x1F49, 0x1420,
+ 0x2DA5, 0x396B, 0x0171, 0x264A, 0x0ABE, 0x1844, 0x118B, 0x5CA1, 0x7691, 0x7FBD, 0x485A, 0x0A74,
+ 0xACB3, 0x6265, 0x111A, 0x13BB, 0x0E93, 0x3EB3, 0x08A9, 0x0377, 0x8EA3, 0x7586, 0x1BA9, 0x5291,
+ 0x11A2, 0x69BB, 0x535C, 0x92A5, 0x87BC, 0x5796, 0x436E, 0x139B, 0x3E71, 0x459C, 0xA1AC, 0x9DBF,
+ 0x7890, 0x6985, 0x0149, 0x0D1A, 0x2E47, 0x184E, 0x6CA8, 0x303A, 0x439C, 0x5D97, 0x0797, 0x1F59,
+ 0x229F, 0x3B64, 0x2045, 0x0E62, 0x1957, 0x418E, 0x4798, 0x2083, 0x5895, 0x2168, 0x295E, 0x9FAD,
+ 0x8CB0, 0x106D, 0x12A4, 0x0E91, 0x0436, 0xAEB1, 0x208A, 0x5A89, 0x3CBA, 0x3383, 0xB0B5, 0x0B66,
+ 0x186A, 0x178F, 0x7293, 0xA5A6, 0x698F, 0x1DA5, 0x219D, 0x1B1E, 0x3CB7, 0x77BE, 0x6F8D, 0x50B8,
+ 0x76BF, 0x0E54, 0x1258, 0x0752, 0x1F2E, 0x2E90, 0x16AB, 0x44B9, 0x5980, 0x1525, 0x3BB3, 0x387C,
+ 0x4B53, 0x42AA, 0x6788, 0x135F, 0x3775, 0x5B8D, 0x5A99, 0x3487, 0x3590, 0x5E61, 0x232A, 0x8F90,
+ 0x3C60, 0x082D, 0x1DA8, 0x0825, 0x2935, 0x2E4F, 0x729A, 0x7097, 0x0E2C, 0x4667, 0x181A, 0x3180,
+ 0x1B43, 0x0450, 0x687A, 0x2430, 0x2C3C, 0x188C, 0x3A45, 0x3886, 0x7DA0, 0x1D52, 0x2D75, 0x91BB,
+ 0x0577, 0x2F4F, 0x156E, 0x5A73, 0x7196, 0x2FB6, 0x5694, 0x0E2A, 0x8F9B, 0x489E, 0x052B, 0x4C7F,
+ 0x023E, 0x1659, 0x7CB4, 0x5759, 0x1B30, 0x156B, 0x0F2A, 0x8CAB, 0x0778, 0x0D92, 0x8C9F, 0x083B,
+ 0x066A, 0x52A9, 0x688C, 0x2A56, 0x5966, 0x5EB9, 0x3ABA, 0x347E, 0x49A4, 0x19B4, 0x5A61, 0x5EAB,
+ 0x1FAF, 0x2670, 0x5BAE, 0x78A5, 0x213E, 0x267F, 0x555E, 0x6498, 0x343B, 0x049E, 0x0657, 0x0F9B,
+ 0x627B, 0x2538, 0x135D, 0x1747, 0x6690, 0xA9AF, 0x122C, 0x7EBA, 0x556F, 0x0340, 0x315D, 0x5B7E,
+ 0x54BE, 0x2A85, 0x137B, 0x1A1B, 0x7FB5, 0x22A6, 0x6BB0, 0x3286, 0x1FB2, 0x778F, 0x3C98, 0x75A2,
+ 0x54B4, 0x638C, 0x7AAC, 0x2666, 0x0542, 0x318E, 0x219C, 0x5AA2, 0x6B77, 0x408E, 0x6876, 0x4884,
+ 0x047F, 0x3E56, 0xA9B8, 0x0B9F, 0x697C, 0x89B2, 0x40B8, 0xA1A4, 0x36B1, 0x3C9E, 0x0067, 0x1A30,
+ 0x077F, 0x034F, 0x22BA, 0x02B1, 0xA1AE, 0x0C2F, 0x4164, 0x4983, 0x1391, 0x1A9B, 0x2C8B, 0x0F1C,
+ 0x608B, 0x3CBC, 0x2C91, 0x9EFF, 0x041C, 0x16B5, 0x1C2C, 0x506E, 0x0B61, 0x2275, 0x1F82, 0x1E6B,
+ 0x8C90, 0x8497, 0x2C80, 0x3878, 0xACBF, 0x009D, 0x4865, 0x88A6, 0x82B2, 0x0EBE, 0x29A4, 0x0203,
+ 0x19B5, 0x3BA4, 0x7C89, 0x2055, 0x27A8, 0x70FF, 0x1D39, 0x7380, 0x2782, 0x8F9C, 0x4379, 0x5A68,
+ 0x5EA4, 0x286C, 0x3467, 0x1AB6, 0x75B2, 0x4965, 0x7F89, 0x024A, 0x6EB0, 0x4F60, 0x157D, 0x156A,
+ 0x011D, 0x8A9E, 0x74BD, 0x404E, 0x4853, 0x2C5C, 0x2537, 0x45AE, 0x067F, 0x223C, 0x6F70, 0x0F2C,
+ 0x5369, 0x8AAE, 0x0A21, 0x1665, 0x034E, 0x2E91, 0x578F, 0x0A80, 0x1FA0, 0x0372, 0x676F, 0x1E94,
+ 0x7BA1, 0x1355, 0x2B42, 0x0445, 0x76FF, 0x014E, 0xA7BE, 0x18B3, 0x030F, 0x7E93, 0x5BA5, 0x35A7,
+ 0x86A9, 0x4FBA, 0xA6B9, 0x3354, 0x64A6, 0x5E6B, 0x8EFF, 0x777B, 0x3D88, 0x4653, 0x409C, 0x9396,
+ 0x13BD, 0x6063, 0x33A3, 0x13B7, 0x64A0, 0x74B2, 0x53AF, 0x5FA4, 0x7599, 0x0C6D, 0x6DB4, 0x1026,
+ 0x4C84, 0x63A4, 0x535B, 0x43A9, 0x272F, 0x151B, 0x94FF, 0x5492, 0x0045, 0x959F, 0x24BF, 0x7A89,
+ 0x14BC, 0x3560, 0x0964, 0x9CBF, 0x3A7E, 0x04A3, 0x03BF, 0x2EFF, 0x757D, 0x4787, 0x71A0, 0x4B57,
+ 0x678C, 0x54A3, 0x95BC, 0x4C8E, 0x8388, 0x33B2, 0x4A9C, 0x8F9F, 0x1F93, 0x234C, 0xB5BF, 0x333D,
+ 0x4568, 0x1D8B, 0x2156, 0x99A3, 0x1D2B, 0x2A50, 0x6F81, 0x081C, 0x0470, 0x0A2A, 0x4A80, 0x798E,
+ 0x0772, 0x3867, 0x5280, 0x0B72, 0x0CA2, 0x1544, 0x70BD, 0x2034, 0x5D95, 0x0995, 0x355D, 0x4B95,
+ 0x2B70, 0x2350, 0x77BF, 0x689D, 0x6285, 0x349E, 0x0228, 0x19AA, 0x2047, 0x9AAC, 0x20B0, 0x6466,
+ 0x515A, 0x0B82, 0x487D, 0x1EA3, 0x3075, 0x50BC, 0x456D, 0x29B6, 0x77A9, 0x696D, 0x87B3, 0x4068,
+ 0x355C, 0x79B8, 0x2697, 0x076A, 0xA1BF, 0x1E8E, 0x4298, 0x3770, 0x3D41, 0x1242, 0x2769, 0x5781,
+ 0x5BB5, 0x4783, 0x95AA, 0x2E31, 0x33BF, 0x8D99, 0x15AA, 0x064B, 0x1A81, 0x72BF, 0x1A61, 0x22A9,
+ 0x4C71, 0x6497, 0x75AB, 0x2233, 0x4AB7, 0x0423, 0x58B7, 0x3E97, 0x078C, 0x186B, 0x48B1, 0x408D,
+ 0x7682, 0x8CB7, 0x515F, 0x97AC, 0x5BA7, 0x087F, 0x6B7F, 0x198D, 0x379F, 0x939A, 0x164B, 0x51B3,
+ 0x4470, 0x1186, 0x5A64, 0x3683, 0x3C8E, 0x31A0, 0x4084, 0x37B1, 0x3646, 0x214A, 0x0A54, 0x5B8A,
+ 0x87B4, 0x67A8, 0x939D, 0x6277, 0x1A76, 0x3797, 0x3B62, 0x919C, 0x41AE, 0x0586, 0x48BA, 0x4A96,
+ 0x275C, 0x7795, 0x2980, 0x7E86, 0x2873, 0x0966, 0x0C54, 0x5BBF, 0x2D7E, 0x1B2C, 0xB2B5, 0x1435,
+ 0x1F4D, 0xA9B6, 0x6483, 0x2640, 0x68BB, 0x3472, 0x4B8E, 0x217F, 0x1630, 0x1097, 0x2F6D, 0x82B3,
+ 0x42A5, 0x5EA2, 0x6AA0, 0x0F3D, 0x68A4, 0x3691, 0x3D40, 0x3395, 0x477F, 0x5AFF, 0x1981, 0x2D51,
+ 0x127A, 0x38A0, 0x16BA, 0x2F98, 0x014F, 0x79A2, 0x6CB4, 0x6A88, 0x4C85, 0x7E81, 0x7DAE, 0x1371,
+ 0x527E, 0x51FF, 0x7490, 0x898D, 0x54A1, 0x577E, 0x7C97, 0x7F87, 0x0F20, 0x7091, 0x12AE, 0x6C9E,
+ 0x757E, 0x098E, 0x1877, 0x3289, 0x84B2, 0x9DA1, 0x4548, 0x2A90, 0x1431, 0x4A86, 0x94BE, 0x0C7D,
+ 0x049A, 0x3840, 0x1C6E, 0x8087, 0x5882, 0x82AF, 0x3C45, 0x00A5, 0x9CAC, 0x1943, 0x1D75, 0x123C,
+ 0x7173, 0x83B0, 0x5766, 0xB4BA, 0x172F, 0x97AD, 0x3470, 0x415A, 0x0AA7, 0x127B, 0x4076, 0x212D,
+ 0x74B8, 0x5D86, 0x3056, 0x9EB2, 0x0846, 0x0F3B, 0x224C, 0x557D, 0x7793, 0x0D2D, 0x8EBF, 0x2DBD,
+ 0x939E, 0x68AF, 0x057F, 0x4E94, 0x37A3, 0x063D, 0x5563, 0x1B6E, 0x03A0, 0x1424, 0x2841, 0x1F36,
+ 0x2EB5, 0x1770, 0x508E, 0x064F, 0x4449, 0x656B, 0x549A, 0x32B2, 0x059E, 0x9FBF, 0x5376, 0x3083,
+ 0x3471, 0x1259, 0x3346, 0x47BC, 0x1A5A, 0x4CB4, 0x0B7A, 0x2B4F, 0x6CA3, 0x425A, 0x365E, 0x2692,
+ 0x6E86, 0x6BA8, 0x1859, 0x85A3, 0x0539, 0x0F64, 0x0D77, 0x8285, 0x3B49, 0x5FA3, 0x3F63, 0x1349,
+ 0x0F82, 0x2B4B, 0x1857, 0x4488, 0x94BA, 0x45A8, 0x5D9E, 0x7079, 0x5E73, 0x0568, 0x0F36, 0x4AAE,
+ 0x8E8F, 0x1E7F, 0x4D8D, 0x1AB2, 0x0611, 0x179D, 0x585F, 0x1112, 0x9AA9, 0x17BA, 0x98BA, 0x2D6D,
+ 0x040A, 0x555C, 0x738F, 0x0179, 0x88B5, 0x494D, 0x6882, 0x2F8E, 0x1A91, 0x0954, 0x0E31, 0x0837,
+ 0x73A3, 0x8FB9, 0x71FF, 0x428B, 0x1773, 0x3380, 0x3E73, 0x207C, 0x0D85, 0x073C, 0x5094, 0x1C4A,
+ 0x5B9E, 0x5088, 0x82B0, 0x1A5C, 0x2ABB, 0x1AA5, 0x214B, 0xBABD, 0x1B21, 0x507F, 0x1E90, 0x6B8F,
+ 0x62B4, 0xA2BF, 0x98A9, 0x84FF, 0x1B31, 0x7AAD, 0x4F63, 0x157E, 0x545F, 0x828F, 0x1036, 0x5A86,
+ 0x697E, 0xA4A8, 0x38A4, 0x161F, 0x345B, 0x376F, 0x6299, 0x649F, 0x13AA, 0x0679, 0x999C, 0x0E87,
+ 0x536B, 0x8DAF, 0x1F8E, 0x2582, 0x1D7D, 0x1F26, 0x2762, 0x465A, 0x205E, 0x2F5A, 0x2186, 0x8B9C,
+ 0x478D, 0x88A3, 0x2E34, 0xA7BD, 0x1C55, 0x3E93, 0x1375, 0x5F73, 0x2787, 0x1182, 0x077A, 0x082C,
+ 0x335D, 0x1EA5, 0x4CA5, 0x0930, 0x91A4, 0x4095, 0x7DB8, 0x5E5F, 0x179B, 0x1172, 0x4C6C, 0x2150,
+ 0xA9AA, 0x0526, 0x2E3C, 0x235E, 0xA9BD, 0x3FA6, 0x8AAA, 0x0FB0, 0xA8BF, 0x2A69, 0x70A2, 0x318A,
+ 0x0467, 0x63A5, 0x6E7E, 0x86A1, 0x5677, 0x437E, 0x2933, 0x899C, 0x74AE, 0x0357, 0x176D, 0x898E,
+ 0x1175, 0x8CA7, 0x48B7, 0x0530, 0x272B, 0x517C, 0x8E91, 0x4A9B, 0x6494, 0x7FA7, 0x1C92, 0x8099,
+ 0x6DBC, 0x6979, 0x1B32, 0x5D91, 0x216C, 0x0E6D, 0x11AD, 0x52A7, 0x0B20, 0x1B64, 0x0E4B, 0x6272,
+ 0x136E, 0x209C, 0x152E, 0x4A9F, 0x778D, 0xACBB, 0x5263, 0x2484, 0x4656, 0x7283, 0x072B, 0x07B3,
+ 0x1C46, 0x4DBD, 0x27A6, 0x237E, 0x234B, 0x3963, 0x3276, 0x4C59, 0x4256, 0x408B, 0x398E, 0x2A5A,
+ 0x707D, 0x8CA5, 0x263B, 0x2D4B, 0x0B40, 0x0424, 0x007C, 0x4860, 0x5154, 0x70B2, 0x035A, 0x4A8C,
+ 0x0FA9, 0x8BB5, 0x65FF, 0x3A60, 0x61BC, 0x0C3C, 0x30AB, 0x1F40, 0x14B8, 0x3E86, 0x0E28, 0x454E,
+ 0x3195, 0x41BB, 0x0786, 0x17AC, 0x1E7E, 0xB9BD, 0x2164, 0x3761, 0x25A7, 0x424F, 0x252F, 0x4CAF,
+ 0x0C23, 0x98AE, 0x49BC, 0x149A, 0x2734, 0x3371, 0x5158, 0x0B92, 0x0B6F, 0x1588, 0x1A40, 0x5EB1,
+ 0x4CB8, 0x4D81, 0x36A2, 0x4D7F, 0x7AA0, 0x3066, 0x24B4, 0x6D7E, 0x65BF, 0x0289, 0x2A65, 0xA2B1,
+ 0x6797, 0x1AB0, 0x8EA9, 0x5198, 0x132A, 0x1356, 0x6C8E, 0x0BB7, 0x2526, 0x1053, 0x3035, 0x73A9,
+ 0x41B1, 0xBCFF, 0x3766, 0x7E8E, 0x272D, 0x295F, 0x14B9, 0x103E, 0x1F42, 0x4E52, 0x0D96, 0x4757,
+ 0x63BF, 0x087E, 0x4B97, 0x0028, 0x3AA7, 0x68B1, 0x0046, 0x1D94, 0x334A, 0x3452, 0x4D74, 0x295D,
+ 0x3C4F, 0x1364, 0x038B, 0x185F, 0x3C72, 0x518A, 0x26A6, 0x002E, 0x20A3, 0x497E, 0x8597, 0x39A8,
+ 0x0282, 0x8797, 0x68AA, 0x2F7A, 0x4B6A, 0x1628, 0x5DB1, 0x40BA, 0xA8B4, 0x2059, 0x1575, 0x325C,
+ 0x086F, 0x9ABC, 0x77AF, 0x2451, 0x65A0, 0x0F45, 0x1D64, 0x56BE, 0x5999, 0x0468, 0x55A8, 0x4A58,
+ 0x59FF, 0xB8BE, 0x3196, 0x3233, 0x0B1A, 0x0008, 0x7C9B, 0x9EB6, 0x26BA, 0x5475, 0x1C95, 0x3642,
+ 0xAAAC, 0x9BAF, 0x66AC, 0x349A, 0x149D, 0x5762, 0x2A6E, 0x1841, 0x1DB8, 0x0DAD, 0x049F, 0x6CBE,
+ 0x15A3, 0x0A9F, 0x3BBF, 0x7AA4, 0x7589, 0x2975, 0x3B4A, 0x477B, 0x43AC, 0x5085, 0x949F, 0x6977,
+ 0x1C97, 0x2444, 0x62B8, 0x46AA, 0x39BB, 0x0D93, 0x03A1, 0x070A, 0x44B1, 0x54A9, 0x055E, 0x1F76,
+ 0x6E6F, 0x6BAB, 0x104F, 0x6097, 0x1721, 0x3D92, 0x2E87, 0x18AD, 0x148F, 0x4D88, 0xBCBF, 0x397F,
+ 0x3B54, 0x1D6B, 0x0E5B, 0x1434, 0x0412, 0x8A9C, 0x2C70, 0x4185, 0x5290, 0x93A6, 0xAAAB, 0x3260,
+ 0x44A9, 0x1BA8, 0x0650, 0x737A, 0x9CB7, 0x0E8D, 0x124A, 0x1390, 0x2660, 0x7E8D, 0x59AC, 0x0F17,
+ 0x07BA, 0x3DBE, 0x6EBB, 0x4651, 0x248C, 0x719F, 0x3D9C, 0x167F, 0x0D39, 0x3F48, 0x0E32, 0x1CAD,
+ 0x5152, 0x444D, 0x0C77, 0x6FAB, 0x4CB7, 0x4781, 0x6B6D, 0x90BF, 0x2747, 0x243A, 0x416A, 0x7883,
+ 0x64B9, 0x7177, 0x6181, 0x3884, 0x2130, 0x6092, 0x4586, 0x3798, 0x17B5, 0x1FA4, 0x017E, 0x1753,
+ 0x8CB2, 0x4DB8, 0x4283, 0x787D, 0x7095, 0x8A99, 0xA2BE, 0x3290, 0x4A56, 0x1766, 0x4A8E, 0x1BB2,
+ 0x3E87, 0x6E79, 0x90A4, 0x8993, 0x058B, 0x507E, 0x2058, 0xB0BC, 0x3069, 0x599D, 0x6B9C, 0x509A,
+ 0x8CBD, 0x2197, 0x0DB5, 0x3468, 0x467E, 0x618D, 0x3092, 0x0BAD, 0x3976, 0x4B6D, 0x3032, 0x3375,
+ 0xA2BD, 0x86AF, 0x1DB6, 0x0E70, 0x66A4, 0x286E, 0x6473, 0x777C, 0x0D45, 0x2D8D, 0x7897, 0x8395,
+ 0x2B77, 0x6E90, 0x4854, 0x808F, 0x004C, 0x17A1, 0xA6FF, 0x16BC, 0x06B6, 0x4960, 0x3A52, 0x3D68,
+ 0x2FA3, 0x348E, 0x53FF, 0x6189, 0x77B9, 0x5982, 0x1F3F, 0x3695, 0x3059, 0x5DAF, 0x2A3F, 0x0571,
+ 0x59A8, 0x1F2D, 0x4065, 0x355A, 0x3E4B, 0x5DAD, 0x275A, 0x298C, 0x1ABA, 0x559D, 0x34B6, 0x1CB9,
+ 0x3F4C, 0x364C, 0x7FB9, 0x16B0, 0x06A9, 0x51A2, 0x59AE, 0x5493, 0x35B3, 0x7B97, 0x3E84, 0x337D,
+ 0x1C8F, 0x2E4B, 0x3067, 0x4872, 0x7087, 0x4374, 0x33B9, 0x0052, 0x1E42, 0x617B, 0x9D9F, 0x153F,
+ 0x202E, 0x1E24, 0x003B, 0x528D, 0x30A7, 0x358C, 0x056E, 0x1256, 0x1F7A, 0x57A3, 0x3897, 0x41BF,
+ 0x1C33, 0x2A2D, 0x267D, 0x0882, 0x2B36, 0x5495, 0x3978, 0x4382, 0x030A, 0x013A, 0x2B7F, 0x60A2,
+ 0x4E8F, 0x8EB2, 0x082A, 0x83AC, 0xA0A3, 0x109D, 0x454C, 0x1CB6, 0x5266, 0x3694, 0x57A4, 0x999F,
+ 0x7B8B, 0x4179, 0x3388, 0x6E92, 0x3C54, 0x09B8, 0xACB7, 0x25B5, 0x87AC, 0x0B8E, 0x016D, 0x1F64,
+ 0x2542, 0x3340, 0x769E, 0x047B, 0x53A2, 0x767D, 0x88AD, 0x0488, 0x4194, 0x3445, 0x6D86, 0x42B3,
+ 0x21A9, 0x68AD, 0x253C, 0x6D92, 0x848C, 0x066C, 0x5683, 0x53AD, 0x7FB4, 0x0B6A, 0x084D, 0x1048,
+ 0x5C8E, 0x2DB1, 0x182E, 0x5AAA, 0x4F8C, 0x1B22, 0x053F, 0x63AC, 0x0B94, 0x1C71, 0x182F, 0x6183,
+ 0x0714, 0x0C32, 0x344A, 0x1091, 0x348C, 0x4C4F, 0x86B8, 0x0E13, 0x95A2, 0x4C92, 0x427E, 0x344D,
+ 0x48A1, 0x084E, 0x35AF, 0x5E81, 0x4E7E, 0x7DA6, 0x2D98, 0x6588, 0x50A3, 0x6DA6, 0x02B8, 0x0F4A,
+ 0x0713, 0x134E, 0x297B, 0x0269, 0x779B, 0x3A55, 0x0B39, 0x0821, 0x2169, 0x041A, 0x2936, 0x033F,
+ 0x0D4E, 0x01BA, 0x2E60, 0x65B9, 0x257F, 0x3B9B, 0x599F, 0x68B7, 0x104B, 0x7CB0, 0x1037, 0x279D,
+ 0x157C, 0x528C, 0x639F, 0x09B1, 0x5EA7, 0x1C66, 0x09BB, 0x3AA9, 0x465B, 0x7280, 0x1736, 0x749E,
+ 0x1198, 0x3B97, 0x3589, 0x279E, 0x265F, 0x4C6F, 0x6981, 0x069E, 0x0A3A, 0x89AD, 0x39B9, 0x2544,
+ 0x4692, 0x2695, 0x8FB4, 0x0C5B, 0x7AA9, 0x222A, 0x0C18, 0x0C37, 0x547E, 0x44B5, 0x1CA0, 0x5EAC,
+ 0x7A7D, 0x71B6, 0x447B, 0x0323, 0x2A66, 0x52B0, 0x2583, 0x3F7D, 0x1F22, 0x53BE, 0x21A6, 0x1083,
+ 0x5B8C, 0x6683, 0x2F5F, 0x4A5B, 0x134B, 0x4055, 0x4572, 0x5F70, 0x2774, 0x61A6, 0x94A9, 0x313B,
+ 0x2428, 0x466D, 0x1D73, 0x0F30, 0x0E5A, 0x7C7E, 0x2C39, 0x0460, 0x1DA0, 0xA0B4, 0x0112, 0x1EBB,
+ 0x4353, 0x7AA1, 0x809A, 0x4571, 0x2A7C, 0x6A92, 0x15AD, 0x52B4, 0x2EA8, 0x6468, 0x1163, 0x445E,
+ 0x619A, 0x7695, 0x699D, 0x1376, 0x207D, 0x79B9, 0x6AA4, 0x2874, 0x1ABF, 0x6E94, 0x3095, 0x0610,
+ 0x87A2, 0x717B, 0x23A0, 0x0077, 0x2477, 0x95A5, 0x4C91, 0x3361, 0x178E, 0x24BB, 0x4DA8, 0x424D,
+ 0x47A7, 0x85A1, 0x0D7C, 0x72AD, 0xBDFF, 0x032F, 0xA9BA, 0x169D, 0x7A8B, 0x1316, 0x888A, 0x1BB7,
+ 0x1DA2, 0x0097, 0x2FAC, 0x0F96, 0x3B9F, 0x283A, 0x66BD, 0x1797, 0x3E94, 0x9C9E, 0x0262, 0x5079,
+ 0x0C1E, 0x2569, 0x82A2, 0x081D, 0x55BE, 0x2126, 0x81BF, 0x3E43, 0x0861, 0x4E8E, 0x60A3, 0x1D5D,
+ 0x3441, 0x29A6, 0x1013, 0x277D, 0x41BC, 0x51A6, 0x4D70, 0x6BB4, 0x93AA, 0x8599, 0x2BB9, 0x5A76,
+ 0x3080, 0x0454, 0x2CB5, 0x0A15, 0x0A6F, 0x6A8E, 0x2C6C, 0x66A2, 0x4755, 0x0EB9, 0x3181, 0x22B6,
+ 0x3D8A, 0x2548, 0x1882, 0x16A3, 0x3093, 0x336D, 0xADB4, 0x185E, 0x95B7, 0x436D, 0x0D71, 0x30B2,
+ 0x95AD, 0x2140, 0x5F8F, 0x5E71, 0x5AAC, 0x19B0, 0x748C, 0x33B8, 0x1541, 0x236C, 0x668E, 0x1017,
+ 0xB4B7, 0x525F, 0x3688, 0x748F, 0x14FF, 0x475B, 0xB5BD, 0x5294, 0x0A2F, 0x2F60, 0x1D9C, 0x6671,
+ 0x0E80, 0x2D63, 0x2491, 0x55B9, 0x89BE, 0x829A, 0x3E6F, 0x6064, 0x38B9, 0x6CA2, 0x0F58, 0x30A3,
+ 0x2187, 0x4DA4, 0x2646, 0x1193, 0x5CBA, 0x1539, 0x3974, 0x47B7, 0x5B86, 0x29A9, 0x39A7, 0x0099,
+ 0x64AE, 0x32B9, 0x353D, 0x03B5, 0x1C6B, 0x93FF, 0x3C49, 0x5785, 0x3643, 0x9CFF, 0x435D, 0x6283,
+ 0x0006, 0x14B2, 0x1195, 0x0978, 0x3158, 0x1F77, 0x1423, 0x6A90, 0x61B8, 0x063F, 0x4B7A, 0x1F83,
+ 0x04BC, 0x3B91, 0x2D32, 0x374E, 0x1560, 0x1D85, 0x02AC, 0x738B, 0x1EBF, 0x1085, 0x2238, 0x19B2,
+ 0x2C7C, 0x2C86, 0x0D6A, 0x4C82, 0x9DAF, 0x77B6, 0x3253, 0x1322, 0x028C, 0x80B4, 0x26BD, 0x1B78,
+ 0x21B9, 0x527A, 0x637F, 0x259F, 0x4591, 0x4BB6, 0x7A9A, 0xA7B9, 0x353C, 0x5B97, 0x398D, 0x355E,
+ 0x4680, 0x5B95, 0x19B1, 0x1B48, 0x126E, 0x424C, 0x3D7B, 0x093C, 0x2167, 0x9AB2, 0x18A8, 0x07B1,
+ 0x4F55, 0x31B2, 0x06BC, 0x95FF, 0x1D51, 0x82A5, 0x1852, 0x9EBB, 0x6F78, 0x5FB1, 0x4577, 0x3A8C,
+ 0x3C61, 0xB6BE, 0x40A5, 0x014D, 0x2C3E, 0x73A2, 0x4769, 0x1480, 0x086A, 0x0175, 0x7A90, 0x3990,
+ 0x237D, 0x39BD, 0x678A, 0x1987, 0x335A, 0x064C, 0x2C64, 0x31A1, 0x2144, 0x5272, 0x33BE, 0x728E,
+ 0x2D73, 0x57B4, 0x0630, 0x92A0, 0x8C9E, 0x2459, 0x3FB9, 0x188A, 0x238D, 0x137F, 0x458B, 0x498E,
+ 0x3448, 0x57B0, 0x6EAE, 0x4D75, 0x84B5, 0x53B5, 0x05BE, 0x3C56, 0x6E78, 0x899E, 0xA1AD, 0x0C49,
+ 0x0C16, 0xA4B2, 0x1030, 0x74B3, 0x119A, 0x6D9F, 0x8ABA, 0x1B5D, 0x3F59, 0x78A9, 0x2D77, 0x05A0,
+ 0x2252, 0x90AA, 0x20A0, 0xA1AB, 0x003A, 0x0CA9, 0x2CBA, 0x89A0, 0x617F, 0x37BD, 0x06B4, 0x49AC,
+ 0x20FF, 0x0819, 0x5259, 0x5FB9, 0x2198, 0x043E, 0x18AE, 0x0B8A, 0x3A79, 0x84B1, 0x296B, 0x149B,
+ 0x72AE, 0x52A0, 0x24A8, 0x3EA7, 0x3B70, 0xA6AF, 0x1B34, 0x588E, 0x1C74, 0x258A, 0x3DB6, 0x6D9D,
+ 0x228E, 0x2781, 0x2E55, 0x3EAA, 0x4B7C, 0x07BD, 0x34AF, 0x5253, 0xAEBB, 0x376E, 0x0E79, 0x10BC,
+ 0x162C, 0x2937, 0x3586, 0x1D60, 0x0C2A, 0x7592, 0x869D, 0x7273, 0x21AC, 0x414C, 0x425D, 0x2D9E,
+ 0x96BA, 0x1416, 0x4497, 0x7BA7, 0xA2B9, 0x53AE, 0x2FB2, 0x7789, 0x0B16, 0x5C82, 0x808D, 0x0F71,
+ 0x5E80, 0x165D, 0x233A, 0x229C, 0x5C70, 0x8C8F, 0x549C, 0x4F80, 0x55BB, 0x3D48, 0x1F37, 0x8BB2,
+ 0x4AA3, 0x23BA, 0x0A0C, 0x2672, 0x5E67, 0x1E8B, 0x2C62, 0x19A6, 0x4EB2, 0xB6BD, 0x4F7C, 0x2E63,
+ 0x189C, 0x7F8A, 0x5C6A, 0x66A5, 0x6F98, 0x26BE, 0x1D48, 0x0762, 0x8DFF, 0x728B, 0x367F, 0x94A8,
+ 0x96A2, 0x16A4, 0x2598, 0x262C, 0x1A7C, 0x68AB, 0x263A, 0x0D7B, 0x4561, 0x1493, 0x095A, 0x789B,
+ 0x0FA8, 0x6D98, 0x1A66, 0x279C, 0x6EBE, 0x8EAC, 0x1E71, 0x3868, 0x687F, 0x246B, 0x6263, 0x277E,
+ 0x51BF, 0x2681, 0x0986, 0x16BB, 0x395E, 0x1936, 0x8185, 0x556E, 0x041E, 0x1D4B, 0x007B, 0x7B9D,
+ 0x17BF, 0x115A, 0x0C4E, 0x475D, 0x5B84, 0x17AF, 0x0210, 0x208D, 0x33BB, 0x0AB3, 0x6A75, 0x53A8,
+ 0x569D, 0x02FF, 0x4576, 0x59B6, 0x96A4, 0x2433, 0x0595, 0x5FA2, 0x66A7, 0x248B, 0x2387, 0x5FA9,
+ 0x5B72, 0x5C7C, 0x558B, 0x6781, 0x5578, 0x0295, 0x0132, 0x59B3, 0x689E, 0x2F53, 0x16A2, 0x44A4,
+ 0x74A1, 0x4546, 0x6376, 0x88A4, 0x192C, 0x2348, 0x326D, 0x606E, 0x0CAA, 0x6971, 0x28A4, 0x1724,
+ 0x19AD, 0x405B, 0x016C, 0x459D, 0x5E8A, 0x1FB1, 0x4CA6, 0x4D76, 0x4F50, 0x5C91, 0x2892, 0x3E4C,
+ 0x595E, 0x01B9, 0x07BE, 0x2B7B, 0x2F7F, 0x4686, 0x879C, 0x7DB9, 0x9EA8, 0x476C, 0x2BA9, 0x4687,
+ 0x407A, 0x0414, 0x41B5, 0x0FBD, 0x0129, 0x45B4, 0xA5BC, 0x3D55, 0x3697, 0x647E, 0x3943, 0x3237,
+ 0x5573, 0x7488, 0x1098, 0x10AA, 0x1A74, 0x1229, 0x5056, 0x144C, 0x5A6A, 0x759C, 0x2237, 0xA9AB,
+ 0x2461, 0x0674, 0x5061, 0x80B1, 0x1183, 0x4A74, 0x218F, 0x0DA1, 0x73A1, 0x85B4, 0x05AE, 0x345A,
+ 0x49AB, 0x3B6B, 0x5482, 0x789A, 0x3350, 0x1A24, 0x35B6, 0x5E63, 0x8FA5, 0x5E64, 0x3038, 0x1E20,
+ 0x0465, 0x3BB9, 0x2D7D, 0x4A54, 0x4186, 0x315E, 0xACAF, 0x6369, 0x4CAA, 0x1757, 0x5072, 0x1341,
+ 0x8DAD, 0x495F, 0x4E5A, 0x019E, 0x04A1, 0x15B4, 0x1C69, 0x0932, 0x25A9, 0x3F66, 0x0CB5, 0x3CA1,
+ 0x7AAA, 0x0156, 0x0447, 0x09A3, 0x119F, 0x114C, 0x37B3, 0x286D, 0x167A, 0x0F72, 0x1293, 0x7D90,
+ 0x5373, 0xADBE, 0x373E, 0x92FF, 0x71AF, 0x0BB8, 0x335C, 0x189D, 0x5A77, 0x2338, 0x9BA0, 0x4B75,
+ 0x6395, 0x3866, 0x3270, 0x0536, 0x7EAC, 0x0B49, 0x3882, 0x3536, 0x1E2A, 0x4870, 0x75BC, 0x1F35,
+ 0x0D4C, 0x0F8F, 0x0640, 0x34AB, 0x37BA, 0x3C97, 0x0E9B, 0x1054, 0x1DA7, 0x193A, 0x299C, 0x6472,
+ 0x4060, 0x84A6, 0x5090, 0x3459, 0x0698, 0x0180, 0x60AF, 0x6F80, 0x547F, 0x4EBA, 0x1B75, 0x4CB6,
+ 0x0373, 0x87A3, 0x0BAA, 0x3876, 0x0F25, 0x618E, 0x70A5, 0x0D16, 0x2D83, 0x3A71, 0x99AE, 0x3B61,
+ 0x0A87, 0x18A4, 0x88A5, 0x9FA2, 0x3034, 0x115D, 0x6BA2, 0x0B0F, 0x1BB1, 0x5A87, 0x055B, 0x27AB,
+ 0x1675, 0x2A46, 0x23B4, 0x369A, 0x4976, 0x1A8A, 0x3C82, 0x50BD, 0x2465, 0x0929, 0x98BC, 0x0860,
+ 0x376A, 0x737E, 0x349F, 0x2D93, 0x9698, 0x363C, 0x4DBC, 0x259E, 0x307A, 0x268C, 0x0B3E, 0x2D6F,
+ 0x4675, 0x3FBA, 0x35AD, 0x67AC, 0x2897, 0x0BB0, 0x1136, 0x2A30, 0x2B61, 0x1221, 0x0887, 0x5F9D,
+ 0x508D, 0x062E, 0x3C88, 0x60A5, 0x2682, 0x282B, 0x718E, 0x2BB1, 0x178C, 0x71A6, 0x2663, 0x7AB7,
+ 0x4399, 0x5574, 0x152F, 0x2B33, 0x107E, 0x506A, 0x2EBD, 0x5074, 0x0091, 0x04A7, 0x5BBE, 0x4E69,
+ 0x94A0, 0x1E72, 0x078A, 0x33A4, 0x23A2, 0x1149, 0x78BE, 0x1362, 0x1D36, 0x2AAA, 0x3498, 0x118F,
+ 0x0F21, 0x3B82, 0x15BE, 0x2F7B, 0x7B96, 0x6A82, 0x6F8C, 0x1421, 0x82A8, 0x64AD, 0x7281, 0x0023,
+ 0x1744, 0x6A80, 0x5FB5, 0x0A94, 0x08AC, 0x5C9E, 0x399A, 0x16B1, 0x5E6C, 0xA9B1, 0x1F90, 0x31B9,
+ 0x06FF, 0x3F83, 0x87B9, 0x2877, 0x8BA6, 0x486D, 0x0672, 0x0151, 0x5896, 0x1E8F, 0x7FA8, 0x67BF,
+ 0x299A, 0x005F, 0x49BA, 0x1063, 0x1727, 0x58A2, 0x1489, 0x16A5, 0x4C6E, 0x9CAF, 0x51AC, 0x61B2,
+ 0x2360, 0x436F, 0x48B6, 0x218D, 0x44A1, 0x859C, 0x25B4, 0x4DA6, 0x3D82, 0x89BC, 0x0642, 0x0356,
+ 0x0810, 0x2F6F, 0x9CB8, 0x6EA6, 0x669D, 0x699A, 0x1F8D, 0x949B, 0x0B11, 0x60BA, 0x55A5, 0x69AE,
+ 0x1784, 0x1930, 0x9FB0, 0x1227, 0x27BA, 0x2C85, 0x315C, 0x225D, 0x0A18, 0x0157, 0x426B, 0xABB1,
+ 0x4795, 0x2883, 0x2871, 0x7590, 0x198C, 0x2527, 0x08A4, 0x0439, 0x4C53, 0x4B5C, 0x86A2, 0x4BB4,
+ 0x536C, 0x5070, 0x0952, 0x2180, 0x103A, 0x6EBC, 0x1F89, 0x0881, 0x498B, 0x1E5C, 0x3267, 0x7274,
+ 0x2437, 0x90AE, 0x577C, 0x1F85, 0x0061, 0x095E, 0xA9AC, 0x728A, 0x239E, 0x8688, 0x407B, 0x1383,
+ 0x6E96, 0x22BB, 0x048D, 0x1899, 0x374A, 0x1D44, 0x71BE, 0x6173, 0x0693, 0x0C70, 0x4092, 0x1B5E,
+ 0x215B, 0x1137, 0x5678, 0x010B, 0x2788, 0x3074, 0x1439, 0x7BFF, 0x1780, 0x2A42, 0x8CB6, 0x299F,
+ 0x3C99, 0x62BC, 0x52B3, 0x406A, 0x5F7C, 0x0661, 0x5A70, 0x0A5C, 0x54A8, 0x329F, 0x1D77, 0x5B6C,
+ 0x2859, 0x1551, 0x4088, 0x8CA6, 0x5465, 0x01BE, 0x1F21, 0x4C73, 0x58BF, 0x2C76, 0x2FBC, 0x6594,
+ 0x3E95, 0x516A, 0x7CA0, 0x3792, 0x5CB5, 0x44BC, 0x3EAC, 0x6F71, 0x081E, 0x9EB3, 0x2EB1, 0x0FAB,
+ 0x9EAD, 0x274C, 0x5AB0, 0x49A5, 0x32B0, 0x94B1, 0x0213, 0x7DB4, 0x4F5D, 0x7175, 0x3E4D, 0x0735,
+ 0x3D86, 0x518B, 0x0CB4, 0x023D, 0x4D4F, 0x232E, 0x4373, 0x0D34, 0x50B1, 0x0427, 0x528F, 0x85AA,
+ 0xA8AE, 0x7286, 0x6D6F, 0x5B75, 0x72A3, 0x305C, 0x378B, 0x2379, 0x5793, 0x1165, 0x1839, 0x154D,
+ 0x5270, 0x769C, 0x80A5, 0x31AD, 0x2642, 0x107F, 0x0A7A, 0x0F11, 0x5E83, 0x075A, 0x13B6, 0xB4BD,
+ 0x6493, 0x2E42, 0x6DB7, 0x5990, 0x7585, 0x3C68, 0x3344, 0x88A0, 0x40BF, 0x8385, 0x6B92, 0x16A1,
+ 0x72A2, 0x69A8, 0x11A4, 0x6D99, 0x4691, 0x38A7, 0x1430, 0x85A5, 0x818F, 0x85B5, 0x5CB7, 0x6485,
+ 0x0D6F, 0x839C, 0x5789, 0x4F9C, 0x021C, 0x054A, 0x3D67, 0x1B2B, 0x5E86, 0x2C38, 0x1D71, 0x1B49,
+ 0x36BB, 0x5355, 0x57BD, 0x5585, 0x1D61, 0x768D, 0x226A, 0x3AA4, 0x2F6A, 0x1D37, 0x7B8A, 0x88B1,
+ 0x6F94, 0x056D, 0x0B86, 0x639A, 0x1029, 0x8C97, 0x6675, 0x0A2E, 0x9CA9, 0x12BD, 0x1B28, 0x29B4,
+ 0x3474, 0x94B9, 0x4FB9, 0x87BE, 0x0830, 0x0A83, 0x2376, 0x2C3B, 0x4FAF, 0x1295, 0x0E7B, 0x04B3,
+ 0x0617, 0x6278, 0x24A5, 0x6F86, 0x3743, 0x02AD, 0x5BA9, 0x0636, 0x0246, 0x5F77, 0x75B5, 0x0FBC,
+ 0x0D74, 0x2A9F, 0x6B75, 0x8AB4, 0x44B2, 0x2073, 0x1D45, 0x50AB, 0x0886, 0x797B, 0x5FA1, 0x3EB0,
+ 0x08B5, 0x0AA0, 0x60B9, 0x3543, 0x719D, 0x6885, 0x1979, 0x42A2, 0x0A2B, 0x02A4, 0x9A9C, 0x88FF,
+ 0x4765, 0x254C, 0x1631, 0x2370, 0x0DA9, 0x98BD, 0x9296, 0x2F8D, 0x95A8, 0x1020, 0x7397, 0x4579,
+ 0x2A5B, 0x80B0, 0x29BE, 0x0858, 0x9CBC, 0x2091, 0x2F9F, 0x0EB0, 0x0464, 0x98B8, 0x1C96, 0x43BC,
+ 0x8498, 0x99B3, 0x0442, 0x2F3D, 0x6E72, 0x4D5C, 0x3DBD, 0x1F4C, 0x0E6A, 0x4F75, 0x79FF, 0x0002,
+ 0x2B7D, 0x1556, 0xAFB6, 0x455F, 0x265A, 0x73A7, 0x6FA0, 0x151F, 0x0118, 0x2847, 0x0F3A, 0x314F,
+ 0x1EB1, 0x7E92, 0x2147, 0x3B46, 0x4D6D, 0x2CB1, 0x3345, 0x628C, 0x2E8A, 0x56A2, 0x626B, 0x73FF,
+ 0x50A9, 0x2575, 0x033E, 0x7377, 0x0745, 0x5BB1, 0x3257, 0x455E, 0x181E, 0x3082, 0x2B85, 0x5791,
+ 0x3CA6, 0x8AB7, 0x1530, 0x4D4E, 0x0D32, 0xB8BD, 0x4F56, 0x4A99, 0x2657, 0x2E68, 0x7CA8, 0x20A5,
+ 0x42BD, 0x2B88, 0x0E7A, 0x3CB8, 0x2D9C, 0x096B, 0x1B8A, 0x95A4, 0x4FAB, 0x0ABC, 0x77BB, 0x4F92,
+ 0x4398, 0x1829, 0x0BBD, 0x3079, 0x66BE, 0x1E5B, 0x3555, 0x65B6, 0x2D61, 0x197A, 0x6D93, 0x76B4,
+ 0x85BA, 0x2B80, 0x5E9F, 0x8994, 0x616A, 0x263E, 0x41AD, 0x2267, 0x4274, 0x45BB, 0x6795, 0x78B4,
+ 0x60A8, 0x7D97, 0x0A57, 0x5B6F, 0x132E, 0x3094, 0x1824, 0x4D6B, 0x50AD, 0x5776, 0x01B1, 0x6482,
+ 0x3B4E, 0x1578, 0x3A76, 0x3D6F, 0x3655, 0x00B8, 0xA5AD, 0x1927, 0x1752, 0x7D96, 0x3F69, 0x16AC,
+ 0x648B, 0x2C67, 0x2395, 0x1D30, 0x0F42, 0xB2B3, 0x0543, 0x0A56, 0x8494, 0x757A, 0x48B5, 0x4381,
+ 0x57A8, 0x2668, 0x8A91, 0x3B5E, 0x36AC, 0x2EA6, 0x4DA9, 0x1EA8, 0x626D, 0x7394, 0x737F, 0x123A,
+ 0x329D, 0x1E4D, 0x60FF, 0x1E5A, 0x5D80, 0x278F, 0x9FB8, 0x6AA9, 0x227A, 0x566A, 0x879D, 0x0A91,
+ 0x33B5, 0x3F89, 0x2A9E, 0x53B8, 0x8097, 0x35A4, 0x0844, 0x0193, 0x6192, 0x474A, 0x1964, 0x426A,
+ 0x4FA0, 0x4197, 0x41B3, 0x5760, 0x28BA, 0x54AA, 0x1C34, 0x62A3, 0x6694, 0x3A9E, 0x2664, 0x0B1B,
+ 0x6298, 0x2995, 0x76B0, 0x0565, 0x6071, 0x0477, 0x1941, 0x1069, 0x46AF, 0x10A6, 0x1028, 0x24BA,
+ 0x227B, 0x383A, 0x3AA8, 0x6E81, 0x2F33, 0x78A8, 0x65B2, 0x2F72, 0x6A79, 0xA3A4, 0x96FF, 0x162A,
+ 0x90A0, 0x2D95, 0x3B75, 0x6EA5, 0x044C, 0x4043, 0x83A3, 0x3542, 0x106E, 0x7A7C, 0x6C74, 0x3D7C,
+ 0x3CA9, 0x2183, 0x015F, 0x27A0, 0x3288, 0x93BF, 0x9DA0, 0x366A, 0x6B71, 0x5AA3, 0x8FB8, 0x1F94,
+ 0x2DAF, 0x435F, 0x29BB, 0x8B97, 0xB2B8, 0x95BD, 0x949A, 0x1997, 0x69A0, 0x2C2E, 0x499B, 0x9BB2,
+ 0x0A88, 0x3FA8, 0x62A1, 0x0D53, 0x2FA7, 0x919D, 0x4A7C, 0x1954, 0x1077, 0x184B, 0x3E81, 0x124F,
+ 0x79A7, 0x60B1, 0x2391, 0x2E41, 0x0E96, 0x82AE, 0x46A5, 0x1881, 0x0A37, 0x5572, 0x99B0, 0x2E3E,
+ 0x228F, 0x449B, 0x5DA4, 0x3C7B, 0x1968, 0x090A, 0x1A54, 0x228A, 0x28FF, 0x2E77, 0x2226, 0x28B1,
+ 0xB7BD, 0x0208, 0x5CBB, 0x1E8D, 0x258D, 0x269F, 0x309F, 0x385B, 0xA9B3, 0x629A, 0x6874, 0x1A4A,
+ 0x1528, 0x4D7B, 0x70AF, 0x7DA1, 0x69A4, 0x2235, 0x7B82, 0x2039, 0x30A4, 0xA6A7, 0x2EAB, 0x1879,
+ 0x3E8F, 0x67A5, 0x4177, 0x70BA, 0x0EB4, 0x4B68, 0x9196, 0x4E93, 0x93A3, 0xA7B7, 0x666C, 0x2C44,
+ 0x82A3, 0x1FB7, 0x0E46, 0x6EFF, 0x6099, 0x1F68, 0x3579, 0x1D5A, 0x0638, 0x8297, 0x1689, 0x0378,
+ 0x509E, 0x4C63, 0x02A2, 0x7AB9, 0xA8AC, 0x1554, 0x74A9, 0x6EAD, 0x6374, 0x7A8D, 0x2837, 0x2A77,
+ 0x1FA3, 0x2A31, 0x8A8D, 0x4EA2, 0x2C35, 0x2956, 0x3739, 0x1F72, 0x467D, 0x247E, 0x2224, 0x259D,
+ 0x448F, 0x4CB9, 0x4F81, 0x4165, 0x89B5, 0x579F, 0x5FA8, 0x0144, 0x0EBC, 0xA5A7, 0x398C, 0x7DB5,
+ 0x0D18, 0x3C6A, 0xACBE, 0x0F33, 0x6AB3, 0x2E5A, 0x14A4, 0x0053, 0x3AAF, 0x30BC, 0x008C, 0x106F,
+ 0x2184, 0x1D57, 0x525E, 0x3CA3, 0x0572, 0x53A5, 0x54A2, 0x3464, 0x156F, 0x5AAD, 0x42A9, 0x1A78,
+ 0x5D74, 0x104C, 0x61B1, 0x5FBA, 0x4EB5, 0x23B3, 0x1015, 0x5E87, 0x137E, 0x1E8C, 0x3C5D, 0x666B,
+ 0x82B1, 0x5A74, 0x002D, 0x0D1E, 0x318D, 0x6CB8, 0x6470, 0x5496, 0x4CB3, 0x001D, 0x0E26, 0x20AB,
+ 0x4B8C, 0x0462, 0x85BD, 0x101F, 0x1622, 0x0518, 0x7CB9, 0x3170, 0x12A7, 0x5A7C, 0x0ABF, 0x040D,
+ 0x3B45, 0x2A94, 0x0451, 0x0090, 0x888C, 0x29B5, 0x29A5, 0x2C75, 0x6C95, 0x0C73, 0x3B4F, 0x5784,
+ 0x2C6A, 0x0029, 0x8596, 0x9AB1, 0x49B1, 0xA6AC, 0xAEB0, 0x458E, 0x2070, 0x47A8, 0x3964, 0x2258,
+ 0x354F, 0x929F, 0x7AA3, 0x0484, 0x04AC, 0x95B3, 0x8096, 0x3D70, 0x0385, 0x1F57, 0x6B7B, 0x60A0,
+ 0x0482, 0x79AB, 0x0C89, 0x1068, 0x43B7, 0x36A8, 0x67A7, 0xABBE, 0x8A8F, 0x7BB4, 0x8CA2, 0x115F,
+ 0x2029, 0x38B1, 0xA8B9, 0x08B3, 0x1763, 0x10B7, 0x0845, 0x242C, 0x184D, 0x0E36, 0x1A48, 0x5587,
+ 0x3F7A, 0x259C, 0x9D9E, 0x4664, 0x2F68, 0x94B2, 0x1F43, 0x1F52, 0x345C, 0x46A7, 0x0C22, 0x06B8,
+ 0x2B54, 0x235C, 0x81B0, 0x0EAC, 0x0B5D, 0x98B2, 0x13BF, 0x1099, 0x116C, 0x108E, 0x2572, 0x3D96,
+ 0x38BA, 0x5490, 0x20AE, 0x2F8A, 0x164F, 0x3BA2, 0x128A, 0x1449, 0x1547, 0x8187, 0x2D44, 0x6DBD,
+ 0x898C, 0x639E, 0x5E77, 0x1572, 0xAFBF, 0x5068, 0x85AD, 0x82B4, 0x6390, 0x045E, 0x399B, 0x1B81,
+ 0x8BA3, 0x8DB3, 0x2C33, 0x56FF, 0x1366, 0x3D8E, 0x1C1F, 0x296F, 0x35BF, 0x0FAC, 0x091B, 0x2C72,
+ 0x284B, 0x050E, 0x46A2, 0x5E95, 0x1C86, 0x1A1E, 0x7C99, 0x27A3, 0x5B90, 0x0792, 0x7294, 0x6AA5,
+ 0x93B6, 0x45BF, 0x67BE, 0x8393, 0x94A6, 0x0C63, 0x585B, 0x11B0, 0x7BAC, 0x366F, 0x8CA1, 0x76AB,
+ 0xB2B4, 0x56BF, 0x3791, 0x0718, 0x0E9D, 0x7A81, 0x1190, 0x5C7F, 0x133B, 0x1DB2, 0x88B3, 0x80AC,
+ 0x52B9, 0x43A4, 0x8FAF, 0x3F57, 0x6EB2, 0x2455, 0x3F73, 0x616F, 0x1E21, 0x0370, 0x1950, 0x025F,
+ 0x18A9, 0x4B78, 0x47BE, 0x1351, 0x518F, 0x144D, 0x33BC, 0x2146, 0x0BAC, 0x2B57, 0x0741, 0x2596,
+ 0x7EBD, 0x164D, 0x3CA4, 0x2E6E, 0x4567, 0x11B3, 0x1437, 0x8AB5, 0x4063, 0x7176, 0x7B87, 0x1169,
+ 0x0F90, 0x008B, 0x044E, 0x286F, 0x71AE, 0x2052, 0xA6AD, 0x17B2, 0x029E, 0x2330, 0x7B7C, 0x59AA,
+ 0x6770, 0x1D98, 0x20B7, 0x598C, 0x3946, 0x0E17, 0x0694, 0x11BC, 0x648A, 0x6790, 0x094B, 0x282A,
+ 0x194A, 0x16A9, 0x5CB9, 0x40BD, 0x1579, 0x6BB3, 0x589C, 0x6E89, 0x6D88, 0x73BF, 0x2C36, 0x7282,
+ 0x4365, 0x3064, 0x3595, 0x4EBC, 0xACB9, 0x7C81, 0x849C, 0x0E15, 0x6DA5, 0x828A, 0x0B4F, 0x2C9B,
+ 0x1A3F, 0x0A43, 0x2B4D, 0xA5B8, 0x43AE, 0x6691, 0x1479, 0x1BB0, 0x0355, 0x3A88, 0x264B, 0x466E,
+ 0x51BE, 0xA4AD, 0x0E60, 0x61AB, 0x3779, 0x0997, 0x1F58, 0x8A93, 0x0D89, 0x5F94, 0x58FF, 0x5D9F,
+ 0x2388, 0x1CAC, 0x98B5, 0x2E9E, 0x060A, 0x1E26, 0x1836, 0x7EAD, 0x6793, 0x5363, 0x3A67, 0x1270,
+ 0x76B5, 0x136A, 0x15BF, 0x4CA9, 0xB5B7, 0x708E, 0x273F, 0x2684, 0x0469, 0x6572, 0x547A, 0x9EBE,
+ 0x1D2A, 0x2992, 0x3F62, 0x9ABD, 0x82B5, 0x9CBD, 0x1291, 0x1A8B, 0x97A6, 0x098F, 0x4771, 0x4EB9,
+ 0x2C7A, 0x5C7E, 0x45A7, 0x6A7B, 0x3C50, 0x05AA, 0x4498, 0x1833, 0x9EA6, 0x5277, 0x33FF, 0x0DB0,
+ 0x8D9D, 0x66B9, 0x0F6C, 0x5B85, 0x43FF, 0x23BF, 0x1B7B, 0x2476, 0x2229, 0x2AFF, 0x143C, 0x121F,
+ 0x0227, 0x596D, 0x03B3, 0x4DAD, 0x146A, 0x3989, 0x3F52, 0x24B7, 0x83A4, 0x84AD, 0x213D, 0x5DAC,
+ 0x95AE, 0x2B47, 0x0B7C, 0x25AD, 0x6089, 0x3E9B, 0x96A1, 0x1289, 0x0438, 0xA5B2, 0x0C2D, 0x0B19,
+ 0x373C, 0x38AF, 0x3CAF, 0x4564, 0x7C8E, 0x76A1, 0x0299, 0x568A, 0x93B7, 0x2838, 0x77B3, 0x49A8,
+ 0x9092, 0x043D, 0x09BE, 0x9DA3, 0x2C69, 0x119E, 0x5A80, 0x02B4, 0x7376, 0x3239, 0x6E9F, 0x0C72,
+ 0x3D6A, 0x4599, 0x2740, 0x58B4, 0x3C84, 0x2A3D, 0x0286, 0x0A9C, 0x4DFF, 0x30B1, 0x4AB9, 0x1A2F,
+ 0x6776, 0x32AE, 0x2274, 0x3764, 0x2733, 0x5B99, 0x83B5, 0x53BD, 0xB0B4, 0x46B8, 0x1442, 0x020C,
+ 0xA2B4, 0x46B4, 0x767A, 0x7E85, 0x196F, 0x0D8F, 0x26B8, 0x0382, 0xACB5, 0x2676, 0x5F9A, 0x0FB3,
+ 0x043A, 0x1041, 0x509B, 0x118E, 0x2997, 0x3F4B, 0x7E97, 0x13B4, 0x4471, 0x235B, 0x4A5E, 0x78A0,
+ 0x2840, 0x2081, 0x3860, 0x1284, 0x18AA, 0x626F, 0x3657, 0x193E, 0x1AFF, 0x9DAA, 0x159E, 0x7DB1,
+ 0x3F8F, 0x0C9E, 0x29A2, 0x5194, 0x2CAA, 0xA0B9, 0x5D69, 0x3B56, 0x4DA1, 0x0334, 0x37A0, 0x627A,
+ 0xB5BB, 0x44A5, 0x4D5D, 0x071D, 0x111B, 0x2C83, 0x4956, 0x6084, 0x5D68, 0x5356, 0x298F, 0x59BA,
+ 0x327E, 0x10BF, 0x5C73, 0x4196, 0x0F7F, 0x7FB3, 0x1F9A, 0x6BBD, 0x1D1F, 0x0915, 0x0109, 0x0F8D,
+ 0x2173, 0x40A2, 0x94A5, 0x0058, 0xA8AB, 0xA6AA, 0x21A8, 0x6087, 0x8FA2, 0x7677, 0x2CB7, 0x5463,
+ 0x2C4B, 0x23FF, 0x2950, 0x3594, 0x6FFF, 0x2951, 0x4281, 0x1344, 0x4F58, 0x31B5, 0x4F68, 0x1219,
+ 0x1D3C, 0x4F78, 0x1D47, 0x559F, 0x5C9A, 0x8CB1, 0x71B5, 0x7CA6, 0x153C, 0x3F6F, 0x1C90, 0x032E,
+ 0x8AA7, 0x4F6E, 0x3958, 0x1B53, 0x1C40, 0x08B4, 0x177F, 0x2B2D, 0x6974, 0x5EBD, 0x5F7D, 0x60B3,
+ 0x61A9, 0x7FAF, 0x37AC, 0x3859, 0x4BBB, 0x1226, 0x1C8B, 0x4E89, 0x374D, 0x5DA8, 0x1656, 0x1866,
+ 0x037A, 0x205D, 0x6C90, 0x1CA7, 0x2C6B, 0x2F5E, 0x5C8C, 0x409A, 0x3CAB, 0x7FBB, 0x0C4F, 0x0317,
+ 0x3EA1, 0x1E52, 0xA6BD, 0x99AA, 0x2930, 0x3357, 0x31BE, 0x55B2, 0x578A, 0x6BB1, 0x9BAA, 0x258F,
+ 0x559E, 0x57B5, 0x7CA7, 0x515D, 0x6B74, 0xA1BC, 0x1296, 0x0222, 0x498F, 0x225A, 0x22BE, 0x5D8E,
+ 0x1537, 0x4350, 0x439B, 0x3664, 0x0C83, 0x5361, 0x29AC, 0x005C, 0x5183, 0x6A86, 0x297A, 0x216F,
+ 0x222B, 0x91A1, 0x479D, 0x4EA7, 0x2751, 0x6061, 0x67A4, 0x9295, 0x0972, 0x2F79, 0x7ABE, 0x2088,
+ 0x526D, 0x2F92, 0x509C, 0x3294, 0x40A8, 0x07A0, 0x3C93, 0xBDBE, 0x2B94, 0x5C66, 0x2374, 0x073A,
+ 0x4B4E, 0x646F, 0x248F, 0x0A89, 0x5F9F, 0x5AB8, 0x81A3, 0x50B5, 0x147D, 0x0406, 0x5EB4, 0x5F8C,
+ 0x4042, 0x3B9E, 0x6EB9, 0x2547, 0x3E6C, 0x0C7F, 0x091F, 0x30B8, 0x8197, 0x1277, 0x6DBF, 0x3A4A,
+ 0x3241, 0x299E, 0x8284, 0x0652, 0x2A52, 0x949D, 0x8698, 0x1D40, 0x89B9, 0x0BAB, 0x7583, 0x0856,
+ 0x3FAD, 0x4056, 0x20B5, 0x5F87, 0x0C67, 0x1EA9, 0x4EB7, 0x334F, 0x4E65, 0x568B, 0x42B4, 0x507D,
+ 0x03A8, 0x083D, 0x2535, 0x1F9E, 0x8BBF, 0x80AB, 0x0433, 0x0D9B, 0x8DA2, 0x5B81, 0x707F, 0x0178,
+ 0x3DBF, 0x1649, 0x5F9C, 0x028D, 0x60A4, 0x6978, 0x779A, 0x1373, 0x5D8C, 0x4794, 0x1522, 0x2539,
+ 0x123F, 0x759A, 0x99BF, 0x04BF, 0x061F, 0x0D60, 0x04AA, 0x8289, 0x7A98, 0x4F67, 0x6267, 0x6892,
+ 0x4E81, 0x4E5F, 0x809C, 0x169B, 0x101D, 0x347F, 0x889F, 0x4058, 0x28A6, 0x5A7A, 0x2A3A, 0x1D97,
+ 0x0F12, 0x0247, 0x2C9E, 0x0166, 0x05A3, 0x2490, 0x3142, 0x0148, 0x1F48, 0x5556, 0x1BB8, 0x6A8F,
+ 0x549E, 0x2A5C, 0x7BAB, 0x5C8D, 0x7D8E, 0x094D, 0x0AAB, 0x2D76, 0x727C, 0x9BBA, 0x3473, 0x5172,
+ 0x2BBB, 0x67BB, 0x328E, 0x488C, 0x7C96, 0x285C, 0x2178, 0x74A0, 0x4CA1, 0x0641, 0x6FBB, 0x4A7D,
+ 0x3738, 0xB9FF, 0x5163, 0x637C, 0x1940, 0x053C, 0x9DB5, 0x212B, 0x0E3F, 0x19A7, 0x1890, 0x47A5,
+ 0x739C, 0xB2BB, 0x607D, 0x0A5E, 0x0BBE, 0x3053, 0x4991, 0x28B6, 0x010D, 0x4354, 0x5472, 0x294C,
+ 0x1179, 0x3FBD, 0x70BE, 0x50A2, 0x495D, 0x2442, 0x739F, 0xAFB9, 0x5A63, 0x2E39, 0x266A, 0x36A4,
+ 0x2257, 0x35A3, 0xB1B9, 0x71B9, 0x3E6A, 0x4F9B, 0x4171, 0x0734, 0x0A73, 0x4BAA, 0x6699, 0x013D,
+ 0x0D3D, 0x94AF, 0x3C92, 0x003F, 0x2170, 0x5DB0, 0x7997, 0x61A5, 0x031E, 0x18AC, 0x6B80, 0x2A70,
+ 0x709C, 0xA6BE, 0x3B3C, 0x7089, 0x1DB1, 0x2C6F, 0x022D, 0x0726, 0x9FAE, 0x4188, 0x345E, 0x5DAB,
+ 0x6E70, 0x78A4, 0x6CB2, 0x6893, 0x2A7B, 0x0D2A, 0x3537, 0x4C99, 0x0D62, 0x2793, 0x0A29, 0x4959,
+ 0x8AA8, 0x192B, 0x9495, 0x2CA4, 0x06B1, 0x4774, 0x0022, 0x435E, 0x4E95, 0x2588, 0x4288, 0x3BB2,
+ 0x1E9C, 0x70B7, 0x8997, 0x2B8E, 0x41AF, 0x1A9D, 0x1755, 0x5BB2, 0x3672, 0x7782, 0x3971, 0x7487,
+ 0x1497, 0x4A92, 0x70AA, 0x4297, 0x22A4, 0x92BF, 0x9498, 0x13FF, 0x7E8C, 0x0719, 0x68AC, 0x4669,
+ 0x4490, 0x1191, 0x0194, 0x11AA, 0x2576, 0x137C, 0x2730, 0x207B, 0x5181, 0x0646, 0x5D8D, 0x3A3D,
+ 0x0048, 0x262F, 0x1D5C, 0x545D, 0x83A5, 0x0EBD, 0x17A8, 0x0E64, 0x0A81, 0x1139, 0x0FB8, 0xA9BE,
+ 0x797A, 0x0AA2, 0x59BF, 0xB1BE, 0x4B50, 0x559A, 0x1BA2, 0x5382, 0x7B8F, 0x2578, 0x3F9C, 0x378F,
+ 0x3D9D, 0x76BA, 0x2E48, 0x274B, 0x3D44, 0x2D60, 0x2B31, 0x3FAB, 0xADB2, 0x589D, 0x27A9, 0x2976,
+ 0x3353, 0x1398, 0x0B90, 0xA2BA, 0x74AF, 0x1286, 0x4E79, 0x4792, 0x28B4, 0x4C72, 0x1E67, 0x39B4,
+ 0x4192, 0x3D58, 0x72A9, 0x2F95, 0x2E94, 0x3E7B, 0x1CA5, 0x3692, 0x1498, 0x318C, 0x4D5B, 0x155E,
+ 0x117E, 0x1374, 0x78BA, 0x0167, 0x5185, 0x78AE, 0x6C72, 0x4E57, 0x25BB, 0x648F, 0x9EBC, 0x08B8,
+ 0x1265, 0x44A7, 0x012B, 0x25B7, 0x7B86, 0x98B1, 0x508B, 0x8F91, 0x243F, 0x2B73, 0x2232, 0x8A90,
+ 0x2E95, 0x83B7, 0x14A1, 0x3CAE, 0x163E, 0xB6BC, 0x1E81, 0x1E65, 0x54B7, 0x7198, 0x061C, 0x0A9D,
+ 0x8793, 0x4D93, 0x386F, 0x2B3D, 0x0EA5, 0x383B, 0x3055, 0x2FB8, 0x26B4, 0x415E, 0x7689, 0x91FF,
+ 0x78BC, 0x269B, 0x2AA5, 0x434D, 0x51B7, 0x5ABC, 0x8689, 0x09AD, 0x2373, 0x24A3, 0x32B8, 0x1743,
+ 0x41A4, 0xABBB, 0x0314, 0x4563, 0x7FA3, 0x159A, 0x5CBF, 0x6AB4, 0x1B35, 0xB7BC, 0x4558, 0x436B,
+ 0x011B, 0x032C, 0x79B2, 0x6F88, 0x3065, 0x1922, 0x013C, 0x59B1, 0x3E45, 0x1274, 0x7D9B, 0x363A,
+ 0x5768, 0x6C7C, 0x33BD, 0x2F4E, 0x6D8D, 0x041B, 0x0EA8, 0x628E, 0x3E85, 0x0B58, 0x819B, 0x2425,
+ 0x0007, 0x1C58, 0x4670, 0x0C62, 0x4FBB, 0x1189, 0x1A27, 0x216B, 0x486E, 0x06A1, 0x32B7, 0x1D8C,
+ 0x1181, 0x5389, 0x3B87, 0x5D83, 0x7479, 0x069F, 0x3269, 0x5876, 0x1266, 0x95A0, 0x5D75, 0x6576,
+ 0x0DB7, 0x1696, 0x000D, 0x2CBD, 0x2F8F, 0x7496, 0x0612, 0x1592, 0x5B9D, 0x84B6, 0x77AB, 0x5F99,
+ 0x198B, 0x14B7, 0x2479, 0x289F, 0x689F, 0x358A, 0x34FF, 0x208B, 0x2A2C, 0x7F91, 0x070D, 0x29BD,
+ 0x29BF, 0x074B, 0x005E, 0x1654, 0x063A, 0x32B5, 0x58BB, 0x8AAC, 0x105A, 0x03AB, 0x1E78, 0x01A3,
+ 0x6477, 0x657C, 0x2AA7, 0x3E44, 0x1158, 0x899D, 0x0024, 0x9298, 0x1D9D, 0x43B3, 0x3D4F, 0x0DBD,
+ 0x38AD, 0x1788, 0x131F, 0x1246, 0xACB0, 0x7891, 0x4B8A, 0x016B, 0x788C, 0x2398, 0x4973, 0x98B3,
+ 0x5D72, 0x0A31, 0x64BC, 0x2F89, 0x0C34, 0x4E74, 0x61A3, 0x6166, 0x62AE, 0x239C, 0x27BC, 0x2242,
+ 0x83BC, 0x109C, 0x1F6B, 0x369C, 0x0785, 0x5897, 0x7485, 0x274F, 0x8FAC, 0x497A, 0x358D, 0x3438,
+ 0x2753, 0x72B7, 0x848B, 0x4F85, 0x5DA9, 0x497D, 0x4677, 0x3941, 0x4BB5, 0x4581, 0x36BE, 0x6474,
+ 0x4B89, 0x2E4C, 0x4CA7, 0x84B4, 0x0AB1, 0x2E56, 0x0C6B, 0x8FBD, 0x20B4, 0x3B86, 0x0F77, 0x178B,
+ 0x71BA, 0x2659, 0xBFFF, 0x4897, 0x4565, 0x5179, 0x2145, 0x4AB5, 0x3F95, 0x83A0, 0x6BB9, 0x9BA7,
+ 0x3E78, 0x579E, 0x0025, 0x3A66, 0x235A, 0x3940, 0x3C7C, 0x30BA, 0x2584, 0x0A7B, 0x0580, 0x79A3,
+ 0x2F96, 0x3C94, 0x3E88, 0x1F7D, 0x449E, 0x0268, 0x4AA8, 0x03B6, 0x0E3A, 0x397D, 0x95AC, 0x5261,
+ 0x2767, 0x1223, 0x7CBE, 0x3CAC, 0x1F61, 0x536F, 0x4DB4, 0x2853, 0x4793, 0x5ABA, 0x3D46, 0x469F,
+ 0x76AF, 0x2268, 0x2652, 0x3782, 0x4E71, 0x6467, 0x209B, 0xA7AE, 0x2035, 0x00FF, 0x2863, 0x1491,
+ 0x2A35, 0x3A6B, 0x3B7D, 0x63A1, 0x6C96, 0x32AD, 0x5C61, 0x5976, 0x073E, 0x5B60, 0x157A, 0x3889,
+ 0x4C95, 0x7881, 0x3A8A, 0x5F65, 0x3436, 0x5DB9, 0x6BA0, 0x85B2, 0x5054, 0x638D, 0x2858, 0x52AA,
+ 0x94B6, 0x276A, 0x2854, 0x066E, 0x0725, 0x319D, 0x4555, 0x0A42, 0x67B0, 0x1B8E, 0x9AB5, 0x7C9E,
+ 0x3F4D, 0x398F, 0x1794, 0x051D, 0x1E44, 0x0D1B, 0x22AB, 0x4559, 0x0653, 0x1CAE, 0x39B0, 0x0238,
+ 0x02B6, 0x9BAB, 0x1D3E, 0x5AB3, 0x80B7, 0x2CAF, 0x40B5, 0x2F7C, 0x2C74, 0x51B8, 0x55AD, 0x132D,
+ 0x5CB8, 0x082E, 0x3786, 0x24B3, 0xA9B4, 0x587C, 0x0C51, 0x3150, 0x1D46, 0xAABA, 0x0EA6, 0x51A0,
+ 0xA0AC, 0x3F40, 0x074F, 0x4372, 0x38BC, 0xA4B6, 0x3BA1, 0x2665, 0x0174, 0x76A5, 0x11BE, 0x3189,
+ 0x3F42, 0x84BB, 0x98A3, 0x028B, 0x87A7, 0x2D2E, 0x0748, 0x4287, 0x50A7, 0x42BA, 0x46B2, 0x2195,
+ 0x8E92, 0x92BE, 0x0231, 0x81A7, 0xA4AE, 0x00BE, 0x1849, 0x1E50, 0x516F, 0x0BA9, 0x3450, 0x4053,
+ 0x0318, 0x28B3, 0x2680, 0x0783, 0xB0B3, 0x0154, 0x3945, 0x2128, 0x71A5, 0x268F, 0x2094, 0x039B,
+ 0x839B, 0x97B3, 0x3DA8, 0x83A9, 0x596E, 0xA3B9, 0xB0B8, 0x0730, 0x3656, 0x1314, 0x5B73, 0x1147,
+ 0x1A8D, 0x115E, 0x0E97, 0x2276, 0x0DA0, 0x6D76, 0x1889, 0x419F, 0x016F, 0x8EB0, 0x0628, 0x3DA3,
+ 0x0163, 0x199B, 0x3574, 0x222E, 0x029B, 0x0D55, 0x396F, 0x4EA6, 0xA9BB, 0x3C78, 0x318B, 0x1F28,
+ 0x889D, 0x0682, 0x2C95, 0x4C51, 0x357F, 0x3DBA, 0x516B, 0x52A3, 0x81B1, 0x1032, 0x099B, 0x069B,
+ 0x086D, 0x1520, 0x636A, 0x0993, 0x338B, 0x0A75, 0x034D, 0x4B63, 0x2028, 0x0FAD, 0x3DB8, 0x23B8,
+ 0x325D, 0x148B, 0x107A, 0x0102, 0x066F, 0x5A92, 0x0AA4, 0x3437, 0x171B, 0x7CA1, 0xA2AF, 0x1E3A,
+ 0x1297, 0x3489, 0x3F77, 0x444B, 0x6B70, 0x388B, 0x81A2, 0x418F, 0x0753, 0x7172, 0x34A9, 0x4481,
+ 0x3968, 0x7CBD, 0x5059, 0x5E69, 0x64A5, 0x789C, 0x3D6D, 0x0D9D, 0x2285, 0x6188, 0x3389, 0x5362,
+ 0x0030, 0x6EBD, 0x658F, 0x4B5B, 0x4668, 0x0759, 0x91A5, 0x4869, 0x5D7F, 0x8ABD, 0x8BBB, 0x0F7C,
+ 0x173E, 0x272E, 0x0428, 0x10AE, 0x4FFF, 0x227E, 0x0152, 0x7CB3, 0x36B2, 0x0312, 0x2DB0, 0x0EBA,
+ 0x1089, 0x2FA4, 0x1571, 0x2EA0, 0x8BAB, 0x5BB8, 0x386D, 0x126B, 0x8499, 0x9ABE, 0x56B1, 0x3A5B,
+ 0x86A4, 0x3485, 0x4C68, 0x254E, 0x1C4E, 0x999B, 0x6A9F, 0x357B, 0x0375, 0x16AA, 0x87A8, 0x868D,
+ 0x2333, 0x54B5, 0x0C8D, 0x0941, 0x044F, 0x34BD, 0x4982, 0x719A, 0x07A1, 0x26BB, 0x2434, 0x3C69,
+ 0x3040, 0x3046, 0x358F, 0x357C, 0x9EA9, 0x105B, 0x799D, 0x062F, 0x42B9, 0xB5FF, 0x4B85, 0x7DBE,
+ 0x384C, 0x85A9, 0x242F, 0x758F, 0x66B2, 0x2C56, 0x33B3, 0x1542, 0x3136, 0x0B7F, 0xA0A9, 0x4B4C,
+ 0x1287, 0x055F, 0x0363, 0x62B9, 0x2C52, 0x3C51, 0x1A28, 0x709F, 0x0A1A, 0x7AB2, 0x287D, 0x2B6F,
+ 0x0393, 0x0D88, 0x1490, 0x9B9F, 0x2764, 0x3862, 0x1C27, 0x385A, 0x5F88, 0x47B1, 0x1DBA, 0x07A8,
+ 0x2B7A, 0x4F76, 0x4174, 0x38A3, 0x1750, 0x5891, 0x296E, 0x7F84, 0x1D8A, 0x9CAA, 0x1C8C, 0x3BAD,
+ 0x515E, 0x1B59, 0x1F2A, 0x7BA0, 0x1A9C, 0x3C4A, 0x2E38, 0x525C, 0x8C94, 0x96A3, 0x2D90, 0x0925,
+ 0x4F99, 0x1E69, 0x2656, 0x8ABC, 0x4380, 0x0F26, 0x597C, 0x7791, 0x83B3, 0x0137, 0x1245, 0x2E5E,
+ 0x2F8C, 0x9699, 0x4C4E, 0x1052, 0x0999, 0x5B96, 0x15A0, 0x124E, 0x1039, 0x2534, 0x2F45, 0x6392,
+ 0x3591, 0x0336, 0xA7BA, 0x8DB4, 0x2143, 0x3DBC, 0x091E, 0x6787, 0x3588, 0x3D93, 0x4647, 0x264E,
+ 0x2879, 0x86AC, 0x5076, 0x0988, 0x98AB, 0x4385, 0x1061, 0x3A9A, 0x3C80, 0x1F23, 0x278A, 0x1D4E,
+ 0x05BF, 0x64B2, 0x1F87, 0x5DAA, 0x6293, 0x2B5C, 0x57AD, 0x4E90, 0x141F, 0x81B5, 0x8F92, 0x65B8,
+ 0x31B0, 0x00A2, 0x364B, 0x2F58, 0x6CFF, 0x3057, 0x0CAC, 0x2494, 0x4981, 0x4C81, 0x8CA9, 0x439D,
+ 0x1534, 0x0A59, 0x2BB0, 0x1049, 0x0B54, 0x1D63, 0x2B82, 0x20BF, 0x327A, 0x92AC, 0x1359, 0x1128,
+ 0x4167, 0x9DBC, 0x335E, 0x090B, 0x13BA, 0x8C9C, 0x4F87, 0x0591, 0x90BD, 0x1A55, 0x52A4, 0x797D,
+ 0x2B67, 0x7781, 0x7B93, 0xB4B8, 0x2748, 0x4C7A, 0x1C80, 0x6768, 0x3B5A, 0x0FA6, 0x224F, 0x4954,
+ 0x1E47, 0x1453, 0x3870, 0x2EA7, 0x2644, 0x2061, 0x0275, 0x366B, 0x0E35, 0x2D4F, 0x9192, 0x0B62,
+ 0xA7BB, 0x4B9B, 0x08AE, 0x3950, 0x1D25, 0x9299, 0x19A1, 0x0C4A, 0x6086, 0x0BA4, 0x1F95, 0x4375,
+ 0x0A63, 0x026A, 0x4DB5, 0x61A2, 0x112C, 0x0E2E, 0x525D, 0x2F74, 0x5199, 0x1FB4, 0x63B7, 0x4093,
+ 0x8287, 0x1A45, 0x051E, 0x8298, 0x355F, 0x419C, 0x3E7A, 0x1550, 0x2127, 0x2D4E, 0x117F, 0x5F93,
+ 0x2770, 0x021E, 0x0D81, 0x172C, 0xA4B4, 0x379B, 0x0510, 0x1768, 0x0728, 0x1854, 0x0D3A, 0x142D,
+ 0x215F, 0x689B, 0x41BA, 0x394F, 0x0C93, 0x1A2D, 0xBCBE, 0x0827, 0x919B, 0x3076, 0x7187, 0x2A79,
+ 0x9CB9, 0x375D, 0x0EAF, 0x0D0E, 0x0EB5, 0x9CB5, 0xACB1, 0x0E63, 0x0771, 0x768C, 0x3C5C, 0x4775,
+ 0x5586, 0x0E34, 0x889B, 0x2CA1, 0x5864, 0x9FA6, 0x8E9B, 0x0E99, 0x5975, 0x5A75, 0x8F97, 0x1EA7,
+ 0x187A, 0x61AA, 0x1086, 0x166C, 0x0B3F, 0x46BD, 0x29AD, 0x0C74, 0x429F, 0x186E, 0x5491, 0x3293,
+ 0x5A9A, 0x7986, 0x0C96, 0x068E, 0x32B4, 0x1669, 0x5178, 0x4951, 0x99B2, 0x089C, 0x46A0, 0x002C,
+ 0x364D, 0x129F, 0x4782, 0xA0A1, 0x7A9F, 0x3C55, 0x1942, 0x424E, 0x1771, 0x4D8A, 0x8ABB, 0x5DA6,
+ 0x0181, 0x50BA, 0x048E, 0x93BE, 0x015E, 0x2B84, 0x4B8F, 0x1045, 0x2296, 0x1478, 0x467C, 0x3165,
+ 0x418C, 0xA0AE, 0x34AE, 0x27B8, 0x3060, 0x0344, 0x314A, 0x0822, 0x134D, 0xA0FF, 0x424B, 0x149E,
+ 0xA5B3, 0x0926, 0x0E38, 0x4F77, 0x7E94, 0x5A5E, 0x0F5D, 0x6873, 0x1E66, 0x3440, 0x3A57, 0x2960,
+ 0x86B1, 0xADBD, 0x3137, 0x34B9, 0x3D9F, 0x19A0, 0x2365, 0x1EB6, 0x0165, 0x98A4, 0x63B5, 0x25AC,
+ 0x7180, 0x4868, 0x2B4E, 0x2B5B, 0x00BD, 0x40BE, 0x737B, 0x2563, 0x1D7F, 0x6773, 0x0187, 0x58BA,
+ 0x031A, 0x3665, 0x6784, 0x4B58, 0x72A6, 0x2E7D, 0x4346, 0x62A9, 0x43B9, 0x02A7, 0x0B6B, 0x32BE,
+ 0x39B7, 0x343C, 0x26AD, 0x8E9C, 0x418B, 0x5C64, 0x7AA5, 0x5A69, 0x176B, 0x457A, 0x338D, 0x609D,
+ 0x4459, 0x919E, 0x486B, 0x9B9E, 0x0F84, 0x5A9C, 0x334C, 0x001F, 0x8990, 0xA1B4, 0x83AA, 0x699F,
+ 0x1EB7, 0x7287, 0x91AE, 0x4892, 0x3DB4, 0xB6B7, 0x67B8, 0x1958, 0x169C, 0x56AB, 0x4C93, 0x155C,
+ 0x2D40, 0x9EB8, 0x5657, 0x9DBB, 0x1C44, 0x8D93, 0x8DA0, 0x6C9A, 0x0686, 0x79B6, 0x7797, 0x0C75,
+ 0x484F, 0x90B5, 0x54FF, 0x4F91, 0x3F94, 0x5461, 0x8B9D, 0x6FA8, 0x03A5, 0x1871, 0x89BB, 0x477D,
+ 0x122A, 0x1EB8, 0x1E80, 0x0C43, 0x474D, 0xA2A4, 0x7EB9, 0x0F4B, 0x99BE, 0x7796, 0x3B95, 0x1E93,
+ 0x5A95, 0x08A1, 0x5892, 0x5173, 0x1E3D, 0x2C7B, 0x030C, 0x88AB, 0x0A12, 0x0BBA, 0x3363, 0x0834,
+ 0x3FBF, 0x0980, 0x26A7, 0x18A6, 0x3251, 0x307E, 0x4B56, 0x5B9C, 0x37A5, 0x4166, 0x2C45, 0x0D3B,
+ 0x0523, 0x7EA6, 0x1425, 0x022F, 0x2DA9, 0x9DA4, 0x37B6, 0x4BAC, 0x618C, 0x09AF, 0x3144, 0x4886,
+ 0x042A, 0x0B53, 0x0A48, 0x3666, 0x3476, 0x0C3F, 0x13AC, 0x48A5, 0x1C50, 0x45B3, 0x5F71, 0x1F33,
+ 0x21B7, 0x546F, 0x2887, 0x70A0, 0x97B5, 0x15B6, 0x0033, 0x93BD, 0x5660, 0x09A5, 0x2757, 0x0B73,
+ 0x4784, 0x2BB3, 0x1D38, 0x8290, 0x3A62, 0xA5B1, 0x5C86, 0xA7AF, 0x6E80, 0x0C5F, 0x8091, 0x0F9A,
+ 0x0584, 0x0716, 0xAFB4, 0x93AB, 0x2BBF, 0x0217, 0x505D, 0x8FBC, 0x92BC, 0x3966, 0x0256, 0x6E7A,
+ 0x3480, 0x3CA0, 0x6571, 0x6798, 0x2B40, 0x3198, 0x4360, 0x7DBA, 0x0A14, 0x395D, 0x1035, 0x01B2,
+ 0x0A65, 0x256C, 0x58A7, 0x2358, 0x3C5E, 0x3EAB, 0x74A6, 0x26AC, 0x2248, 0x367A, 0x0150, 0x0F46,
+ 0x51A5, 0x0387, 0x049B, 0x1C65, 0x179E, 0x1970, 0x04B9, 0x5965, 0x70A1, 0x5792, 0x92B7, 0x4F93,
+ 0x0EA1, 0x0789, 0xA6B6, 0x0525, 0x3CA2, 0x696A, 0x1C6C, 0x2F65, 0x98BF, 0x69B9, 0x035E, 0x2BAB,
+ 0x8799, 0x1B4E, 0x9DB7, 0x539D, 0xA4BE, 0x183C, 0x648D, 0x006E, 0x23BE, 0x7CA9, 0x4EA8, 0x4491,
+ 0x4C55, 0x349B, 0x013F, 0x4F94, 0x6062, 0x829E, 0x0ABB, 0x557A, 0x1DA4, 0x3952, 0x080D, 0x71B1,
+ 0x3185, 0x6271, 0x099C, 0x05B1, 0x406F, 0x7B95, 0x1235, 0x576D, 0x9B9C, 0x4075, 0x5772, 0x2431,
+ 0x4BA0, 0x153D, 0x3986, 0x55A0, 0x053B, 0x2953, 0x2A91, 0x183F, 0x4D66, 0x45AB, 0x2765, 0x139D,
+ 0x449D, 0x353F, 0x2636, 0x0C29, 0x2A54, 0x6684, 0x5697, 0x4969, 0x7998, 0x369D, 0x2D5A, 0x1994,
+ 0x00BF, 0x0381, 0x197B, 0x51AF, 0xA6B3, 0x8194, 0x3578, 0x0D72, 0xA7A9, 0x2D96, 0x598F, 0xA8B6,
+ 0x289C, 0x1213, 0x10B9, 0x98A5, 0x5D96, 0x288A, 0x6170, 0x74B4, 0x559C, 0x15BC, 0x1319, 0x1995,
+ 0x3249, 0x76AC, 0x72BA, 0x8089, 0x3D87, 0x3660, 0x4E56, 0x6B86, 0x71A2, 0x58B3, 0x7D98, 0x4A64,
+ 0x1333, 0x436A, 0x92B1, 0x808B, 0x5063, 0x158E, 0x3387, 0x2194, 0x5AA6, 0x5F6A, 0x4D90, 0x3F6A,
+ 0x3580, 0x288B, 0x0D73, 0x272A, 0x0F23, 0x0F55, 0x4D68, 0x7CB7, 0x0D17, 0x4E7D, 0x4276, 0x6AA1,
+ 0x4D62, 0x0F95, 0x1872, 0x0D5E, 0x6667, 0x24A4, 0x3E46, 0x6ABA, 0x4758, 0x4D8C, 0x0D97, 0x3EBE,
+ 0x6B93, 0x126C, 0x6996, 0x4A6F, 0x26A4, 0x04B0, 0x3568, 0x1F74, 0x57B3, 0x003D, 0x16AE, 0x0CA0,
+ 0x0FBB, 0x0138, 0x7085, 0xB2FF, 0x0F49, 0xAAB5, 0x3262, 0x5783, 0x0E84, 0x3DA4, 0x7E95, 0x283C,
+ 0x3135, 0x2648, 0x3C46, 0x4253, 0x5880, 0x80B6, 0x167D, 0x0349, 0x1C5E, 0x292D, 0x4E6E, 0x0625,
+ 0x2BA4, 0x4C8C, 0x4B66, 0x0384, 0x2026, 0x4A71, 0x0E88, 0x05B0, 0x0A4B, 0x123D, 0x6693, 0x1F7F,
+ 0x12B3, 0x1C37, 0x047C, 0x5D6C, 0x76BC, 0x213B, 0x0131, 0x2938, 0x5CBC, 0x91A6, 0x46B1, 0x57A7,
+ 0x22BC, 0x5686, 0x191D, 0x5DA2, 0x7077, 0x2AAF, 0xAEB6, 0xACBC, 0x4D96, 0x44A6, 0x7FB0, 0x1197,
+ 0x28BB, 0x2B95, 0x0481, 0x5D8A, 0x1EB5, 0x7D8B, 0x8E9E, 0x0422, 0x4F73, 0x388F, 0x4284, 0x88B6,
+ 0x065B, 0x07A9, 0x33A8, 0x12A1, 0x135E, 0x2A6C, 0x2DAA, 0x5486, 0x1222, 0x3B59, 0x0C1B, 0x3AAA,
+ 0x5D89, 0x27A5, 0x0E98, 0x88BB, 0x41AB, 0x2469, 0x65AB, 0x0C5E, 0x445F, 0x96AB, 0x4260, 0x0050,
+ 0x194E, 0x0780, 0x0CBC, 0x4D51, 0x5AAF, 0x4867, 0x0F65, 0x0637, 0x0D24, 0x8A8C, 0x416F, 0x3967,
+ 0x677F, 0x0010, 0x1F5E, 0x1C3C, 0x039F, 0x15A1, 0x95B9, 0x1A64, 0x075F, 0x1739, 0x6595, 0x17A5,
+ 0x328F, 0x5BBD, 0x0367, 0x000B, 0x8BA5, 0x5B92, 0x238C, 0x5A81, 0x3347, 0x4A8F, 0x4E7C, 0x1591,
+ 0x35B5, 0x05A8, 0x1B68, 0x8EB5, 0x5057, 0x4B6E, 0x44A0, 0x768E, 0x7580, 0x3F58, 0x0D87, 0x5671,
+ 0x5E93, 0x328A, 0x0768, 0x078E, 0x2162, 0x4A93, 0x3759, 0x96BC, 0x3B5B, 0x47AD, 0x0013, 0x406E,
+ 0x287C, 0x229B, 0x224E, 0x1C3D, 0x939F, 0x5097, 0x5769, 0x4361, 0x138D, 0x25A4, 0x3888, 0x3C4C,
+ 0x53BC, 0x76BE, 0x2599, 0x2098, 0x7A97, 0x3599, 0x9A9D, 0x67AA, 0x0DA4, 0x2271, 0x1E25, 0x4168,
+ 0x2A96, 0x3285, 0x6A6E, 0x1243, 0x0B37, 0x0D8A, 0x96A6, 0x646D, 0x474B, 0x4C69, 0x6C8D, 0x62A7,
+ 0x7BBC, 0x686C, 0x2E73, 0x4362, 0x3899, 0x1BAD, 0x80AA, 0x369B, 0x5299, 0x5E96, 0x2789, 0x6BAC,
+ 0x1122, 0x3585, 0x2964, 0x0493, 0x304B, 0x6EA9, 0x2C50, 0x6A76, 0x5F63, 0x14A7, 0x0136, 0x1D4D,
+ 0xA5A8, 0x3773, 0x0A3E, 0x065F, 0x78B7, 0x73A8, 0x00B0, 0x5A60, 0x5663, 0x1B69, 0x2F85, 0x2F54,
+ 0x5E7E, 0x3871, 0x4086, 0x0B65, 0x2C73, 0x25B1, 0x0089, 0x5464, 0x0A62, 0x0D9A, 0x226C, 0x0172,
+ 0x048C, 0x99B9, 0x619B, 0x24B0, 0x5D61, 0x31BB, 0x62A2, 0x98BB, 0x4963, 0x2F36, 0x28BC, 0x1072,
+ 0x4BBC, 0x0774, 0x56B4, 0x3C73, 0x13AD, 0x080A, 0x598E, 0x7174, 0x1EAD, 0x3162, 0x5C90, 0x5B94,
+ 0x256A, 0x2F39, 0x0115, 0x17B7, 0x7C9C, 0x4290, 0x48B0, 0x0F78, 0x2898, 0x88B9, 0x3337, 0x3763,
+ 0x4B7F, 0x7BAF, 0x1974, 0x0F60, 0x73B9, 0x7D8A, 0x7BB3, 0x108C, 0x1096, 0x5A8E, 0x0297, 0x8FA3,
+ 0x5C6D, 0x6870, 0x46B0, 0x1155, 0x1850, 0x556D, 0x1AA9, 0x9194, 0x0A16, 0x7A7F, 0x4D73, 0x6070,
+ 0x404D, 0x65A6, 0x4041, 0x518C, 0x1D3B, 0x1E79, 0x2F5B, 0x1260, 0x4163, 0x3369, 0x8398, 0x88BC,
+ 0x6AAC, 0x46A3, 0x0C27, 0x027D, 0x1D41, 0x1B38, 0x4D8F, 0x01A2, 0x17A2, 0x6AAB, 0x6269, 0x88BA,
+ 0x6F97, 0x4B4D, 0x1928, 0x0D59, 0x3B58, 0x6A98, 0x1019, 0x5BB6, 0x70B5, 0x606F, 0x0EB8, 0x109B,
+ 0x1080, 0x647C, 0x0F4E, 0x173D, 0x578C, 0x3089, 0x2899, 0x39A3, 0x13B3, 0x0987, 0xBAFF, 0x0670,
+ 0x18B9, 0x61BA, 0x7798, 0x649C, 0x9DB6, 0x4B74, 0x011F, 0x0051, 0x96A7, 0x7E99, 0x56B3, 0x0C8B,
+ 0x0083, 0x0019, 0x0660, 0x2D64, 0x1038, 0x0D8D, 0x2458, 0x99B1, 0x0531, 0x0C30, 0x193F, 0x252A,
+ 0x0328, 0x3E60, 0x4A55, 0x7DAF, 0x60B2, 0x6877, 0x28AD, 0x729F, 0x191E, 0x0A97, 0x5293, 0x0C0D,
+ 0x83AE, 0x53A1, 0x9DB4, 0x2B96, 0x78B6, 0x49B4, 0x71AC, 0x527F, 0x2B8D, 0x566D, 0x3EA8, 0x359C,
+ 0x4EA4, 0x026B, 0x618F, 0x4899, 0x107D, 0x95A7, 0x4CFF, 0x4F83, 0x079B, 0xAFB2, 0x0967, 0x12A8,
+ 0x4E64, 0xB9BC, 0xA0BE, 0x2273, 0x3B41, 0x7F86, 0x686E, 0x92A9, 0x0316, 0x2AA0, 0x7F81, 0x0F62,
+ 0x4079, 0x0073, 0x9093, 0x0B32, 0x1969, 0x39B5, 0x2449, 0x404B, 0x1D7E, 0x1D33, 0x27B6, 0x547B,
+ 0x4E50, 0x8CAF, 0x4A89, 0x5E62, 0x4665, 0x8EBB, 0x718D, 0x4763, 0x185C, 0x3254, 0x8EBC, 0x2C8F,
+ 0x5761, 0x2745, 0x307D, 0x4ABD, 0x3071, 0x2890, 0x0263, 0x5EA6, 0x30BE, 0x87AB, 0x5963, 0x7D7E,
+ 0x79A6, 0x0848, 0x0F89, 0x1D6F, 0x0738, 0x1388, 0x0207, 0x0528, 0x45B7, 0x0C56, 0x1D7C, 0x0897,
+ 0x6478, 0x2AAE, 0x45A6, 0x1549, 0x2A45, 0x474E, 0x54BF, 0x0B6D, 0x6180, 0x1E9A, 0x5276, 0x367D,
+ 0x3234, 0x4DAC, 0x1F20, 0x1114, 0x2F62, 0x6F9C, 0x4595, 0x13AB, 0x38AE, 0x0843, 0x0B2B, 0x2A8E,
+ 0x2C2D, 0xACBD, 0x022B, 0x9EB5, 0x798F, 0x32A9, 0x92B5, 0x4BBA, 0x9EB4, 0x2C43, 0xB2BD, 0x2E76,
+ 0x098D, 0x03AA, 0x8BA9, 0x566C, 0x6796, 0x4087, 0x7099, 0x305E, 0x19BA, 0x9CA0, 0x1E83, 0x51BA,
+ 0x0106, 0x49AE, 0x0C97, 0x485C, 0x2D8E, 0x505A, 0x0F73, 0x6BA1, 0x5386, 0x0E49, 0x079A, 0x535A,
+ 0x3670, 0x173A, 0x44A3, 0x085C, 0x2B2F, 0x8DB6, 0x5060, 0x288F, 0x1451, 0x2850, 0x7BA4, 0x688D,
+ 0x4A83, 0x3B79, 0x96B0, 0x8186, 0x1A6A, 0x5989, 0x2E99, 0x7C90, 0x3D71, 0x445C, 0x6CAE, 0x48AD,
+ 0x2C41, 0x1146, 0x1860, 0x6E82, 0x2971, 0x1F62, 0x75A9, 0x6085, 0x48A0, 0x3FA5, 0x3A5A, 0x597F,
+ 0x193C, 0x3FBB, 0x2969, 0x8184, 0x0204, 0x0F94, 0x1767, 0x5996, 0x3751, 0x143E, 0x0F92, 0x1F63,
+ 0x4E61, 0x71A8, 0x80A4, 0x6E7B, 0x339D, 0x0F29, 0x7C80, 0x2ABA, 0x9798, 0x2122, 0x3644, 0x266D,
+ 0x8BBE, 0x4CA8, 0x2072, 0x438D, 0x3F44, 0x2EAF, 0x135A, 0x5C79, 0x1283, 0x389A, 0x216E, 0x4A51,
+ 0x47AA, 0x246A, 0x1040, 0x0234, 0x0BB4, 0x7EAA, 0x06A4, 0x1885, 0x2353, 0x0491, 0x4DB6, 0x13A2,
+ 0x385E, 0x05BD, 0x3F8C, 0x32AC, 0x9DAB, 0x4048, 0x2C7D, 0x8AA0, 0x03AC, 0x5FAC, 0x1044, 0x5392,
+ 0x3366, 0x729C, 0x2768, 0x37AA, 0x046C, 0x72FF, 0x394D, 0x3F50, 0x4CA3, 0x7579, 0x4386, 0x747D,
+ 0x9CB1, 0x2B6A, 0x8E97, 0x0F4F, 0x2B72, 0x0979, 0x0711, 0x0017, 0x1055, 0x2C98, 0x41AC, 0x2993,
+ 0x63B1, 0x2833, 0x3036, 0x80BC, 0x57A0, 0xABB0, 0x1D83, 0x35A9, 0x0809, 0x3463, 0xA4A9, 0x2C78,
+ 0x3E62, 0x0076, 0x2A2B, 0x1361, 0x307B, 0x265B, 0x446A, 0x0717, 0x6F76, 0x25A3, 0x1B63, 0x69BF,
+ 0x3951, 0x0DBC, 0x6C7D, 0x2846, 0x4DAA, 0x4B9A, 0x2560, 0x9CB6, 0x1B65, 0x325F, 0x507A, 0x233B,
+ 0x43A5, 0x439A, 0x14AC, 0x3DA2, 0x3033, 0x74A5, 0x2A63, 0x5EA5, 0x0F61, 0x1972, 0x0CBB, 0x82BE,
+ 0x245F, 0x3955, 0x1A92, 0x6B84, 0x04A5, 0x13A5, 0x1D88, 0x2B9D, 0x8BAC, 0x73B0, 0x2397, 0x2A93,
+ 0x3339, 0x979E, 0x29BC, 0x2381, 0x7A8F, 0x9ABF, 0x7B8C, 0x3334, 0x45A2, 0x84A9, 0x858D, 0x048F,
+ 0x099E, 0x5675, 0x4F71, 0x1F2C, 0x1BAB, 0x4D60, 0x06B2, 0x1DA9, 0x1567, 0x71A7, 0x39AE, 0x5898,
+ 0x0A17, 0x2DA7, 0x8FA4, 0x53A3, 0x469E, 0x12A2, 0x25B6, 0x4B8D, 0x337A, 0xADFF, 0xAAB3, 0x4D92,
+ 0x538C, 0x1F3D, 0x75A1, 0x31A4, 0x3C43, 0x0116, 0x6B87, 0x4C90, 0x0466, 0x1121, 0x2780, 0x68B0,
+ 0x0F70, 0x0852, 0x296A, 0x399F, 0x0F37, 0x27B1, 0x4DA2, 0x3073, 0x5A72, 0x82A0, 0x4277, 0x2352,
+ 0x2E75, 0x8692, 0x3EB4, 0x4F6B, 0x3B8E, 0x2D79, 0x298D, 0x59A2, 0x7899, 0x61BF, 0x0994, 0x7AFF,
+ 0x247D, 0x5FBC, 0x2BBA, 0x57A5, 0x4DBB, 0x89BD, 0x82B7, 0x1EBE, 0x1896, 0x84BC, 0x1E5D, 0x55B4,
+ 0x33AD, 0x5390, 0x6F9F, 0x3462, 0x182B, 0x3A63, 0x2051, 0x1760, 0x0B3A, 0x1368, 0x34B3, 0x608C,
+ 0x2531, 0x3D69, 0x34B4, 0x7375, 0x3086, 0x1D66, 0x477E, 0x9DB3, 0x1E98, 0x41B6, 0x9EB0, 0x394A,
+ 0x90B3, 0x2959, 0x1A50, 0x0A84, 0x0DBF, 0x9AAE, 0x465C, 0x0C95, 0x2AB7, 0x5EBE, 0x26B5, 0x3BB1,
+ 0x0E7C, 0x97A1, 0xA1B7, 0x0BBC, 0x81B8, 0x47BF, 0x91BC, 0x82BD, 0x1323, 0x2024, 0x42A4, 0x0DB6,
+ 0x37A1, 0x3268, 0x1DAE, 0x656E, 0x3892, 0x4760, 0x2347, 0x163D, 0x2FAF, 0xA4B3, 0x0B9E, 0x7C86,
+ 0x056F, 0x21FF, 0x181B, 0x2157, 0x4391, 0x2C82, 0x7E9D, 0x0A6C, 0x68BD, 0x8CBF, 0x040E, 0x2D2F,
+ 0x1C49, 0x268A, 0x30B9, 0x555D, 0x479E, 0x6E8E, 0x3BBA, 0x0390, 0x4F6D, 0x5C80, 0x4681, 0x2856,
+ 0xBABE, 0x90AD, 0x637D, 0x84AC, 0x64B0, 0x5FAE, 0x02A0, 0x76AA, 0x3161, 0x2223, 0x244E, 0x0EB1,
+ 0x7A9B, 0x56BA, 0x3E70, 0x148C, 0xA4AA, 0x6B8C, 0x1443, 0x1A89, 0x1F80, 0x1E60, 0x0596, 0x2C4C,
+ 0x58B2, 0x1989, 0x1673, 0x06BB, 0x0483, 0x27B7, 0x1071, 0x17BE, 0x438E, 0x1CAA, 0x0A1F, 0x8C96,
+ 0x3B3D, 0x0824, 0x0407, 0x2BBC, 0x3F93, 0x6D77, 0x066B, 0x0DAE, 0x5288, 0x95B2, 0x456A, 0x166D,
+ 0x6BAD, 0x3084, 0x84AF, 0x0A86, 0x37B4, 0x569E, 0x09B2, 0x456B, 0x64A1, 0x61FF, 0x6065, 0x80AF,
+ 0x0D54, 0x073D, 0x1F4B, 0x5396, 0x4597, 0x4671, 0x47A4, 0x49B6, 0x3998, 0x21B1, 0x199C, 0x0220,
+ 0x5DB4, 0x04B6, 0x0B1F, 0x7AB8, 0x2390, 0x83B8, 0x57B2, 0x2D84, 0x1A90, 0x232B, 0x0235, 0x0196,
+ 0x0922, 0x6287, 0x5187, 0x53BB, 0x22B5, 0x42B7, 0x323C, 0x167B, 0x0191, 0x1C5D, 0x89A1, 0x002F,
+ 0x6CBF, 0x476F, 0x4583, 0x030E, 0x468D, 0x3037, 0xA8AD, 0x86B7, 0x3373, 0x2589, 0x039D, 0x2256,
+ 0x0C26, 0x3364, 0x13A1, 0x7EBF, 0x0BBB, 0x6372, 0x23B5, 0x6871, 0x2955, 0x0689, 0x1C8A, 0x496E,
+ 0x1660, 0x24BE, 0x203C, 0x42B1, 0x6582, 0x315F, 0x3857, 0x1962, 0x2F8B, 0x0198, 0x4F51, 0x3B88,
+ 0x2946, 0x2B5D, 0x0D3C, 0x73BD, 0x709D, 0x161D, 0x343F, 0x04B4, 0x088E, 0x0D70, 0xAFBC, 0x3C7F,
+ 0x7F8E, 0x1F79, 0x567A, 0x202D, 0x1F6A, 0x11B2, 0x4F88, 0x3647, 0x2C84, 0x04B1, 0x1680, 0x3F54,
+ 0x1C38, 0x0885, 0x386E, 0x5A6D, 0x506C, 0x3D6C, 0x09BA, 0x0C31, 0x2696, 0xA1A6, 0x4E6B, 0xA9BF,
+ 0x6872, 0x0769, 0x027E, 0x48B3, 0x1526, 0x1728, 0x132F, 0x8492, 0x3957, 0x8BAD, 0x5385, 0x4654,
+ 0x2FFF, 0x4698, 0x0A1E, 0x0A35, 0x0249, 0x154B, 0x1B8B, 0x50B3, 0x2634, 0x1DA3, 0x7697, 0x3F56,
+ 0x8093, 0x9AA1, 0x3454, 0x1518, 0x5C5D, 0x2DA3, 0x2742, 0x37A6, 0x63BE, 0x9BB3, 0x00B2, 0x4E6D,
+ 0x1A67, 0x359B, 0x47BB, 0x6681, 0x659A, 0x02BC, 0x1A29, 0x136C, 0x3C7E, 0x1984, 0x6066, 0x0F87,
+ 0x0F93, 0x438B, 0x249B, 0x9ABA, 0x5483, 0x0BA1, 0x1873, 0x737C, 0x8DAA, 0x0304, 0x2339, 0x0574,
+ 0x859E, 0x317C, 0x0878, 0x74AC, 0x0875, 0x4593, 0x4C78, 0x3C6E, 0x6383, 0x43AA, 0x19A8, 0x1AB3,
+ 0x9DBA, 0x567B, 0x7E89, 0x6BB6, 0x2B81, 0x23A8, 0x2263, 0x0E47, 0x3050, 0x589E, 0x3755, 0x5682,
+ 0x0342, 0x1795, 0x1937, 0x9CAE, 0x5964, 0x60B0, 0x02BA, 0xA5AB, 0x3172, 0x678B, 0x5DA0, 0x6B95,
+ 0x3C5F, 0x2D9D, 0x698B, 0x0955, 0x3AA5, 0x496F, 0x7374, 0x5B78, 0x1991, 0x8294, 0x0859, 0x545A,
+ 0x526E, 0x0737, 0x353E, 0x25B0, 0x1084, 0x57AF, 0x535E, 0x2B3C, 0x32BF, 0x1450, 0x086E, 0x78A7,
+ 0x3875, 0x0421, 0x66BA, 0x00A6, 0x81B9, 0x8C92, 0x0512, 0x1740, 0x292F, 0x384A, 0x1992, 0x3839,
+ 0x00B3, 0x1E5F, 0x2934, 0x106C, 0x5A5D, 0x1463, 0x4648, 0x1DAB, 0x0E61, 0x89BF, 0x0A1C, 0x2A6A,
+ 0x6DA8, 0x72AB, 0x88B8, 0x2A67, 0xB2BC, 0x2A68, 0x9097, 0x3B9A, 0x4294, 0x121E, 0x5691, 0x595C,
+ 0x1A4B, 0x272C, 0x16A8, 0x546B, 0x010C, 0x3988, 0x108D, 0x7EA5, 0x3367, 0x025E, 0x5078, 0x394B,
+ 0xAAB0, 0x585E, 0x199E, 0x5D5F, 0x77A3, 0x0CB1, 0x05A7, 0x0E18, 0x3157, 0x062B, 0xABAF, 0x6FB3,
+ 0x1955, 0x2763, 0x3A7F, 0x1B2E, 0x768B, 0x1176, 0x2FB4, 0x0B8B, 0x486F, 0x05FF, 0x4CA2, 0x3C8C,
+ 0x707B, 0x38A1, 0x176F, 0x1C88, 0x0D2B, 0x70B6, 0x158B, 0x5C62, 0x6584, 0x9FB4, 0x1858, 0x92AF,
+ 0x46BF, 0x4FAC, 0x414F, 0x566E, 0x3A97, 0x5782, 0x56A8, 0x4BBD, 0x49B9, 0x353A, 0xAAAE, 0x0508,
+ 0x4D78, 0x1066, 0x87B6, 0x4582, 0x5E9E, 0x297D, 0x2AB2, 0x6264, 0x608D, 0x3296, 0x1762, 0x4547,
+ 0x5159, 0x78A6, 0x5469, 0x195B, 0x5F72, 0x91B0, 0x6FA5, 0x116F, 0x597B, 0x799A, 0x0C0E, 0x80A7,
+ 0x4A5C, 0x3376, 0x356D, 0x85AE, 0x05B9, 0x5EBB, 0x2E79, 0x488D, 0x2C3D, 0x535D, 0x5092, 0x034B,
+ 0x1576, 0x82AB, 0x55AB, 0x2492, 0x5273, 0x1167, 0x3FAF, 0x5879, 0x0E1F, 0x2475, 0x24AA, 0x0410,
+ 0x63A7, 0x49BF, 0x2A43, 0x68A8, 0x21B3, 0x3048, 0x6C91, 0x6073, 0x017B, 0x0659, 0x5F8E, 0x9CA1,
+ 0x3E66, 0x1F92, 0x597D, 0x1B83, 0x7D80, 0x3C9B, 0x3FBC, 0x90B0, 0x07A3, 0x479F, 0x7F8B, 0x1079,
+ 0x489C, 0x7092, 0x0D35, 0x014C, 0x12AA, 0x6597, 0x1729, 0x77AD, 0x247F, 0x1042, 0x4469, 0x163C,
+ 0x4478, 0x78AA, 0xA6BB, 0x1385, 0x54AB, 0x5381, 0x479B, 0x327B, 0x182C, 0x4768, 0x1558, 0x4A4D,
+ 0x0215, 0x6C98, 0x31B8, 0x20A2, 0x1D53, 0x4097, 0x42B6, 0x0CB2, 0x79AF, 0x7C8D, 0x5B70, 0xBABC,
+ 0x11FF, 0x02B3, 0x1EBD, 0x55BD, 0x0168, 0x3486, 0x77AC, 0x1524, 0x0291, 0xAAB1, 0x0114, 0x0DAA,
+ 0x3ABC, 0x62BF, 0x0369, 0x0720, 0x0EA7, 0x668A, 0x7C9A, 0x476B, 0xB7FF, 0x089A, 0x237F, 0x0176,
+ 0x929A, 0x4E72, 0x10A4, 0x497F, 0x68B3, 0x6366, 0x3684, 0x55AF, 0x3745, 0x2D45, 0x5281, 0x6C73,
+ 0x0155, 0x188D, 0x4252, 0x3548, 0x1EA0, 0x4E7B, 0x2C5F, 0x1FAD, 0x1A9A, 0x3877, 0x0835, 0x6D80,
+ 0x2D5D, 0x3F7B, 0x3EA0, 0x8593, 0x6CAB, 0x31BC, 0x6CA9, 0x02A8, 0x72AC, 0x5888, 0x61AE, 0x5375,
+ 0x3E51, 0x75BE, 0x2132, 0x71AA, 0x4257, 0x3B7B, 0x1FB6, 0x58A3, 0x6495, 0x6A81, 0x4FBD, 0x45AF,
+ 0x36A3, 0x80FF, 0xA2AA, 0x0255, 0x575A, 0x1D21, 0x037B, 0x5CAB, 0x18BF, 0x5E6D, 0x40A0, 0xA0A7,
+ 0x0509, 0x73AA, 0x5289, 0x244C, 0x03A9, 0x041F, 0x2C7E, 0x5883, 0x38A6, 0x669F, 0x0FAE, 0x2ABC,
+ 0x14A0, 0x6F7A, 0x28A0, 0x698D, 0x2344, 0x26A8, 0x72B2, 0x72B4, 0x6688, 0x858A, 0x77A8, 0x9FBE,
+ 0x126F, 0x2269, 0x087C, 0x80A3, 0x5B76, 0x5E98, 0x1444, 0x87B5, 0x4655, 0x434A, 0x3C59, 0x91A7,
+ 0x89AC, 0x3E4A, 0x2985, 0x191B, 0x40BB, 0x2B53, 0x5C96, 0x0F44, 0x444E, 0x2D8A, 0x1A5E, 0x0F9F,
+ 0x5153, 0xA4AB, 0x6190, 0x6785, 0x47A2, 0x4C74, 0x033C, 0x0BA2, 0x419E, 0x5189, 0x8EA4, 0x537B,
+ 0x151E, 0x6570, 0x439F, 0x0C82, 0x4189, 0x4A98, 0x2254, 0x0C44, 0x161B, 0x2297, 0x6DAA, 0x7AA2,
+ 0x515C, 0x88B2, 0x3D59, 0x10B4, 0x0F28, 0x015D, 0x5E78, 0x22AF, 0x1625, 0x1141, 0x2533, 0x1E85,
+ 0x2B38, 0x5B65, 0x4B65, 0x1636, 0x5599, 0x0944, 0xA4B1, 0x5A79, 0x0F6F, 0x60A9, 0x2675, 0x1E2C,
+ 0x519F, 0x519E, 0x526B, 0x4A68, 0x3D4A, 0x688E, 0x2987, 0x0B36, 0x1A83, 0xB7B9, 0x72B9, 0x98A2,
+ 0x0042, 0x4B8B, 0x8DA5, 0x36A5, 0x0120, 0x28BD, 0x6C83, 0x0331, 0x277A, 0x8EA5, 0x53AA, 0x049D,
+ 0x038F, 0x2B45, 0x474C, 0x8490, 0x5EA1, 0x0E21, 0x6379, 0x393F, 0xA3B8, 0x2123, 0x507C, 0x8DB7,
+ 0x83AF, 0x6F74, 0x0446, 0x4D80, 0x3D3E, 0x0757, 0x0399, 0x21A4, 0x8391, 0x0A6B, 0x6F91, 0x2190,
+ 0x1533, 0x99AD, 0x56AA, 0x0E2F, 0x2D7C, 0x6DBE, 0x5EA8, 0x45A3, 0x719C, 0xA9AE, 0x7E96, 0x1663,
+ 0x1AA3, 0x1C47, 0x5169, 0x4958, 0x0A3B, 0x059D, 0x5A8F, 0x0740, 0x1A32, 0x218A, 0x003E, 0x6488,
+ 0x258E, 0x5670, 0x0366, 0x5087, 0x0E45, 0x39B8, 0x0E6F, 0x1E30, 0x1986, 0x0CAF, 0xA3A7, 0x2155,
+ 0x209A, 0x38AB, 0x3B81, 0x13A3, 0x9AB0, 0x070B, 0x405D, 0x8CB3, 0x8CA4, 0x7F8C, 0x008E, 0x0480,
+ 0x0192, 0x2889, 0x619D, 0x5C67, 0x108F, 0x102E, 0xA6AE, 0x537A, 0x29B7, 0x0054, 0x122E, 0x7FB8,
+ 0x1C84, 0x1738, 0x3538, 0x4F69, 0x0296, 0x494B, 0x2982, 0x87FF, 0x2B7C, 0x4243, 0x4861, 0x054D,
+ 0x99A1, 0x0631, 0x6BBF, 0x5BA4, 0x9BA9, 0x09A8, 0x01AE, 0x0015, 0x3C67, 0x23B2, 0x0031, 0x34A8,
+ 0x152A, 0x47A1, 0x018A, 0x65B1, 0x97A7, 0x6F8F, 0x2690, 0x3C47, 0x7BA9, 0x35B0, 0x2B56, 0x506F,
+ 0x325E, 0x223F, 0x1230, 0xADB8, 0x1166, 0x1E70, 0xAFB0, 0x808E, 0x4267, 0x0960, 0x1546, 0x257E,
+ 0x1220, 0x1021, 0x8F99, 0x255F, 0x2A49, 0x4CBE, 0x4158, 0x1BB9, 0x97BE, 0x0F59, 0x8086, 0x0869,
+ 0x5F6E, 0x111F, 0x5E79, 0x455C, 0x5559, 0x5168, 0x54BB, 0x1B54, 0x2CB8, 0x1965, 0x3B8D, 0x1C62,
+ 0x0298, 0x85A2, 0x1A1F, 0x516D, 0x92AE, 0x535F, 0x1B92, 0x2E2F, 0x3FBE, 0x03B4, 0x65B7, 0x3E9E,
+ 0x6B9E, 0x2C90, 0x0409, 0x7096, 0x5093, 0x5257, 0x637A, 0x819A, 0x1A44, 0x2B5A, 0x0747, 0x34BA,
+ 0x6396, 0x0521, 0x69A9, 0x276D, 0x1B3C, 0x5477, 0x2989, 0x172A, 0x0C84, 0x6C78, 0x075D, 0x4BB3,
+ 0x5F7B, 0x6C75, 0x96A5, 0x6EAC, 0x247C, 0x139A, 0x5D5E, 0x0D8C, 0x99BC, 0x0437, 0x31AA, 0x4473,
+ 0x3465, 0x91AF, 0x06BD, 0x283E, 0x11B4, 0x0B81, 0x495B, 0x3D4C, 0x3BB8, 0x4961, 0x0F74, 0x2066,
+ 0x39AD, 0x274E, 0x017D, 0x84A4, 0x1448, 0x09B0, 0x0E9F, 0x05A6, 0x1194, 0x1E40, 0x171A, 0x73AE,
+ 0x63B4, 0x0069, 0x2C3F, 0x2D7A, 0x84A7, 0xA0B1, 0x4A7F, 0x7996, 0x18BD, 0x0947, 0x2C93, 0x306B,
+ 0x6A91, 0x1A20, 0x097B, 0x679D, 0x1236, 0x383D, 0x6EB8, 0xAFB1, 0x6D75, 0x6C85, 0x7A84, 0x3E48,
+ 0x042E, 0x3E90, 0x41A2, 0x7DBF, 0x3CBF, 0x7684, 0x9CA5, 0x3C41, 0x0890, 0xA5AA, 0x9DA7, 0x3742,
+ 0xB0B7, 0x8FAE, 0x0E52, 0x47B6, 0x8ABE, 0x1D28, 0x4882, 0x152D, 0x101B, 0x6171, 0x019D, 0x357A,
+ 0x4A50, 0x2074, 0x2C54, 0x0940, 0x3039, 0x7475, 0x7680, 0x6970, 0x95BB, 0x31BA, 0x0744, 0x36B6,
+ 0x90A3, 0x3B6C, 0x0559, 0x4553, 0x17BD, 0xA9B2, 0x1C82, 0x0092, 0x067E, 0x5875, 0x278C, 0x89B7,
+ 0x121B, 0x0BA6, 0x3159, 0x5D66, 0x1980, 0x42A8, 0xA8B2, 0x779F, 0x2F61, 0x09A2, 0x2D3C, 0x709A,
+ 0x233D, 0x3F8E, 0x4F86, 0x2AB3, 0x050F, 0x0F7A, 0x1BAE, 0x9CA7, 0x5960, 0x7288, 0x155F, 0x7999,
+ 0x90B9, 0x879E, 0x417F, 0x73A5, 0x0754, 0x1E89, 0x405E, 0x4773, 0x359A, 0x169A, 0x2EB9, 0x1725,
+ 0x8DAB, 0x389F, 0x4D7C, 0x7CB5, 0x7683, 0xBABF, 0x367C, 0xA4B7, 0x20BA, 0x3753, 0x90B6, 0x213F,
+ 0x365C, 0x475A, 0x28AE, 0x5278, 0x4356, 0x539B, 0x0F5B, 0x2435, 0x20B1, 0x5C74, 0x2F91, 0x6177,
+ 0x29FF, 0x175D, 0x30B3, 0x5E8C, 0x3A7A, 0x4A70, 0x09B4, 0x5256, 0x5D92, 0x69B0, 0x18A7, 0x478C,
+ 0x63B3, 0x444F, 0x484C, 0x1365, 0x06A6, 0x4272, 0x51A4, 0x81BB, 0x68A7, 0x4D6E, 0x6499, 0x5155,
+ 0x0665, 0x4FBF, 0x4A7A, 0x1F2B, 0x6185, 0x034C, 0x0B2A, 0x1E22, 0x3771, 0x83A1, 0x3379, 0x6672,
+ 0x3EAD, 0x6F7F, 0x649D, 0x20B2, 0x6F79, 0x0239, 0x68A2, 0x5CAF, 0x4893, 0x4F62, 0x428E, 0x6574,
+ 0x0AB9, 0x97A5, 0x9BBF, 0x787F, 0x1DAA, 0x1793, 0x111E, 0x5197, 0x2590, 0x76B3, 0x2D91, 0x4393,
+ 0x5467, 0x0649, 0x838E, 0x3280, 0x1565, 0x1F45, 0x0D7D, 0x5991, 0x919A, 0x8AA4, 0x0DB3, 0x7399,
+ 0x9FA8, 0x58AF, 0x588C, 0x53A7, 0x5F97, 0x4D6A, 0x8489, 0x6ABE, 0xA5B4, 0x6496, 0x2356, 0x0206,
+ 0x3F96, 0x7179, 0x0142, 0x0544, 0x252D, 0x697B, 0x4999, 0x52B5, 0x2266, 0x2B75, 0x0C8C, 0x33B7,
+ 0x70B4, 0x8F95, 0x457D, 0x1B3D, 0x0011, 0x7387, 0x0F4D, 0x2DAE, 0x0534, 0x2786, 0x8D98, 0xAAB9,
+ 0x265D, 0x3D62, 0x1014, 0x2F63, 0x51A3, 0x1A4E, 0x5174, 0x5064, 0x147A, 0x2573, 0x5077, 0x2AB0,
+ 0x4F7E, 0x056C, 0x4244, 0x2043, 0x3556, 0x2E53, 0x609B, 0xA4BF, 0x0F1A, 0x68A1, 0x5BBC, 0x5580,
+ 0x3D78, 0x4448, 0xA5B0, 0x3291, 0x2CA8, 0x71BD, 0x85B9, 0x88A2, 0x224B, 0x1865, 0x183A, 0x5FA5,
+ 0x52B8, 0x1DAD, 0x0B34, 0x5B98, 0x2E58, 0x089E, 0x2E7C, 0x144E, 0x2671, 0x7887, 0x4072, 0x609F,
+ 0x7678, 0x8CA0, 0x1584, 0x3FAA, 0x0274, 0x36B0, 0xA7B4, 0x30AC, 0x49B5, 0x79AD, 0x488B, 0x2FAA,
+ 0x12FF, 0x0C91, 0x9193, 0x6074, 0x82AA, 0x748B, 0x1380, 0x5E9D, 0x3789, 0x336C, 0x5E9B, 0x3264,
+ 0x5EB5, 0x2D50, 0x3A98, 0x4858, 0x5877, 0x0B47, 0x5E97, 0x00B7, 0x87B1, 0xA1BE, 0x1933, 0x2A61,
+ 0x199D, 0x3CB2, 0x5177, 0x3E83, 0x1D62, 0x1F31, 0x73AF, 0x081F, 0x4989, 0x3B7E, 0x5A98, 0x0892,
+ 0x2564, 0x2C61, 0x5E65, 0x48FF, 0x4D72, 0x34B0, 0x4896, 0x6370, 0x0E76, 0x448E, 0x2693, 0x0D3E,
+ 0x7A96, 0x09A9, 0x4AA4, 0x4B69, 0x125A, 0x00A8, 0x1D69, 0x519B, 0x0AB4, 0x5881, 0x1E63, 0x3A6C,
+ 0x28BF, 0x339A, 0x31A2, 0x095F, 0x687E, 0x0B4A, 0x72AA, 0x7FAC, 0x2686, 0x1698, 0x54A4, 0x6388,
+ 0x0C57, 0x136F, 0x0937, 0x7481, 0x8BA8, 0x8183, 0x0632, 0x2E35, 0x2C8A, 0x2B35, 0x2561, 0x4487,
+ 0xA2AC, 0x3B8B, 0x236E, 0x2545, 0x2B4C, 0x5575, 0x4952, 0x4697, 0x298A, 0x0A33, 0x3F41, 0x4E97,
+ 0x91BA, 0x5A83, 0x1D95, 0x44AE, 0x5479, 0x124B, 0x101C, 0x5ABE, 0x4397, 0x3C9D, 0x348B, 0x1486,
+ 0x566B, 0x2AB6, 0x2A89, 0x304E, 0x0018, 0x62B6, 0x0496, 0x64AC, 0x27A1, 0x03A6, 0x359D, 0x4155,
+ 0x0EA0, 0x3355, 0x008D, 0x393B, 0xA2B0, 0x89FF, 0x2372, 0x5566, 0x459B, 0x7074, 0x0981, 0x07B5,
+ 0x3577, 0x2042, 0x0346, 0x339B, 0x243E, 0x90B2, 0x5C78, 0x115C, 0x7C8F, 0x447E, 0x78AB, 0xABFF,
+ 0x6887, 0x4BA7, 0x2944, 0x3778, 0xAEB9, 0x1666, 0x6C7F, 0x5460, 0x01AB, 0x95AB, 0x4D91, 0x5494,
+ 0x0D38, 0x3336, 0x8A9D, 0x1B72, 0x1B60, 0x2A44, 0x4D86, 0x8B8D, 0x61BB, 0x0872, 0x5BAC, 0x3638,
+ 0x4FB3, 0x2B92, 0x7C91, 0x7B7E, 0x6BBB, 0xA9B5, 0x3973, 0xB1B3, 0x01A8, 0x415C, 0x9197, 0x2D5B,
+ 0x5468, 0xADB6, 0x617C, 0x22B2, 0x656A, 0x0B85, 0x4F57, 0x82AD, 0x5ABF, 0x464E, 0x8C9B, 0x061A,
+ 0x039A, 0x888F, 0x11AC, 0x0566, 0x3255, 0x78B8, 0x0620, 0x57A1, 0x3676, 0x40B2, 0x38B7, 0x4780,
+ 0x1454, 0x0BA3, 0x1585, 0x1975, 0x5C7D, 0x65A1, 0x3E89, 0x5665, 0x41B7, 0x6F7C, 0x15A6, 0x029F,
+ 0x3845, 0x0B9D, 0x30A0, 0x4A66, 0x2AB1, 0x4887, 0x0724, 0x0662, 0x4D99, 0x3DB7, 0x57FF, 0x5AAE,
+ 0x0A53, 0x1AAC, 0xAABE, 0x7D8C, 0x015B, 0x0059, 0x376C, 0x31BD, 0xA4BA, 0x0870, 0x2D9B, 0x2783,
+ 0x0128, 0x429E, 0x6888, 0x21BF, 0x0775, 0x6DB8, 0x93A2, 0x5BB9, 0x0655, 0x92AB, 0x0654, 0x0975,
+ 0x6896, 0x071E, 0x109F, 0x0C39, 0x7BAD, 0x2086, 0x1F8C, 0x0368, 0xB7BE, 0x95B6, 0x242D, 0x656D,
+ 0x424A, 0x1D56, 0x6D95, 0x27FF, 0x00BC, 0x0E39, 0x2A5D, 0x00B6, 0x4A61, 0x2F32, 0x767F, 0x636F,
+ 0x404C, 0x74BF, 0x7CB1, 0x09BC, 0x0708, 0x4594, 0x0F81, 0x4F84, 0x9496, 0x8EA6, 0x0971, 0x0127,
+ 0x5986, 0x4894, 0x4247, 0x8EB1, 0x5F90, 0x2F51, 0x0B76, 0x1D7B, 0x417A, 0x4849, 0x4A6A, 0x153E,
+ 0x545B, 0x0AAA, 0x7076, 0x1A94, 0x6897, 0x4DB2, 0x1281, 0xA7FF, 0x08B9, 0x2958, 0xBCBD, 0x0A8D,
+ 0x3D56, 0x3650, 0x0B29, 0x5F61, 0xABB9, 0x0C59, 0x54B3, 0x8085, 0x023A, 0x5D8B, 0x0E48, 0x7DA2,
+ 0xAFB7, 0x55AC, 0x1E43, 0x8081, 0x0284, 0x1AAA, 0x085F, 0x0F34, 0x3C4B, 0x5DA1, 0x3F9A, 0x5C98,
+ 0x0B8D, 0x0F56, 0x6C86, 0xA0AA, 0x3B85, 0x2260, 0x5680, 0x2E98, 0xACB8, 0x5282, 0x189B, 0x40B0,
+ 0x6FA1, 0x233C, 0x383F, 0x1484, 0x055C, 0x3F68, 0x4891, 0x159D, 0x000F, 0x3A9F, 0x6A9A, 0x264D,
+ 0x7C85, 0x1CBE, 0x3C95, 0x3FB7, 0x4992, 0x638F, 0x2149, 0x4D61, 0x088A, 0x044B, 0x1494, 0x1934,
+ 0x5D85, 0x2446, 0x65BD, 0x054E, 0x1690, 0x6398, 0x8FBF, 0x3E96, 0x92BA, 0x54B8, 0x3B84, 0x266B,
+ 0x4358, 0x0697, 0x366E, 0x1A4F, 0x8690, 0x1462, 0x1A31, 0x078B, 0x1E4A, 0x2153, 0x34A3, 0x0319,
+ 0x60B4, 0x0D8B, 0x2E8B, 0x4C5A, 0x445D, 0x0CA7, 0x2253, 0x1218, 0x17A3, 0x5BBA, 0x1CFF, 0x63A9,
+ 0x99B5, 0x5165, 0x0F19, 0x64A7, 0x3944, 0x7EA0, 0x7895, 0x4F96, 0x5C5F, 0x83B2, 0x28A3, 0x6EBA,
+ 0x5A8C, 0x1C73, 0x0C61, 0x6DAE, 0x3265, 0x1224, 0x3961, 0x0214, 0x1F5D, 0x3CB1, 0x8C8D, 0x2F9E,
+ 0x0C24, 0x20AD, 0x7E87, 0x2C4A, 0x44AF, 0x5C6B, 0x18B8, 0x3C91, 0x0507, 0x2439, 0x6AB8, 0x36AD,
+ 0x84A2, 0x929E, 0x769D, 0x36A6, 0x15BA, 0x3794, 0x2C77, 0x56A0, 0x0EBB, 0x7DB3, 0x285F, 0x6389,
+ 0x393E, 0x5873, 0x68A6, 0x20AF, 0x6368, 0x89A2, 0x14A2, 0x0C66, 0x7F9E, 0x000A, 0x0678, 0x4E63,
+ 0x9DB1, 0x70B8, 0x96B7, 0x5069, 0x0563, 0x0633, 0x273B, 0x1459, 0x85B6, 0x2A5E, 0x1990, 0x379E,
+ 0x869B, 0x559B, 0x0E0F, 0x3377, 0x4580, 0x1A8C, 0x067B, 0x19AC, 0x025D, 0x58AD, 0x2DB3, 0x3E5E,
+ 0x204B, 0x3679, 0x1545, 0x2E93, 0x233F, 0x04A4, 0x829B, 0x144B, 0x4367, 0x1D8D, 0x69A5, 0x0B83,
+ 0x0855, 0x1446, 0x1627, 0x1D93, 0x5884, 0xA3BE, 0x74A2, 0x5D99, 0x4383, 0x617E, 0xA7B1, 0x529E,
+ 0x519C, 0x3279, 0x4384, 0x4B9D, 0xBBBE, 0x1861, 0x083F, 0x2C9F, 0x10FF, 0x01B6, 0x299D, 0x1A58,
+ 0x4B5A, 0x3858, 0x09AC, 0x4A81, 0x01A7, 0x0A79, 0x3760, 0x1342, 0x92AD, 0xA8B0, 0x14B4, 0x14AD,
+ 0x359F, 0x0853, 0x1E95, 0x005A, 0x8E99, 0x0D30, 0x45A1, 0x5A85, 0x84BF, 0x3B53, 0x132B, 0x038D,
+ 0x7C92, 0x39B1, 0x989B, 0x2882, 0x83B4, 0x3393, 0x469C, 0x24BC, 0x459A, 0x207E, 0x9EB9, 0x537C,
+ 0x4E5B, 0x3756, 0x1D58, 0x2A6B, 0x44B7, 0x4182, 0x7D9C, 0x0D1C, 0x022C, 0x8999, 0x3B83, 0x2A8A,
+ 0x8092, 0x2426, 0x0927, 0x313A, 0x8AAD, 0x7FAA, 0x22AE, 0x0189, 0x1B7F, 0x3E8D, 0x8C98, 0xA2B8,
+ 0x2B64, 0x89A3, 0x6592, 0x1329, 0x597A, 0x5C72, 0x2097, 0x5377, 0x3842, 0x3258, 0x3193, 0x2D3D,
+ 0x2F87, 0x036F, 0x6068, 0x454B, 0x0380, 0x3490, 0x4C66, 0x406B, 0x6E8B, 0x3F98, 0x17BB, 0x1262,
+ 0x0E81, 0x2738, 0x3070, 0x506D, 0x3478, 0x94AB, 0x4C6B, 0x1EB3, 0xACB6, 0x277C, 0x4980, 0x3351,
+ 0x5571, 0x3C4D, 0x95B8, 0x5ABD, 0x54B1, 0x4A52, 0x565E, 0x306F, 0x3EA3, 0x1781, 0x4C9B, 0x18B6,
+ 0x303C, 0x3B89, 0x1C5C, 0x0162, 0x9CBB, 0x5367, 0x059B, 0x204A, 0x3444, 0x1A43, 0x5B9F, 0x2AA4,
+ 0x2182, 0x194C, 0x011C, 0x7BB5, 0x779E, 0x5F8D, 0x878B, 0x5DBC, 0x8687, 0x63FF, 0x2053, 0x288D,
+ 0x83AD, 0x6992, 0x4073, 0x47AC, 0x8CBC, 0x74BA, 0x7681, 0x30A2, 0x016E, 0x08A0, 0x99B8, 0x6080,
+ 0x79B1, 0x3699, 0x788E, 0x4ABF, 0x1D2C, 0xADBA, 0x61AC, 0x077B, 0x494A, 0x7EAB, 0x7BA8, 0x2FB9,
+ 0x2A6F, 0x1D5F, 0x64B1, 0x2385, 0x2D53, 0x1E53, 0x55A7, 0x2839, 0x4752, 0x3A6F, 0x5051, 0x4D77,
+ 0x35AE, 0x7679, 0x9BB6, 0x679E, 0x6D8B, 0x3645, 0x65A9, 0x5AA9, 0x1589, 0x6CBA, 0x2FBF, 0x6B79,
+ 0x8DA6, 0x7888, 0x5388, 0x7492, 0x15FF, 0x959E, 0xA6B2, 0x4E59, 0x162E, 0x25A8, 0x0104, 0x595A,
+ 0x0035, 0x1B3E, 0x0064, 0x49B7, 0x455A, 0x0474, 0x2553, 0x406C, 0x4EA0, 0x122D, 0x0C87, 0x18B7,
+ 0x5292, 0x9EAA, 0x345F, 0x3552, 0x4249, 0x91AC, 0x0581, 0x035F, 0x409F, 0x1B9C, 0x187E, 0x246E,
+ 0x1D2D, 0x3C3D, 0x1C3F, 0xAABF, 0xAAB2, 0x4EAC, 0x1C64, 0x5A62, 0x65A7, 0x90BE, 0x6FB4, 0x1925,
+ 0x7FA2, 0x0DA7, 0x8D9A, 0x054C, 0x5D93, 0x455B, 0x7075, 0x4466, 0x5B7A, 0x587A, 0x0E3B, 0x06BE,
+ 0x4C50, 0x236D, 0x2B43, 0x516E, 0x407C, 0x6B83, 0x1495, 0x19A5, 0x5A93, 0xA0B3, 0x58B0, 0xA9BC,
+ 0x04FF, 0x24A1, 0x34A4, 0xA6BC, 0x2F99, 0x4099, 0x007F, 0x4AB0, 0x3BAC, 0x125C, 0x6BB7, 0x1C48,
+ 0x717C, 0x65BC, 0x071F, 0x164C, 0x3044, 0x2E57, 0x35A0, 0x3C7A, 0x3C3F, 0x0AAF, 0x2A64, 0x1C6F,
+ 0x316D, 0x1E4C, 0x1292, 0x238A, 0x256D, 0x16B3, 0x168A, 0x8DA1, 0x2B37, 0x7072, 0x53AC, 0x89B6,
+ 0x0D1F, 0x8CAD, 0x3F74, 0x289A, 0x161C, 0x5DFF, 0x2F69, 0x154F, 0x2DAC, 0x6168, 0x075E, 0xB4BC,
+ 0x2844, 0x3378, 0x07FF, 0x4FB0, 0x4962, 0x1791, 0x245A, 0x195C, 0x0B12, 0x1732, 0x3A8D, 0x4777,
+ 0x8CBB, 0x46B6, 0x849F, 0x2E4E, 0x84AB, 0x577F, 0x8E96, 0xA3A6, 0x0417, 0x4864, 0x7576, 0x2E32,
+ 0x305F, 0x596C, 0x6C71, 0x6585, 0x2DFF, 0x59BC, 0x326C, 0x3B93, 0x6C7E, 0x749A, 0x0A66, 0x4566,
+ 0x59BB, 0x064E, 0x73A6, 0x91BF, 0x7AB1, 0x42BF, 0x3B4D, 0x6C94, 0x1327, 0x418A, 0x7DAC, 0x5E7C,
+ 0x3479, 0x7181, 0xB9BF, 0x252C, 0x2BAC, 0x4FA8, 0x3AA1, 0x1F3C, 0x0A11, 0x30A8, 0x419B, 0x0B89,
+ 0x60AA, 0x2B7E, 0x7783, 0x2878, 0x1A2C, 0x3BAE, 0x2775, 0x1543, 0x4ABC, 0x387E, 0x7C8A, 0x0376,
+ 0x0190, 0x1C1D, 0x012A, 0x4852, 0x3569, 0x48A9, 0x103F, 0x456E, 0x6FA7, 0x209F, 0x8B98, 0x2BA1,
+ 0x1C85, 0x1BA3, 0x40A3, 0x41A6, 0x3E5C, 0x2A9D, 0x8AAF, 0x73A0, 0x35BB, 0x4857, 0x687D, 0x3D99,
+ 0x5B71, 0x3145, 0x6CA1, 0x0992, 0x2E30, 0x10A0, 0x1C43, 0x8DB9, 0x0A93, 0x3B43, 0x5C95, 0x0616,
+ 0x1A82, 0x07B2, 0x51B0, 0x131A, 0x393D, 0x28A2, 0x2A88, 0x19A9, 0x5384, 0x5987, 0x0691, 0xA3BC,
+ 0x86FF, 0x204D, 0x2FB7, 0x22AA, 0x1B97, 0x3784, 0x646E, 0x1870, 0x3AAD, 0x494F, 0x3D8D, 0x5354,
+ 0x9FBC, 0x6EB5, 0x2552, 0x1920, 0x0D6C, 0x22FF, 0x51A9, 0x315B, 0x1D8F, 0x0AA8, 0x4B60, 0x197D,
+ 0x8088, 0x7577, 0x3852, 0x669E, 0x7EAE, 0x6D85, 0x0A61, 0x4E8D, 0x2292, 0x6D81, 0x1D43, 0x3492,
+ 0x1555, 0x5B6B, 0x117A, 0x0CAB, 0x0721, 0x3A89, 0x2D85, 0x057D, 0x4DBE, 0x2345, 0x3456, 0x44BB,
+ 0x87A5, 0x1117, 0x749C, 0x4EA3, 0x4E85, 0x1658, 0x0619, 0x0347, 0x9096, 0x0264, 0x8DB1, 0x344B,
+ 0xA4A6, 0x2A36, 0x4A82, 0x3B57, 0x649B, 0x0D14, 0x96B5, 0x287A, 0x8EA8, 0x4198, 0x1EAB, 0x0358,
+ 0x1C91, 0x1C6D, 0x5C63, 0x4149, 0x73B3, 0x62B5, 0x01BC, 0x346C, 0x0B60, 0x1699, 0x169E, 0x0B24,
+ 0x7AAB, 0x0224, 0x3D83, 0x8495, 0x4E9F, 0x1632, 0x7DAB, 0x869A, 0x8F9E, 0x4BB2, 0x9BBB, 0x4569,
+ 0x20A7, 0x2470, 0x159B, 0x1485, 0x1135, 0x6484, 0x7D84, 0x2283, 0x343A, 0x124D, 0x5489, 0x398A,
+ 0x0E59, 0x1CBC, 0x91B5, 0x8F96, 0x1A5D, 0x41B0, 0x3C9A, 0x24B2, 0x97AE, 0x319B, 0x00BB, 0x0C88,
+ 0x053E, 0x546C, 0x16BD, 0x91B4, 0x29B9, 0x191A, 0x195D, 0x5BAB, 0x2D86, 0x0763, 0x4445, 0x12A9,
+ 0x5271, 0x2669, 0x1D27, 0x0240, 0x365F, 0x64A9, 0x4E7F, 0x1779, 0x3140, 0x172B, 0x6D6E, 0x4066,
+ 0x4F5B, 0x3B60, 0x499C, 0x2163, 0x4AFF, 0x45B5, 0x0F8A, 0x4A62, 0x5878, 0x253F, 0x3F86, 0x2361,
+ 0x2752, 0x0DBA, 0x4F97, 0x0535, 0x204E, 0x484A, 0x3F81, 0x8798, 0x7A7B, 0x9398, 0x0A32, 0x1845,
+ 0x216A, 0x989F, 0x62B2, 0x2289, 0x252B, 0x9AAA, 0x2044, 0x5973, 0x2B65, 0x4049, 0x5AB4, 0x2B2C,
+ 0x468C, 0x2E9F, 0x4693, 0xA1A7, 0x5C88, 0x428C, 0x549B, 0x2543, 0x2489, 0x29A3, 0x658D, 0x45A0,
+ 0x60A6, 0x2C87, 0x1799, 0x5B74, 0x128E, 0x1745, 0x051F, 0x0958, 0x4E68, 0x3275, 0x43A0, 0x1EA1,
+ 0xB4B5, 0x63B0, 0x6179, 0x264C, 0x4676, 0x227C, 0x1A73, 0x44BF, 0x03BA, 0x1D3D, 0x5EB7, 0x79A0,
+ 0x1846, 0x1046, 0x1C5B, 0x0F53, 0x36B7, 0x038C, 0x7BA2, 0xA0A4, 0x537D, 0x749B, 0xA4B8, 0x1646,
+ 0x1C45, 0x53BA, 0x639D, 0x5FAD, 0x31B3, 0x28BE, 0x48AA, 0x0D43, 0x1AB5, 0x3587, 0x1AB8, 0x3FAE,
+ 0x179A, 0x5462, 0x1496, 0x78B0, 0x0B98, 0x1A25, 0x3956, 0x959B, 0xADB1, 0x8590, 0x467F, 0x1B24,
+ 0x607C, 0x417C, 0x030B, 0x1C4B, 0x4D9C, 0x4484, 0x7C98, 0x61B9, 0x1239, 0x004B, 0x3A82, 0x929B,
+ 0x8EA0, 0x79A5, 0x369E, 0x5166, 0x1830, 0x3881, 0x59A0, 0x2C8E, 0x898F, 0x004A, 0x1B4D, 0xA5BF,
+ 0x97B7, 0x6B7D, 0x3D49, 0x5EBA, 0x50AA, 0x40AE, 0x5CA9, 0x65AA, 0x3677, 0x7478, 0x2FBD, 0x7D93,
+ 0x2FAD, 0x2645, 0x0DAB, 0x3A83, 0x1674, 0xB5BC, 0x89A9, 0x5893, 0x88B7, 0x3D75, 0x2E61, 0x374C,
+ 0x878D, 0x9FBB, 0x36B3, 0x0320, 0x4EAB, 0xA0B2, 0x49A0, 0x7396, 0x205A, 0x174B, 0x35BA, 0x62B1,
+ 0x07B4, 0x1465, 0x7F9F, 0x6E77, 0x29AA, 0x8A8E, 0x14A6, 0x3C75, 0x00AC, 0x6D83, 0x2DBA, 0x3CBE,
+ 0x488A, 0x0A49, 0x2E50, 0x5C9B, 0x0258, 0x3EB1, 0x0313, 0x2D47, 0x4483, 0x2F37, 0x3F8B, 0x2C6D,
+ 0x25B3, 0x2876, 0x0B2C, 0x54AD, 0x1E3E, 0x5C76, 0x747F, 0x8EA7, 0x78B5, 0x0360, 0x5BA2, 0x2E43,
+ 0x0308, 0x8EAE, 0x3982, 0x168E, 0x08A6, 0x3153, 0x2556, 0x6CAF, 0x1637, 0x4A9E, 0x6FBE, 0x076B,
+ 0x27AD, 0x2BA0, 0x6399, 0x8D9F, 0x0133, 0x2528, 0x1156, 0x7279, 0x0549, 0x165B, 0x95A6, 0x3D9A,
+ 0x009B, 0x77AA, 0x3F6D, 0xA5AE, 0x6F72, 0x337E, 0x0292, 0x6A87, 0x4688, 0x1082, 0x2CBF, 0x5581,
+ 0x215C, 0x1334, 0x478B, 0x1E28, 0x7BB1, 0x8E93, 0x269A, 0x8B8F, 0x0983, 0x519D, 0x2996, 0x27A4,
+ 0x0817, 0x3AA0, 0x4DB1, 0x5357, 0x56B5, 0x458D, 0x06BF, 0x7EB2, 0x777E, 0x1A4D, 0x4F90, 0x5180,
+ 0x15BB, 0x2857, 0x025B, 0x6A95, 0x3C89, 0x9EBF, 0x1863, 0x5F9B, 0x6A74, 0x8A97, 0x5870, 0x45B9,
+ 0x529A, 0x2529, 0x018E, 0x3CA7, 0x0552, 0x3477, 0x6A73, 0x2866, 0x99B7, 0x1921, 0x226F, 0x2E96,
+ 0x7893, 0x1F97, 0x667E, 0x37FF, 0x328C, 0x1F86, 0x186F, 0x04B2, 0x7D85, 0x1679, 0x3596, 0x299B,
+ 0x4759, 0x91AA, 0x657F, 0x88A1, 0x5E92, 0x24BD, 0x36BF, 0x96B3, 0x2CA6, 0x076C, 0x1263, 0x19FF,
+ 0x5871, 0x23A5, 0x104D, 0x6B8B, 0x5E85, 0x4D67, 0x97A2, 0x7495, 0x4C62, 0x0F31, 0x78B3, 0x5053,
+ 0x13A4, 0x1840, 0x2EA5, 0x9EA2, 0x1867, 0x1671, 0x8586, 0x5692, 0x256B, 0x6ABC, 0x1B2F, 0x1075,
+ 0x4683, 0x67B7, 0x5D82, 0x0864, 0x2852, 0x5860, 0x83B6, 0x4F6F, 0xA4B9, 0x7AA7, 0x53B2, 0xA3AD,
+ 0x7B9E, 0x197E, 0x49FF, 0x04A8, 0x91B3, 0x16BF, 0x61BE, 0x18AF, 0x0B8C, 0x3281, 0x08A8, 0x1A35,
+ 0x9EB1, 0xA1A2, 0x377F, 0x6A9E, 0x4296, 0x3942, 0x2647, 0x5C87, 0x3D77, 0x06B7, 0x142C, 0x0158,
+ 0x0126, 0x7984, 0x5186, 0x3BB0, 0x149C, 0x6CB1, 0x192E, 0x3D91, 0x30A5, 0x273D, 0x1458, 0x0425,
+ 0x39A4, 0x8DBD, 0x5C93, 0x3283, 0x57BF, 0x3A53, 0x068C, 0x8E95, 0x1234, 0x6162, 0x0E74, 0x1FB3,
+ 0x3E4E, 0x0973, 0x4B93, 0x4885, 0x3E40, 0xA8AA, 0x3197, 0xAEFF, 0x1E97, 0x529F, 0x14AF, 0x52A6,
+ 0xA8B1, 0x7098, 0x3C5A, 0x57A2, 0x24B6, 0x2F46, 0x0560, 0x35B2, 0x3EA9, 0x6B97, 0x7182, 0x8B9F,
+ 0x3A6D, 0x3C53, 0x0685, 0x9DA2, 0x11A0, 0x1B40, 0x1561, 0x93BB, 0x3068, 0x021B, 0x1B2D, 0x0456,
+ 0x085B, 0x3D76, 0x3C5B, 0x107B, 0x0FA1, 0x0B48, 0x8AAB, 0x22BD, 0x3D65, 0x4E6F, 0x3671, 0x76A3,
+ 0x40B3, 0x5594, 0x27B9, 0x3554, 0x2E36, 0x6397, 0x4BB8, 0x177E, 0x5B89, 0x98AD, 0x7291, 0x7799,
+ 0x4770, 0x6FAC, 0x2559, 0x6B89, 0x3E65, 0x6D87, 0x373A, 0x1A57, 0x4270, 0x0812, 0x3341, 0x1759,
+ 0x7073, 0x32BC, 0x456F, 0x1CA3, 0x04BA, 0x070F, 0x406D, 0x397B, 0x0429, 0x2E74, 0x001B, 0x979F,
+ 0x5065, 0x6CB0, 0x329B, 0x547C, 0x5F80, 0x141C, 0x33A6, 0x43A1, 0x8BA2, 0x5255, 0x1825, 0x939B,
+ 0x1C9A, 0x8FFF, 0x096F, 0x2F52, 0x27AF, 0x6BA9, 0x39AB, 0x0A50, 0x6791, 0x295C, 0x3E67, 0x0793,
+ 0x26AE, 0x71B3, 0x0645, 0x699C, 0x38A8, 0x4BB7, 0x9ABB, 0x5E7A, 0x5590, 0x6567, 0x14BD, 0x1F3E,
+ 0x6C79, 0x383E, 0x2741, 0x81A8, 0x0767, 0x4B9E, 0x1A79, 0x4A6C, 0x1F9D, 0x1653, 0x909E, 0x205F,
+ 0x5195, 0x1B20, 0x0CA6, 0x3146, 0x4044, 0x57AC, 0x5AA0, 0x6CA6, 0x4C9A, 0x183E, 0x2D71, 0x3A72,
+ 0x268E, 0x0266, 0x174E, 0x3F9F, 0x08AD, 0x0943, 0x72BB, 0x01A0, 0x2932, 0x5297, 0x59A1, 0x1331,
+ 0x3C8B, 0x1F41, 0x4F54, 0x347B, 0x4A8A, 0x4289, 0x087D, 0x999D, 0x2EB0, 0x4A73, 0x3F70, 0x0159,
+ 0x7780, 0x63A8, 0x2228, 0x0D86, 0x0854, 0x7EFF, 0x618B, 0x319E, 0x8FB1, 0x3A3B, 0x114E, 0x6A97,
+ 0x75A4, 0x5EAD, 0x4262, 0x001E, 0x626A, 0x97AF, 0x82B9, 0x1A77, 0x1A53, 0x15A9, 0x2592, 0x393C,
+ 0x1024, 0x4C98, 0x3C76, 0x98AA, 0x3458, 0x222F, 0x316E, 0x074D, 0x3134, 0x304C, 0x1A8E, 0x3F5F,
+ 0x068B, 0x0271, 0x6AA7, 0x62B7, 0x2298, 0x0D40, 0x4083, 0x74AD, 0x608A, 0x2F3E, 0x0272, 0x094F,
+ 0x1EAA, 0x517D, 0x3752, 0x333C, 0x586E, 0x1945, 0x024B, 0x497C, 0x337B, 0x6F85, 0xA1B0, 0x0C3B,
+ 0xA7AB, 0x29A0, 0x4057, 0x4BFF, 0x9AA3, 0x278B, 0x2349, 0x70A8, 0x787A, 0x0251, 0x8EAF, 0x55B8,
+ 0x5696, 0x4764, 0x1823, 0x6279, 0x788B, 0x0B9B, 0x062A, 0x3A56, 0x6EAA, 0x5CA5, 0x07AE, 0x0916,
+ 0x91B9, 0x4AB4, 0x305B, 0x052D, 0x51A1, 0x3DAE, 0x2AB8, 0x47AE, 0x9599, 0x58AC, 0x4978, 0x7A83,
+ 0x45B8, 0x1476, 0x8EA1, 0xB2BA, 0x32A2, 0x4EAD, 0x0287, 0xA4A7, 0x2F5D, 0x227F, 0x298B, 0x4071,
+ 0x347D, 0x555A, 0x4CB5, 0x3173, 0x035D, 0x92A1, 0x4193, 0x2731, 0x2B66, 0x74B5, 0x5995, 0x6284,
+ 0x70B9, 0x33B6, 0x97B8, 0x4C57, 0x0709, 0x449A, 0x52A8, 0x1C3B, 0x2A38, 0x0965, 0x2D52, 0x4278,
+ 0x014A, 0x125E, 0x3D95, 0x3A59, 0x2457, 0x6199, 0x1F69, 0x6475, 0x5778, 0x49A1, 0x1F46, 0x23AB,
+ 0x112E, 0x1749, 0x3E7E, 0x02AA, 0xA4B0, 0x2D8C, 0x7A8C, 0x848D, 0x66B5, 0x0795, 0x409D, 0x2587,
+ 0x4062, 0x2454, 0x99B6, 0x7F83, 0x6E98, 0x074E, 0x279B, 0x1074, 0x4D54, 0x4A9D, 0x89B0, 0x90A1,
+ 0x344E, 0x04A0, 0x3965, 0x1855, 0x4C7D, 0x0599, 0x8892, 0x1C9D, 0x41B2, 0x013E, 0x578B, 0x1339,
+ 0x50B9, 0x4F89, 0x86AE, 0x2B9F, 0x1774, 0x959D, 0x3493, 0x96BE, 0xA1BB, 0x5F6B, 0x526F, 0x319F,
+ 0x1CB5, 0x1947, 0x314D, 0x5C8B, 0x49A7, 0x375E, 0x458A, 0x2EA9, 0x0529, 0x1CB2, 0x7BB2, 0x7480,
+ 0xABB7, 0x328D, 0x4465, 0x187B, 0x276E, 0x3DA5, 0x498C, 0x21B6, 0x4B67, 0x3B4C, 0x1070, 0x32A7,
+ 0x2D43, 0x728C, 0x43A6, 0x0A68, 0x0AA6, 0x020B, 0x3689, 0x8190, 0x212C, 0x5B5D, 0x43B6, 0x7493,
+ 0x568D, 0x3D61, 0x3160, 0x2C4E, 0x6CA7, 0x41A7, 0x0D1D, 0x0088, 0x0164, 0xA3AC, 0x4EBD, 0x69BD,
+ 0x6BAE, 0x0A67, 0x0684, 0x105C, 0x06AC, 0x6895, 0x7AB0, 0x74B7, 0x4EAE, 0x1F5F, 0x8292, 0x5295,
+ 0x2E4D, 0x1340, 0x0322, 0x2E54, 0x6367, 0x113C, 0x2466, 0x6A8C, 0x010E, 0xAFBB, 0x6669, 0x14A8,
+ 0x0332, 0x129E, 0x2E6C, 0x5C75, 0x446E, 0x73AD, 0x5366, 0x0E8E, 0x175A, 0x0A9E, 0x07A7, 0x2EAE,
+ 0x09A0, 0xAEBA, 0x1A1C, 0x63B8, 0x44BE, 0x41A9, 0x4995, 0x9DA9, 0x0D8E, 0x92B4, 0x1382, 0x4A91,
+ 0x0935, 0x75BD, 0x6D73, 0x1B57, 0x57BA, 0x1A75, 0x4B80, 0x4AAB, 0x3167, 0x0F7E, 0x5196, 0x0C4C,
+ 0x5A8B, 0x2D33, 0x2A7F, 0x9395, 0x7FAD, 0x5FFF, 0xAEBD, 0x273C, 0x2C5D, 0x849D, 0x659D, 0x25BF,
+ 0x8AB6, 0x0E66, 0x4682, 0x0874, 0x05A4, 0x5487, 0x0962, 0x5592, 0x5865, 0x0315, 0x7BBE, 0x8295,
+ 0x1D50, 0x1E34, 0x373B, 0x0589, 0x69B1, 0x2947, 0x1E77, 0x86B9, 0x1BAC, 0x587B, 0x4A8D, 0x29B2,
+ 0x78BB, 0x7497, 0x92A2, 0x4851, 0x7595, 0x95BE, 0x1634, 0x4CB2, 0x4389, 0x86BD, 0x75AD, 0x3947,
+ 0x0680, 0x0588, 0x2062, 0x818D, 0x2631, 0x2C9C, 0x72B1, 0x5167, 0x29BA, 0x2D88, 0x85BC, 0x4570,
+ 0x49BB, 0x485E, 0x78FF, 0x287E, 0x57B6, 0x22B0, 0x0139, 0x0D28, 0x2277, 0x182A, 0x6193, 0x4B9F,
+ 0x9CA6, 0x4286, 0x90AB, 0x0749, 0x8CBE, 0x90B1, 0x4DAF, 0x4C7C, 0x1D8E, 0x6F8E, 0x6573, 0x2791,
+ 0x218B, 0x79BD, 0x62BE, 0x0690, 0x558D, 0x3851, 0x97A9, 0x4753, 0x15BD, 0x3052, 0x27AE, 0x4974,
+ 0x1357, 0x0F50, 0x1B9A, 0x4DB7, 0x3F5D, 0x777A, 0x0F2E, 0x7DA7, 0x3D53, 0x5B7F, 0x596F, 0x2076,
+ 0x9497, 0x0D41, 0x487F, 0x4C4D, 0x9BB5, 0x5FA6, 0x3C6D, 0x99A4, 0x3A75, 0x138F, 0x1884, 0x6081,
+ 0x85B8, 0x25A2, 0x5BA6, 0x2CA2, 0xA2A9, 0x76AD, 0x6589, 0x65A5, 0x667A, 0x058D, 0x5557, 0x1275,
+ 0x3041, 0x346A, 0xA1FF, 0x2EAD, 0x6C77, 0x03AF, 0x888D, 0x0B10, 0x4B92, 0x0712, 0x1457, 0x465D,
+ 0x1D26, 0x0E27, 0x2396, 0x111C, 0x1C32, 0x87B2, 0x093A, 0x38B8, 0x5664, 0x6986, 0x38B0, 0x0815,
+ 0x2AA6, 0x5695, 0x0BA8, 0x8696, 0x253B, 0x636D, 0x0AB8, 0x78AD, 0x4A9A, 0x2694, 0x9AAD, 0x697A,
+ 0x427A, 0x2EB8, 0x484D, 0x8B90, 0x7E9B, 0x1E54, 0x1E7B, 0x0561, 0x2E5F, 0x5B9A, 0x4347, 0x12A0,
+ 0x9BAE, 0x1D89, 0x2A3B, 0x6AFF, 0x3063, 0x425C, 0x457B, 0x0351, 0x058A, 0x77BD, 0x0E90, 0x3A7B,
+ 0x1A85, 0x6480, 0x98AC, 0x0647, 0x6680, 0x3EBD, 0x679C, 0x9EBD, 0x759F, 0x6B91, 0x1251, 0x42BB,
+ 0x0A4E, 0x2B51, 0x12AD, 0x06B0, 0x2A8F, 0x1BA7, 0x0D19, 0x1A72, 0x2E5B, 0xAAB4, 0x278E, 0x3681,
+ 0x2BA3, 0x347A, 0x7080, 0x3B5D, 0x71AD, 0x0D48, 0x0656, 0x3E9C, 0x1785, 0x2456, 0x186D, 0xABB4,
+ 0x4788, 0x6A72, 0x8D92, 0x4694, 0x8CA8, 0x6EB4, 0x2354, 0x294E, 0x7DB0, 0x5FB6, 0x5D7D, 0x2ABF,
+ 0x525B, 0x6164, 0x5E68, 0x0C45, 0x4A84, 0x019C, 0x4590, 0x86BA, 0x2A62, 0x76A4, 0xA3B5, 0x53B1,
+ 0x5481, 0x1F53, 0x21BB, 0x1488, 0x8FB5, 0x6F93, 0xB3FF, 0x0E11, 0x129D, 0x5D60, 0x5D73, 0x1B33,
+ 0x6A70, 0x9BAC, 0x3F47, 0x799B, 0x798A, 0x3A3F, 0x095C, 0x47AB, 0x0C9B, 0x91B1, 0x4A6B, 0x0C99,
+ 0x1011, 0x37BC, 0x015A, 0x42BC, 0x117D, 0x3A41, 0x6EA3, 0x7E91, 0x145B, 0x3987, 0x61A1, 0x0B93,
+ 0x4E54, 0x1676, 0x1657, 0x76AE, 0x3572, 0xA5AF, 0x5C71, 0x2CB4, 0x548F, 0x18A5, 0x0C1F, 0x41B8,
+ 0x4575, 0x466A, 0x1819, 0x4779, 0x1426, 0x95BA, 0x2450, 0x050A, 0x1E3B, 0x5B5C, 0x498A, 0x1B52,
+ 0x2A8C, 0x74FF, 0x79BB, 0x62A8, 0x0479, 0xA8B5, 0x8189, 0x0A0F, 0x0E3E, 0x0570, 0x2EB4, 0x5B5F,
+ 0x1A99, 0x3481, 0x55AA, 0x64AA, 0x696B, 0x6F9D, 0xB6BB, 0x5787, 0x1367, 0x626E, 0x0D2F, 0x7BB9,
+ 0x0758, 0x09A7, 0x0D4B, 0xACAD, 0x0C11, 0x0060, 0x0850, 0x0BA7, 0x4C79, 0x4169, 0x3045, 0x0490,
+ 0xB8BB, 0x5075, 0x2B58, 0x6CB5, 0x1577, 0x1C4D, 0x0D94, 0xB7B8, 0xB0BD, 0x0F2D, 0x25AF, 0x143F,
+ 0x9AA8, 0x5C9D, 0x59B5, 0x1E48, 0x3F91, 0x053A, 0x21B0, 0x0098, 0xB0BE, 0x1D3A, 0x8EB6, 0x0D68,
+ 0x0A36, 0x0B2E, 0x07AC, 0x11BA, 0x4B72, 0x0CB3, 0x3FA7, 0x94AC, 0x1789, 0x136B, 0x80BD, 0x5CB4,
+ 0x6F9B, 0x7C9D, 0x3A4D, 0x1E51, 0x47B9, 0x0E1E, 0x38FF, 0x0305, 0x6EAB, 0x5A5B, 0x5E66, 0x5262,
+ 0xB1BC, 0x242B, 0x6E93, 0x1F9B, 0x0229, 0x4344, 0x24B5, 0x0C4B, 0x206F, 0x47BA, 0x3399, 0x0499,
+ 0x7185, 0x0669, 0x1CA9, 0x0C6F, 0x4672, 0x0072, 0x3F6E, 0x658A, 0x154A, 0x3969, 0x859A, 0x0B26,
+ 0x2D31, 0x0F97, 0x858C, 0x5F8B, 0x386C, 0x2A32, 0x1B27, 0x49AD, 0x04A2, 0x6C81, 0x2054, 0x15A7,
+ 0x388D, 0x5DB2, 0x1E56, 0x0161, 0x1AB4, 0x1150, 0x98A7, 0x088B, 0x3491, 0x738D, 0xB0FF, 0x8486,
+ 0x252E, 0x1466, 0x41BE, 0x5C5E, 0x3F5C, 0x90A8, 0x3F53, 0x05B3, 0x249C, 0x708D, 0x5699, 0x697D,
+ 0x1593, 0x0911, 0x5872, 0x8EB4, 0x2A83, 0x6DA9, 0x0C55, 0x2E72, 0x6088, 0x86BE, 0x9DFF, 0x33AB,
+ 0x040B, 0x2B39, 0x3F49, 0x0C46, 0x87A9, 0x21B8, 0x427C, 0x325B, 0x7078, 0x0E78, 0x1249, 0x1D84,
+ 0x1D86, 0x4F82, 0x97A0, 0x5254, 0x2758, 0x4474, 0x2B5E, 0x324E, 0x3374, 0x6471, 0x1688, 0x4574,
+ 0x115B, 0x589F, 0x4FBE, 0x909B, 0x2A9A, 0x38B3, 0x0696, 0x4E8B, 0x56AF, 0x3E55, 0x079C, 0x34A2,
+ 0x4078, 0x1343, 0x4152, 0x07B9, 0x069D, 0x8AA1, 0x7596, 0x0813, 0x7DBC, 0x6C82, 0x325A, 0x727D,
+ 0xAEB4, 0x2DB6, 0x4660, 0x1E62, 0x6D71, 0x2698, 0x1DB9, 0x565A, 0x9EA4, 0x15B8, 0x9EA3, 0x255D,
+ 0x6A9B, 0x1D49, 0x47BD, 0x2D6C, 0x2B50, 0x8DBE, 0x21BD, 0x0B31, 0x11B5, 0x62B3, 0x0913, 0x175B,
+ 0x2367, 0x20B3, 0x8FA6, 0x3948, 0x5A9E, 0x1944, 0x1E84, 0x45B1, 0x77B8, 0x4C5F, 0x579C, 0x08AF,
+ 0x0A24, 0x475E, 0x27AA, 0x31AC, 0xA3AA, 0x0E51, 0x4C8F, 0x036D, 0x305A, 0x82BB, 0x1F44, 0x33A0,
+ 0x1BA1, 0x1326, 0x67B2, 0x058C, 0x2438, 0x6884, 0x145D, 0x3356, 0x2383, 0x2D68, 0x0E94, 0x797F,
+ 0x0009, 0x1C51, 0x2F82, 0x3A80, 0x1A98, 0x6B7A, 0x096A, 0x727B, 0x17B1, 0x3EB5, 0x2F41, 0x3E6E,
+ 0x273A, 0x378D, 0x181F, 0x3693, 0x9195, 0xA6B1, 0x5193, 0x5F83, 0xABAC, 0x3488, 0x66BB, 0x6091,
+ 0x8CAA, 0x9098, 0x89AF, 0x2C3A, 0x1837, 0x96B1, 0x384D, 0x64B5, 0x3D6E, 0x86AD, 0x3199, 0x9FB6,
+ 0x7CAE, 0x7F88, 0x83BB, 0x4C76, 0x7477, 0x01A5, 0x23BD, 0x21B2, 0x2867, 0x2635, 0x7784, 0x3551,
+ 0x8790, 0x469D, 0x0950, 0x4BA1, 0x5D6B, 0x5EAF, 0x5CB2, 0x4FA5, 0x4F8E, 0x1670, 0x55A6, 0x2562,
+ 0x4348, 0x0989, 0x09BF, 0x5859, 0x1A6D, 0x788F, 0x747B, 0x008A, 0x45B2, 0x2E46, 0x74BB, 0x034A,
+ 0xAABD, 0x80B5, 0x7FBA, 0x2A8B, 0x2C30, 0x1F8A, 0x0B33, 0x0F86, 0x3B7C, 0x6F87, 0x669B, 0x19BE,
+ 0x119C, 0x3564, 0x0587, 0x4494, 0x88AC, 0x93BA, 0x2C71, 0x2DA6, 0x0D11, 0x5380, 0x08BA, 0x1D5B,
+ 0x1748, 0x6CBD, 0x0A78, 0x5466, 0x38A5, 0x6E84, 0x7693, 0x3BA7, 0x4046, 0x234A, 0x44AA, 0x6A6B,
+ 0x1460, 0x3648, 0x6C8B, 0x3287, 0x3E47, 0x2089, 0x6A71, 0x4B5E, 0x0841, 0x569A, 0x3A9B, 0x39BA,
+ 0x5777, 0x0C8F, 0x203B, 0x609A, 0x4A6E, 0x0782, 0x075C, 0x0E37, 0xA8AF, 0x0113, 0x2C4D, 0x2C46,
+ 0x3164, 0x04AB, 0x0D10, 0x093B, 0x5D70, 0x3BB7, 0x5B80, 0x014B, 0x282E, 0x0996, 0x5C68, 0x589B,
+ 0x3673, 0x23B1, 0x43B2, 0x3658, 0x66AB, 0x82A6, 0x353B, 0x48BC, 0x0021, 0xB3BE, 0x0FA5, 0x70AE,
+ 0x3E53, 0x263D, 0x5795, 0x3D7F, 0x0254, 0x5799, 0x56BC, 0x3BA0, 0x577D, 0x2343, 0x4EB0, 0x0294,
+ 0x4D5F, 0x5EB8, 0x171F, 0x0435, 0x69BA, 0x979A, 0x8D94, 0x2654, 0x7D81, 0x76B8, 0x4069, 0x466C,
+ 0x5F85, 0x35B1, 0x444C, 0x02B9, 0x5B6A, 0x8F98, 0x76B9, 0x92B3, 0x5CBE, 0x96BD, 0x4B81, 0x3C4E,
+ 0x0341, 0x5CFF, 0x4862, 0x81AA, 0x3674, 0x0359, 0x5569, 0x909F, 0x3169, 0x2735, 0x0770, 0x46FF,
+ 0x3273, 0x9DA5, 0x2F84, 0x3678, 0x3883, 0x045A, 0x9BB4, 0x1F65, 0x6F8A, 0x4BB0, 0x238F, 0x0E6C,
+ 0x3D3F, 0x2DA4, 0x1324, 0x0667, 0x0257, 0x1347, 0x7BAE, 0x0A98, 0x308A, 0x5191, 0x88BD, 0x8D9C,
+ 0x6069, 0x12BE, 0x023B, 0x5688, 0x7389, 0x279F, 0x718B, 0x4F7F, 0x2250, 0x8D96, 0x587D, 0x5066,
+ 0x2998, 0x0A7D, 0x1A70, 0x75B3, 0x2A9B, 0x1EB9, 0x98B9, 0x2C37, 0x00AA, 0x20A8, 0x4268, 0x7CAB,
+ 0x3099, 0x5C8A, 0x92AA, 0xB1B2, 0x53B4, 0x25BD, 0x1832, 0x4859, 0x2F5C, 0x70B0, 0x4B54, 0x1E7A,
+ 0x93A4, 0x0D83, 0x3A6E, 0x4170, 0x2D36, 0x434C, 0x7F82, 0x39A2, 0x7885, 0x364A, 0x59B7, 0x297C,
+ 0x177D, 0x0245, 0x6A96, 0x4D56, 0x3352, 0x287B, 0x3F4A, 0x7E8F, 0x3A8E, 0x0C38, 0x8397, 0x0441,
+ 0x3D5F, 0x3194, 0x838C, 0x38BF, 0x37B2, 0x5AB6, 0x4368, 0x46B5, 0x1145, 0x9CAB, 0x4C7B, 0x1F7C,
+ 0x26B7, 0x1988, 0x162B, 0x7CA5, 0x3675, 0x5368, 0x239D, 0x131B, 0x0E2D, 0x2766, 0x4F53, 0x0B0D,
+ 0x4E8A, 0x54AF, 0x1E1F, 0x0C13, 0x0D7E, 0xA3B3, 0x0A8A, 0x10BE, 0x7183, 0x26A2, 0x373D, 0x2558,
+ 0x079F, 0x3DBB, 0x437C, 0x47B0, 0x5596, 0x25AA, 0x232F, 0x1215, 0x1151, 0x5D64, 0x3F51, 0x0371,
+ 0x0259, 0xAEB2, 0x5EFF, 0x2022, 0xA8B7, 0x06AF, 0x749D, 0x151D, 0x9293, 0x8693, 0x32AA, 0x818C,
+ 0x78BD, 0x2160, 0x3872, 0x5767, 0x38AA, 0x78AF, 0x0EB3, 0x0F91, 0x3475, 0x1093, 0x202B, 0x2D30,
+ 0x32A1, 0x3461, 0x2591, 0x6C70, 0x0849, 0x5162, 0x98BE, 0x0956, 0x2776, 0x63AA, 0x489F, 0x91B8,
+ 0x4D53, 0x859B, 0x05B5, 0x9FA4, 0x0A47, 0x5786, 0x5BA3, 0x0C20, 0x5F6C, 0x288C, 0x75A8, 0x5D90,
+ 0x75BA, 0x123B, 0x2063, 0x35B4, 0x0910, 0x5457, 0x3238, 0x266C, 0x0485, 0x37B0, 0x069C, 0x6A6D,
+ 0x2193, 0x4295, 0x4144, 0x051B, 0x20BD, 0x8E90, 0x2973, 0x2974, 0x4258, 0x419A, 0x2F40, 0x47A0,
+ 0x1668, 0x90A7, 0x4DBF, 0x3D57, 0x3855, 0x8998, 0x7D83, 0x8E94, 0x085E, 0x3DB9, 0x3972, 0x1E27,
+ 0x2B3A, 0x359E, 0x25AB, 0x2B3F, 0x7990, 0x2B30, 0x72BD, 0x2270, 0x59B2, 0x4180, 0x3796, 0x0248,
+ 0x3584, 0x51B9, 0x2D41, 0x1D23, 0x6674, 0x445A, 0x2151, 0x0A8F, 0x86BB, 0x9A9F, 0x44BA, 0x3166,
+ 0x2DBF, 0x93AF, 0x1E46, 0x42FF, 0x8F94, 0x414E, 0x1A21, 0x91AB, 0x23B7, 0x4F65, 0x1214, 0x1250,
+ 0x0A7F, 0x43BF, 0x0A70, 0x33A2, 0x5BAD, 0x0A10, 0x9FA0, 0x1C25, 0x3DAC, 0x80AE, 0x023C, 0x2D5C,
+ 0x556A, 0x1566, 0x307F, 0x5BA1, 0x7277, 0xABBD, 0x5B8E, 0x607A, 0x43BE, 0x1683, 0x4B77, 0x3558,
+ 0x434F, 0x2835, 0x6F8B, 0xABB6, 0x7295, 0x25FF, 0x848F, 0x2BAA, 0x3D7E, 0x72B3, 0x0736, 0x4552,
+ 0x9CA4, 0x4889, 0x4B87, 0x6CA4, 0x4875, 0x528B, 0x2EA1, 0x21AA, 0x234E, 0x1A62, 0x45BE, 0x75B6,
+ 0x2236, 0x3B42, 0x334D, 0x2335, 0x57B1, 0x4BA6, 0x040F, 0x3850, 0x7886, 0x487C, 0x638B, 0x1317,
+ 0x143D, 0x3553, 0x1073, 0x0D99, 0x1B6D, 0xB0BA, 0x9CB0, 0x079D, 0x7C8B, 0x5899, 0x1A51, 0x6FB1,
+ 0x1C53, 0x0411, 0xB3BA, 0x0044, 0x258C, 0x35FF, 0x2246, 0x92B6, 0x9AB4, 0x196C, 0x07A6, 0x43B8,
+ 0x5868, 0x4EB6, 0x3D47, 0xA4B5, 0x7B9C, 0x2894, 0x4162, 0x333E, 0x1CA2, 0x349C, 0x2F49, 0x3F75,
+ 0x363D, 0x4761, 0x2689, 0x2332, 0x263C, 0x8BBC, 0x88AE, 0x82A1, 0x0432, 0x020E, 0x6270, 0x5258,
+ 0x2F67, 0x81A1, 0xA5BD, 0x57A9, 0x329E, 0x4968, 0x39B3, 0x0B22, 0x8FA7, 0x79B5, 0x1633, 0x07AA,
+ 0x94B8, 0x4D71, 0x2F59, 0x00B9, 0x1EA2, 0x1820, 0x69B4, 0x24A0, 0x1AB1, 0x8CAE, 0x1848, 0x4789,
+ 0x17A6, 0x3C8F, 0x5CAC, 0x051C, 0x539C, 0x3DB0, 0x65AD, 0x5962, 0x4EAA, 0x3D4B, 0x203A, 0x37B8,
+ 0x12BF, 0x1B95, 0x0569, 0x22B1, 0x02A6, 0x1CA1, 0x4A5A, 0x0C2C, 0x79B0, 0x0E6B, 0x1583, 0x556C,
+ 0x5264, 0x48AC, 0x0C53, 0x84A8, 0x9BA5, 0x3740, 0x319A, 0x58B1, 0x0EAD, 0xA0B6, 0x7A87, 0x1C4C,
+ 0x30B5, 0x294A, 0x0418, 0x0C0F, 0x02B2, 0x2068, 0x1F32, 0x196B, 0x0F10, 0x1AAD, 0x4C58, 0x006C,
+ 0x298E, 0x5A67, 0x0327, 0x4673, 0xAABC, 0x505E, 0x0311, 0x539F, 0x7C8C, 0x7DAA, 0x527B, 0x171E,
+ 0x454D, 0x3A87, 0x262E, 0x06B9, 0x84B9, 0x66A0, 0x036A, 0x3A68, 0x3AB3, 0xA8BC, 0x7A8E, 0x23B9,
+ 0x2281, 0x195F, 0x4BBF, 0x4450, 0x7E8A, 0x33A7, 0x0F7B, 0x01B4, 0x717E, 0x009A, 0x7B85, 0x2972,
+ 0x708B, 0x4190, 0xA0AD, 0x2161, 0x75B0, 0x1880, 0x1BA5, 0x0626, 0x44AB, 0x3970, 0x4387, 0x1FBC,
+ 0x829C, 0x285A, 0x20B8, 0x1153, 0x02BB, 0x79A8, 0x548C, 0x1FA2, 0x6581, 0x67AF, 0x1EAC, 0x8BBD,
+ 0x5161, 0x0216, 0x50B2, 0x3854, 0x58AB, 0x2460, 0x34A7, 0x33A1, 0x23B6, 0x0546, 0x0335, 0x2AA8,
+ 0x4B84, 0x02B7, 0x899B, 0x68A9, 0x08BC, 0x43BA, 0x1516, 0x0731, 0x142F, 0x0A6A, 0x3DFF, 0x999E,
+ 0x1FB0, 0x2C51, 0xA6B0, 0x3168, 0x0934, 0x40B1, 0x114A, 0x02B0, 0x4271, 0x4C94, 0x6CAA, 0x2E66,
+ 0x39AF, 0x747C, 0x3DAF, 0x2931, 0x8AB8, 0x465E, 0x6CB7, 0x1532, 0x3977, 0x6C89, 0x666A, 0x1F25,
+ 0x6D70, 0x316F, 0x8FB3, 0x0B78, 0x1F2F, 0x93B1, 0x6A85, 0x198A, 0x002A, 0x182D, 0x5484, 0x0D9F,
+ 0x0310, 0x46A1, 0x7A9E, 0x6FB8, 0x3E61, 0x4C61, 0x2F9C, 0x1CBD, 0x303B, 0x2A5F, 0x679F, 0x1C41,
+ 0x1B89, 0x4B6F, 0x5ABB, 0x3E92, 0x285E, 0x0EFF, 0x13A9, 0x0416, 0x45AD, 0xA1B5, 0x62AA, 0x68AE,
+ 0x6B72, 0x2595, 0x477A, 0x94A3, 0x4D8E, 0x2429, 0x4366, 0x464B, 0x0829, 0x0195, 0x0A64, 0x4489,
+ 0x0CB0, 0x1EB4, 0x4DA5, 0x2090, 0x466B, 0x81FF, 0x5FBE, 0x6B9A, 0x57B9, 0x1697, 0x273E, 0x1DFF,
+ 0x989D, 0x15B5, 0x0E29, 0x166B, 0x065E, 0x0E50, 0x064D, 0x3271, 0x303E, 0x2C9A, 0x141D, 0x85BB,
+ 0x91B7, 0x79A4, 0x67AE, 0x768F, 0x08BB, 0x2377, 0x7DA8, 0x2633, 0x5D8F, 0x4FA2, 0x60B7, 0x5B91,
+ 0x5874, 0x0AB5, 0x3C42, 0x6B6E, 0x2F75, 0x3DA9, 0x81AE, 0x1B36, 0x5052, 0x5FA7, 0x0E30, 0x3AB2,
+ 0x2743, 0x89AE, 0x1F99, 0x0AA3, 0x878A, 0x09FF, 0x65A2, 0x6D9A, 0x2D94, 0x5287, 0x2C2F, 0x25BA,
+ 0x8588, 0x2262, 0xA6A8, 0x2E82, 0x1BBC, 0x05B6, 0x149F, 0x3843, 0x1016, 0x23AA, 0x1C70, 0x0431,
+ 0x5584, 0x0D6D, 0x0C79, 0x1C35, 0x3A8F, 0x5961, 0x0A76, 0x1B39, 0x1761, 0x9FB7, 0x5A84, 0x367B,
+ 0x0E8C, 0x1F30, 0x9BA1, 0x0938, 0x1F6C, 0x3183, 0x45AC, 0x585D, 0x0651, 0x13B5, 0x4DA3, 0x86A0,
+ 0x0939, 0x2FA2, 0x1C63, 0x7F95, 0x8DA9, 0x5B6E, 0x7CAC, 0x3B55, 0x1C9C, 0x59A6, 0x232C, 0x64B4,
+ 0x2831, 0x4E6A, 0x1056, 0x828C, 0x4EA5, 0x2F30, 0x687B, 0xA1A5, 0xA3B4, 0x1E49, 0x3593, 0x07A5,
+ 0x5B7B, 0x3BB6, 0x2630, 0x82BC, 0x3E80, 0x6BB5, 0x7BBD, 0x151C, 0x0C5C, 0x7F80, 0x2B6B, 0x58B6,
+ 0x74A3, 0x378C, 0x3D85, 0x5184, 0x5067, 0x6F92, 0x2EB7, 0x0333, 0x429B, 0x0B79, 0x20B6, 0x69FF,
+ 0x0506, 0x2F48, 0x6F73, 0x6BA7, 0x8095, 0x06B5, 0x3891, 0x269C, 0x5C8F, 0x2D74, 0x2885, 0x0951,
+ 0x5AA4, 0x578D, 0x2948, 0x6182, 0x4C86, 0x3148, 0xBBBC, 0x2BAE, 0x10BD, 0x5EB3, 0x4251, 0x5A7D,
+ 0x25BC, 0x1332, 0x2A7E, 0x40AA, 0x3B96, 0x5889, 0xACBA, 0x0857, 0x7090, 0x1CB8, 0x335B, 0x3348,
+ 0x0B77, 0x3AB4, 0x4453, 0x1B84, 0x0A4D, 0x0765, 0x3B47, 0x1445, 0x365B, 0x1058, 0x387B, 0x242E,
+ 0x819D, 0x94B4, 0x113B, 0x3E3F, 0x5391, 0x1570, 0x7CA2, 0x1DAF, 0x2462, 0x2A9C, 0x21A2, 0x37A2,
+ 0x0C80, 0x3B78, 0x607B, 0x1225, 0x58A5, 0x9399, 0x548A, 0x387A, 0x4A78, 0x1F5C, 0x2F88, 0x0C58,
+ 0x5D7C, 0x1393, 0x26FF, 0x1A96, 0x52B7, 0x57AB, 0xA2B6, 0x177A, 0x58B9, 0x08B2, 0x39B6, 0x8594,
+ 0x26AF, 0x48B2, 0x4AB2, 0x1BBE, 0x0E4C, 0x84B7, 0x427D, 0x4A65, 0x90BC, 0x356A, 0x236F, 0x797E,
+ 0x1CAF, 0x94AA, 0x01AF, 0x3545, 0x7C94, 0x497B, 0x289B, 0x9DBD, 0x61B4, 0x0D6B, 0x16B6, 0x416C,
+ 0x2497, 0x2B98, 0x77A2, 0xA3BA, 0x66A6, 0x7094, 0x6EA8, 0x016A, 0x475F, 0x2B63, 0x0221, 0x2463,
+ 0x738C, 0x095D, 0x03B0, 0x012C, 0x80A9, 0x46A4, 0x159C, 0x00B4, 0x2570, 0x4984, 0x96AD, 0x8889,
+ 0x1778, 0x56B0, 0x035C, 0x4090, 0x2240, 0x5CA8, 0x5DA7, 0x94A4, 0x8EAB, 0x8DBC, 0x1D6C, 0x627E,
+ 0x0F8C, 0x354A, 0x0374, 0x089D, 0x1722, 0x83A7, 0x6391, 0x549D, 0x118A, 0x1E68, 0x7188, 0x028E,
+ 0x010F, 0x2EA4, 0x3298, 0x166F, 0x1FA5, 0x2482, 0x0F2B, 0x79AE, 0x22B9, 0x1396, 0x2746, 0x37A8,
+ 0x2FAE, 0x0F3F, 0x62A5, 0x1888, 0x63BC, 0x1D72, 0x1A6B, 0x2566, 0x15AC, 0x309A, 0x5DBF, 0x3639,
+ 0xB4B6, 0x4588, 0x02A5, 0x079E, 0x1C93, 0x2B79, 0x3769, 0xAAFF, 0x2D89, 0x0968, 0x2CBC, 0x25A5,
+ 0x6E85, 0x2CAD, 0x9091, 0x79A9, 0xA0AB, 0x1456, 0x1574, 0x5EA0, 0x69AA, 0x317B, 0x077D, 0x2777,
+ 0x1481, 0x01B0, 0x4E7A, 0x99AB, 0x3CFF, 0x324B, 0x2D58, 0x1765, 0x046D, 0x68B8, 0x0A25, 0x4456,
+ 0x0715, 0x7197, 0x13A0, 0x278D, 0x7FAE, 0x0699, 0x6F90, 0x7AB3, 0xABB8, 0x2DBE, 0x5B8F, 0x0C47,
+ 0x567F, 0x0E4F, 0xB0B1, 0xB1FF, 0x46A6, 0x15AE, 0x3539, 0xA4FF, 0x097E, 0x0936, 0x2CB2, 0x0039,
+ 0x1638, 0x4696, 0x3D90, 0x60AE, 0x4B64, 0x1294, 0x32B1, 0x0337, 0x2077, 0x5071, 0x000E, 0x6881,
+ 0x2691, 0x8D90, 0x3E4F, 0x0361, 0x08BE, 0x77A7, 0x0538, 0x1ABB, 0x6D8C, 0x66A9, 0x327D, 0x045C,
+ 0x5CA7, 0x74B0, 0x282D, 0x5979, 0x0558, 0x9CAD, 0x5BA0, 0x0F5C, 0x4EB8, 0x2F97, 0x2B46, 0x046B,
+ 0x1D68, 0x858B, 0x2E9B, 0x4D82, 0x01A4, 0x1123, 0x0573, 0x2C99, 0x0FB4, 0xAEBF, 0x83BE, 0x80BA,
+ 0x34AD, 0x5458, 0x77A0, 0x66B7, 0x17AB, 0x7194, 0x6D7D, 0x64BB, 0x5D9C, 0xAEB5, 0x87AF, 0x4556,
+ 0x9DB2, 0x5DBB, 0x037C, 0x88A9, 0x3453, 0x0A6E, 0xBBFF, 0x096E, 0x0B35, 0x25AE, 0xA0A8, 0x2B71,
+ 0x090C, 0x284C, 0x5D76, 0x94B5, 0x3668, 0x18BE, 0x6AB5, 0x060F, 0x87B7, 0x173B, 0xA0AF, 0x194B,
+ 0x5869, 0x4E84, 0x0F5F, 0x0A8C, 0x5E9A, 0x1853, 0x5F84, 0x14BE, 0x148A, 0x38A2, 0x7EA7, 0x1261,
+ 0x0230, 0x17A7, 0x2B89, 0x4790, 0x2F70, 0x6A7A, 0x54B6, 0x114B, 0x1E86, 0x8D95, 0x133F, 0x749F,
+ 0x4ABB, 0x8B96, 0x212A, 0x7AA6, 0x526A, 0x0FBA, 0xAEBE, 0x1C6A, 0x6F95, 0x0773, 0x266F, 0x3F6C,
+ 0x2565, 0x0B3B, 0x3E5D, 0x4A94, 0x368B, 0x203E, 0x3085, 0x5CB3, 0x0C8E, 0x59AB, 0x303F, 0x4F66,
+ 0x50B6, 0x51B2, 0x4E5D, 0x2368, 0x38BD, 0x90AF, 0x1527, 0x165C, 0x93A8, 0x1232, 0x6DB1, 0x7A95,
+ 0x99AC, 0x3E7F, 0x1143, 0x2FA6, 0x76BB, 0x4447, 0x1580, 0x89B4, 0x426C, 0x617D, 0x5499, 0x0553,
+ 0x6F7D, 0x1337, 0x8083, 0x868A, 0x7EB7, 0x696F, 0x7C87, 0x0FB7, 0x4C9C, 0x059F, 0x5CB6, 0x577B,
+ 0x80A1, 0x03B8, 0x253D, 0x21BE, 0x2FA5, 0x7FA1, 0x69A3, 0x6CBB, 0x7CB6, 0x4F6A, 0x2A4C, 0xADB5,
+ 0x7D92, 0x13B1, 0x5C85, 0x498D, 0x0A90, 0x4282, 0x2D4C, 0x36FF, 0x1DB0, 0x017F, 0x64A8, 0x57BC,
+ 0x6194, 0x99A2, 0x146E, 0x99BD, 0x377A, 0x6F7B, 0x4F98, 0x1335, 0x4D89, 0x1244, 0x0087, 0x3A54,
+ 0x6DA4, 0x1883, 0x9BB8, 0x2E97, 0x97A8, 0x2687, 0x3235, 0x2389, 0x686B, 0x70B3, 0x3191, 0x6DAD,
+ 0x377E, 0x0205, 0x1436, 0x5B61, 0x476A, 0x134A, 0x61A7, 0x4B51, 0x7CAA, 0x1C7F, 0x285B, 0x7882,
+ 0x55A2, 0x19BD, 0x35A1, 0x07B6, 0x2F42, 0x3FB6, 0x24AB, 0x0A3D, 0x58AA, 0x649A, 0x5F67, 0x1B6F,
+ 0x1B73, 0x1B29, 0x09B6, 0x0576, 0x2B8A, 0x48BF, 0x9BB7, 0x5A6E, 0x407E, 0xA4BD, 0x1F4A, 0x778E,
+ 0x1B6B, 0x3DB3, 0x0070, 0x2E81, 0x3A64, 0x0A0B, 0x0B13, 0x0071, 0x356C, 0xBABB, 0x8792, 0x28AF,
+ 0x3A48, 0x2B9B, 0x6BFF, 0x87AD, 0x658C, 0x4F9F, 0x6AB6, 0x448A, 0x0B4B, 0x2D7B, 0x1228, 0x6BAA,
+ 0x5279, 0x1730, 0x0E5D, 0x5673, 0x7E8B, 0x214E, 0x337C, 0x50B0, 0x92B8, 0x71B8, 0x065D, 0x0E9A,
+ 0x255B, 0x369F, 0x242A, 0x2D3F, 0x3E64, 0x3C44, 0x163F, 0x3AB9, 0x34BF, 0x3799, 0x0085, 0x1241,
+ 0x1897, 0x38AC, 0x1290, 0x4DBA, 0x60A1, 0x5AAB, 0x4674, 0x8BA7, 0x5797, 0x1CAB, 0x0B1C, 0x92A4,
+ 0x0A72, 0x3CB4, 0x1864, 0x50AC, 0x0BB2, 0x8591, 0x6386, 0x2291, 0x59B8, 0x2082, 0x0398, 0x3B40,
+ 0x1E58, 0x0C7B, 0x254D, 0x3C83, 0x094E, 0x1FAE, 0x2E65, 0x8695, 0x44FF, 0x4F9D, 0x083A, 0x1298,
+ 0x7B7F, 0x2293, 0x3BAB, 0x404A, 0x35A8, 0x0A6D, 0x5564, 0x1783, 0x7EB1, 0x24B1, 0x1271, 0x1F9C,
+ 0x1772, 0x3D97, 0x3649, 0x28AC, 0x5992, 0x2772, 0x7391, 0x79B7, 0x175C, 0x139C, 0x1F6D, 0x6676,
+ 0x1FB8, 0xB0BB, 0x4685, 0x1397, 0x8384, 0x8389, 0x2940, 0x80B9, 0x2234, 0x74BE, 0x91A2, 0x0005,
+ 0x1B5B, 0x0CA5, 0x53A4, 0x4D69, 0x0891, 0x286A, 0x0D23, 0x0354, 0x3D5A, 0x8FA8, 0x4070, 0x121A,
+ 0x14BF, 0x7C9F, 0x5F66, 0x06A8, 0x2BFF, 0x7CA4, 0x1119, 0x64B6, 0x5190, 0x2131, 0x6377, 0x338A,
+ 0x5E99, 0x629C, 0x5459, 0x01BD, 0xA3AF, 0x324F, 0x146D, 0x53B3, 0x69AC, 0x3746, 0x64BA, 0x97B0,
+ 0x243B, 0x4679, 0x0984, 0x1A95, 0x4D7E, 0x4D57, 0x191C, 0x267B, 0x5690, 0x80B2, 0x0894, 0x05BB,
+ 0x7787, 0x7A9C, 0x87BB, 0x86BF, 0x091D, 0x90A9, 0x1379, 0x05BA, 0x80A0, 0x0012, 0x2643, 0x31A7,
+ 0x2E62, 0xB4BB, 0x678F, 0x64B3, 0x12AB, 0x46B3, 0x94B7, 0x2F9D, 0x2952, 0x01B5, 0x2597, 0x6268,
+ 0x48A2, 0x4BA8, 0x10AC, 0xA3B2, 0x729B, 0x4785, 0x8B99, 0x3E74, 0x757B, 0x0624, 0x5998, 0x1741,
+ 0x18A0, 0x1A2B, 0x6DA0, 0x8DB0, 0x17B9, 0x157F, 0x48AB, 0x839A, 0x68B4, 0x225E, 0x2B60, 0x3544,
+ 0x739B, 0x1E9B, 0x709B, 0x4DAE, 0x28A1, 0x0FB1, 0x1E45, 0x2F81, 0x4996, 0x4A53, 0x8B8E, 0xA2AE,
+ 0x3246, 0x77A1, 0x2E3D, 0x95B1, 0x505B, 0x017A, 0x496C, 0x7379, 0x1754, 0x5775, 0x4964, 0x3A6A,
+ 0x0722, 0x496D, 0x419D, 0x0C12, 0x7FA9, 0x0C19, 0x3EBF, 0x3997, 0x698C, 0x3372, 0x57B7, 0x26A9,
+ 0x21A5, 0x2580, 0x2736, 0x3E75, 0x214C, 0xB3B8, 0x6076, 0x72A4, 0x1C7D, 0x334B, 0x2E7F, 0x059A,
+ 0x06AD, 0xA3B6, 0x0BB6, 0x0D56, 0x08BF, 0x379C, 0x8EAA, 0x142E, 0x7C95, 0x4051, 0x8A9B, 0x1A84,
+ 0x4462, 0x13BE, 0x52BE, 0x1E55, 0x209E, 0x33B1, 0x16BE, 0x2F66, 0x81AD, 0x0575, 0x309E, 0x4EBF,
+ 0x316C, 0x1CBA, 0x6869, 0x3865, 0x7786, 0x3360, 0x3565, 0x676B, 0x9094, 0x0426, 0x10A7, 0x78AC,
+ 0xA0B5, 0x292C, 0x90A2, 0x4150, 0x209D, 0x1161, 0x2DB4, 0x0B91, 0x5455, 0xA3A8, 0x6890, 0x2EAC,
+ 0x5B82, 0x3785, 0x7088, 0x55AE, 0x74BC, 0x025C, 0x0339, 0x5AA5, 0x0D22, 0x0A44, 0x06BA, 0x66AD,
+ 0x828E, 0x17B6, 0x2093, 0x6E8F, 0x1F4E, 0x0524, 0x0476, 0x249D, 0x2363, 0x6FA4, 0x72A8, 0x5A66,
+ 0x2678, 0x185B, 0x5C89, 0x0B0C, 0xA0B8, 0x545C, 0x1417, 0x6973, 0x51AB, 0x0C6C, 0xA7A8, 0x099F,
+ 0x9AAB, 0x2B49, 0x015C, 0x228B, 0x4F8A, 0x2E92, 0x5260, 0xABBC, 0x0851, 0x0443, 0x606B, 0x6583,
+ 0x0145, 0x41A3, 0x2A80, 0x262B, 0x6695, 0x157B, 0x1B45, 0x1AA4, 0x3CA5, 0x2F64, 0x5089, 0x3EB6,
+ 0x0E95, 0x011E, 0x93B5, 0x3E77, 0x6AAD, 0x989E, 0x2579, 0x81A9, 0x189A, 0x2125, 0x3682, 0x3B74,
+ 0x12B2, 0x4E88, 0x0F54, 0x5F86, 0x98B0, 0x296C, 0x59B0, 0x97B1, 0x7A86, 0x01B7, 0x2B99, 0x4EA1,
+ 0x85AB, 0x8A9F, 0xB9BB, 0x8196, 0x1377, 0x1822, 0x4F74, 0x2E6B, 0x2B97, 0x042B, 0x2829, 0x0AAE,
+ 0x3662, 0x6A7F, 0x619E, 0x2B62, 0x4EBE, 0x58B8, 0x43B1, 0x0618, 0x202C, 0x787E, 0x0578, 0x5274,
+ 0x759E, 0xADB3, 0x323E, 0x7587, 0x6FA9, 0x7991, 0x7F96, 0x5A82, 0x326A, 0x020F, 0x84BE, 0x4767,
+ 0x1154, 0x5379, 0x0B75, 0x0A40, 0x59A5, 0x1535, 0x6AA8, 0x3343, 0x6B98, 0x4B83, 0x98A1, 0x6BBC,
+ 0x2129, 0x13A8, 0x95B5, 0x2A4E, 0x2737, 0x408A, 0x0001, 0x647A, 0x2A59, 0x385D, 0x1B8D, 0x43AF,
+ 0x2941, 0x479A, 0x3F8A, 0xA2BC, 0x608E, 0x43A3, 0x3B51, 0x346F, 0x3EB8, 0x0E53, 0x317E, 0x4154,
+ 0x5763, 0x0CB9, 0x0B84, 0x81B3, 0x88AF, 0x5370, 0x3499, 0x092D, 0x4A97, 0x7B8D, 0x4A88, 0x244B,
+ 0x313E, 0x2472, 0x0833, 0x4280, 0x4463, 0x1E73, 0x618A, 0x0766, 0x3993, 0xA2A5, 0x255C, 0x1475,
+ 0x4898, 0xADB9, 0x5FBB, 0x4D63, 0x6479, 0x0B46, 0x20AC, 0x6C7B, 0x456C, 0x0823, 0x97BF, 0x4378,
+ 0x1953, 0x104A, 0x8F9A, 0x5C7A, 0x80BF, 0x4395, 0x097C, 0x4C9F, 0x839E, 0x68A3, 0x268D, 0x70A7,
+ 0x2F55, 0x1563, 0x9BB0, 0x1315, 0x1C24, 0x639B, 0x04B8, 0x0811, 0x538D, 0x0A46, 0x787B, 0x12AC,
+ 0x7985, 0x11BF, 0x31BF, 0x2DBB, 0x73B6, 0x668F, 0x72AF, 0x397A, 0x5AA8, 0x35BE, 0x1719, 0x6D89,
+ 0x6C7A, 0x55FF, 0x28B0, 0x4972, 0x93AE, 0x6AA3, 0x9FA5, 0x08B7, 0x60AB, 0x67AB, 0x9AA2, 0x1842,
+ 0x93AC, 0x495E, 0x5C9C, 0x3680, 0x2C8C, 0x0567, 0x3163, 0x5FB3, 0x3C57, 0x3263, 0x1587, 0x118D,
+ 0x046F, 0x0756, 0x7383, 0x04AD, 0x8DBA, 0x47A6, 0x19BF, 0x66AA, 0xA3BD, 0x176E, 0x112A, 0x2A95,
+ 0x1931, 0x1A5B, 0x0BB9, 0x2F77, 0x088F, 0x0865, 0x8291, 0x3DA0, 0x7086, 0x5F89, 0x2754, 0x1092,
+ 0x0B4D, 0x2D39, 0x677C, 0x52BF, 0x59A7, 0x51A8, 0x257B, 0x3C9C, 0x72A5, 0x9FBA, 0x1F27, 0x1949,
+ 0x8F9D, 0x0F57, 0x2888, 0x2653, 0x62BB, 0x3CAD, 0x7E90, 0x2988, 0x42B2, 0x0EA4, 0x1DB4, 0x6689,
+ 0x464C, 0x7193, 0x05AB, 0x4FB1, 0x0B64, 0xA3B0, 0x96A9, 0x7792, 0x082F, 0xB3BF, 0xA2AD, 0x1ABD,
+ 0x6B96, 0x4195, 0x36BA, 0x1321, 0x407F, 0x243D, 0x2784, 0x49B3, 0x1EBA, 0x0A45, 0x3042, 0x1E36,
+ 0x5983, 0x646C, 0x18A2, 0x0755, 0x092E, 0x95A3, 0x1521, 0x8592, 0x7186, 0x699E, 0x1645, 0x2638,
+ 0x3D42, 0xABAE, 0x1B3B, 0x1952, 0x6880, 0x162F, 0x0840, 0x36B9, 0x2DB7, 0x06A5, 0x0554, 0x9899,
+ 0x8098, 0x0746, 0x37AD, 0x7C93, 0x0990, 0x3D64, 0x2139, 0x758E, 0x3A49, 0x2B6C, 0x717D, 0x060D,
+ 0x0306, 0x67A1, 0x24A2, 0x5568, 0x141B, 0x2BB8, 0x2F9A, 0x38B2, 0x5D7A, 0x6C6F, 0x1B67, 0x293E,
+ 0x2A34, 0x2B68, 0x66A3, 0x5B88, 0x96A0, 0x3435, 0x4986, 0x1346, 0x6FA3, 0xB1B4, 0x1D82, 0x5F78,
+ 0x799E, 0x56A9, 0x1248, 0x03AD, 0x0459, 0x0C5D, 0x7278, 0x3856, 0x41B9, 0x4A6D, 0x447A, 0x517A,
+ 0x2B86, 0x0961, 0x0CA4, 0x5E90, 0x2159, 0x538F, 0x11A6, 0x848A, 0x76A2, 0x2ABD, 0x17A0, 0x2D92,
+ 0x283F, 0x0386, 0x3E59, 0x99AF, 0x21BC, 0x1648, 0x1C36, 0x0040, 0x1B9E, 0x627F, 0x44B6, 0x3954,
+ 0x0A2C, 0x0594, 0x4050, 0x9AA5, 0x5372, 0x3E82, 0x308C, 0x262D, 0x36BC, 0x0169, 0x7290, 0x464F,
+ 0x7EB0, 0x007A, 0x6C80, 0x235D, 0x6D8F, 0x06A7, 0x103B, 0x50A5, 0x729D, 0x2DAB, 0x9AB3, 0x4C65,
+ 0x4B5D, 0x3147, 0x1887, 0x028F, 0x1B94, 0x4B61, 0x36B5, 0x3278, 0x5182, 0x3D73, 0x44BD, 0x0963,
+ 0x5B64, 0x3698, 0x81AB, 0x5E94, 0x6575, 0x5F92, 0x9BA4, 0x1C81, 0x0C68, 0x0AA1, 0x88BF, 0x7AA8,
+ 0x2EB2, 0x1E6A, 0x8CB5, 0x56B8, 0x0AA9, 0x3B8F, 0x191F, 0x446C, 0x3896, 0x6B99, 0x3DB1, 0x275E,
+ 0x0C9C, 0x77B4, 0x4089, 0x3141, 0x52B6, 0x256E, 0x1D81, 0x12B4, 0x5676, 0x12BC, 0x6C8C, 0x304D,
+ 0x0063, 0x1C72, 0x0B97, 0x87B8, 0x077C, 0x1A59, 0x4D9B, 0x0C3D, 0x1288, 0x7D87, 0x0D65, 0x0579,
+ 0x0B74, 0x6780, 0x7081, 0x4184, 0x466F, 0x47B2, 0x13A6, 0x2ABE, 0x3D94, 0x027B, 0x0C76, 0x6492,
+ 0x5C6F, 0x03FF, 0x0DFF, 0x1E7C, 0xA3A5, 0x5EB2, 0xB6BA, 0x6993, 0x1A3B, 0x1692, 0x64AF, 0x0B63,
+ 0x0664, 0x6165, 0x0E41, 0x276F, 0x4549, 0x7982, 0x8296, 0x11AF, 0x4E82, 0x67BA, 0x3BBD, 0x253A,
+ 0x2868, 0x2EA2, 0x98B6, 0x429D, 0x024D, 0x395B, 0x45BD, 0x7083, 0x7AAF, 0x1695, 0x48A7, 0x394C,
+ 0x19B7, 0x0038, 0x98B4, 0x70AD, 0x0F15, 0x0A26, 0x2795, 0x0A41, 0x7ABB, 0x60BF, 0x24A6, 0x438A,
+ 0x1FAB, 0x2CB9, 0x4AA1, 0x4776, 0x7395, 0x7898, 0x8894, 0x10A1, 0x011A, 0x1C75, 0x1E2E, 0x21B5,
+ 0x89B8, 0x73B1, 0x85FF, 0x445B, 0x0B1E, 0xA2A6, 0x0898, 0xAFBD, 0x71A3, 0x4AAF, 0x9598, 0x257C,
+ 0xADBC, 0x69B5, 0x80A8, 0x12B5, 0x478A, 0x4E5E, 0x7390, 0x459F, 0x8788, 0x358E, 0x1BA6, 0x2842,
+ 0x6982, 0x8396, 0x5F76, 0x0F3E, 0x1BB3, 0x0FB5, 0x56B2, 0x2649, 0x71A1, 0x81BC, 0x039C, 0x779C,
+ 0x1415, 0x5298, 0x396E, 0x0A3F, 0x383C, 0x2474, 0x2A71, 0x2D69, 0x4751, 0x3C85, 0x7FAB, 0x4BAF,
+ 0x1E74, 0x2060, 0x3156, 0x4F7A, 0x5EAE, 0x2A39, 0x1A7A, 0x64A2, 0x0472, 0x0A9A, 0x64BD, 0x658E,
+ 0xA7AC, 0x2136, 0x838A, 0x6590, 0x6174, 0x5582, 0x0598, 0x3E76, 0x389C, 0x3284, 0x155B, 0x081A,
+ 0x43BB, 0x8898, 0x1523, 0x338E, 0x629F, 0x133C, 0x0C81, 0x137A, 0x0F5E, 0x6EB7, 0x1CB1, 0x4950,
+ 0x30B6, 0x2830, 0x1E59, 0x7B94, 0x2C5A, 0x62AB, 0x3567, 0x67B4, 0x15B0, 0x95B0, 0x427B, 0x7FA4,
+ 0x74A8, 0x7191, 0x08B0, 0x868F, 0x7398, 0x33AC, 0x083C, 0x2D6A, 0x1127, 0x354C, 0x2546, 0x194F,
+ 0x0B52, 0x0D61, 0x050D, 0x2488, 0x0352, 0x4BA5, 0x667C, 0x26A5, 0x7B92, 0x1447, 0x368F, 0x555B,
+ 0x09A6, 0x1E6D, 0x4248, 0x0826, 0x216D, 0x5286, 0x73AB, 0x3F90, 0x7584, 0x4157, 0x1796, 0x737D,
+ 0x94A1, 0x62AF, 0x027F, 0x9597, 0x2968, 0x2CB3, 0x8BFF, 0x1280, 0x019F, 0x2860, 0x186C, 0x2A4A,
+ 0x7688, 0x3338, 0x072E, 0x1482, 0x70BF, 0x2C47, 0x1345, 0x3A86, 0x1299, 0x5774, 0x1AAE, 0x0B5B,
+ 0xA7B0, 0x89BA, 0x306A, 0x2A74, 0x6DAF, 0x208F, 0x4CBA, 0x3090, 0x0A23, 0x6CB6, 0x3AB8, 0x98AF,
+ 0x2049, 0x0663, 0x1EAE, 0x197C, 0x80B3, 0x628F, 0x3A96, 0x1EAF, 0x3641, 0x84AE, 0x378A, 0x5993,
+ 0x161E, 0x02A3, 0x379A, 0x2099, 0x5693, 0x105F, 0x109A, 0x47A9, 0x129C, 0x868B, 0x889C, 0x80BE,
+ 0x35BC, 0x09B9, 0x2536, 0x4C8D, 0x536D, 0x1051, 0xA6BA, 0x6186, 0x02AE, 0x121C, 0x2862, 0x5E6E,
+ 0x4176, 0x5FB8, 0x098B, 0x106B, 0x53A0, 0x118C, 0x81B7, 0x0893, 0x414B, 0x6B94, 0x0478, 0x6487,
+ 0x1996, 0x1157, 0x5E7D, 0x0FA0, 0x3F7E, 0x033A, 0x56BD, 0xABBF, 0x255E, 0x6169, 0x47B8, 0x0473,
+ 0xADBB, 0x2030, 0x2371, 0x989C, 0x79AC, 0x0695, 0x56AD, 0x6094, 0x73BE, 0x14A9, 0x5DB7, 0x40B9,
+ 0x3A47, 0x3C96, 0x7879, 0x07B8, 0x90A5, 0x12A3, 0x1D91, 0x87A6, 0x1252, 0x0B2D, 0x2384, 0x017C,
+ 0x4390, 0x0C33, 0x026D, 0x0209, 0x42A7, 0x2C89, 0x146F, 0x19BB, 0x0622, 0x3C6B, 0x1268, 0x76B1,
+ 0x346E, 0x6FAD, 0x213A, 0x4E66, 0x686A, 0x3F99, 0x81B4, 0x55B6, 0x284F, 0x336E, 0x97B4, 0x505C,
+ 0x2359, 0x4160, 0xB1B8, 0x26A1, 0x617A, 0x1A86, 0x8191, 0x236B, 0xA8BA, 0x0C15, 0x0B96, 0x3365,
+ 0x4173, 0x70BB, 0x91AD, 0x1F71, 0x5478, 0x5B5E, 0x3DB2, 0x2071, 0x6266, 0x9198, 0x1162, 0x246F,
+ 0x0036, 0x32AB, 0x1FBA, 0x4159, 0x1798, 0x1E99, 0x8199, 0x6794, 0x619F, 0x5C9F, 0x006D, 0x32FF,
+ 0x20BB, 0x3E8B, 0x70A6, 0x2DA1, 0x063E, 0x5D71, 0x3A4F, 0x89A8, 0x2A86, 0x4461, 0x0E2B, 0x159F,
+ 0x608F, 0x7EB8, 0xB6FF, 0x3CB5, 0x2AB4, 0x5689, 0x72A0, 0xAFB3, 0x98A0, 0x438F, 0x24AE, 0x2677,
+ 0x4285, 0x15B1, 0x40A4, 0x1A7D, 0x3457, 0x84BA, 0x4C6D, 0x52AB, 0xA0BD, 0x86AA, 0x8992, 0x0867,
+ 0x1CB7, 0x595F, 0x1F9F, 0x3F60, 0x3C71, 0x4F70, 0x48B4, 0x8CA3, 0x1677, 0x1639, 0x819E, 0x88B0,
+ 0x7393, 0x60BD, 0x3EBA, 0x2977, 0x07B0, 0x4E86, 0x1982, 0x3F5E, 0x405C, 0xA7B6, 0x528A, 0x6D78,
+ 0x05A9, 0x9AA6, 0x0A1B, 0x5397, 0xB3B7, 0x2AAD, 0x565D, 0x1440, 0x5DA5, 0x40B4, 0x6679, 0x1CA8,
+ 0x154E, 0x676D, 0x3277, 0x10A5, 0x66B6, 0x48A3, 0x208E, 0x0B25, 0x2B78, 0x2067, 0x2E8C, 0x7ABC,
+ 0x126D, 0x30AA, 0x1DB5, 0x838F, 0x2278, 0x50FF, 0x5EB6, 0x9BBE, 0x5B7D, 0x0392, 0xAFB8, 0x2447,
+ 0x0D2C, 0x1174, 0x337F, 0x6670, 0x909A, 0x3C90, 0x96AF, 0x1D2F, 0x3F9D, 0x2CBE, 0x327F, 0x3A84,
+ 0x91A9, 0x74AA, 0x8BB9, 0x3DAA, 0x7EA2, 0x92BD, 0x1D20, 0x488F, 0xA2FF, 0x1033, 0x0122, 0x1B96,
+ 0x7D8D, 0x415B, 0x0A99, 0x3985, 0x122F, 0x33AA, 0x84A0, 0x317F, 0x356B, 0x516C, 0x79BE, 0x39A6,
+ 0x34B5, 0x677D, 0x7C82, 0x91BD, 0x0FA4, 0x4874, 0x4151, 0x165A, 0x2981, 0x859D, 0x6BBA, 0x3CB9,
+ 0x417E, 0xA6B4, 0x12B1, 0x68FF, 0x6CBC, 0x40BC, 0x0383, 0x5498, 0x828B, 0x4E62, 0x3051, 0x30BF,
+ 0x343E, 0x27BD, 0x15B3, 0x19A4, 0x46A9, 0x4562, 0x0794, 0x46BA, 0x489B, 0x11B6, 0x354E, 0x0A30,
+ 0x8CB4, 0x3F80, 0x8084, 0x9BFF, 0x1B99, 0x4061, 0x3A81, 0x444A, 0x0086, 0x809F, 0x2355, 0x057B,
+ 0x2473, 0x6387, 0x2299, 0x3187, 0x0A85, 0x24AF, 0x3AAB, 0x89B1, 0x1369, 0x1088, 0x4181, 0x5394,
+ 0x7DAD, 0x339F, 0x217E, 0x166E, 0x0D26, 0x2A4F, 0x176C, 0x7EB5, 0x2F3A, 0x1C57, 0x4045, 0x8082,
+ 0x1C52, 0x043B, 0x46BE, 0x9CB3, 0x3CB3, 0xB9BE, 0x8697, 0x5AB7, 0x92B0, 0x3177, 0x3149, 0x1963,
+ 0x839D, 0x18A1, 0x4B55, 0x279A, 0x177B, 0x4BA3, 0x207A, 0x64A3, 0x1868, 0x5C77, 0xB1BB, 0x8FBB,
+ 0x2432, 0x235F, 0x6769, 0x1624, 0x102D, 0x217B, 0x3894, 0x1FBB, 0x6A89, 0x1D74, 0x166A, 0x4457,
+ 0x3563, 0x044A, 0x091C, 0x75BB, 0x1756, 0x6075, 0x145A, 0x6C9D, 0x0147, 0x7FBF, 0x29B3, 0x20A4,
+ 0x125F, 0x0324, 0x3FFF, 0x054B, 0x3B3F, 0x5794, 0x77BA, 0x33A5, 0x045B, 0x183B, 0x8DA7, 0x1CA6,
+ 0x36B4, 0x42A3, 0x237B, 0x9EA1, 0x008F, 0x2D87, 0x5F98, 0x0948, 0x2F3F, 0x1834, 0x1D6D, 0x7AAE,
+ 0x69AD, 0x89A6, 0x1977, 0x1651, 0x1C76, 0x45BC, 0x2175, 0x457E, 0x58A6, 0x9AA0, 0x4DAB, 0x389D,
+ 0x25B9, 0x727E, 0x0AB2, 0x69BC, 0x284E, 0x4482, 0x1318, 0x1A6C, 0x1731, 0x1681, 0x6B82, 0x939C,
+ 0x458C, 0x6577, 0x58B5, 0x8FAA, 0x7D9A, 0x1EB2, 0x8496, 0x496A, 0x7D82, 0x1BBB, 0x0914, 0x1A2E,
+ 0x5EB0, 0x3AB1, 0x0082, 0x0D37, 0x3D5D, 0x203D, 0x4AB3, 0x626C, 0x2864, 0x6E73, 0x23A1, 0x6C9C,
+ 0x314C, 0x769F, 0x202A, 0x68B6, 0x4A85, 0x194D, 0x308D, 0x05B4, 0x263F, 0x2FBE, 0x0307, 0x2F94,
+ 0x2427, 0x2E9A, 0x85B3, 0x14B1, 0x849A, 0x2667, 0x1133, 0x606C, 0x0B99, 0x55B7, 0x57BB, 0x68BF,
+ 0x1B66, 0x428A, 0x37AE, 0xA1AA, 0x3873, 0x0032, 0x3FB3, 0x0DAF, 0x80AD, 0x0395, 0x3496, 0x3ABD,
+ 0x54BD, 0x3F4F, 0x1499, 0x93B4, 0x03B9, 0x3BB5, 0x486C, 0x0D2E, 0x44AD, 0x2BB4, 0x399D, 0x1255,
+ 0x6D84, 0x0DAC, 0x94BD, 0x14B6, 0x4273, 0x0D15, 0x7B88, 0x9199, 0x46AB, 0x6586, 0x3FB8, 0x2A33,
+ 0x2D49, 0x3E63, 0x7B98, 0x49AF, 0x687C, 0x0974, 0x5CA6, 0x0B5A, 0x5667, 0x1E82, 0x6DA3, 0x0F1F,
+ 0x5B67, 0x67FF, 0x698A, 0x73A4, 0x1A33, 0x1C78, 0xA3AB, 0x616E, 0x0675, 0x6673, 0x4585, 0xADAE,
+ 0x1399, 0x4880, 0x14A5, 0x4098, 0x7E9E, 0x1777, 0x8587, 0x7199, 0x739E, 0x254B, 0x0585, 0x0E23,
+ 0x0124, 0x5BB4, 0x0C65, 0x0E6E, 0x76A9, 0x0350, 0x8EB7, 0x2C81, 0x3758, 0x029C, 0x0D80, 0x0D5B,
+ 0x14B0, 0x36AB, 0x04A9, 0x9FFF, 0x11A3, 0x3E57, 0x4649, 0x4B82, 0x348F, 0x4F61, 0x4F5C, 0x0590,
+ 0x505F, 0x6DB2, 0x558E, 0x5589, 0x3274, 0x306E, 0x0184, 0x8795, 0x3741, 0x07A4, 0x2586, 0x318F,
+ 0x6975, 0x5DB5, 0x8EAD, 0x17A4, 0x1076, 0x1394, 0x18B4, 0x1E23, 0x3562, 0x3849, 0x007D, 0x657B,
+ 0x1B1F, 0x79B3, 0x1372, 0x6D8E, 0x6997, 0x8B9A, 0x5790, 0x2893, 0x4E78, 0x01B3, 0x93B9, 0x2571,
+ 0x0DA3, 0x65B5, 0x41A8, 0x0055, 0x3D60, 0x7093, 0x2E6A, 0x22B8, 0x0924, 0x193B, 0x1D6E, 0x1847,
+ 0x1CB3, 0x2D6B, 0x5BB3, 0x2EBB, 0x28B8, 0x8991, 0x50A1, 0x4D9A, 0x7A80, 0x3E6D, 0x098C, 0x8CBA,
+ 0x0A96, 0x2E9C, 0x3F72, 0x1094, 0xB1B6, 0x5476, 0x0949, 0x889E, 0x3774, 0x0111, 0x56AC, 0x48BD,
+ 0x2366, 0x9E9F, 0x1B70, 0x9DAD, 0x658B, 0x2750, 0x1067, 0x049C, 0x1CB0, 0x7299, 0x4689, 0x1CB4,
+ 0x1E9F, 0x3151, 0x0D9E, 0x666E, 0x0E1B, 0x6B73, 0x667B, 0x2D34, 0x6EA7, 0x223B, 0x1432, 0x7EB3,
+ 0x457F, 0x324D, 0x6AA6, 0xA7AA, 0x474F, 0x5F96, 0x6D91, 0x6E7D, 0x15A2, 0x7687, 0x2D3E, 0x3846,
+ 0x6568, 0x3EA6, 0x292B, 0x8FBE, 0x0186, 0x0405, 0x4C67, 0x616D, 0x85A6, 0x39BE, 0x16B4, 0x2F6E,
+ 0x92A7, 0x01BB, 0x5C92, 0xADB0, 0x1E39, 0x293D, 0x7D99, 0x036B, 0x889A, 0x01A9, 0x2632, 0x9AB6,
+ 0x04B5, 0x028A, 0x5E8E, 0x1A7E, 0x072F, 0x67B5, 0x285D, 0x2DB9, 0x0278, 0x21AD, 0x2761, 0x51B4,
+ 0x8387, 0x5687, 0x2380, 0x2346, 0x2080, 0x204C, 0x758C, 0x0AB7, 0x1A47, 0x85A7, 0x12B0, 0x5470,
+ 0x1F84, 0x2436, 0x056A, 0x425F, 0x2BA8, 0x0918, 0x2991, 0x0EAA, 0x5B79, 0x7A94, 0x7FB2, 0x4D87,
+ 0x34BB, 0x599E, 0x43BD, 0x81A6, 0x0C52, 0x5058, 0xA8B8, 0x548B, 0x94BC, 0x5A5F, 0x0A0D, 0x0226,
+ 0x4C5C, 0x2137, 0x0494, 0x308F, 0x184F, 0xADAF, 0x77B0, 0x4650, 0x3E9F, 0x1A36, 0x7382, 0x576E,
+ 0x1095, 0x4FB4, 0x1AB7, 0x11A1, 0x5E70, 0x586B, 0x074A, 0x4AAA, 0x0799, 0x0E92, 0x4499, 0x94A2,
+ 0x9DA6, 0x2445, 0x77B7, 0x076F, 0x23AE, 0x5F69, 0x7C88, 0x3547, 0x1D80, 0x77B1, 0x3BA5, 0x31A6,
+ 0x2EBE, 0x4C77, 0x077E, 0x1116, 0x6CA0, 0x31B4, 0x5473, 0x718F, 0x8B9B, 0x2641, 0x2441, 0x8C91,
+ 0x446B, 0x92A8, 0x0B70, 0x0E22, 0x1EA6, 0x1C42, 0x4786, 0x2F93, 0x6375, 0x767E, 0x0281, 0x219A,
+ 0xB2B6, 0x0223, 0x7EAF, 0x759D, 0x2FB3, 0x1025, 0x2F3C, 0x7582, 0x5C6E, 0x5086, 0x1483, 0x81A4,
+ 0x00AF, 0x1E5E, 0x3757, 0x1D2E, 0x6C9B, 0x1FBF, 0x0F4C, 0x849E, 0x2541, 0x4652, 0x307C, 0x386A,
+ 0x2662, 0x4EB4, 0x05B8, 0x1893, 0x87BF, 0x018D, 0x0A52, 0x0629, 0x5764, 0x1AA6, 0x859F, 0x1124,
+ 0x0CFF, 0x084A, 0x609C, 0x0C69, 0x1620, 0x638E, 0x8ABF, 0x65BE, 0x3E54, 0x144F, 0x1D4A, 0x2B90,
+ 0x0B14, 0x0A5F, 0x636B, 0x288E, 0xA2B3, 0x43B5, 0x76A0, 0x4096, 0x8FAD, 0x7D8F, 0xA8B3, 0x2D67,
+ 0x90AC, 0x898B, 0x131D, 0x3D84, 0x3687, 0x0440, 0x2265, 0x276B, 0x899A, 0x989A, 0x5AA1, 0x9FA3,
+ 0x8B94, 0x579B, 0x078D, 0x32BA, 0x3236, 0x52AD, 0x3793, 0x43AB, 0x1148, 0x2324, 0x6281, 0x1776,
+ 0xACFF, 0x3EFF, 0x0E9C, 0x30A1, 0x198F, 0x102C, 0x5D94, 0x0F18, 0x75A5, 0x0448, 0x70A3, 0x44AC,
+ 0x1875, 0x1B44, 0x5DBA, 0x04B7, 0x275D, 0x294F, 0x1217, 0x1B88, 0x0C21, 0x08A2, 0x3D5B, 0x5CAA,
+ 0x6BA3, 0x1733, 0x4146, 0x3841, 0x6273, 0x99A0, 0x679A, 0x2D80, 0x147B, 0x4D9F, 0x0CAE, 0x1196,
+ 0x60B5, 0x3979, 0x29AF, 0xB8FF, 0x0C3E, 0x2E8F, 0x2334, 0x4370, 0x05B2, 0x4B91, 0x65B0, 0x03BE,
+ 0x2230, 0x78A2, 0x247A, 0xA3A9, 0x2C68, 0x1FBE, 0x34A0, 0x4749, 0x7EA1, 0x427F, 0x2227, 0x5570,
+ 0x525A, 0x707E, 0x2939, 0x4A59, 0x1596, 0x0E1A, 0x31A3, 0x0049, 0x569C, 0x11BD, 0x1129, 0x8D9E,
+ 0x1358, 0x1131, 0x86B2, 0x2F71, 0x909D, 0x3BA9, 0x293B, 0x76B2, 0xA3FF, 0x6F9E, 0x4A4E, 0x96BF,
+ 0x4250, 0x134C, 0x215A, 0x7386, 0x3385, 0x3DA1, 0x168B, 0x6D8A, 0x024E, 0x179C, 0x5A94, 0x2C7F,
+ 0x66BC, 0x3443, 0x387D, 0x3B7F, 0x7EB6, 0x0096, 0x2243, 0x6C99, 0x2D57, 0x3546, 0x128B, 0x656C,
+ 0x3C6C, 0x3659, 0x485B, 0x0D66, 0x35AA, 0x509D, 0x56A5, 0x33AF, 0x558A, 0x2749, 0x2F44, 0x58A9,
+ 0x65B3, 0xABB3, 0x1DBF, 0x88A8, 0x064A, 0x7E98, 0x197F, 0x3A61, 0x688F, 0x0B43, 0x1828, 0x97BB,
+ 0x1A4C, 0x40AC, 0x199F, 0xAFB5, 0x117C, 0x1782, 0x476E, 0xB8BC, 0x3C74, 0x1142, 0x0F79, 0x7E84,
+ 0x0B1D, 0x058E, 0x1F34, 0x646B, 0xADB7, 0x0D21, 0x4A5F, 0x98A6, 0x141E, 0x97BA, 0x0A7E, 0x86A6,
+ 0x97B6, 0x5561, 0x092A, 0x293F, 0x53AB, 0x4B7E, 0x1254, 0x909C, 0x12BB, 0x0237, 0x1C61, 0x3853,
+ 0x86A3, 0x8288, 0x8D9B, 0x071A, 0x0F83, 0x237C, 0x8C9A, 0x4CAD, 0x4EAF, 0x1C79, 0x1678, 0x4279,
+ 0x1938, 0x1935, 0x40A9, 0x3788, 0x4265, 0x037F, 0x39BF, 0x1360, 0x1640, 0x676E, 0x5A5C, 0x2244,
+ 0x020A, 0x1831, 0x17FF, 0x0B5E, 0x7ABD, 0x192D, 0x68B2, 0x9EA7, 0x0621, 0x47AF, 0x68A0, 0x0F24,
+ 0x579D, 0x0FAF, 0x809E, 0x95B4, 0x0C94, 0x04AF, 0x3A90, 0x86AB, 0x0673, 0x0CBD, 0x5567, 0x5485,
+ 0x5FAB, 0x9DB0, 0x50B4, 0x2794, 0x92B9, 0x048B, 0x09B3, 0x0779, 0x192F, 0x8B92, 0x315A, 0x245C,
+ 0x6184, 0x74A4, 0x2A37, 0x0B88, 0x35A6, 0x1E8A, 0x586A, 0x728D, 0x85A8, 0x34B1, 0x8595, 0x719E,
+ 0x02B5, 0x1956, 0x495A, 0x5BB0, 0x058F, 0x6AA2, 0x7F93, 0x6384, 0x196D, 0x5583, 0x2A47, 0x1216,
+ 0x6373, 0x1D4C, 0x2AA2, 0x0919, 0x52B2, 0x1D99, 0x0F38, 0x4662, 0x1C2A, 0x2A41, 0x1B87, 0x00A4,
+ 0x155D, 0xA0A6, 0x808C, 0x3245, 0x0723, 0x168D, 0x1178, 0x0ABD, 0x3054, 0x9095, 0x224D, 0x1973,
+ 0x8B9E, 0x2E4A, 0x2499, 0x2970, 0x2943, 0x468A, 0x395F, 0x7FA0, 0x1269, 0x243C, 0x4A7E, 0x309B,
+ 0x2486, 0x7EBC, 0x4FAE, 0x747E, 0x4B5F, 0x529B, 0x548E, 0x64BF, 0x55A3, 0x137D, 0x1D9A, 0x11AB,
+ 0x49A3, 0x48AE, 0x2A2E, 0x3E6B, 0x144A, 0x65A8, 0x2D65, 0x2785, 0x2452, 0x0B57, 0x314E, 0x1B93,
+ 0x08A3, 0x4C5B, 0xA7B2, 0x3984, 0x5AB1, 0x2A6D, 0x2961, 0x4DB0, 0x6775, 0x1A41, 0x3EAF, 0x6A84,
+ 0x28A7, 0x0CB6, 0x51B6, 0x1C56, 0x568C, 0x1081, 0x667F, 0x2B74, 0x1E92, 0x078F, 0x3439, 0x1C39,
+ 0x2DB5, 0x0B38, 0x0330, 0x3349, 0x2C60, 0x6196, 0x368A, 0x5D7E, 0x1D79, 0x222D, 0x5DB3, 0x64BE,
+ 0x45B6, 0x6DB6, 0x4175, 0x0396, 0x447F, 0x40AB, 0x1967, 0x2E37, 0xA7B3, 0x4B59, 0x3E99, 0x75A6,
+ 0x3392, 0x7E9F, 0x2DBC, 0x12AF, 0x96A8, 0x8DAE, 0x5984, 0x5974, 0x6DAB, 0x0798, 0x39BC, 0x45B0,
+ 0x3A4C, 0x1381, 0x2778, 0x4CAB, 0x4CAC, 0x65B4, 0x28B9, 0x2F7E, 0x2B83, 0x7A99, 0x27A2, 0x1160,
+ 0x3FB0, 0x0326, 0x84A3, 0x6BA6, 0x557F, 0x2C57, 0x0816, 0x1C98, 0x8789, 0x3A42, 0x055A, 0x208C,
+ 0x143B, 0x0583, 0x4476, 0xA6A9, 0x8A98, 0x05AF, 0x0CBA, 0x3795, 0x5A6C, 0x69B8, 0x0003, 0x547D,
+ 0x0862, 0x5DBD, 0x425E, 0x3A99, 0x0364, 0x297F, 0x21A3, 0x0E57, 0x313F, 0xA1B9, 0xB3B9, 0x2079,
+ 0x080F, 0x686F, 0x2FA9, 0x005B, 0x0E58, 0xB3BB, 0x8891, 0x0C85, 0x82A9, 0x7491, 0x69BE, 0x5F62,
+ 0x2255, 0x4161, 0x81BA, 0x08A7, 0x138E, 0x84A5, 0x0C1D, 0x0079, 0x6DA7, 0x031D, 0x19A2, 0xA9B7,
+ 0x5E7B, 0x0D4D, 0x48A4, 0x20BE, 0x869C, 0x2790, 0xA0A2, 0x6C8F, 0x314B, 0x0C41, 0x0615, 0x3248,
+ 0x1134, 0xA5A9, 0x364F, 0x87BD, 0x42B5, 0x2FA1, 0x708C, 0x6972, 0x8FB2, 0x319C, 0x3F7C, 0x7476,
+ 0x6381, 0x0388, 0x5265, 0x0E67, 0x7484, 0x33B0, 0x056B, 0xAEB7, 0x60BB, 0x8996, 0x30AD, 0x0EBF,
+ 0x080E, 0x7BA6, 0x2329, 0x4FB8, 0x8B91, 0x34AC, 0x1320, 0x2D72, 0x14BB, 0x1050, 0x99A7, 0x0A9B,
+ 0x8791, 0x329A, 0x3368, 0x45A5, 0x3653, 0x4FB6, 0x61B6, 0x4F5F, 0x2834, 0x3A9C, 0x1655, 0x2D3A,
+ 0x6D9E, 0x128C, 0x4796, 0x1A69, 0x1594, 0x6988, 0x0C5A, 0x1B9D, 0x8699, 0x3667, 0x76B6, 0x0F16,
+ 0x294B, 0x0A39, 0x1A9F, 0x2792, 0x8182, 0x1E2F, 0x0BAE, 0x7D91, 0x8F93, 0x283B, 0x3A5C, 0xA0BB,
+ 0x4A69, 0x1BA4, 0x07A2, 0x1667, 0x7FBC, 0x65A4, 0x1540, 0x7692, 0x057C, 0x0277, 0x217A, 0x6F96,
+ 0x1CA4, 0x7591, 0x2E86, 0x66AF, 0x139F, 0x4369, 0x293C, 0x9EAF, 0x116B, 0x394E, 0x37B7, 0x499E,
+ 0x4F95, 0x114F, 0x1433, 0x164E, 0x00B5, 0x5BAA, 0x2EBA, 0x3B66, 0x18BA, 0x5D9D, 0x1FAC, 0x869F,
+ 0x63A2, 0x1AA7, 0x1B8F, 0x2627, 0x4495, 0x0183, 0x1A63, 0x4666, 0x5F6F, 0x2B8B, 0x7EA8, 0x2B41,
+ 0x6A83, 0x212F, 0x8899, 0x086C, 0x0FFF, 0x777F, 0x4263, 0x36A7, 0x0790, 0x7F8F, 0x005D, 0x7298,
+ 0x7779, 0x76A8, 0x3879, 0x24FF, 0x143A, 0x67B9, 0x25B8, 0x2294, 0x7F9B, 0x0D82, 0x5FBF, 0x999A,
+ 0x373F, 0x0B21, 0x4695, 0x3F61, 0x2021, 0x407D, 0x6465, 0x8394, 0x5679, 0x1BFF, 0x2DA2, 0x69A2,
+ 0x2E5C, 0x75AF, 0x23A4, 0x3384, 0x6A9C, 0x63A6, 0x3BAF, 0x2A4D, 0x3A58, 0x1A97, 0x0C48, 0x0434,
+ 0x84BD, 0x6593, 0x78A1, 0x677A, 0x5099, 0x6E88, 0x6789, 0x3B73, 0x67B6, 0x5972, 0x258B, 0x2478,
+ 0xA1BD, 0x113D, 0x0C86, 0x777D, 0x0E44, 0x2483, 0x17AE, 0x16A0, 0x479C, 0x53B6, 0x75B7, 0x8488,
+ 0x4E4F, 0x7CBA, 0x3EB7, 0x0DB1, 0x0C7E, 0x3F4E, 0x1F3B, 0x2B48, 0x7B9F, 0x2357, 0x306C, 0x9AAF,
+ 0x062D, 0x75AC, 0x565B, 0x171D, 0x4D97, 0x215D, 0x0075, 0x0A82, 0x637B, 0x5E76, 0x9BB9, 0x7B9B,
+ 0x6C88, 0x29B1, 0x1581, 0x596B, 0x05A1, 0x0FA3, 0x79BA, 0x1338, 0x0C40, 0x1B46, 0x6F75, 0x0B55,
+ 0x5B7C, 0x37B5, 0x4AA5, 0x2C65, 0x7385, 0x4172, 0x3396, 0x97BD, 0x1C4F, 0x1BBA, 0x1FFF, 0x4067,
+ 0x4953, 0x339E, 0x4352, 0x248D, 0x818B, 0x507B, 0x47B5, 0x5CAE, 0x4866, 0x1C59, 0x50A8, 0x7071,
+ 0x7184, 0x3088, 0x1D92, 0x80B8, 0x3A44, 0x55BF, 0x6A8A, 0x18B1, 0x23BC, 0x5F64, 0x08B1, 0x7D89,
+ 0x283D, 0x9EB7, 0x13A7, 0x205C, 0x26A3, 0x56A3, 0x4584, 0x0B7D, 0x6DB9, 0x02AF, 0x69B3, 0x4EB1,
+ 0x052F, 0x4492, 0x5D88, 0x5E8B, 0x070E, 0x7588, 0x7B80, 0x0F22, 0x1E31, 0x246D, 0x52BD, 0x508C,
+ 0x6FA2, 0x3A85, 0x83B9, 0x2942, 0x1643, 0x6991, 0xA1AF, 0x00A7, 0xA8A9, 0x67B3, 0x2B93, 0x5D77,
+ 0x0265, 0x6994, 0x5A7B, 0x7297, 0x4FBC, 0x4451, 0x1D31, 0x2E3B, 0x528E, 0x1B1D, 0x189E, 0x0B15,
+ 0x4B86, 0x4554, 0x97A3, 0x5560, 0xA8BB, 0x1C28, 0x15AF, 0x78B9, 0x64B8, 0x417D, 0x25A6, 0x7B89,
+ 0x55B5, 0x2176, 0x446F, 0x01AC, 0x6D72, 0x4E53, 0xA0BA, 0x4560, 0x3A46, 0x569B, 0x2896, 0x2585,
+ 0x6579, 0x121D, 0x021D, 0x5662, 0x4E58, 0x0B56, 0x0338, 0x1536, 0x3A77, 0x86BC, 0x1976, 0x1642,
+ 0x4766, 0x5FB2, 0x2D4A, 0x39A1, 0x48B8, 0x3890, 0x8293, 0x88A7, 0x001C, 0x586C, 0x207F, 0x858E,
+ 0xA1B3, 0x517F, 0x575D, 0x326B, 0x0475, 0x2E89, 0x2E84, 0x18B2, 0x333B, 0x304A, 0x060E, 0x7192,
+ 0x2046, 0x238B, 0x1B47, 0x6FBD, 0x3F46, 0x7DB7, 0x1C99, 0x259B, 0x10AB, 0x37AB, 0x5B68, 0x4550,
+ 0x1C94, 0x7CFF, 0x16AF, 0x9FAF, 0x3874, 0x188F, 0x5658, 0x8896, 0x27BF, 0x434E, 0x3D9E, 0x1325,
+ 0x86A5, 0x0A71, 0x3292, 0x10B0, 0x3192, 0x558C, 0x3570, 0x7384, 0x3F55, 0x0D84, 0x6167, 0x4850,
+ 0x1D96, 0x6A77, 0xAFBE, 0x2555, 0x165F, 0x3282, 0x508F, 0x0471, 0x8D91, 0x71B4, 0x4589, 0x2651,
+ 0x042C, 0x3B50, 0x1F70, 0x2040, 0x44A8, 0x5A7F, 0x1597, 0x4748, 0x286B, 0xA7AD, 0x0884, 0x34B2,
+ 0x6288, 0x155A, 0x7ABA, 0x1B71, 0x2D81, 0x2E67, 0x5886, 0x4377, 0x478E, 0x046E, 0x6F89, 0x4883,
+ 0x3096, 0x3B94, 0x3295, 0x1018, 0x3981, 0x56A4, 0x637E, 0x9DB9, 0x666F, 0x1939, 0x0290, 0x87A1,
+ 0x0648, 0x61AD, 0x49B8, 0x10B5, 0x33AE, 0x6BAF, 0x59BE, 0x5669, 0x2F73, 0x1113, 0x0E4E, 0x2453,
+ 0x3959, 0x4587, 0x0E5E, 0x2189, 0x1144, 0x1978, 0x65BA, 0x2F78, 0x26B9, 0x93A7, 0x2E8D, 0x1DB3,
+ 0x2949, 0x3663, 0x2C59, 0x0F9E, 0x3B48, 0x163A, 0x0DBE, 0x8DBB, 0x7BA3, 0x1EB0, 0x12B7, 0x0692,
+ 0x4970, 0x679B, 0x5283, 0x232D, 0x7D9E, 0x6E97, 0x1617, 0x3690, 0x334E, 0x0056, 0x0130, 0xB7BA,
+ 0x3CBD, 0x1A60, 0x3696, 0x01AD, 0x546E, 0x96BB, 0x36A9, 0x2AA3, 0x5D87, 0x0014, 0x1B80, 0x1769,
+ 0x487E, 0x10B2, 0x60BC, 0x28A9, 0x5157, 0x2199, 0x7597, 0x638A, 0x1B82, 0x8CAC, 0x6078, 0x6BA4,
+ 0x68BE, 0x0CA3, 0xB0B9, 0x036E, 0x1AA2, 0x4F59, 0x8090, 0x3C40, 0x3382, 0x00AB, 0x1F5A, 0x44B8,
+ 0x2096, 0x204F, 0x2085, 0x64AB, 0x669A, 0x629B, 0x267C, 0x0DB4, 0x3FB4, 0x338C, 0x021F, 0x1960,
+ 0x35AC, 0x2EB3, 0x6096, 0x2798, 0x0945, 0x1D24, 0x5E91, 0x1D3F, 0x006A, 0x30AE, 0x6D7F, 0x9EA0,
+ 0x44A2, 0x6777, 0x47FF, 0x4878, 0x397C, 0x7388, 0x609E, 0x23BB, 0x2E6F, 0x04A6, 0x05AD, 0x3B80,
+ 0x4B79, 0x1C9E, 0x537F, 0xA6B8, 0x0C3A, 0x2E51, 0x174F, 0x677B, 0x6D9B, 0x0B42, 0x78BF, 0x26BC,
+ 0x046A, 0x3A43, 0x096D, 0x43AD, 0xB6B8, 0xA1A9, 0x1A1D, 0x90B4, 0x2639, 0x344C, 0x0E82, 0x51BB,
+ 0x1115, 0x0527, 0x2B9C, 0x6DBA, 0x7EA3, 0x4FA9, 0x27B5, 0x2F4C, 0x68B9, 0x11BB, 0x5E60, 0x1951,
+ 0x0212, 0x2549, 0x45BA, 0x499A, 0x448B, 0x1B7E, 0x29A1, 0x206C, 0x65AE, 0x0540, 0x61A8, 0x10A3,
+ 0x4CBB, 0x7A8A, 0x7483, 0xA1B1, 0x6FB2, 0x364E, 0x004D, 0x4148, 0x3CB6, 0x0F63, 0x3062, 0x1D32,
+ 0x3152, 0x7486, 0x9BBC, 0x767B, 0x187D, 0x3F92, 0x4778, 0x0520, 0x6E8C, 0x0F6A, 0x7BBF, 0x125D,
+ 0x39A5, 0x597E, 0x0107, 0x184C, 0x0F52, 0x0644, 0x8094, 0x688B, 0x1A80, 0x1A3C, 0x8995, 0x8493,
+ 0x19AE, 0x8FB7, 0x2E8E, 0x0593, 0x3B5C, 0x0219, 0x469A, 0x0F80, 0x2B8C, 0x009F, 0x2A72, 0x519A,
+ 0x0093, 0x326E, 0x0A60, 0x96AE, 0x4467, 0x2957, 0x4059, 0x090D, 0x567D, 0x1926, 0x1A38, 0x3768,
+ 0x0379, 0x5364, 0x22A1, 0x1DB7, 0x2D38, 0x1A23, 0x2A97, 0x3E72, 0x2A60, 0x6A9D, 0x1F6E, 0x181D,
+ 0x0E43, 0x99B4, 0x5081, 0x0AB0, 0x196A, 0x489A, 0x6AB9, 0x3DA7, 0x526C, 0x2174, 0x1B42, 0x2134,
+ 0x2577, 0x8BB1, 0x0796, 0x2832, 0x1F67, 0x4799, 0x66B3, 0x9C9D, 0x1336, 0x469B, 0x1D5E, 0x38B4,
+ 0x6E91, 0xA2B7, 0x3087, 0x19AF, 0xA5BE, 0x49BE, 0x2325, 0x1691, 0x7F99, 0x0FAA, 0x2124, 0x0C50,
+ 0x1F39, 0x7980, 0x5684, 0x6B81, 0x3557, 0x3133, 0x29AB, 0x292A, 0x0917, 0x599C, 0x2C9D, 0x41BD,
+ 0x1D9F, 0x236A, 0x4E87, 0x449F, 0x2251, 0x4355, 0x67BD, 0x1354, 0x6D9C, 0x2F80, 0x5B77, 0x18FF,
+ 0x969F, 0x46BB, 0x119B, 0x74A7, 0x5F7A, 0x515B, 0x338F, 0x5798, 0x2171, 0x4E9D, 0x01B8, 0x2891,
+ 0x1735, 0x0AA5, 0x3F43, 0x767C, 0x2990, 0x060C, 0x40FF, 0x4153, 0x1A49, 0x696C, 0x41A0, 0x1946,
+ 0x758B, 0x0733, 0x5E6A, 0x367E, 0x0E75, 0x4863, 0x26AA, 0x4E9C, 0x0969, 0x42BE, 0x24B8, 0x2BBE,
+ 0x35A2, 0x587F, 0x88B4, 0x8AB9, 0x5788, 0x61BD, 0x0047, 0x3A91, 0x348D, 0x4A95, 0x2152, 0x38B5,
+ 0x8A95, 0x4156, 0x77FF, 0x188E, 0x0942, 0x20BC, 0x3C48, 0x839F, 0x268B, 0x5BA8, 0x93A1, 0x0C10,
+ 0x1758, 0x6B9F, 0x2A84, 0x51B5, 0x748A, 0x4AA6, 0x113A, 0x254A, 0x5170, 0x0F14, 0x1418, 0x5968,
+ 0x0FB6, 0x0BB5, 0x6E9A, 0x1737, 0x38BE, 0x5674, 0x1BB6, 0x16B7, 0x49AA, 0xA3B1, 0x57AA, 0x004F,
+ 0x125B, 0x5577, 0x4E76, 0x7B84, 0x2D5E, 0x277B, 0xA2A8, 0x536A, 0x00AD, 0x677E, 0x12A5, 0x1E37,
+ 0x7896, 0x55B1, 0x588B, 0x3D4D, 0x0117, 0x5393, 0x2331, 0x2F50, 0x326F, 0x1A68, 0x85AC, 0x156C,
+ 0x275B, 0x3654, 0x25A0, 0x0B95, 0x21AB, 0x9CA2, 0x0912, 0x152C, 0x2550, 0x1E41, 0x304F, 0x092F,
+ 0x4FAA, 0x0739, 0x4BB1, 0x18A3, 0x58A4, 0x9BA3, 0x17B8, 0x7189, 0x26B2, 0x5D6D, 0xAAAD, 0x19AB,
+ 0xA5B6, 0x6995, 0x1F98, 0x9AB8, 0x1B4C, 0x21A0, 0x4C96, 0x0C78, 0x317D, 0x05BC, 0x79B4, 0x22B7,
+ 0x48BE, 0x097F, 0x1D9B, 0x73B4, 0x07BF, 0x2688, 0x3540, 0x1E88, 0x1AB9, 0x8AA2, 0x1569, 0x2B55,
+ 0x538A, 0x2288, 0x324A, 0x38BB, 0x185D, 0x5AA7, 0x788D, 0x269D, 0x116A, 0x020D, 0x4A77, 0x7DA4,
+ 0x5383, 0x4C54, 0x3AA6, 0x323D, 0x15B2, 0x4EBB, 0x2BAF, 0x0EB2, 0x072D, 0x1180, 0x7C7D, 0x1687,
+ 0xA1BA, 0x929C, 0x1428, 0x025A, 0x4D84, 0x55A4, 0x6098, 0x1F55, 0x068F, 0x196E, 0x6980, 0x7082,
+ 0x2AB5, 0x56A1, 0x686D, 0x5365, 0x85A4, 0x6879, 0x66A1, 0x8FA9, 0x399C, 0x8BB8, 0x0E55, 0x02A9,
+ 0x36AF, 0x1B2A, 0x5095, 0x1F7B, 0x4A7B, 0x0C9A, 0x949C, 0x1B37, 0x5593, 0x0F5A, 0x1E6E, 0x3049,
+ 0x067C, 0x043F, 0x6FAF, 0x4F5A, 0x1177, 0x13AF, 0x1A6F, 0x1285, 0x4394, 0x6C6D, 0xB1BF, 0x0D91,
+ 0x568F, 0xBDBF, 0x15B7, 0x0EA2, 0x3F87, 0x409E, 0x3E58, 0x5A65, 0x3C58, 0x0C14, 0x27BB, 0xA8FF,
+ 0x5E6F, 0x4455, 0x31AE, 0x5A91, 0x6883, 0x82A7, 0x949E, 0x4A75, 0x5A97, 0x7D94, 0x073B, 0x4BA9,
+ 0x37A4, 0x0397, 0x0283, 0x14AA, 0x0D36, 0x7BAA, 0x13B8, 0xA7B8, 0x2280, 0x6276, 0x7778, 0x2A99,
+ 0x499D, 0x1718, 0x5A71, 0x3261, 0x071B, 0x1267, 0x7178, 0x739A, 0x060B, 0x5FAF, 0x5E88, 0x5F75,
+ 0x91B6, 0x0232, 0x4699, 0x4E9B, 0x0921, 0x6696, 0x1895, 0x01FF, 0x8FA1, 0x039E, 0x7190, 0x368C,
+ 0x14AE, 0x797C, 0x5082, 0x3898, 0xACAE, 0x3887, 0x7CAD, 0x4CA4, 0x05B7, 0x1DA6, 0x39AC, 0x0389,
+ 0x616B, 0x3138, 0x377D, 0x0727, 0x269E, 0x1012, 0x92A6, 0xA7B5, 0x2E69, 0x0487, 0x4191, 0x29A8,
+ 0x2F38, 0x098A, 0x205B, 0x4598, 0x097A, 0x4EB3, 0x414A, 0xAFFF, 0x2BA6, 0x5164, 0x446D, 0x4AA9,
+ 0xB6BF, 0x44B0, 0x66B4, 0x3D52, 0x2FBA, 0x1170, 0x66B0, 0x2AA9, 0x0D49, 0x0688, 0x3999, 0x3A92,
+ 0x206E, 0x53A9, 0x6B8E, 0x1838, 0x1A34, 0x151A, 0x47B3, 0x245E, 0x4D7D, 0xB2B7, 0x0D25, 0x1826,
+ 0x60BE, 0x5994, 0x6F83, 0x4F7D, 0x127D, 0x1330, 0x0A5B, 0x6095, 0x97FF, 0x6490, 0x1F8F, 0x455D,
+ 0x2872, 0x1685, 0x4557, 0x77B2, 0x488E, 0x0027, 0x23A9, 0x1C2D, 0x0F51, 0x061E, 0x79BF, 0x2A57,
+ 0x19B3, 0x94BF, 0x527D, 0x0A55, 0x5F60, 0x558F, 0x0119, 0x4B76, 0x3442, 0x2C32, 0x8BB6, 0x5F9E,
+ 0x0C42, 0x1363, 0x0666, 0xB8BA, 0x428D, 0x0D67, 0x828D, 0x408F, 0x4E6C, 0x1E96, 0x9FA9, 0x808A,
+ 0x2E49, 0x5176, 0x63A0, 0x68BA, 0x5062, 0x0C17, 0x7292, 0x1619, 0x4BA2, 0x4259, 0x1F7E, 0x1B7D,
+ 0x108A, 0x3B68, 0x0838, 0x254F, 0x0957, 0x3E7C, 0x629E, 0x3299, 0x83BD, 0x3975, 0x95A9, 0x054F,
+ 0x4678, 0x647B, 0x8BB7, 0x13AE, 0x3B4B, 0x5EBC, 0x274A, 0x0243, 0x00A3, 0x9596, 0x759B, 0x226B,
+ 0x2037, 0xA9FF, 0x6DB5, 0x1E75, 0xA5B5, 0x819F, 0xBBBF, 0x7084, 0x1C67, 0x435B, 0x0E12, 0x2729,
+ 0x0676, 0xACB2, 0x9BA8, 0x0F85, 0x40A6, 0x0513, 0x375F, 0x5F8A, 0x1474, 0x8B93, 0x28A8, 0x1492,
+ 0x4B94, 0x8CB8, 0x2440, 0x3F8D, 0x75A3, 0x377B, 0x0A28, 0x3091, 0x386B, 0xA6B7, 0x0BFF, 0x1C30,
+ 0x1A2A, 0x3184, 0x178D, 0x63AB, 0x0820, 0x384E, 0x79AA, 0x398B, 0x0B9A, 0x0F27, 0x71AB, 0x1C83,
+ 0x3767, 0x2AAB, 0x0BA5, 0x3CBB, 0x11B1, 0x01A6, 0x28B7, 0x0E42, 0x0D52, 0x2E88, 0x0C7C, 0x18B5,
+ 0x23A3, 0x224A, 0x7BB0, 0x3F64, 0x5DBE, 0x212E, 0x4966, 0x2581, 0x7B9A, 0x67A0, 0x7598, 0x3F5A,
+ 0x03A4, 0x45FF, 0x4254, 0x9AB9, 0x1564, 0x1641, 0x4454, 0x0776, 0x36AE, 0x0E72, 0x494C, 0x6CA5,
+ 0x37BF, 0x94A7, 0x3DAB, 0x2845, 0x02BD, 0x5399, 0x499F, 0x3996, 0x39B2, 0x376D, 0x98B7, 0x7275,
+ 0x595D, 0x1843, 0x5073, 0x316B, 0x3E49, 0x0564, 0x0F41, 0x63AD, 0x2963, 0x0732, 0x0329, 0x2050,
+ 0xB0B2, 0x16B2, 0x37A9, 0x222C, 0x1A42, 0x1ABE, 0x217D, 0x2A51, 0x7F9A, 0x979B, 0x2699, 0x0EB6,
+ 0x0BB3, 0x366C, 0x2962, 0x246C, 0x3F5B, 0x31A9, 0x4266, 0x648C, 0x1FA7, 0x4D6F, 0x0F66, 0x6197,
+ 0x72B8, 0x9B9D, 0x78A3, 0x6792, 0x17AD, 0x4CBF, 0x4B70, 0x1C8D, 0x34B8, 0x50AF, 0x2B87, 0x2EAA,
+ 0x5D78, 0x2E7B, 0x282F, 0x099D, 0x598D, 0x39AA, 0x0348, 0x0B68, 0x3E9A, 0xB3B4, 0x8485, 0x4994,
+ 0x4094, 0x6B9D, 0x607E, 0x8E9A, 0x487B, 0x3AA3, 0x313C, 0x167C, 0x4756, 0x4895, 0x3C77, 0x0B23,
+ 0x1983, 0x4B62, 0x72BE, 0x4993, 0x67A3, 0x267A, 0x165E, 0x5D6A, 0x1E91, 0x1DBC, 0x309D, 0x0541,
+ 0x8C93, 0x3983, 0x51A7, 0x084F, 0x29B8, 0x22B3, 0x2133, 0x4D58, 0xB6B9, 0x3C62, 0x1726, 0x2327,
+ 0x7F8D, 0x42A0, 0x628A, 0x045F, 0x1D87, 0x255A, 0x3962, 0x6A94, 0x4364, 0xA3BB, 0x4E8C, 0x6682,
+ 0xA4AF, 0x6EA4, 0x0873, 0x139E, 0x62AC, 0x8B95, 0x35B8, 0x1FAA, 0x429C, 0x327C, 0x3242, 0x0A69,
+ 0x0270, 0x1D34, 0x2B3B, 0x37B9, 0x4C8B, 0x94AD, 0x798C, 0x07AF, 0x2033, 0x437B, 0x5597, 0x05A5,
+ 0x92A3, 0x08B6, 0x4873, 0x18B0, 0x089F, 0x1384, 0x9DAE, 0x7BB8, 0x409B, 0x3047, 0x06AB, 0x426F,
+ 0x147E, 0x0F75, 0x2487, 0x0498, 0x7EBB, 0x717A, 0x42AB, 0x397E, 0x2D59, 0x5977, 0x6385, 0x81A5,
+ 0x2192, 0x2158, 0x3575, 0x1C2E, 0x2978, 0x508A, 0x2954, 0x24A7, 0x1231, 0x0977, 0x1E38, 0x7A91,
+ 0x019B, 0x1B56, 0x395A, 0x295A, 0x2D56, 0x8B8C, 0x42AF, 0x9A9E, 0x1FBD, 0x2B5F, 0x3686, 0x4D55,
+ 0x2C5B, 0x317A, 0x0AAD, 0xA2B5, 0x6481, 0x6364, 0x129B, 0x189F, 0x4AAD, 0xA4BC, 0x026F, 0x093E,
+ 0x86B0, 0x48AF, 0x3484, 0x616C, 0x2E71, 0x4762, 0x59A4, 0x5B62, 0x17BC, 0x3081, 0x72B0, 0x356F,
+ 0x65AF, 0x1629, 0x8AFF, 0x3EBB, 0x22A3, 0x48B9, 0x1720, 0x6976, 0x4C52, 0x4A57, 0x4997, 0x6591,
+ 0x2259, 0x628B, 0x148E, 0x99A6, 0x538E, 0x374F, 0x081B, 0x308B, 0x536E, 0x2E3F, 0x3B65, 0x668B,
+ 0x2CB6, 0x388C, 0x74B9, 0x2C53, 0x1999, 0x7B7D, 0x7FA6, 0x576C, 0x0F1B, 0x1B7C, 0x0D5D, 0x529D,
+ 0x1BAA, 0x5AB9, 0x75BF, 0x1F96, 0x0103, 0x577A, 0x54B0, 0x0D29, 0x5595, 0x1898, 0x12B9, 0x3D5C,
+ 0x79A1, 0x106A, 0x6093, 0x9BA2, 0x64A4, 0x56B6, 0x4F9E, 0x2185, 0x335F, 0x7378, 0x044D, 0x4C9D,
+ 0x6566, 0xA5AC, 0x127E, 0x219B, 0x0461, 0x1C87, 0x083E, 0x82B6, 0x414D, 0x1878, 0x94BB, 0x5A88,
+ 0x7B8E, 0x6282, 0x65AC, 0x575B, 0x3747, 0x51BC, 0x32A3, 0xB8BF, 0x49B0, 0x4E98, 0x3DAD, 0x3AFF,
+ 0x1132, 0x4FB5, 0x3864, 0x979D, 0x2172, 0x4C9E, 0x4E51, 0x5562, 0x0555, 0x8AA9, 0x9CBE, 0x063B,
+ 0x0C9D, 0x7685, 0x9EBA, 0x66AE, 0x6191, 0x6EA0, 0x3E9D, 0x696E, 0x4299, 0x5997, 0xB4B9, 0x2D62,
+ 0x3953, 0xA4BB, 0x85BE, 0x0889, 0x2728, 0x6187, 0x54BC, 0x8399, 0x1257, 0x4CBC, 0x578E, 0x85BF,
+ 0x1184, 0x61AF, 0x549F, 0x1894, 0x9AA7, 0x2247, 0x3F82, 0x127C, 0x35AB, 0x012D, 0x1D9E, 0x6875,
+ 0x0B4E, 0x4856, 0x3754, 0x74B1, 0x2272, 0x91B2, 0x3250, 0x0C64, 0x0121, 0x1C7B, 0x1891, 0x3EB2,
+ 0x26B3, 0x05A2, 0x3861, 0x4147, 0x1E2D, 0x586D, 0x52A2, 0x00AE, 0x213C, 0x39FF, 0x1C29, 0x2679,
+ 0x1876, 0x75B8, 0x1031, 0x0B30, 0x848E, 0x2732, 0x059C, 0x0125, 0x0750, 0x676C, 0xB2B9, 0x5861,
+ 0x7498, 0x0E40, 0x6290, 0x248A, 0x0BB1, 0x0C71, 0x9799, 0x5C81, 0x1469, 0x15A5, 0x167E, 0x429A,
+ 0x26A0, 0x145E, 0x659E, 0x0D27, 0x77A5, 0x5171, 0x0279, 0x42AD, 0x2BB6, 0x6685, 0x0F88, 0x368E,
+ 0x145F, 0x1DBD, 0x799C, 0x183D, 0x1E4F, 0x366D, 0x4357, 0x7D95, 0x5D79, 0x518D, 0x448C, 0x4BAB,
+ 0x40AD, 0x70A4, 0x69B2, 0x3031, 0x57BE, 0x3097, 0x8390, 0x0E7E, 0x2481, 0x3D6B, 0xABB5, 0x1452,
+ 0x16B8, 0x2D48, 0x0D46, 0x5C60, 0x2D5F, 0x2075, 0x2CFF, 0x6898, 0x3847, 0x0135, 0x18BB, 0x3171,
+ 0x5CA2, 0x17A9, 0x1C9F, 0x1057, 0x0522, 0x789D, 0x0515, 0x47A3, 0x4B9C, 0x2F3B, 0x5F91, 0x3571,
+ 0x6B78, 0x5985, 0x6999, 0x5474, 0x84B3, 0x529C, 0x2E59, 0x4388, 0x969E, 0x1278, 0x3880, 0x647F,
+ 0x2C55, 0x7884, 0x1552, 0x8198, 0x093D, 0x0D79, 0x6C9F, 0x2849, 0x1464, 0x1185, 0x8DB2, 0x4596,
+ 0x3247, 0x7ABF, 0x1159, 0x1D7A, 0x6D74, 0x6771, 0x93B8, 0x4AA0, 0x0026, 0x0CA8, 0x72B6, 0x1472,
+ 0x2245, 0x5275, 0x0321, 0x1664, 0x53B9, 0x375B, 0x647D, 0x7E9A, 0x0D75, 0x2D7F, 0x8DA4, 0x557B,
+ 0x0D51, 0x97A4, 0xABB2, 0x175F, 0x95BF, 0x3391, 0x2064, 0x7C84, 0x376B, 0x1BB5, 0x6E7F, 0xBBBD,
+ 0x707A, 0x53B0, 0x2683, 0x000C, 0x168F, 0x23A6, 0x248E, 0x7983, 0x28A5, 0x385C, 0xA1B2, 0x244F,
+ 0x3F79, 0x7DFF, 0x73B2, 0x293A, 0x53B7, 0x01A1, 0x85B7, 0x3C87, 0x5091, 0x3AB5, 0x7FB7, 0x388E,
+ 0x6782, 0x4754, 0x265C, 0x60B8, 0x7489, 0x6E9C, 0x2843, 0x1350, 0x3C7D, 0x0497, 0x4B96, 0x0B4C,
+ 0x34B7, 0x169F, 0x0D76, 0x7F9D, 0x1C77, 0x2F86, 0x4578, 0x5D65, 0x2A98, 0x1A87, 0x0B8F, 0x3D45,
+ 0x2875, 0x82A4, 0x656F, 0x1E7D, 0x81AC, 0x70B1, 0x7A9D, 0x2057, 0x6D97, 0x6578, 0x9FA7, 0x3762,
+ 0x416E, 0x4A90, 0x1AA1, 0x4661, 0x6677, 0x5DAE, 0x4496, 0x2188, 0x4187, 0x2CAE, 0x4376, 0x3E68,
+ 0x264F, 0x2498, 0x0832, 0x4477, 0x1E6C, 0x7EB4, 0x0683, 0x59A9, 0x838B, 0x3B44, 0x6FB5, 0x6DBB,
+ 0x5CA0, 0x29AE, 0x296D, 0x25B2, 0x3B69, 0x2A3E, 0x2B6D, 0x1B79, 0x66A8, 0x0F6B, 0x33B4, 0xA9B0,
+ 0x4AB1, 0x309C, 0x3B9C, 0x657A, 0x24B9, 0x0868, 0x8D8F, 0x04BE, 0x3D80, 0x3652, 0x102B, 0x82BA,
+ 0x2574, 0x2F7D, 0x6692, 0x85B1, 0x4052, 0x3C63, 0x9DBE, 0x4E91, 0x0608, 0x3CA8, 0x2443, 0x5890,
+ 0x669C, 0x2056, 0x0788, 0x0B3C, 0x678D, 0x4592, 0x8A92, 0x518E, 0x4ABA, 0x102A, 0x5967, 0x0B5F,
+ 0x71B0, 0x0177, 0x3B6F, 0x0141, 0x0923, 0x599B, 0x4B71, 0x2F35, 0x778B, 0x2E45, 0xAAB7, 0x3C9F,
+ 0x3EA5, 0x029A, 0x0A51, 0x75A0, 0x2C88, 0x365A, 0x2F9B, 0x6D7C, 0x51AD, 0x2E6D, 0x63AE, 0x0273,
+ 0x0ABA, 0x0F40, 0x7392, 0x0A1D, 0x0A5A, 0x3750, 0x3A4E, 0x00BA, 0x1959, 0x7699, 0x6C84, 0x4FB2,
+ 0x158A, 0x4269, 0x4D95, 0x5EAA, 0x7F9C, 0x274D, 0x3559, 0x9CA8, 0x9FB1, 0x4ABE, 0x50BE, 0x3F7F,
+ 0x4A67, 0x58BC, 0x93B0, 0x11B8, 0xB1BA, 0x0D20, 0x277F, 0x9297, 0x3C52, 0x3A95, 0x2467, 0x5F82,
+ 0x6489, 0x389E, 0x1B9F, 0x7E7F, 0x6079, 0x5CB0, 0x2C63, 0x4CBD, 0x0847, 0x90B8, 0x9FA1, 0x06A3,
+ 0x4D6C, 0x339C, 0x3E8A, 0x55A1, 0x587E, 0x22A5, 0x85A0, 0x83FF, 0x657D, 0x5F68, 0x3381, 0x485D,
+ 0x168C, 0x1192, 0x129A, 0x0253, 0x6077, 0x8E98, 0x5B93, 0x56AE, 0x486A, 0x63B9, 0x226E, 0x2756,
+ 0x568E, 0x10A9, 0x0681, 0x099A, 0x0C60, 0x2328, 0x3A73, 0x3D5E, 0x6EA2, 0x8890, 0x5F81, 0xB3B5,
+ 0x0CBF, 0x3C86, 0x3592, 0x2239, 0x5C94, 0x2BB7, 0x5175, 0x4077, 0x5A6B, 0x2D8B, 0x0532, 0x0607,
+ 0x2895, 0xA2BB, 0x75AA, 0x013B, 0x0F43, 0x1F54, 0x5E7F, 0x0643, 0x1AAB, 0x2886, 0xB7BB, 0x7B81,
+ 0x5A96, 0x21A1, 0x7285, 0x31B1, 0x349D, 0x1034, 0x4D79, 0x8FAB, 0x2069, 0x1723, 0x0D50, 0x2C42,
+ 0x108B, 0x55B0, 0x219F, 0x7FB1, 0x2771, 0x49A2, 0x5B66, 0x2179, 0xB4FF, 0x027A, 0x8DA8, 0x2D9A,
+ 0x6491, 0x1E76, 0x62A0, 0x2760, 0x6587, 0x8491, 0x4054, 0x6ABD, 0x038E, 0x3C8D, 0x2087, 0x4FA6,
+ 0x5497, 0x13B2, 0x6F82, 0x0F99, 0x629D, 0x22AC, 0x1A5F, 0x2530, 0x3190, 0xBEBF, 0x96AC, 0x56A6,
+ 0x74B6, 0x17AA, 0x5588, 0x0140, 0x0345, 0x26AB, 0x1652, 0x6987, 0x3B6A, 0x3787, 0x0F35, 0x0D4F,
+ 0x4979, 0x75A7, 0x1F38, 0x879A, 0x399E, 0x4D8B, 0xB0B6, 0x0F69, 0x3174, 0x3072, 0x58AE, 0x9C9F,
+ 0x126A, 0x3E7D, 0x5268, 0x36A1, 0x0E85, 0x4480, 0x6C87, 0x6365, 0x4392, 0x1751, 0x3A50, 0x090F,
+ 0x64FF, 0x2A53, 0x0D3F, 0x1618, 0x4890, 0x5558, 0x4871, 0x1187, 0x003C, 0x71B2, 0x0551, 0x3D4E,
+ 0x6BBE, 0x0B67, 0x556B, 0x84AA, 0x62BA, 0x6083, 0x4064, 0x4FA7, 0x5969, 0x3A74, 0x94AE, 0x173F,
+ 0x4081, 0x4879, 0x2D82, 0x607F, 0x6984, 0x5488, 0x0CB8, 0x12A6, 0x4D50, 0x9397, 0x32B3, 0x8AB3,
+ 0x218E, 0x2471, 0x3790, 0xB1BD, 0x0236, 0x1467, 0x9DAC, 0x007E, 0x868E, 0x163B, 0x3994, 0x2B69,
+ 0x1188, 0x2C40, 0x177C, 0x1835, 0x3E8C, 0x5EA9, 0x2480, 0x37BE, 0x2E7A, 0x4C83, 0x2DAD, 0x4BBE,
+ 0x5579, 0x385F, 0x1370, 0x07BB, 0x2967, 0x08BD, 0x74AB, 0xB7BF, 0x3D89, 0x627C, 0x145C, 0x24A9,
+ 0x0D78, 0x6686, 0x5765, 0x0742, 0x5EA3, 0x15A4, 0x7DB2, 0x0211, 0x06AA, 0x0C2B, 0x6ABF, 0x1775,
+ 0x0B9C, 0x6990, 0x237A, 0x239A, 0x3781, 0x3FA1, 0x6B6C, 0x509F, 0x2485, 0x142A, 0x5887, 0x0743,
+ 0x297E, 0x2326, 0x5C99, 0x2241, 0x6FAE, 0x0A13, 0x8386, 0x55BC, 0x787C, 0x4E92, 0x3744, 0x363E,
+ 0x757C, 0x1C2B, 0x7686, 0x1D6A, 0x094A, 0x55BA, 0x4C56, 0x6BA5, 0x1C2F, 0x6E9E, 0x6C93, 0x628D,
+ 0x1A88, 0x3C81, 0x389B, 0x59B4, 0x447D, 0x0D44, 0x09AE, 0x3895, 0x3A3C, 0x198E, 0x0982, 0x188B,
+ 0x1DBE, 0x93B3, 0x388A, 0x6A7E, 0x0110, 0x1023, 0x308E, 0x2464, 0x3992, 0x174A, 0x4D9E, 0x32A8,
+ 0x036C, 0x1F60, 0x99A9, 0x35B7, 0x2CAC, 0x090E, 0x6B88, 0x539A, 0x2DB2, 0x2025, 0x2BBD, 0x0016,
+ 0x0545, 0x9EAB, 0x4A87, 0x2FBB, 0x92B2, 0x1087, 0x0E77, 0x2836, 0x6FB9, 0x0043, 0x649E, 0x6E87,
+ 0x2674, 0x3C6F, 0x158C, 0x2A7A, 0x0062, 0x239F, 0x4085, 0x0D4A, 0x249A, 0xA5FF, 0x276C, 0x072C,
+ 0x3CB0, 0x1D29, 0x1B25, 0x96B8, 0x6176, 0x3949, 0x26B1, 0x105E, 0x0876, 0x81B2, 0x1764, 0x6A6C,
+ 0x0D69, 0x1199, 0xB4BF, 0x0899, 0x14B5, 0x484B, 0x2065, 0x9BA6, 0x14AB, 0x3991, 0x676A, 0x0037,
+ 0x01BF, 0x08FF, 0x0842, 0xB5BA, 0x81A0, 0x7B90, 0x0260, 0x6E9B, 0x54A0, 0x0B87, 0x3B72, 0x7381,
+ 0x96B9, 0x13B9, 0x8CB9, 0x3E50, 0x1B7A, 0x464D, 0x50BF, 0x4988, 0x1529, 0x575E, 0x3C70, 0x434B,
+ 0x1A3E, 0x065A, 0x2979, 0x76A7, 0x42AC, 0x0FB2, 0x16A7, 0x6275, 0x6D96, 0x6371, 0x5A8D, 0x88BE,
+ 0x1684, 0x51AE, 0x1064, 0x0A4A, 0x09BD, 0x3E41, 0x2965, 0x06A0, 0x3058, 0x2759, 0x1E4E, 0x6B8D,
+ 0x030D, 0x52AE, 0x73B5, 0x7BBB, 0x2C94, 0x6772, 0x778A, 0x16A6, 0x42B8, 0x2BB5, 0x0BAF, 0x1B26,
+ 0x1CBF, 0x4BB9, 0x2382, 0x8AB1, 0x67A6, 0x0495, 0x46BC, 0x6697, 0x374B, 0x9AA4, 0x6B9B, 0x07BC,
+ 0x0928, 0x1F51, 0x0EB7, 0x2027, 0x4C87, 0x3469, 0x46AC, 0x6E74, 0x546D, 0x0F6E, 0x0B17, 0x136D,
+ 0x4E60, 0x23AD, 0x2B8F, 0x5BAF, 0x448D, 0x408C, 0x426E, 0x3A7D, 0x193D, 0x104E, 0x468E, 0x87B0,
+ 0x4AA2, 0x375A, 0x44B3, 0x1D54, 0x289D, 0x3272, 0x1B4B, 0x1118, 0x0188, 0x1125, 0x0E7D, 0x047D,
+ 0x0931, 0x5A9F, 0x0537, 0x2661, 0x5576, 0x1553, 0x0784, 0x48BB, 0x22A8, 0x4750, 0x2B34, 0x234D,
+ 0x1FB9, 0x2351, 0x5360, 0x0160, 0xAFBA, 0x219E, 0x0B6E, 0x30BD, 0x185A, 0x0547, 0x0687, 0x2FAB,
+ 0x5971, 0x28AB, 0x15AB, 0x1078, 0x878F, 0x1F81, 0x9394, 0x415F, 0x3186, 0x93A9, 0x5668, 0x468B,
+ 0x052A, 0x7D9F, 0x437F, 0x1B23, 0x195E, 0x0B51, 0x3F71, 0x3D51, 0x415D, 0x3D54, 0x4B73, 0x58A1,
+ 0x0BBF, 0x3449, 0x8691, 0x3541, 0x4460, 0x9FAB, 0x439E, 0x3155, 0x83AB, 0x7995, 0x244A, 0x0C36,
+ 0x537E, 0x1562, 0x1E61, 0x6B6F, 0x75FF, 0x3893, 0x4F8F, 0x1140, 0x6AB2, 0x1EBC, 0x667D, 0x0199,
+ 0x31AF, 0x6B90, 0x52AC, 0x4791, 0x4573, 0x575F, 0x112D, 0x233E, 0x284D, 0x2336, 0x1B86, 0x0D47,
+ 0x2540, 0x1B3F, 0x3335, 0x0DB8, 0x2B59, 0x97B2, 0x93A5, 0x1E64, 0x3EB9, 0x1AAF, 0x1C21, 0x416B,
+ 0xA5BB, 0x072A, 0x66B1, 0x3C3E, 0x354D, 0x4998, 0x19B8, 0x214D, 0x09A1, 0x919F, 0x7CBC, 0x1A93,
+ 0x0486, 0x2284, 0x153B, 0x3E5B, 0x61A0, 0x141A, 0x7B99, 0x83BA, 0x1792, 0x769A, 0x2031, 0x0E8A,
+ 0x6E95, 0x1173, 0x4985, 0x5E84, 0x37AF, 0x0293, 0xA0B7, 0x0430, 0x4C88, 0x2CB0, 0x6EB3, 0x0880,
+ 0x659F, 0x6989, 0x7B91, 0x061B, 0x849B, 0x5285, 0x6BB8, 0x7A93, 0x2E40, 0x8E9F, 0x2165, 0x8EBA,
+ 0x6598, 0x0095, 0x249E, 0x2C48, 0x13B0, 0x26B0, 0x3460, 0x1328, 0x2865, 0x3A4B, 0x3A51, 0x085D,
+ 0x107C, 0x43B0, 0x3F78, 0x3B6E, 0x4C89, 0xA3B7, 0x0288, 0x323F, 0x727A, 0x22AD, 0x1971, 0x3446,
+ 0x3043, 0x6AAE, 0xAAB8, 0x02BE, 0x3AB6, 0x56B9, 0x487A, 0x69A6, 0x2D35, 0x54A6, 0xB5BE, 0x9294,
+ 0xB3BC, 0x73AC, 0x0242, 0x416D, 0x7CB2, 0x6891, 0x1C31, 0x8FB0, 0x287F, 0x32A4, 0x7284, 0x2F47,
+ 0x1D1E, 0x01AA, 0x065C, 0x46AE, 0x050B, 0x8DB5, 0x00A0, 0x1599, 0x2EA3, 0x89AA, 0x3E42, 0x1C23,
+ 0x3176, 0x0457, 0x4479, 0x0233, 0x3359, 0x3AB0, 0xAEB3, 0x8BA4, 0x0556, 0x70A9, 0x86B6, 0x2C92,
+ 0x0415, 0x2D54, 0x2EBF, 0x223D, 0x2F4D, 0x0639, 0x73B8, 0x2A82, 0x4B88, 0x6FBC, 0x1F4F, 0x3BFF,
+ 0x595B, 0x8DBF, 0x7F94, 0x2BA2, 0x5F7F, 0x2A40, 0x0896, 0x2E33, 0x2A4B, 0x8A8B, 0x0EAB, 0x071C,
+ 0x8694, 0x3370, 0x1152, 0x4B4F, 0x0F39, 0x23AF, 0x435A, 0x53A6, 0x72A1, 0x1D4F, 0x1059, 0x83B1,
+ 0x11A7, 0x90BB, 0x96AA, 0x3B52, 0x42B0, 0x0DA2, 0x4A63, 0x4D52, 0x438C, 0x97AA, 0x84B0, 0x459E,
+ 0xAEAF, 0x2D99, 0x1A9E, 0x3BB4, 0x689A, 0x0FBF, 0x0CB7, 0x0A8E, 0x1586, 0x0094, 0x1461, 0x3583,
+ 0x0D90, 0x0004, 0x2041, 0x5CA4, 0x2C6E, 0x7BA5, 0x5862, 0x437D, 0x1047, 0x758D, 0x81BE, 0x6DA1,
+ 0x4A60, 0x2A75, 0x06B3, 0xA4AC, 0x7DBB, 0x122B, 0x2A7D, 0x2855, 0x69AB, 0x067D, 0x2FB5, 0x109E,
+ 0x0105, 0x4A4C, 0x1441, 0xA7BC, 0x5192, 0x2AB9, 0x4359, 0x8AB0, 0x3D7A, 0x1126, 0x3C65, 0x1422,
+ 0x9AFF, 0x0A7C, 0x6AB0, 0x8893, 0x1595, 0x437A, 0x1C89, 0x3F65, 0x0B5C, 0x0D33, 0x4797, 0x5981,
+ 0x363F, 0x75B1, 0x71BB, 0x1138, 0x1F78, 0x4371, 0x1FB5, 0x2362, 0x5B83, 0x313D, 0x4B7B, 0x5978,
+ 0x04AE, 0x6C92, 0x19B6, 0x3EAE, 0x61B3, 0x7581, 0x3E5A, 0x0D58, 0x1A39, 0x1B4F, 0x3386, 0x057E,
+ 0x70BC, 0x60AC, 0x1557, 0x295B, 0x4D5A, 0x2295, 0x20A1, 0x0863, 0x18BC, 0x27B0, 0x249F, 0x3078,
+ 0x9FB2, 0x2282, 0x0635, 0x3AAC, 0x6A8B, 0x1B85, 0x5F79, 0x7D9D, 0x1247, 0xA5B9, 0x176A, 0x3844,
+ 0x5E82, 0x5BB7, 0x58BD, 0x5773, 0x517B, 0x2E52, 0x62A6, 0x4977, 0x588D, 0x39A0, 0x4C70, 0x3AAE,
+ 0x3748, 0x9BAD, 0x3F85, 0x012F, 0x5374, 0x073F, 0x9CB4, 0x0E73, 0x43A7, 0x355B, 0x417B, 0x0562,
+ 0x00B1, 0x3B77, 0x0084, 0x0489, 0x2048, 0x0C90, 0x7981, 0x0533, 0x2D9F, 0x103C, 0x5D9A, 0x152B,
+ 0x5BFF, 0x256F, 0x5378, 0x0933, 0x1D65, 0x32A0, 0x79BC, 0x85AF, 0x0B27, 0x668C, 0x576A, 0x179F,
+ 0xA8BE, 0x4876, 0x50A6, 0x5E8F, 0x4772, 0x3BBC, 0x4396, 0x5FB0, 0x1477, 0x97BC, 0x5565, 0x08AB,
+ 0x2196, 0x365D, 0x1821, 0x4080, 0x869E, 0x1A3D, 0x2E7E, 0x7696, 0x6D90, 0x3D43, 0x161A, 0x58BE,
+ 0x0A8B, 0x1BB4, 0x858F, 0x0658, 0x1279, 0x018F, 0x114D, 0x101A, 0x022E, 0x0517, 0x4B52, 0x05AC,
+ 0x6172, 0x28AA, 0x2869, 0x2393, 0x969C, 0x4D98, 0x46B9, 0x1BAF, 0x3178, 0x3266, 0x1468, 0x5698,
+ 0x6569, 0x8192, 0x467A, 0x6380, 0x1B8C, 0x3A5F, 0x36BD, 0x1C68, 0x4F8B, 0x31FF, 0x418D, 0x38A9,
+ 0x588F, 0x076E, 0x63BA, 0x5C7B, 0x0D98, 0x2B9A, 0x19A3, 0x3495, 0x3573, 0x59B9, 0x3FA4, 0x128F,
+ 0x67BC, 0x5398, 0x829F, 0x6FBF, 0x002B, 0x517E, 0x0453, 0x3995, 0x0D13, 0x3E5F, 0x899F, 0x1282,
+ 0x0D95, 0x0E19, 0x244D, 0x2A58, 0x92BB, 0x1455, 0x257A, 0x8D8E, 0x333A, 0x30AF, 0x7593, 0x033B,
+ 0x1022, 0x0DB9, 0x52FF, 0x5AB5, 0x0413, 0x2D8F, 0x2B76, 0x0764, 0xABBA, 0x0A4F, 0x11B7, 0x2D6E,
+ 0x042D, 0x368D, 0x24AC, 0x1961, 0x3D74, 0x5A7E, 0x080C, 0x63BD, 0x4F79, 0x259A, 0x267E, 0x172E,
+ 0x1B1C, 0x5779, 0x0D5A, 0x4291, 0x1548, 0x4A72, 0x9099, 0x2B9E, 0x5C65, 0x1869, 0x589A, 0x69AF,
+ 0x56A7, 0x3482, 0x04BD, 0x5FB4, 0x0F98, 0x3A5E, 0x27B2, 0x8BAF, 0x0511, 0x2BA7, 0x475C, 0x2A2F,
+ 0x0081, 0x88AA, 0x5659, 0x17B4, 0x7BB7, 0x2290, 0x3259, 0x8A9A, 0x545E, 0x405A, 0x5E8D, 0x225C,
+ 0x5096, 0x0609, 0x6A78, 0x0514, 0x0883, 0x97AB, 0x2F83, 0x646A, 0x494E, 0x34AA, 0x6778, 0x9FB9,
+ 0x0A77, 0x3A70, 0x709E, 0x598A, 0x5E74, 0xB9BA, 0x1827, 0x11A5, 0x1240, 0x40B6, 0x2884, 0x27BE,
+ 0x557C, 0x1B61, 0x02AB, 0x2F76, 0x6EA1, 0x8895, 0x68BC, 0x61B7, 0x2A81, 0x085A, 0x1A71, 0x116D,
+ 0x275F, 0x33BA, 0x0458, 0x659C, 0x3651, 0x2FB1, 0x565C, 0x0A5D, 0x245B, 0x63B6, 0x4C6A, 0x2B2E,
+ 0x727F, 0x266E, 0x1DAC, 0x1647, 0x2399, 0x3C79, 0x0761, 0x3E98, 0x83A2, 0x2A76, 0x3F6B, 0x4B98,
+ 0x3B8C, 0x6195, 0x03AE, 0x4EFF, 0x87BA, 0x1573, 0x96B2, 0x5B87, 0x1352, 0x3776, 0x1AA8, 0x4E9E,
+ 0x57B8, 0x606A, 0x0953, 0x10BA, 0x5D7B, 0x719B, 0x2095, 0x28B5, 0x627D, 0x09B5, 0x4446, 0x4C7E,
+ 0x7994, 0x1A22, 0x19BC, 0x0D7F, 0x2A73, 0x0C7A, 0xA3AE, 0x5FB7, 0x147C, 0x2797, 0x2F34, 0x199A,
+ 0x7987, 0x1F91, 0x6A7D, 0x2994, 0x3598, 0x3342, 0x747A, 0x1998, 0x7FFF, 0x10AF, 0x0B69, 0x86B5,
+ 0x00A1, 0x879B, 0x1874, 0x1043, 0x3AA2, 0x8EB8, 0x5CB1, 0x718C, 0x18AB, 0x819C, 0x3669, 0x289E,
+ 0x454F, 0x5358, 0x6082, 0x4D59, 0x14BA, 0x6163, 0x253E, 0x346D, 0x3FB5, 0x5894, 0x53BF, 0x3863,
+ 0x228D, 0x328B, 0x4B99, 0x8FA0, 0x0146, 0x66B8, 0xACB4, 0x2135, 0x4881, 0x5267, 0x03B1, 0x4AB6,
+ 0x8AB2, 0x1F75, 0x468F, 0x3960, 0x699B, 0x4486, 0x0325, 0x0671, 0x1273, 0x1559, 0x1538, 0x0066,
+ 0x55B3, 0x4659, 0x59AF, 0x20A6, 0x2036, 0x8DB8, 0x3B3E, 0x2A48, 0x5284, 0x343D, 0x0A2D, 0x0A92,
+ 0x0F9C, 0x2D78, 0x0E86, 0x3243, 0x0285, 0x2739, 0xAAB6, 0x0DA8, 0x2C66, 0x1B3A, 0x0170, 0x03BB,
+ 0x9BBD, 0x31AB, 0x3DB5, 0xA1B8, 0x489D, 0x90FF, 0x2594, 0x22A7, 0x1C26, 0x0B71, 0x7E9C, 0x1387,
+ 0x1C7E, 0x5DA3, 0x0866, 0x113F, 0x4EA9, 0x4C80, 0x2286, 0x3C66, 0x2225, 0x6A93, 0x5D81, 0x6E83,
+ 0x333F, 0x6295, 0x2A8D, 0x1C3E, 0x2EB6, 0x76A6, 0x62AD, 0x728F, 0x1D67, 0x87AE, 0x146B, 0x0E56,
+ 0x4A4F, 0x1438, 0x72A7, 0x72BC, 0x358B, 0x9EAE, 0x30B0, 0x0408, 0x51BD, 0x2BB2, 0x40A7, 0x8EBE,
+ 0x13BC, 0x4C5E, 0x8E9D, 0xAABB, 0x606D, 0x187F, 0x2E78, 0x2341, 0x3783, 0x54AC, 0x2637, 0x225F,
+ 0x6799, 0x174D, 0x0E20, 0x1856, 0x99BA, 0x4FAD, 0x2629, 0x6274, 0x77A4, 0x2A92, 0x22B4, 0x363B,
+ 0x192A, 0x707C, 0x67A2, 0x89A4, 0x2C31, 0x1FA1, 0x42A6, 0x6AAF, 0x58A0, 0x73BA, 0x0A0E, 0x636E,
+ 0x031C, 0xA2AB, 0x6FAA, 0x0DA5, 0x71A4, 0x075B, 0x7CAF, 0x0C8A, 0x43B4, 0x898A, 0x9FBD, 0x20B9,
+ 0x4178, 0x7AB6, 0x2CA0, 0x063C, 0x788A, 0x26BF, 0x6296, 0x71BC, 0x3F9B, 0x2A87, 0x336F, 0xB2BE,
+ 0x1886, 0x619C, 0x1419, 0x4C60, 0x2CA3, 0x6280, 0x7F90, 0x405F, 0x2BAD, 0x0444, 0x585C, 0x8BB3,
+ 0x5BBB, 0x454A, 0x0078, 0x206A, 0x2861, 0x0EAE, 0x2554, 0x3D72, 0x8A96, 0x3E79, 0x56B7, 0x86B4,
+ 0x134F, 0x3B9D, 0x3F9E, 0x0814, 0x4A76, 0x1C22, 0x32BB, 0x84B8, 0x829D, 0x8188, 0x0E71, 0x4A4B,
+ 0x3749, 0x0455, 0x032A, 0x7578, 0x7E88, 0x4C97, 0x050C, 0x3ABB, 0x4D85, 0x03BC, 0x6393, 0x6CAD,
+ 0x0080, 0x3637, 0x59A3, 0x8C99, 0x0C4D, 0x2448, 0x2154, 0x024F, 0x6E99, 0x3175, 0x3D98, 0x0710,
+ 0x2B32, 0x3D9B, 0x08AA, 0x3154, 0x657E, 0x6E8D, 0x87AA, 0x70AB, 0x1A37, 0x54A7, 0x6378, 0xB5B8,
+ 0x4D64, 0x818E, 0x097D, 0x6289, 0x0134, 0x0DB2, 0x959C, 0x8897, 0x7BB6, 0x0839, 0xB1B5, 0x36B8,
+ 0x2685, 0x131E, 0x69A1, 0x06AE, 0x0452, 0x0D12, 0xB0BF, 0x35A5, 0x49BD, 0x91A8, 0x61B0, 0xAEB8,
+ 0x435C, 0x708A, 0x5770, 0x187C, 0x8EB3, 0x032B, 0x4E77, 0x10B1, 0x195A, 0x5D84, 0x3A9D, 0x90BA,
+ 0x1389, 0x29B0, 0x2B6E, 0x6FB6, 0x021A, 0x1F88, 0x63AF, 0x0E5C, 0x3CAA, 0x1985, 0x5780, 0x4245,
+ 0x71B7, 0x3661, 0x41AA, 0x1862, 0x7DA3, 0x50AE, 0x52B1, 0x67A9, 0x5098, 0x119D, 0x60AD, 0x4C5D,
+ 0x038A, 0x86A7, 0x5D6F, 0x1A8F, 0x2D3B, 0x23AC, 0x0787, 0x4B6B, 0x4BAD, 0x8A94, 0x778C, 0x0F6D,
+ 0x4464, 0x0A58, 0x229E, 0x347C, 0x62FF, 0x306D, 0x0F1D, 0x969D, 0x8BAE, 0x1237, 0x0CAD, 0x5080,
+ 0x818A, 0x0B0E, 0x3F84, 0x0888, 0x566F, 0x2C97, 0x1120, 0x6FBA, 0x356E, 0x009C, 0x2983, 0x257D,
+ 0x1C5F, 0x07B7, 0x0668, 0x8EA2, 0x34A1, 0x2F90, 0x1392, 0x3581, 0x5A78, 0x52BA, 0x154C, 0xB3B6,
+ 0x43A8, 0x1378, 0x031B, 0x89A5, 0xA0BC, 0x94B0, 0x5591, 0x051A, 0x71BF, 0x153A, 0x32A5, 0x4FA3,
+ 0x6E75, 0x6198, 0x548D, 0x0E24, 0x357D, 0x4E80, 0x067A, 0x7788, 0x053D, 0x229A, 0x4468, 0x9FAA,
+ 0x5E89, 0x206B, 0x1BA0, 0x464A, 0x2FA8, 0x7289, 0x1A56, 0x387F, 0x54BA, 0x035B, 0x3256, 0x748D,
+ 0x3061, 0x1A46, 0x89B3, 0x0C25, 0x6AB1, 0x6BB2, 0x8BBA, 0x396C, 0x6878, 0x6297, 0x4FA1, 0x6F84,
+ 0x1966, 0x086B, 0x2880, 0x3561, 0x11A9, 0x22A2, 0x2142, 0x52A1, 0x4990, 0x21AE, 0x2C34, 0x0182,
+ 0x2593, 0x023F, 0x6C6E, 0x77A6, 0x001A, 0x40AF, 0x6394, 0x49A9, 0x4CA0, 0x12B8, 0x0516, 0x54B9,
+ 0x1D76, 0x4BA4, 0x2496, 0x2D70, 0x239B, 0x59BD, 0x7FB6, 0x2249, 0x5B8B, 0x45A9, 0x5395, 0x19B9,
+ 0x9A9B, 0x73B7, 0x6DB0, 0x3240, 0x1A3A, 0x101E, 0x4E9A, 0x2551, 0x28B2, 0x4145, 0xA6AB, 0x214F,
+ 0x2023, 0x1993, 0x5055, 0x1F66, 0x0492, 0x2287, 0x2655, 0x2650, 0x2493, 0x070C, 0x6294, 0x138A,
+ 0x3FA3, 0x2F6C, 0x102F, 0x018B, 0x0185, 0x1DBB, 0x21BA, 0x2177, 0x49B2, 0x7F92, 0x0E5F, 0x0831,
+ 0x1686, 0x1AA0, 0x7EA4, 0x9FB5, 0x42A1, 0x47B4, 0x37A7, 0x1164, 0x4E67, 0x3D63, 0x0068, 0x3777,
+ 0x0976, 0x4D5E, 0x1D22, 0xBEFF, 0x1672, 0x345D, 0x1A52, 0x0309, 0x43A2, 0x636C, 0x879F, 0x0EA9,
+ 0x6B7E, 0x092C, 0x2945, 0x6E9D, 0x69B7, 0x1923, 0x3182, 0x234F, 0x7A82, 0x7992, 0x1C3A, 0x047A,
+ 0x4D65, 0x2B52, 0x7790, 0x3362, 0x2FB0, 0x1F50, 0x1CBB, 0x6286, 0x0777, 0x0B41, 0x3E52, 0x6687,
+ 0x344F, 0x1661, 0x2532, 0x5DB8, 0x354B, 0x71A9, 0x1062, 0x2D97, 0x158D, 0x585A, 0x96B6, 0x1644,
+ 0x7889, 0x72B5, 0x5FA0, 0x1471, 0x0DBB, 0x5DB6, 0x1B76, 0x009E, 0x0D42, 0x5CA3, 0x5296, 0x132C,
+ 0x2CBB, 0x0CBE, 0x4293, 0x599A, 0x8DAC, 0x5C69, 0x7E82, 0x3132, 0x1348, 0x4BAE, 0x15A8, 0x66FF,
+ 0x6FB7, 0x0420, 0x6D7B, 0x717F, 0x6678, 0x1264, 0x4143, 0x052C, 0x1D59, 0x3B98, 0x38B6, 0x1B5A,
+ 0x6067, 0x0C1A, 0x5866, 0x4082, 0x46B7, 0x2A55, 0x1276, 0x8AA5, 0x3E69, 0x22A0, 0x4047, 0x0E8B,
+ 0x2261, 0x596A, 0x1060, 0x17B3, 0x3139, 0x93BC, 0x0034, 0x1386, 0x3BBE, 0x018C, 0x7785, 0x5F95,
+ 0x084C, 0x174C, 0x203F, 0x1DA1, 0x36A0, 0x555F, 0x9EA5, 0x218C, 0x0391, 0x7D88, 0x809D, 0x3B6D,
+ 0x0D6E, 0x142B, 0x6A99, 0x1C54, 0x133A, 0x4658, 0x567C, 0x2C8D, 0x1786, 0x45A4, 0x5387, 0x83BF,
+ 0x1D35, 0x9DB8, 0x133D, 0x738E, 0x1B98, 0x0E65, 0x1B51, 0x377C, 0x1F3A, 0x2F4B, 0x5A9B, 0x6DAC,
+ 0x4957, 0x6F99, 0x3447, 0x2AA1, 0x0F76, 0x3FB1, 0x074C, 0x0DA6, 0x0241, 0x3B76, 0x8DA3, 0x4C64,
+ 0x77B5, 0x1C20, 0x0557, 0x0F9D, 0x103D, 0x55A9, 0x68A5, 0x77AE, 0x2141, 0x2CAB, 0x99FF, 0x3FAC,
+ 0x3D50, 0x82BF, 0x40A1, 0x1787, 0x0879, 0x76BD, 0x026C, 0x052E, 0x0A19, 0x3A94, 0x1130, 0x1517,
+ 0x1F5B, 0x0197, 0x5156, 0x2773, 0x0592, 0x21B4, 0x1E32, 0x16AD, 0xA2A7, 0x82FF, 0xB4BE, 0x7C83,
+ 0x99A5, 0x1168, 0x708F, 0x1590, 0x048A, 0x1B90, 0x227D, 0x63B2, 0x0D5C, 0x5CAD, 0x0F32, 0x8589,
+ 0x689C, 0x03B7, 0x175E, 0x5E75, 0x6983, 0x29A7, 0x135B, 0x4CAE, 0x4349, 0x1531, 0x4955, 0x0A38,
+ 0x0123, 0x1F47, 0x99A8, 0x384B, 0x3B71, 0x2191, 0x3D79, 0x2744, 0x3B90, 0x4987, 0x538B, 0x0E68,
+ 0x80A2, 0x87A4, 0x25BE, 0x2DA8, 0x2138, 0x27B4, 0x004E, 0x138B, 0x022A, 0x6382, 0x093F, 0x34BE,
+ 0x6D82, 0x4B90, 0x0634, 0x90B7, 0x1B55, 0x2F56, 0x99BB, 0x6175, 0x3E8E, 0x3D66, 0x2078, 0x4CB0 } ;
@@ -8,6 +8,11 @@
 #include "ognconv.h"
 #include "bitcount.h"
 #include "format.h"
+#include "crc.h"
+#include "crc-correct.h"
+
+extern const uint16_t ADSL_SyndromeDisp[];   // perfect hash of the 1-bit and 2-bit error syndromes, in adsl.cpp
+extern const uint16_t ADSL_SyndromeHash[];
 
 class ADSL_Packet
 { public:
@@ -610,26 +615,11 @@ class ADSL_Packet
 
 // --------------------------------------------------------------------------------------------------------
 
-   static uint32_t PolyPass(uint32_t CRC, uint8_t Byte)     // pass a single byte through the CRC polynomial
-   { const uint32_t Poly = 0xFFFA0480;
-     CRC |= Byte;
-     for(uint8_t Bit=0; Bit<8; Bit++)
-     { if(CRC&0x80000000) CRC ^= Poly;
-       CRC<<=1; }
-     return CRC; }
-
    static uint32_t checkPI(const uint8_t *Byte, uint8_t Bytes) // run over data bytes and the three CRC bytes
-   { uint32_t CRC = 0;
-     for(uint8_t Idx=0; Idx<Bytes; Idx++)
-     { CRC = PolyPass(CRC, Byte[Idx]); }
-     return CRC>>8; }                                          // should be all zero for a correct packet
+   { return CRC_ADSL::Shift(0, Byte, Bytes); }                // should be all zero for a correct packet, else the syndrome
 
    static uint32_t calcPI(const uint8_t *Byte, uint8_t Bytes)  // calculate PI for the given packet data excluding the three CRC bytes
-   { uint32_t CRC = 0;
-     for(uint8_t Idx=0; Idx<Bytes; Idx++)
-     { CRC = PolyPass(CRC, Byte[Idx]); }
-     CRC=PolyPass(CRC, 0); CRC=PolyPass(CRC, 0); CRC=PolyPass(CRC, 0);
-     return CRC>>8; }                                          //
+   { return CRC_ADSL::Pass(0, Byte, Bytes); }                 // = checkPI() over the data followed by three zero bytes
 
     void setCRC(void)
     { uint32_t Word = calcPI((const uint8_t *)&Version, TxBytes-6);
@@ -638,47 +628,20 @@ class ADSL_Packet
     uint32_t checkCRC(void) const
     { return checkPI((const uint8_t *)&Version, TxBytes-3); }
 
-    static int Correct(uint8_t *PktData, uint8_t *PktErr, const int MaxBadBits=6) // correct the manchester-decoded packet with dead/weak bits marked
-    { const int Bytes=TxBytes-3;
-      uint32_t CRC = checkPI(PktData, Bytes); if(CRC==0) return 0;
-      uint8_t ErrBit=FindCRCsyndrome(CRC);
-      if(ErrBit!=0xFF) { FlipBit(PktData, ErrBit); return 1; }
-
-      uint8_t BadBitIdx[MaxBadBits];                                    // bad bit index
-      uint8_t BadBitMask[MaxBadBits];                                   // bad bit mask
-      uint32_t Syndrome[MaxBadBits];                                    // bad bit mask
-      uint8_t BadBits=0;                                                // count the bad bits
-      for(uint8_t ByteIdx=0; ByteIdx<Bytes; ByteIdx++)                  // loop over bytes
-      { uint8_t Byte=PktErr[ByteIdx];
-        uint8_t Mask=0x80;
-        for(uint8_t BitIdx=0; BitIdx<8; BitIdx++)                       // loop over bits
-        { if(Byte&Mask)
-          { if(BadBits<MaxBadBits)
-            { BadBitIdx[BadBits]=ByteIdx;                               // store the bad bit index
-              BadBitMask[BadBits]=Mask;
-              Syndrome[BadBits]=CRCsyndrome(ByteIdx*8+BitIdx); }
-            BadBits++;
-          }
-          Mask>>=1;
-        }
-        if(BadBits>MaxBadBits) break;
-      }
-      if(BadBits>MaxBadBits) return -1;                                 // return failure when too many bad bits
-
-      uint8_t Loops = 1<<BadBits; uint8_t PrevGrayIdx=0;
-      for(uint8_t Idx=1; Idx<Loops; Idx++)                              // loop through all combination of bad bit flips
-      { uint8_t GrayIdx= Idx ^ (Idx>>1);                                // use Gray code to change flip just one bit at a time
-        uint8_t BitExp = GrayIdx^PrevGrayIdx;
-        uint8_t Bit=0; while(BitExp>>=1) Bit++;
-        PktData[BadBitIdx[Bit]]^=BadBitMask[Bit];
-        CRC^=Syndrome[Bit]; if(CRC==0) return Count1s(GrayIdx);
-        uint8_t ErrBit=FindCRCsyndrome(CRC);
-        if(ErrBit!=0xFF)
-        { FlipBit(PktData, ErrBit);
-          return Count1s(GrayIdx)+1; }
-        PrevGrayIdx=GrayIdx; }
-
-      return -1; }
+    // correct the manchester-decoded packet with dead/weak bits marked: up to MaxFreeBits (1 or 2) unmarked bit errors by the syndrome alone,
+    // else flip combinations of up to MaxBadBits marked bits, each combination plus one unmarked bit error
+    static int Correct(uint8_t *PktData, const uint8_t *PktErr, const int MaxBadBits=6, const int MaxFreeBits=1)
+    { uint32_t CRC = checkPI(PktData, TxBytes-3); if(CRC==0) return 0;
+      int FreeBits=CorrectSyndrome(PktData, CRC, MaxFreeBits);
+      if(FreeBits>0) return FreeBits;
+      return Corrector::Correct(PktData, CRC, PktErr, MaxBadBits); }
+
+    // the same with the soft decisions of FSK_RxPacket::getSoft(): combinations of the MaxBadBits least reliable bits
+    static int Correct(uint8_t *PktData, const int8_t *PktSoft, const int MaxBadBits=6, const int MaxFreeBits=1)
+    { uint32_t CRC = checkPI(PktData, TxBytes-3); if(CRC==0) return 0;
+      int FreeBits=CorrectSyndrome(PktData, CRC, MaxFreeBits);
+      if(FreeBits>0) return FreeBits;
+      return Corrector::Correct(PktData, CRC, PktSoft, MaxBadBits); }
 
     static void FlipBit(uint8_t *Byte, int BitIdx)
     { int ByteIdx=BitIdx>>3;
@@ -689,7 +652,7 @@ class ADSL_Packet
     static uint32_t CRCsyndrome(uint8_t Bit)
     { const uint16_t PacketBytes = TxBytes-3;
       const uint16_t PacketBits = PacketBytes*8;
-      const uint32_t Syndrome[PacketBits] = {
+      static const uint32_t Syndrome[PacketBits] = {
  0x7ABEE1, 0xC2A574, 0x6152BA, 0x30A95D, 0xE7AEAA, 0x73D755, 0xC611AE, 0x6308D7,
  0xCE7E6F, 0x98C533, 0xB3989D, 0xA6364A, 0x531B25, 0xD67796, 0x6B3BCB, 0xCA67E1,
  0x9AC9F4, 0x4D64FA, 0x26B27D, 0xECA33A, 0x76519D, 0xC4D2CA, 0x626965, 0xCECEB6,
@@ -716,46 +679,37 @@ class ADSL_Packet
  0x000080, 0x000040, 0x000020, 0x000010, 0x000008, 0x000004, 0x000002, 0x000001 } ;
       return Syndrome[Bit]; }
 
+    const static uint16_t SyndromeBuckets = 4096;              // perfect hash of the 1-bit and 2-bit syndromes: ADSL_SyndromeDisp[] and ADSL_SyndromeHash[]
+    const static uint16_t SyndromeSlots   = 18528;             // 192 single + 192*191/2 double bit errors: no empty slots
+    const static uint32_t SyndromeDispMul = 0x9E3779B9;        // displacement to the second hash: Syndr^(Disp*SyndromeDispMul)
+                                                               // the tables in adsl.cpp are generated by utils/adsl_syndrome_gen
+
+    static uint32_t SyndromeHash(uint32_t Syndr)               // mixes all bits, bijective thus distinct syndromes stay distinct
+    { Syndr*=0x9E3779B1; Syndr^=Syndr>>16; Syndr*=0x85EBCA6B; Syndr^=Syndr>>13; return Syndr; }
+
+    static uint16_t FindCRCpattern(uint32_t Syndr)             // O(1) lookup of a 1-bit or 2-bit error pattern for the CRC syndrome
+    { const uint16_t PacketBits = (TxBytes-3)*8;               // returns (Bit1<<8)|Bit2 with Bit2=0xFF for a single bit, 0xFFFF when none
+      uint16_t Disp = ADSL_SyndromeDisp[SyndromeHash(Syndr)>>20];
+      uint16_t Pattern = ADSL_SyndromeHash[SyndromeHash(Syndr^(Disp*SyndromeDispMul))%SyndromeSlots];
+      uint8_t Bit1=Pattern>>8, Bit2=Pattern;                   // every syndrome lands in some slot: confirm it is the one of this pattern
+      uint32_t PatSyndr = CRCsyndrome(Bit1); if(Bit2<PacketBits) PatSyndr^=CRCsyndrome(Bit2);
+      if(PatSyndr!=Syndr) return 0xFFFF;
+      return Pattern; }
+
     static uint8_t FindCRCsyndrome(uint32_t Syndr)              // quick search for a single-bit CRC syndrome
-    { const uint16_t PacketBytes = TxBytes-3;
-      const uint16_t PacketBits = PacketBytes*8;
-      const uint32_t Syndrome[PacketBits] = {
- 0x000001BF, 0x000002BE, 0x000004BD, 0x000008BC, 0x000010BB, 0x000020BA, 0x000040B9, 0x000080B8,
- 0x000100B7, 0x000200B6, 0x000400B5, 0x000800B4, 0x001000B3, 0x001C1BA6, 0x002000B2, 0x003836A5,
- 0x004000B1, 0x00706CA4, 0x008000B0, 0x00E0D8A3, 0x010000AF, 0x01856788, 0x01C1B0A2, 0x020000AE,
- 0x030ACE87, 0x038360A1, 0x040000AD, 0x049C816D, 0x06159C86, 0x0706C0A0, 0x080000AC, 0x0939026C,
- 0x099DED1E, 0x0AF3852D, 0x0B0E2F5A, 0x0B60CF39, 0x0C2B3885, 0x0DD44197, 0x0E0D809F, 0x100000AB,
- 0x1272046B, 0x133BDA1D, 0x15B82D7E, 0x15E70A2C, 0x161C5E59, 0x16C19E38, 0x1826E724, 0x18567084,
- 0x1BA88296, 0x1C1B009E, 0x1C9AF551, 0x200000AA, 0x24E4086A, 0x2677B41C, 0x26B27D12, 0x2B705A7D,
- 0x2BCE142B, 0x2BFD538F, 0x2C38BC58, 0x2D833C37, 0x304DCE23, 0x30A95D03, 0x30ACE083, 0x34170561,
- 0x365B594D, 0x37510495, 0x38132373, 0x3836009D, 0x3935EA50, 0x3E44099A, 0x3F6D1170, 0x400000A9,
- 0x457C2992, 0x4701E776, 0x49C81069, 0x4CEF681B, 0x4D2EC14A, 0x4D64FA11, 0x4E5C9B66, 0x4FABBF32,
- 0x531B250C, 0x56E0B47C, 0x579C282A, 0x57FAA68E, 0x58717857, 0x5A086F41, 0x5A5C4545, 0x5B067836,
- 0x5F4ACF3D, 0x5F4C215E, 0x609B9C22, 0x6152BA02, 0x6159C082, 0x62696516, 0x6308D707, 0x67675B18,
- 0x682E0A60, 0x696A1347, 0x6B3BCB0E, 0x6CB6B24C, 0x6EA20894, 0x70264672, 0x706C009C, 0x726BD44F,
- 0x72F8C363, 0x73D75505, 0x76519D14, 0x78DBBF53, 0x7A930980, 0x7ABEE100, 0x7C881299, 0x7D41E32F,
- 0x7D9A7920, 0x7EDA226F, 0x800000A8, 0x80665F8A, 0x82C48D5C, 0x82DF353B, 0x860EBF26, 0x8AF85291,
- 0x8E03CE75, 0x91C77F78, 0x93902068, 0x93EDE934, 0x96851D43, 0x97D5B53F, 0x98C53309, 0x99DED01A,
- 0x9A5D8249, 0x9AC9F410, 0x9CB93665, 0x9E31E955, 0x9F577E31, 0xA01E918C, 0xA184A928, 0xA476D97A,
- 0xA6364A0B, 0xADC1687B, 0xAF385029, 0xAFF54C8D, 0xB0E2F056, 0xB3989D0A, 0xB410DE40, 0xB4B88A44,
- 0xB60CF035, 0xB719BB79, 0xBCFD5B27, 0xBE959E3C, 0xBE98425D, 0xBFC92B8B, 0xC1373821, 0xC15AF530,
- 0xC2A57401, 0xC2B38081, 0xC397DB54, 0xC4D2CA15, 0xC611AE06, 0xC6866564, 0xCA67E10F, 0xCB4F0D48,
- 0xCC49A919, 0xCE7E6F08, 0xCECEB617, 0xD05C145F, 0xD05F633E, 0xD2D42646, 0xD2FE3342, 0xD677960D,
- 0xD82FDB33, 0xD8D44967, 0xD96D644B, 0xDC7AF777, 0xDD441093, 0xE04C8C71, 0xE0D8009B, 0xE3F39574,
- 0xE4D7A84E, 0xE5F18662, 0xE7AEAA04, 0xEA04AD90, 0xECA33A13, 0xF1B77E52, 0xF3E97725, 0xF526127F,
- 0xF9102498, 0xFA4A633A, 0xFA7D135B, 0xFA83C62E, 0xFB34F21F, 0xFDB4446E, 0xFF38B789, 0xFFF409A7 } ;
-
-      uint16_t Bot=0;
-      uint16_t Top=PacketBits;
-      uint32_t MidSyndr=0;
-      for( ; ; )
-      { uint16_t Mid=(Bot+Top)>>1;
-        MidSyndr = Syndrome[Mid]>>8;
-        if(Syndr==MidSyndr) return (uint8_t)Syndrome[Mid];
-        if(Mid==Bot) break;
-        if(Syndr< MidSyndr) Top=Mid;
-                       else Bot=Mid; }
-      return 0xFF; }
+    { uint16_t Pattern=FindCRCpattern(Syndr);
+      if((uint8_t)Pattern!=0xFF) return 0xFF;                  // none or a double bit error
+      return Pattern>>8; }
+
+    static int CorrectSyndrome(uint8_t *PktData, uint32_t Syndr, int MaxBits=2) // flip the 1 or 2 bits which give the syndrome
+    { uint16_t Pattern=FindCRCpattern(Syndr);                  // returns the number of bits flipped or -1 when no such pattern
+      if(Pattern==0xFFFF) return -1;
+      uint8_t Bit2=Pattern;
+      if(Bit2==0xFF) { FlipBit(PktData, Pattern>>8); return 1; }
+      if(MaxBits<2) return -1;
+      FlipBit(PktData, Pattern>>8); FlipBit(PktData, Bit2); return 2; }
+
+    typedef CRC_Corrector<uint32_t, (TxBytes-3)*8, CRCsyndrome, FindCRCsyndrome> Corrector; // erasure search of Correct()
 
 } __attribute__((packed));
 
@@ -27,6 +27,13 @@ static FIFO<uint8_t, 256> AP_RxFIFO;
 
 void AP_Write(char Byte) { AP_TxFIFO.Write(Byte); }
 
+#ifdef WITH_FANOUT
+static int AP_Write(const char *Data, int Len)                    // for the output fan-out
+{ return OUT_WriteFIFO(AP_TxFIFO, Data, Len); }
+
+static bool AP_isConnected(void) { return PortServer.Clients()>0; }
+#endif
+
 static int AP_TxPush(size_t MaxLen=256)                           // transmit part of the TxFIFO to the TCP clients
 { char *Data; size_t Len=AP_TxFIFO.getReadBlock(Data);            // see how much data is there in the queue for transmission
   if(Len==0) return 0;                                            // if block is empty then give up
@@ -43,6 +50,9 @@ void vTaskAP(void* pvParameters)
 { esp_err_t Err;
   AP_TxFIFO.Clear();
   AP_RxFIFO.Clear();
+#ifdef WITH_FANOUT
+  int8_t OutSink=OUT_FanOut.addSink("AP", AP_Write, AP_isConnected, 0, 1000000); // traffic sentences for the TCP clients
+#endif
   vTaskDelay(1000);
 
   Err=WIFI_StartAP(Parameters.APname, Parameters.APpass, Parameters.APchan);
@@ -69,7 +79,11 @@ void vTaskAP(void* pvParameters)
   // vTaskDelay(1000);
 
   for( ; ; )                                                       // main (endless) loop
-  { Err=AP_TxPush();
+  {
+#ifdef WITH_FANOUT
+    if(OutSink>=0) OUT_FanOut.Service(OutSink, micros());
+#endif
+    Err=AP_TxPush();
     if(Err>0) { vTaskDelay(1); continue; }
     vTaskDelay(50);
     Err = PortServer.Accept();
@@ -64,6 +64,15 @@ inline uint8_t Count1s(int64_t LongWord) { return Count1s((uint64_t)LongWord); }
 
 int   Count1s(const uint8_t *Byte, int Bytes);
 
+// parity (the lowest bit of the count) of a 32-bit word: for parity checks accumulate the AND-ed words by XOR, then count once
+#if defined(BITCOUNT_USE_BUILTIN) || defined(__POPCNT__) || defined(__riscv_zbb)
+inline uint8_t Parity1s(uint32_t LongWord) { return __builtin_popcount(LongWord)&1; }  // a single instruction where the CPU has popcount
+#else
+inline uint8_t Parity1s(uint32_t LongWord)                                             // else fold to a nibble: no table, no library call
+{ LongWord^=LongWord>>16; LongWord^=LongWord>>8; LongWord^=LongWord>>4;
+  return (0x6996>>(LongWord&0x0F))&1; }
+#endif
+
 // ==========================================================================
 
 // use __builtin_popcount(unsigned int) ? http://stackoverflow.com/questions/109023/how-to-count-the-number-of-set-bits-in-a-32-bit-integer
@@ -33,8 +33,7 @@ class MyCallbacks: public BLECharacteristicCallbacks
 { void onWrite(BLECharacteristic *pCharacteristic)
   { std::string value = pCharacteristic->getValue();
     if(value.length()<=0) return;
-    for (int Idx=0; Idx<value.length(); Idx++)
-    { BLE_SPP_RxFIFO.Write(value[Idx]); }
+    BLE_SPP_RxFIFO.Write(value.data(), value.length());     // as much as fits, visible to the reader at once
   }
 };
 
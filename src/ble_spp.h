@@ -3,6 +3,7 @@
 
 extern FIFO<char, 2048> BLE_SPP_TxFIFO;
 extern FIFO<char, 2048> BLE_SPP_RxFIFO;
+extern bool BLE_SPP_isConnected;
 
 void BLE_SPP_Check(void);
 void BLE_SPP_Start(const char *DevName);
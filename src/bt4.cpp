@@ -6,6 +6,7 @@
 
 #include "format.h"
 #include "fifo.h"
+#include "out-fanout.h"
 
 #ifdef WITH_BT4_SPP                            // classic BT with ESP-IDF
 
@@ -182,6 +183,12 @@ void BT_SPP_Write (char Byte)     // send a character to the BT serial port
   { BT_SPP_TxPush(); }                                                                    // read a block from TxFIFO ad push it into the BT_SPP
 }
 
+int BT_SPP_Write(const char *Data, int Len)   // a whole sentence or nothing: for the output fan-out, see out-fanout.h
+{ if(!BT_SPP_Conn) return 0;
+  Len=OUT_WriteFIFO(BT_SPP_TxFIFO, Data, Len); if(Len==0) return 0;
+  if(BT_SPP_TxCong==0) BT_SPP_TxPush();
+  return Len; }
+
 int BT_SPP_Init(void)
 { esp_err_t Err=ESP_OK;
   if(Parameters.BTname[0]==0) return Err;
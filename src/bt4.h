@@ -7,5 +7,6 @@ int  BT_SPP_Init(void);
 bool BT_SPP_isConnected(void);
  int BT_SPP_Read (uint8_t &Byte);
 void BT_SPP_Write (char Byte);
+ int BT_SPP_Write (const char *Data, int Len);
 
 #endif // __BT4_H__
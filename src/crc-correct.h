@@ -0,0 +1,96 @@
+#ifndef __CRC_CORRECT_H__
+#define __CRC_CORRECT_H__
+
+#include <stdint.h>
+
+#include "bitcount.h"
+
+// Erasure-guided correction of the packets protected only by a CRC: FLARM (CRC-1021) and ADS-L on the M-band (24-bit PI).
+// The candidate bits, least reliable first, are flipped in all combinations in Gray-code order: one candidate changes
+// from one combination to the next, thus the syndrome follows by one XOR, and the first 2^k combinations are those
+// of the k least reliable candidates. A combination is taken when the syndrome is zero or that of one more bit error.
+// Candidates are the Manchester errors (hard input) or the bits of smallest magnitude in the soft decisions
+// of FSK_RxPacket::getSoft(): the Manchester errors (zero) and then the valid bits in the error bursts.
+// More Manchester errors than the budget: the packet is most likely noise, no search, but both inputs
+// (as the former Correct()) still take a single unmarked bit error.
+// The budget of MaxBits candidates tests 2^MaxBits combinations against PacketBits+1 syndromes each, so a packet
+// beyond repair passes with a probability of about 2^MaxBits*(PacketBits+1)/2^Width: keep it small for the 16-bit CRC.
+//   Word         the CRC register, wide enough for the syndromes
+//   PacketBits   data plus CRC, in the order of reception (MSB first)
+//   Syndrome     syndrome of a single bit error at the given bit
+//   FindSyndrome the bit of a single-bit syndrome, 0xFF when none
+
+template <class Word, int PacketBits, Word (*Syndrome)(uint8_t), uint8_t (*FindSyndrome)(Word)>
+ class CRC_Corrector
+{ public:
+   static const int MaxSearchBits = 16;                            // [bits] largest budget: 65536 combinations
+
+   static void FlipBit(uint8_t *Data, int Bit) { Data[Bit>>3] ^= 0x80>>(Bit&7); }
+
+   static int getErased(uint8_t *BitIdx, const uint8_t *Err, int MaxBits) // the Manchester errors in the order of reception
+   { int Bits=0;                                                   // returns their number or -1 when more than MaxBits
+     for(int ByteIdx=0; ByteIdx<PacketBits/8; ByteIdx++)
+     { uint8_t Byte=Err[ByteIdx]; if(Byte==0) continue;
+       for(int Bit=0; Bit<8; Bit++)
+       { if((Byte&(0x80>>Bit))==0) continue;
+         if(Bits>=MaxBits) return -1;
+         BitIdx[Bits++]=ByteIdx*8+Bit; }
+     }
+     return Bits; }
+
+   static int getWeakest(uint8_t *BitIdx, const int8_t *Soft, int MaxBits) // the MaxBits bits of smallest |Soft|, least reliable first
+   { if(MaxBits>MaxSearchBits) MaxBits=MaxSearchBits;              // returns their number or -1 when more than MaxBits are erased (zero):
+     if(MaxBits<=0) return 0;                                      // then the packet is most likely noise
+     uint8_t Ampl[MaxSearchBits]; int Bits=0, Erased=0;            // insertion into a short sorted list: equal ones stay in the order of reception
+     for(int Bit=0; Bit<PacketBits; Bit++)
+     { uint8_t A = Soft[Bit]<0 ? -Soft[Bit]:Soft[Bit];
+       if(A==0 && (++Erased)>MaxBits) return -1;
+       if(Bits==MaxBits && A>=Ampl[Bits-1]) continue;             // not weaker than the weakest MaxBits so far
+       int Pos = Bits<MaxBits ? Bits++ : Bits-1;
+       for( ; Pos>0 && Ampl[Pos-1]>A; Pos--)
+       { Ampl[Pos]=Ampl[Pos-1]; BitIdx[Pos]=BitIdx[Pos-1]; }
+       Ampl[Pos]=A; BitIdx[Pos]=Bit; }
+     return Bits; }
+
+   static int Search(uint8_t *Data, Word CRC, const uint8_t *BitIdx, int Bits) // CRC: the syndrome of the packet as received
+   { if(CRC==0) return 0;                                          // returns the number of bits flipped or -1 when no combination passes
+     uint8_t ErrBit=FindSyndrome(CRC);                             // then the packet is left as it was
+     if(ErrBit!=0xFF) { FlipBit(Data, ErrBit); return 1; }
+     if(Bits>MaxSearchBits) Bits=MaxSearchBits;
+     Word BitSyndr[MaxSearchBits];
+     for(int Idx=0; Idx<Bits; Idx++) BitSyndr[Idx]=Syndrome(BitIdx[Idx]);
+     uint32_t Loops=(uint32_t)1<<Bits; uint32_t GrayIdx=0;
+     for(uint32_t Idx=1; Idx<Loops; Idx++)                         // loop through all combinations of the candidate flips
+     { int Bit=__builtin_ctz(Idx);                                 // Gray code: from Idx-1 to Idx this one bit changes
+       GrayIdx^=(uint32_t)1<<Bit;
+       CRC^=BitSyndr[Bit];
+       if(CRC==0) { Apply(Data, BitIdx, GrayIdx); return Count1s(GrayIdx); }
+       ErrBit=FindSyndrome(CRC);
+       if(ErrBit!=0xFF)
+       { Apply(Data, BitIdx, GrayIdx); FlipBit(Data, ErrBit);
+         return Count1s(GrayIdx)+1; }
+     }
+     return -1; }
+
+   static int Correct(uint8_t *Data, Word CRC, const uint8_t *Err, int MaxBits)  // hard input: no search when more Manchester errors than MaxBits
+   { uint8_t BitIdx[MaxSearchBits];
+     if(MaxBits>MaxSearchBits) MaxBits=MaxSearchBits;
+     int Bits=getErased(BitIdx, Err, MaxBits);
+     if(Bits<0) Bits=0;                                            // then only a single unmarked bit error
+     return Search(Data, CRC, BitIdx, Bits); }
+
+   static int Correct(uint8_t *Data, Word CRC, const int8_t *Soft, int MaxBits) // soft input: the MaxBits least reliable bits,
+   { if(CRC==0) return 0;                                          // more Manchester errors than MaxBits: as the hard input
+     uint8_t BitIdx[MaxSearchBits];
+     int Bits=getWeakest(BitIdx, Soft, MaxBits);
+     if(Bits<0) Bits=0;                                            // then only a single unmarked bit error
+     return Search(Data, CRC, BitIdx, Bits); }
+
+  private:
+   static void Apply(uint8_t *Data, const uint8_t *BitIdx, uint32_t Flip) // flip the candidates of the combination
+   { for(int Idx=0; Flip; Idx++, Flip>>=1)
+       if(Flip&1) FlipBit(Data, BitIdx[Idx]); }
+
+} ;
+
+#endif // __CRC_CORRECT_H__
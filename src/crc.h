@@ -0,0 +1,123 @@
+#ifndef __CRC_H__
+#define __CRC_H__
+
+#include <stdint.h>
+
+// CRC engine for the MSB-first polynomial CRCs of the protocols: ADS-L PI (24-bit), FLARM and GDL90 CRC-1021, PAW CRC8.
+// The tables are generated by the compiler from the polynomial (constexpr, C++11), CRC_SLICES sets the flash budget:
+//   0: no table, bit by bit       1: one table of 256 words per polynomial
+//   4: slicing-by-4, 4 tables     8: slicing-by-8, 8 tables: blocks of 4 or 8 bytes at one lookup per byte without a dependency chain
+// Pass()  is the common CRC: the register runs over the message followed by Width zero bits (FLARM, PAW, ADS-L calcPI)
+// Shift() is the remainder of the message itself (ADS-L checkPI, GDL90): the last Width/8 bytes enter the register as they are.
+
+#ifndef CRC_SLICES
+#define CRC_SLICES 4
+#endif
+
+template <int... Idx> struct CRC_Index { } ;                       // compile-time list 0..N-1 to expand the table initializers
+
+template <class A, class B> struct CRC_Concat;
+template <int... IdxA, int... IdxB>
+ struct CRC_Concat< CRC_Index<IdxA...>, CRC_Index<IdxB...> >
+{ typedef CRC_Index<IdxA..., (int)sizeof...(IdxA)+IdxB...> Type; } ;
+
+template <int N> struct CRC_MakeIndex                              // split in halves: log(N) deep, not N deep
+{ typedef typename CRC_Concat<typename CRC_MakeIndex<N/2>::Type, typename CRC_MakeIndex<N-N/2>::Type>::Type Type; } ;
+template <> struct CRC_MakeIndex<0> { typedef CRC_Index<>  Type; } ;
+template <> struct CRC_MakeIndex<1> { typedef CRC_Index<0> Type; } ;
+
+template <class Engine, class Index> struct CRC_TableData;
+template <class Engine, int... Idx>
+ struct CRC_TableData< Engine, CRC_Index<Idx...> >
+{ static constexpr typename Engine::Word Table[sizeof...(Idx)] = { Engine::Entry(Idx>>8, Idx&0xFF)... } ; } ;
+template <class Engine, int... Idx>
+ constexpr typename Engine::Word CRC_TableData< Engine, CRC_Index<Idx...> >::Table[sizeof...(Idx)];
+
+template <class WordType, int Width, WordType Poly, int Slices=CRC_SLICES>
+ class CRC_Engine
+{ public:
+   typedef WordType Word;
+   static_assert(Width>=8 && Width<=32 && Width<=8*(int)sizeof(Word), "CRC width must fit the word and be 8..32 bits");
+   static_assert(Slices==0 || Slices==1 || Slices==4 || Slices==8, "CRC_SLICES must be 0, 1, 4 or 8");
+
+   static constexpr Word Mask = (Word)(((uint64_t)1<<Width)-1);
+   static constexpr Word Top  = (Word)((uint64_t)1<<(Width-1));
+
+   static constexpr Word Step(Word Reg, int Bits)                  // Bits steps of the shift register with no data entering
+   { return Bits==0 ? Reg : Step( (Word)(((Reg&Top) ? ((uint64_t)Reg<<1)^Poly : (uint64_t)Reg<<1) & Mask ), Bits-1); }
+
+   static constexpr Word Entry(int Slice, int Byte)                // CRC of the byte followed by Slice zero bytes
+   { return Slice==0 ? Step((Word)((uint64_t)Byte<<(Width-8)), 8)
+                     : Zero(Entry(Slice-1, Byte)); }
+
+   static constexpr Word Zero(Word Reg)                            // pass one zero byte
+   { return (Word)(((uint64_t)Reg<<8)&Mask) ^ Entry(0, Reg>>(Width-8)); }
+
+   static Word Pass(Word CRC, uint8_t Byte)                       // pass one byte
+   { return PassByte(CRC, Byte, CRC_Slices<Slices>()); }
+
+   static Word Pass(Word CRC, const uint8_t *Data, int Len)       // pass a block of bytes
+   { return PassBlock(CRC, Data, Len, CRC_Slices<Slices>()); }
+
+   static Word Shift(Word CRC, uint8_t Byte)                      // shift one byte in: remainder of the message
+   { return (Word)((((uint64_t)CRC<<8)|Byte)&Mask) ^ Pass(0, (uint8_t)(CRC>>(Width-8))); }
+
+   static Word Shift(Word CRC, const uint8_t *Data, int Len)      // remainder of a block: the common CRC of all but the last Width/8 bytes
+   { const int Tail=Width/8;                                      // XOR-ed with these bytes as they are
+     if(Width%8 || Len<Tail)
+     { for( ; Len>0; Len--)
+         CRC = Shift(CRC, *Data++);
+       return CRC; }
+     if(CRC)                                                      // the register of Shift() is that of Pass() times x^Width
+     { for(int Idx=0; Idx<Tail; Idx++) CRC=Shift(CRC, (uint8_t)0); }
+     CRC = Pass(CRC, Data, Len-Tail); Data+=Len-Tail;
+     for(int Idx=0; Idx<Tail; Idx++)
+       CRC ^= (Word)((uint64_t)Data[Idx]<<(Width-8-8*Idx));
+     return CRC; }
+
+  private:
+   template <int S> struct CRC_Slices { } ;                       // picks the implementation: no table is referenced with CRC_SLICES=0
+
+   static const Word *Table(void) { return CRC_TableData<CRC_Engine, typename CRC_MakeIndex<Slices*256>::Type>::Table; }
+
+   static Word PassByte(Word CRC, uint8_t Byte, CRC_Slices<0>)
+   { uint32_t Reg = CRC ^ ((uint32_t)Byte<<(Width-8));           // a loop rather than the recursion of Step()
+     for(uint8_t Bit=0; Bit<8; Bit++)
+     { if(Reg&Top) Reg = (Reg<<1) ^ Poly;
+              else Reg =  Reg<<1; }
+     return Reg&Mask; }
+
+   template <int S>
+    static Word PassByte(Word CRC, uint8_t Byte, CRC_Slices<S>)
+   { return (Word)(((uint64_t)CRC<<8)&Mask) ^ Table()[(uint8_t)((CRC>>(Width-8))^Byte)]; }
+
+   template <int S>
+    static Word PassBlock(Word CRC, const uint8_t *Data, int Len, CRC_Slices<S>)
+   { for( ; Len>0; Len--)
+       CRC = Pass(CRC, *Data++);
+     return CRC; }
+
+   static Word PassSlices(Word CRC, const uint8_t *&Data, int &Len) // Slices bytes per loop, each looked up in the table of its distance from the end
+   { const Word *Tab=Table();
+     for( ; Len>=Slices; Len-=Slices, Data+=Slices)
+     { uint32_t Head = ((uint32_t)CRC<<(32-Width)) ^ ((uint32_t)Data[0]<<24 | (uint32_t)Data[1]<<16 | (uint32_t)Data[2]<<8 | Data[3]);
+       Word Next = Tab[(Slices-1)*256+(Head>>24)]        ^ Tab[(Slices-2)*256+((Head>>16)&0xFF)]       // the register enters
+                 ^ Tab[(Slices-3)*256+((Head>>8)&0xFF)] ^ Tab[(Slices-4)*256+(Head&0xFF)];              // with the first four bytes
+       if(Slices==8)
+         Next ^= Tab[3*256+Data[4]] ^ Tab[2*256+Data[5]] ^ Tab[256+Data[6]] ^ Tab[Data[7]];
+       CRC = Next; }
+     return CRC; }
+
+   static Word PassBlock(Word CRC, const uint8_t *Data, int Len, CRC_Slices<4>)
+   { CRC=PassSlices(CRC, Data, Len); return PassBlock(CRC, Data, Len, CRC_Slices<1>()); }
+
+   static Word PassBlock(Word CRC, const uint8_t *Data, int Len, CRC_Slices<8>)
+   { CRC=PassSlices(CRC, Data, Len); return PassBlock(CRC, Data, Len, CRC_Slices<1>()); }
+
+} ;
+
+typedef CRC_Engine<uint32_t, 24, 0xFFF409> CRC_ADSL;              // ADS-L 24-bit PI
+typedef CRC_Engine<uint16_t, 16, 0x1021>   CRC_1021;              // FLARM, GDL90 and the RF statistics snapshots
+typedef CRC_Engine<uint8_t ,  8, 0x07>     CRC_PAW8;              // PilotAware external CRC8
+
+#endif // __CRC_H__
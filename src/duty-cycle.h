@@ -0,0 +1,89 @@
+#ifndef __DUTY_CYCLE_H__
+#define __DUTY_CYCLE_H__
+
+#include <stdint.h>
+#include <string.h>
+
+// Transmitter duty-cycle accounting per frequency band over a sliding one-hour window.
+// The window is a ring of one-minute bins with a running sum, thus the "may I transmit" question is O(1)
+// and the ring advances by at most one bin per minute of time passed.
+// Only the RF task updates it, other tasks read the fill level as of the last update (which happens every second).
+
+class DutyCycle_Band
+{ public:
+   static const uint8_t  Bins   = 60;                 // bins in the ring
+   static const uint8_t  BinSec = 60;                 // [sec] per bin => one hour window
+
+   uint32_t Limit;                                    // [usec] allowed time-on-air within the window, zero => no limit
+   uint32_t Sum;                                      // [usec] time-on-air summed over all bins
+   uint32_t BinTime;                                  // [sec] start of the current bin
+   uint8_t  Bin;                                      // current (most recent) bin of the ring
+   uint32_t usTime[Bins];                             // [usec] time-on-air per bin
+
+  public:
+   void Clear(void) { uint32_t Lim=Limit; memset(this, 0, sizeof(DutyCycle_Band)); Limit=Lim; }
+
+   void Advance(uint32_t Now)                         // move the ring to the bin of the given time, drop the bins which left the window
+   { uint32_t Steps = (Now-BinTime)/BinSec; if(Steps==0) return;
+     BinTime += Steps*BinSec;
+     if(Steps>Bins) Steps=Bins;
+     for( ; Steps; Steps--)
+     { Bin++; if(Bin>=Bins) Bin=0;
+       Sum-=usTime[Bin]; usTime[Bin]=0; }
+   }
+
+   void Charge(uint32_t usTx, uint32_t Now) { Advance(Now); usTime[Bin]+=usTx; Sum+=usTx; }
+
+   bool mayTx(uint32_t usTx, uint32_t Now)            // would a transmission of the given length stay within the limit ?
+   { if(Limit==0) return 1;
+     Advance(Now); return Sum+usTx<=Limit; }
+
+   uint32_t getLeft(void) const                       // [usec] time-on-air left within the window, check Limit first: no limit => all ones
+   { if(Limit==0) return 0xFFFFFFFF;
+     return Sum<Limit ? Limit-Sum:0; }
+
+   uint16_t getFill(void) const                       // [0.1%] fraction of the limit already used
+   { if(Limit==0) return 0;
+     return ((uint64_t)Sum*1000+Limit/2)/Limit; }
+
+} ;
+
+class DutyCycle
+{ public:
+   static const uint8_t Band_M   = 0;                 // 868.0-868.6MHz: FLR, OGN, ADS-L (and LoRaWAN)
+   static const uint8_t Band_O   = 1;                 // 869.4-869.65MHz: PAW, ADS-L/OGN LDR at +13dBm
+   static const uint8_t Band_FNT = 2;                 // FANET at 868.2MHz: own budget, and charged to the M-band as well
+   static const uint8_t Bands    = 3;
+
+   static const uint32_t Hour_us = 3600000000;        // [usec]
+
+   DutyCycle_Band Band[Bands];
+
+  public:
+   void Clear(void) { for(uint8_t Idx=0; Idx<Bands; Idx++) Band[Idx].Clear(); }
+
+   void Update(bool EU, uint32_t Now)                 // ETSI limits in Europe/Africa, none elsewhere
+   { Band[Band_M  ].Limit = EU ? Hour_us/100 : 0;     // 1%
+     Band[Band_O  ].Limit = EU ? Hour_us/10  : 0;     // 10%
+     Band[Band_FNT].Limit = EU ? Hour_us/100 : 0;     // 1%
+     for(uint8_t Idx=0; Idx<Bands; Idx++) Band[Idx].Advance(Now); }
+
+   bool mayTx(uint8_t Idx, uint32_t usTx, uint32_t Now)
+   { if(!Band[Idx].mayTx(usTx, Now)) return 0;
+     return Idx!=Band_FNT || Band[Band_M].mayTx(usTx, Now); }
+
+   void Charge(uint8_t Idx, uint32_t usTx, uint32_t Now)
+   { Band[Idx].Charge(usTx, Now);
+     if(Idx==Band_FNT) Band[Band_M].Charge(usTx, Now); }
+
+   uint8_t BackOff(uint8_t Idx) const                 // extra seconds for the producer to skip: spread the load before the limit is hit
+   { uint16_t Fill=Band[Idx].getFill();
+     if(Idx==Band_FNT) { uint16_t FillM=Band[Band_M].getFill(); if(FillM>Fill) Fill=FillM; }
+     if(Fill< 500) return 0;
+     if(Fill< 750) return 1;
+     if(Fill< 900) return 3;
+     return 7; }
+
+} ;
+
+#endif // __DUTY_CYCLE_H__
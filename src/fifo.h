@@ -4,91 +4,128 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <atomic>
+
+// Single-producer/single-consumer ring: one task (or an interrupt) writes, one task reads, possibly on the other core.
+// Each side owns its pointer: it loads it relaxed and stores it with release after the elements are written or read,
+// the pointer of the other side is loaded with acquire. Thus the consumer never sees an element before it is complete
+// and the producer never overwrites an element which is still being read.
+// The two pointers sit on separate cache lines on hosts with a data cache, on the MCU (internal RAM, no cache) they stay packed.
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+const unsigned FIFO_PtrAlign = 64;                 // [bytes] a cache line
+#else
+const unsigned FIFO_PtrAlign = sizeof(unsigned);
+#endif
+
 template <class Type, const unsigned Size> // size must be (!) a power of 2 like 4, 8, 16, 32, etc.
  class FIFO
 { public:
    static const unsigned Len = Size;
    static const unsigned PtrMask = Size-1;
+   static_assert(Size>=2 && (Size&PtrMask)==0, "FIFO size must be a power of 2");
 
-   volatile unsigned ReadPtr;
-   volatile unsigned WritePtr;
-   Type Data[Len];
+   alignas(FIFO_PtrAlign) std::atomic<unsigned> ReadPtr;   // owned by the consumer
+   alignas(FIFO_PtrAlign) std::atomic<unsigned> WritePtr;  // owned by the producer
+   alignas(FIFO_PtrAlign) alignas(Type) Type Data[Len];
 
   public:
    FIFO() { Clear(); }
 
    bool isCorrupt(void) const
-   { return ReadPtr>=Size || WritePtr>=Size; }
+   { return ReadPtr.load(std::memory_order_relaxed)>=Size || WritePtr.load(std::memory_order_relaxed)>=Size; }
+
+   void Clear(void)                          // clear all stored data: not while the other side is active
+   { ReadPtr.store(0, std::memory_order_relaxed); WritePtr.store(0, std::memory_order_release); }
 
-   void Clear(void)                          // clear all stored data
-   { ReadPtr=0; WritePtr=0; }
+   // producer side
 
    unsigned Write(Type Byte)                // write a single element
-   { unsigned Ptr=WritePtr;
+   { unsigned Ptr=WritePtr.load(std::memory_order_relaxed);
+     unsigned Next=(Ptr+1)&PtrMask;
+     if(Next==ReadPtr.load(std::memory_order_acquire)) return 0;
      Data[Ptr]=Byte;
-     Ptr++; Ptr&=PtrMask;
-     if(Ptr==ReadPtr) return 0;
-     WritePtr=Ptr; return 1; }
+     WritePtr.store(Next, std::memory_order_release); return 1; }
 
    bool isFull(void) const               // if FIFO full ?
-   { unsigned Ptr=WritePtr;
+   { unsigned Ptr=WritePtr.load(std::memory_order_relaxed);
      Ptr++; Ptr&=PtrMask;
-     return Ptr==ReadPtr; }
+     return Ptr==ReadPtr.load(std::memory_order_acquire); }
 
     unsigned Free(void) const               // number of free elements: how much can you write into te FIFO
-    { return ((ReadPtr-WritePtr-1)&PtrMask); }
-
-    unsigned Full(void) const               // number of stored elements: how much you can read from the FIFO
-    { return ((WritePtr-ReadPtr)&PtrMask); }
+    { return (ReadPtr.load(std::memory_order_acquire)-WritePtr.load(std::memory_order_relaxed)-1)&PtrMask; }
 
    Type *getWrite(void)                  // get pointer to the next element which can be written
-   { return Data+WritePtr; }             // even when the FIFO is full this element exists
+   { return Data+WritePtr.load(std::memory_order_relaxed); } // even when the FIFO is full this element exists
 
    unsigned Write(void)                    // advance the write pointer: to be used with getWrite()
-   { unsigned Ptr=WritePtr;
+   { unsigned Ptr=WritePtr.load(std::memory_order_relaxed);
      Ptr++; Ptr&=PtrMask;
-     if(Ptr==ReadPtr) return 0;            // but, when the write pointer hits the read pointer then give up, do not advance
-     WritePtr=Ptr; return 1; }
+     if(Ptr==ReadPtr.load(std::memory_order_acquire)) return 0; // but, when the write pointer hits the read pointer then give up, do not advance
+     WritePtr.store(Ptr, std::memory_order_release); return 1; }  // the element becomes visible to the consumer
+
+   unsigned Write(const Type *Src, unsigned Count) // write a block of elements, as many as there is space for, returns how many
+   { unsigned Ptr=WritePtr.load(std::memory_order_relaxed);
+     unsigned Space=(ReadPtr.load(std::memory_order_acquire)-Ptr-1)&PtrMask;
+     if(Count>Space) Count=Space;
+     unsigned First=Size-Ptr; if(First>Count) First=Count;                    // up to the end of the buffer
+     for(unsigned Idx=0; Idx<First; Idx++) Data[Ptr+Idx]=Src[Idx];
+     for(unsigned Idx=First; Idx<Count; Idx++) Data[Idx-First]=Src[Idx];      // the rest from the start
+     WritePtr.store((Ptr+Count)&PtrMask, std::memory_order_release);           // all of them visible at once
+     return Count; }
+
+   // consumer side
+
+    unsigned Full(void) const               // number of stored elements: how much you can read from the FIFO
+    { return (WritePtr.load(std::memory_order_acquire)-ReadPtr.load(std::memory_order_relaxed))&PtrMask; }
+
+   bool isEmpty(void) const                // is the FIFO all empty ?
+   { return ReadPtr.load(std::memory_order_relaxed)==WritePtr.load(std::memory_order_acquire); }
 
    unsigned Read(Type &Byte)               // read a single element
-   { unsigned Ptr=ReadPtr;
-     if(Ptr==WritePtr) return 0;           // FIFO empty
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     if(Ptr==WritePtr.load(std::memory_order_acquire)) return 0; // FIFO empty
      Byte=Data[Ptr];
      Ptr++; Ptr&=PtrMask;                  // increment pointer
-     ReadPtr=Ptr; return 1; }              // store it
+     ReadPtr.store(Ptr, std::memory_order_release); return 1; } // the element can now be overwritten
 
    void Read(void)                         // increment the read-pointer (thus forget the oldest item)
-   { unsigned Ptr=ReadPtr;
-     if(Ptr==WritePtr) return;
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     if(Ptr==WritePtr.load(std::memory_order_acquire)) return;
      Ptr++; Ptr&=PtrMask;
-     ReadPtr=Ptr; }
+     ReadPtr.store(Ptr, std::memory_order_release); }
+
+   unsigned Read(Type *Dst, unsigned Count) // read a block of elements, as many as there are, returns how many
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     unsigned Stored=(WritePtr.load(std::memory_order_acquire)-Ptr)&PtrMask;
+     if(Count>Stored) Count=Stored;
+     unsigned First=Size-Ptr; if(First>Count) First=Count;
+     for(unsigned Idx=0; Idx<First; Idx++) Dst[Idx]=Data[Ptr+Idx];
+     for(unsigned Idx=First; Idx<Count; Idx++) Dst[Idx]=Data[Idx-First];
+     ReadPtr.store((Ptr+Count)&PtrMask, std::memory_order_release);
+     return Count; }
 
    Type *getRead(void)                     // get pointer to the most recent item.
-   { if(ReadPtr==WritePtr) return 0;
-     return Data+ReadPtr; }
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     if(Ptr==WritePtr.load(std::memory_order_acquire)) return 0;
+     return Data+Ptr; }
 
    Type *getRead(unsigned Idx)
    { if(Idx>=Full()) return 0;
-     unsigned Ptr=(ReadPtr+Idx)&PtrMask;
+     unsigned Ptr=(ReadPtr.load(std::memory_order_relaxed)+Idx)&PtrMask;
      return Data+Ptr; }
 
    unsigned getReadBlock(Type *&Byte)      // get a pointer to the first element and the number of consecutive elements available for read
-   { if(ReadPtr==WritePtr) { Byte=0; return 0; }
-     Byte = Data+ReadPtr;
-     if(ReadPtr<WritePtr) return WritePtr-ReadPtr;
-     return Size-ReadPtr; }
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     unsigned Wr=WritePtr.load(std::memory_order_acquire);
+     if(Ptr==Wr) { Byte=0; return 0; }
+     Byte = Data+Ptr;
+     if(Ptr<Wr) return Wr-Ptr;
+     return Size-Ptr; }
 
    void flushReadBlock(unsigned Len)       // flush the elements which were already read: to be used after getReadBlock()
-   { ReadPtr+=Len; ReadPtr&=PtrMask; }
-
-   bool isEmpty(void) const                // is the FIFO all empty ?
-   { return ReadPtr==WritePtr; }
-
-   unsigned Write(const Type *Data, unsigned Len) // write a block of elements into the FIFO (could possibly be smarter than colling single Write many times)
-   { unsigned Idx;
-     for(Idx=0; Idx<Len; Idx++)
-     { if(Write(Data[Idx])==0) break; }
-     return Idx; }
+   { unsigned Ptr=ReadPtr.load(std::memory_order_relaxed);
+     ReadPtr.store((Ptr+Len)&PtrMask, std::memory_order_release); }
 
 /*
    Type Read(void)
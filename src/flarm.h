@@ -7,6 +7,7 @@
 #include "bitcount.h"
 #include "format.h"
 #include "crc1021.h"
+#include "crc-correct.h"
 
 class Flarm_Packet
 { public:
@@ -51,47 +52,14 @@ class Flarm_Packet
     uint16_t CRCw2 = Byte[Bytes+1] | (uint16_t)(Byte[Bytes])<<8;
     return CRCw ^ CRCw2; }
 
-  // correct the manchester-decoded packet with dead/weak bits marked
-  static int Correct(uint8_t *PktData, uint8_t *PktErr, const int MaxBadBits=6)
-  { uint16_t CRC = checkCRC(PktData, Bytes); if(CRC==0) return 0;
-    uint8_t ErrBit=FindCRCsyndrome(CRC);
-    if(ErrBit!=0xFF) { FlipBit(PktData, ErrBit); return 1; }
-
-    uint8_t BadBitIdx[MaxBadBits];                                    // bad bit index
-    uint8_t BadBitMask[MaxBadBits];                                   // bad bit mask
-    uint16_t Syndrome[MaxBadBits];                                    // bad bit mask
-    uint8_t BadBits=0;                                                // count the bad bits
-    for(uint8_t ByteIdx=0; ByteIdx<Bytes+2; ByteIdx++)                // loop over bytes
-    { uint8_t Byte=PktErr[ByteIdx];
-      uint8_t Mask=0x80;
-      for(uint8_t BitIdx=0; BitIdx<8; BitIdx++)                       // loop over bits
-      { if(Byte&Mask)
-        { if(BadBits<MaxBadBits)
-          { BadBitIdx[BadBits]=ByteIdx;                               // store the bad bit index
-            BadBitMask[BadBits]=Mask;
-            Syndrome[BadBits]=CRCsyndrome(ByteIdx*8+BitIdx); }
-          BadBits++;
-        }
-        Mask>>=1;
-      }
-      if(BadBits>MaxBadBits) break;
-    }
-    if(BadBits>MaxBadBits) return -1;                                 // return failure when too many bad bits
-
-    uint8_t Loops = 1<<BadBits; uint8_t PrevGrayIdx=0;
-    for(uint8_t Idx=1; Idx<Loops; Idx++)                              // loop through all combination of bad bit flips
-    { uint8_t GrayIdx= Idx ^ (Idx>>1);                                // use Gray code to change flip just one bit at a time
-      uint8_t BitExp = GrayIdx^PrevGrayIdx;
-      uint8_t Bit=0; while(BitExp>>=1) Bit++;
-      PktData[BadBitIdx[Bit]]^=BadBitMask[Bit];
-      CRC^=Syndrome[Bit]; if(CRC==0) return Count1s(GrayIdx);
-      uint8_t ErrBit=FindCRCsyndrome(CRC);
-      if(ErrBit!=0xFF)
-      { FlipBit(PktData, ErrBit);
-        return Count1s(GrayIdx)+1; }
-      PrevGrayIdx=GrayIdx; }
-
-    return -1; }
+  // correct the manchester-decoded packet with dead/weak bits marked: a single unmarked bit error by the syndrome alone,
+  // else flip combinations of up to MaxBadBits marked bits, each combination plus one unmarked bit error
+  static int Correct(uint8_t *PktData, const uint8_t *PktErr, const int MaxBadBits=6)
+  { return Corrector::Correct(PktData, checkCRC(PktData, Bytes), PktErr, MaxBadBits); }
+
+  // the same with the soft decisions of FSK_RxPacket::getSoft(): combinations of the MaxBadBits least reliable bits
+  static int Correct(uint8_t *PktData, const int8_t *PktSoft, const int MaxBadBits=6)
+  { return Corrector::Correct(PktData, checkCRC(PktData, Bytes), PktSoft, MaxBadBits); }
 
   static void FlipBit(uint8_t *Byte, int BitIdx)
   { int ByteIdx=BitIdx>>3;
@@ -101,7 +69,7 @@ class Flarm_Packet
 
   static uint16_t CRCsyndrome(uint8_t Bit)
   { const uint16_t PacketBits = (Bytes+2)*8;
-    const uint16_t Syndrome[PacketBits] = {
+    static const uint16_t Syndrome[PacketBits] = {
  0x22DA, 0x116D, 0x80A6, 0x4053, 0xA839, 0xDC0C, 0x6E06, 0x3703,
  0x9391, 0xC1D8, 0x60EC, 0x3076, 0x183B, 0x840D, 0xCA16, 0x650B,
  0xBA95, 0xD55A, 0x6AAD, 0xBD46, 0x5EA3, 0xA741, 0xDBB0, 0x6DD8,
@@ -133,7 +101,7 @@ class Flarm_Packet
 
   static uint8_t FindCRCsyndrome(uint16_t Syndr)              // quick search for a single-bit CRC syndrome
   { const uint16_t PacketBits = (Bytes+2)*8;
-    const uint32_t Syndrome[PacketBits] = {
+    static const uint32_t Syndrome[PacketBits] = {
  0x0001CF, 0x0002CE, 0x0004CD, 0x0008CC, 0x0010CB, 0x0020CA, 0x0040C9, 0x0080C8,
  0x0100C7, 0x0200C6, 0x022D9C, 0x0373B3, 0x037567, 0x0400C5, 0x045A9B, 0x05AD5D,
  0x06A195, 0x06E6B2, 0x06EA66, 0x0800C4, 0x087140, 0x08B49A, 0x0B5A5C, 0x0D4294,
@@ -173,6 +141,8 @@ class Flarm_Packet
                        else Bot=Mid; }
       return 0xFF; }
 
+  typedef CRC_Corrector<uint16_t, (Bytes+2)*8, CRCsyndrome, FindCRCsyndrome> Corrector; // erasure search of Correct()
+
 } ;
 
 #endif // __FLARM_H__
@@ -9,7 +9,7 @@
 // =================================================================================
 
 uint16_t GDL90_CRC16(uint8_t Byte, uint16_t CRC);                        // pass a single byte through the CRC
-uint16_t GDL90_CRC16(const uint8_t *Data, uint8_t Len, uint16_t CRC=0);  // pass a packet of bytes through the CRC
+uint16_t GDL90_CRC16(const uint8_t *Data, int Len, uint16_t CRC=0);      // pass a packet of bytes through the CRC
 
 int GDL90_Send(void (*Output)(char), uint8_t ID, const uint8_t *Data, int Len);  // transmit GDL90 packet with proper framing and CRC
 int GDL90_Send(uint8_t *Out, uint8_t ID, const uint8_t *Data, int Len);
@@ -361,9 +361,7 @@ class GDL90_RxMsg // receiver for the MAV messages
        else return 0; }
      if(RxByte==SYNC)                                        // if not the very first byte and SYNC then the packet is possibly complete
      { if(Len<3 || Byte[Len]!=0) { Clear(); return 0; }
-       uint16_t CRC=0;
-       for(int Idx=0; Idx<(Len-2); Idx++)
-       { CRC=GDL90_CRC16(Byte[Idx], CRC); }
+       uint16_t CRC=GDL90_CRC16(Byte, Len-2);
        if( (CRC&0xFF)!=Byte[Len-2] || (CRC>>8)!=Byte[Len-1] ) { Clear(); return 0; }
        return 2; }                                           // packet complete and good CRC
      if(Byte[Len]==ESC) { RxByte^=0x20; }                    // if after an ESC then xor with 0x20
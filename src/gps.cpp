@@ -18,6 +18,7 @@
 #include "ogn.h"
 
 #include "lowpass2.h"
+#include "proc-wake.h"
 
 // #define DEBUG_PRINT
 
@@ -571,6 +572,7 @@ static void GPS_BurstComplete(void)                                   // when GP
 #endif
   GPS_PosIdx=NextPosIdx;                                                      // advance the index
   xEventGroupSetBits(GPS_Event, GPSevt_NewPos);
+  PROC_Notify(PROCevt_NewPos);                                                // vTaskPROC may start the time slot
 }
 
 static void GPS_BurstEnd(void)                                             // when GPS stops sending the data on the serial port
@@ -748,7 +748,7 @@ static void Table_Relay(httpd_req_t *Req)
   httpd_resp_sendstr_chunk(Req, "<table class=\"table table-striped table-bordered\">\n");
   httpd_resp_sendstr_chunk(Req, "<thead><tr><th>Relay</th><th>Rank</th><th>[sec]</th></tr></thead>\n<tbody>\n");
 
-  for( uint8_t Idx=0; Idx<RelayQueueSize; Idx++)
+  for( uint16_t Idx=0; Idx<RelayQueueSize; Idx++)
   { OGN_RxPacket<OGN_Packet> *Packet = OGN_RelayQueue.Packet+Idx; if(Packet->Rank==0) continue;
     Len =Format_String(Line, "<tr><td>");
     Line[Len++]='0'+Packet->Packet.Header.AddrType;
@@ -766,7 +766,7 @@ static void Table_Relay(httpd_req_t *Req)
 // -------------------------------------------------------------------------------------------------------------
 
 static void Table_RF(httpd_req_t *Req)
-{ char Line[128]; int Len;
+{ char Line[256]; int Len;
 
   httpd_resp_sendstr_chunk(Req, "<h2>RF chip</h2>");
   httpd_resp_sendstr_chunk(Req, "<table class=\"table table-striped table-bordered\">\n");
@@ -818,7 +818,24 @@ static void Table_RF(httpd_req_t *Req)
   Len+=Format_String(Line+Len, "MHz</td></tr>\n");
   httpd_resp_send_chunk(Req, Line, Len);
 */
-  httpd_resp_sendstr_chunk(Req, "</table>\n"); }
+  httpd_resp_sendstr_chunk(Req, "</table>\n");
+
+  httpd_resp_sendstr_chunk(Req, "<h2>RF statistics</h2>");              // last minute per channel and system, full data in /rf.json
+  httpd_resp_sendstr_chunk(Req, "<table class=\"table table-striped table-bordered\">\n");
+  httpd_resp_sendstr_chunk(Req, "<thead><tr><th>Chan</th><th>Sys</th><th>Rx</th><th>Dec</th><th>Corr</th><th>Fail</th><th>LBT</th></tr></thead>\n<tbody>\n");
+  for(uint8_t Idx=0; Idx<Radio_Stats.Cells; Idx++)
+  { RF_StatCell Stat; if(!Radio_Stats.getCell(Stat, Idx)) continue;
+    Len =Format_String(Line, "<tr><td>");
+    Len+=Format_UnsDec(Line+Len, (uint32_t)Stat.Chan);
+    Len+=Format_String(Line+Len, "</td><td>");
+    const char *Name=FSK_RxPacket::SysName(Stat.SysID);
+    Len+=Format_String(Line+Len, Name?Name:"---");
+    for(uint8_t Cnt=0; Cnt<RF_StatCell::Counts; Cnt++)
+    { Len+=Format_String(Line+Len, "</td><td align=\"right\">");
+      Len+=Format_UnsDec(Line+Len, (uint32_t)Stat.getSum(Cnt)); }
+    Len+=Format_String(Line+Len, "</td></tr>\n");
+    httpd_resp_send_chunk(Req, Line, Len); }
+  httpd_resp_sendstr_chunk(Req, "</tbody>\n</table>\n<a href=\"/rf.json\">RF statistics as JSON</a>\n"); }
 
 static uint8_t BattCapacity(uint16_t mVolt)
 { if(mVolt>=4100) return 100;
@@ -1343,6 +1360,23 @@ static esp_err_t logo_get_handler(httpd_req_t *Req)
   httpd_resp_send(Req, (const char *)OGN_logo_jpg, OGN_logo_size);
   return ESP_OK; }
 
+static esp_err_t rf_json_get_handler(httpd_req_t *Req)         // RF statistics as JSON, see rf-stats.h
+{ char Line[RF_Stats::MaxJSON]; int Len;
+  httpd_resp_set_type(Req, "application/json");
+  Len=Radio_Stats.WriteJSONhead(Line, millis()/1000);
+  httpd_resp_send_chunk(Req, Line, Len);
+  bool First=1;
+  for(uint8_t Idx=0; Idx<Radio_Stats.Cells; Idx++)
+  { RF_StatCell Stat; if(!Radio_Stats.getCell(Stat, Idx)) continue;
+    Len=0; if(!First) Line[Len++]=',';
+    Len+=Stat.WriteJSON(Line+Len);
+    httpd_resp_send_chunk(Req, Line, Len);
+    First=0; }
+  Len=Radio_Stats.WriteJSONtail(Line);
+  httpd_resp_send_chunk(Req, Line, Len);
+  httpd_resp_send_chunk(Req, 0, 0);
+  return ESP_OK; }
+
 static const httpd_uri_t HTTPtop =
 { .uri       = "/",
   .method    = HTTP_GET,
@@ -1367,6 +1401,12 @@ static const httpd_uri_t HTTPparmPost =
   .handler   = parm_post_handler,
   .user_ctx  = 0 };
 
+static const httpd_uri_t HTTPrf =
+{ .uri       = "/rf.json",
+  .method    = HTTP_GET,
+  .handler   = rf_json_get_handler,
+  .user_ctx  = 0 };
+
 static const httpd_uri_t HTTPlog =
 { .uri       = "/log.html",
   .method    = HTTP_GET,
@@ -1385,6 +1425,7 @@ esp_err_t HTTP_Start(int MaxSockets, int Port)
   httpd_register_uri_handler(HTTPserver, &HTTPparm); // parameters URL
   httpd_register_uri_handler(HTTPserver, &HTTPparmPost); // parameters URL
   httpd_register_uri_handler(HTTPserver, &HTTPlog);  // log files URL
+  httpd_register_uri_handler(HTTPserver, &HTTPrf);   // RF statistics
   httpd_register_uri_handler(HTTPserver, &HTTPlogo); // OGN logo
   return Err; }
 
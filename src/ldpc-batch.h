@@ -0,0 +1,173 @@
+#ifndef __LDPC_BATCH_H__
+#define __LDPC_BATCH_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ldpc.h"
+
+// Batch LDPC decoder for the OGN n208k160 code, meant for the host (capture replay, ground stations):
+// Lanes codewords are decoded in parallel, each SIMD lane carries the same code bit of a different packet.
+// The arithmetic is that of LDPC_Decoder (int16_t, min-sum, ExtBit>>1) lane by lane, thus the results are bit-exact with it.
+// GCC vector extensions map the lanes onto SSE2 (8 lanes per register) or AVX2 (16 lanes) depending on the -m/-march flags,
+// wider batches take several registers. With LDPC_BATCH_SCALAR or a compiler without the extensions the lanes are plain int16_t.
+
+#if defined(__GNUC__) && !defined(LDPC_BATCH_SCALAR)
+#define LDPC_BATCH_VECTOR
+#endif
+
+#ifdef LDPC_BATCH_VECTOR
+#ifdef __AVX2__
+typedef int16_t LDPC_BatchReg __attribute__((vector_size(32)));  // one register: 16 lanes with AVX2
+#else
+typedef int16_t LDPC_BatchReg __attribute__((vector_size(16)));  // 8 lanes with SSE2 (or NEON)
+#endif
+typedef int16_t LDPC_BatchReg8 __attribute__((vector_size(16)));
+
+template <int Lanes> struct LDPC_BatchPart { typedef LDPC_BatchReg  Type; } ; // wider batches: an array of registers
+template <>          struct LDPC_BatchPart<8> { typedef LDPC_BatchReg8 Type; } ;
+
+inline LDPC_BatchReg  LDPC_BatchLess(LDPC_BatchReg  A, LDPC_BatchReg  B) { return A<B; }    // vector comparisons give 0/-1 already
+inline LDPC_BatchReg  LDPC_BatchSame(LDPC_BatchReg  A, LDPC_BatchReg  B) { return A==B; }
+#ifdef __AVX2__
+inline LDPC_BatchReg8 LDPC_BatchLess(LDPC_BatchReg8 A, LDPC_BatchReg8 B) { return A<B; }
+inline LDPC_BatchReg8 LDPC_BatchSame(LDPC_BatchReg8 A, LDPC_BatchReg8 B) { return A==B; }
+#endif
+#else
+template <int Lanes> struct LDPC_BatchPart { typedef int16_t Type; } ;        // one lane per part
+#endif
+inline int16_t LDPC_BatchLess(int16_t A, int16_t B) { return A<B  ? -1:0; }
+inline int16_t LDPC_BatchSame(int16_t A, int16_t B) { return A==B ? -1:0; }
+
+template <int Lanes>
+ class LDPC_BatchLanes                                 // int16_t per lane, kept as registers (parts) of several lanes each
+{ public:
+   typedef typename LDPC_BatchPart<Lanes>::Type Part;
+   static const int Parts = 2*Lanes/sizeof(Part);
+   Part P[Parts];
+
+  public:
+   LDPC_BatchLanes() { }
+   LDPC_BatchLanes(int16_t Val) { for(int Lane=0; Lane<Lanes; Lane++) set(Lane, Val); }
+
+   int16_t get(int Lane) const          { return ((const int16_t *)P)[Lane]; }
+   void    set(int Lane, int16_t Val)   { ((int16_t *)P)[Lane]=Val; }
+
+   static Part Splat(int16_t Val) { LDPC_BatchLanes Vec(Val); return Vec.P[0]; }
+   static Part Select(Part Mask, Part A, Part B) { return (Mask&A) | ((~Mask)&B); } // A where Mask is set, B elsewhere
+   static Part Abs(Part A) { return Select(LDPC_BatchLess(A, Splat(0)), -A, A); }   // wraps -32768 like int16_t does
+} ;
+
+template <int Lanes>
+ class LDPC_BatchDecoder
+{ public:
+   const static uint8_t UserBits   = LDPC_Decoder::UserBits;
+   const static uint8_t ParityBits = LDPC_Decoder::ParityBits;
+   const static uint8_t CodeBits   = LDPC_Decoder::CodeBits;
+   const static uint8_t CodeBytes  = LDPC_Decoder::CodeBytes;
+   const static uint8_t CodeWords  = LDPC_Decoder::CodeWords;
+
+   typedef LDPC_BatchLanes<Lanes> Vec;
+   typedef typename Vec::Part Part;
+
+   Vec InpBit[CodeBits];     // a-priori bits
+   Vec ExtBit[CodeBits];     // extrinsic inf.
+   Vec OutBit[CodeBits];     // a-posteriori bits
+   Vec Count;                // per lane: checks which failed (or had a zero-amplitude bit) in the last iteration, as ProcessChecks() returns it
+
+   const static int16_t Pending = ParityBits+1;        // Count of a lane not processed yet
+
+  public:
+   void Clear(void)                                    // all lanes empty: they decode (trivially) to zero
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++) { InpBit[Bit]=Vec(-128); OutBit[Bit]=InpBit[Bit]; ExtBit[Bit]=Vec(0); }
+     Count=Vec(0); }
+
+   void Input(int Lane, const uint8_t *Data, const uint8_t *Err)  // bytes and the Manchester error pattern, like LDPC_Decoder::Input()
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
+       int16_t Inp;
+       if(ErrByte&Mask) Inp=0;
+                   else Inp=(DataByte&Mask) ? +128:-128;
+       InpBit[Bit].set(Lane, Inp); OutBit[Bit].set(Lane, Inp); ExtBit[Bit].set(Lane, 0);
+       Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
+     }
+     Count.set(Lane, Pending); }
+
+   void Input(int Lane, const uint32_t Data[CodeWords])
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=Data[Idx];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { int16_t Inp = (Word&Mask) ? +128:-128;
+       InpBit[Bit].set(Lane, Inp); OutBit[Bit].set(Lane, Inp); ExtBit[Bit].set(Lane, 0);
+       Mask<<=1; if(Mask==0) { Word=Data[++Idx]; Mask=1; }
+     }
+     Count.set(Lane, Pending); }
+
+   void Output(int Lane, uint8_t Data[CodeBytes]) const
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t Byte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit].get(Lane)>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Byte;
+   }
+
+   void Output(int Lane, uint32_t Data[CodeWords]) const
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit].get(Lane)>0) Word|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Word; Word=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Word;
+   }
+
+   uint8_t getCount(int Lane) const { return Count.get(Lane); }
+
+   int ProcessChecks(void)                             // one iteration on all lanes, returns the number of lanes not yet decoded
+   { for(int Idx=0; Idx<Vec::Parts; Idx++)             // register by register: the working set of one check stays in the CPU registers
+     { Part Zero=Vec::Splat(0);
+       bool Active=0;                                    // lanes which passed all checks would not change anymore: skip the register when all did
+       for(int Lane=0; Lane<(int)(sizeof(Part)/2); Lane++) if(((const int16_t *)(Count.P+Idx))[Lane]) { Active=1; break; }
+       if(!Active) continue;
+       for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+         ExtBit[Bit].P[Idx]=Zero;
+       Part Fails=Zero;
+       for(uint8_t Row=0; Row<ParityBits; Row++)
+         Fails -= ProcessCheck(Row, Idx);                // masks are -1: subtracting counts them
+       Part Done = LDPC_BatchSame(Fails, Zero);          // like LDPC_Decoder: a lane with no failed checks keeps its OutBit
+       for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       { Part Out = InpBit[Bit].P[Idx] + (ExtBit[Bit].P[Idx]>>1);
+         OutBit[Bit].P[Idx] = Vec::Select(Done, OutBit[Bit].P[Idx], Out); }
+       Count.P[Idx]=Fails; }
+     int Left=0;
+     for(int Lane=0; Lane<Lanes; Lane++) if(Count.get(Lane)) Left++;
+     return Left; }
+
+   Part ProcessCheck(uint8_t Row, int Idx)             // returns the mask of lanes where LDPC_Decoder::ProcessCheck() would return <=0
+   { Part Zero=Vec::Splat(0), Parity=Zero;
+     Part MinAmpl=Vec::Splat(32767), MinAmpl2=MinAmpl, MinBit=Zero;
+     const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { Part Out  = OutBit[CheckIndex[Bit]].P[Idx];
+       Parity ^= LDPC_BatchLess(Zero, Out);            // bits with a positive amplitude count as ones
+       Part Ampl = Vec::Abs(Out);
+       Part New  = LDPC_BatchLess(Ampl, MinAmpl);      // strictly lower: the first of equal minima stays MinBit
+       MinAmpl2  = Vec::Select(New, MinAmpl, Vec::Select(LDPC_BatchLess(Ampl, MinAmpl2), Ampl, MinAmpl2));
+       MinAmpl   = Vec::Select(New, Ampl, MinAmpl);
+       MinBit    = Vec::Select(New, Vec::Splat(Bit), MinBit); }
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { Part &Ext = ExtBit[CheckIndex[Bit]].P[Idx];
+       Part Ampl = Vec::Select(LDPC_BatchSame(MinBit, Vec::Splat(Bit)), MinAmpl2, MinAmpl);
+       Ampl = Vec::Select(Parity, -Ampl, Ampl);        // failed check: push all bits the other way
+       Ext += Vec::Select(LDPC_BatchLess(Zero, OutBit[CheckIndex[Bit]].P[Idx]), Ampl, -Ampl); }
+     return Parity | LDPC_BatchLess(MinAmpl, Vec::Splat(1)); } // failed or the weakest bit has zero amplitude
+
+   int Decode(int Iter=32)                             // iterate till all lanes decode or Iter runs out, returns the lanes still failing
+   { int Left=Lanes;
+     for( ; Iter; Iter--)
+     { Left=ProcessChecks();
+       if(Left==0) break; }
+     return Left; }
+
+} ;
+
+#endif // __LDPC_BATCH_H__
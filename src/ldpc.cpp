@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ldpc.h"
 
@@ -73,7 +74,7 @@ PROGMEM
 } ;
 
 
-const uint8_t LDPC_ParityCheckIndex_n208k160[48][24]
+constexpr uint8_t LDPC_ParityCheckIndex_n208k160[48][24]      // constexpr: the column table is generated from it
 #ifdef __AVR__
 PROGMEM
 #endif
@@ -140,6 +141,51 @@ PROGMEM
     4, 3, 3, 4, 3, 6, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 5, 3, 6, 3, 3, 5, 4, 4, 3, 3, 4, 4, 5, 3, 4, 4,
     5, 4, 5, 5, 5, 4, 3, 5, 3, 3, 6, 5, 4, 3, 4, 5 } ;
 
+#ifndef __AVR__
+// the same matrix by columns: for every codeword bit the checks it takes part in, generated by the compiler from LDPC_ParityCheckIndex_n208k160
+// entry: number of, then Row<<5 | position of the bit within the LDPC_ParityCheckIndex_n208k160 row, zero padded
+
+static constexpr uint8_t LDPC_RowPos(uint8_t Bit, uint8_t Row, uint8_t Pos=1)        // 1 + position of the bit in the row, 0 when not there
+{ return Pos>LDPC_ParityCheckIndex_n208k160[Row][0] ? 0 :
+         LDPC_ParityCheckIndex_n208k160[Row][Pos]==Bit ? Pos : LDPC_RowPos(Bit, Row, Pos+1); }
+
+static constexpr uint8_t LDPC_ColWeight(uint8_t Bit, uint8_t Row=0)                 // number of checks the bit takes part in
+{ return Row>=48 ? 0 : (LDPC_RowPos(Bit, Row)!=0) + LDPC_ColWeight(Bit, Row+1); }
+
+static constexpr uint16_t LDPC_ColCheck(uint8_t Bit, uint8_t Check, uint8_t Row=0)  // the Check-th row with the bit, as Row<<5 | position
+{ return Row>=48 ? 0 :
+         LDPC_RowPos(Bit, Row)==0 ? LDPC_ColCheck(Bit, Check, Row+1) :
+         Check ? LDPC_ColCheck(Bit, Check-1, Row+1) : (uint16_t)(Row<<5 | (LDPC_RowPos(Bit, Row)-1)); }
+
+static constexpr uint16_t LDPC_ColEntry(uint8_t Bit, uint8_t Col)
+{ return Col ? LDPC_ColCheck(Bit, Col-1) : LDPC_ColWeight(Bit); }
+
+template <int... Idx> struct LDPC_Index { } ;                       // compile-time list 0..N-1 as in crc.h
+
+template <class A, class B> struct LDPC_Concat;
+template <int... IdxA, int... IdxB>
+ struct LDPC_Concat< LDPC_Index<IdxA...>, LDPC_Index<IdxB...> >
+{ typedef LDPC_Index<IdxA..., (int)sizeof...(IdxA)+IdxB...> Type; } ;
+
+template <int N> struct LDPC_MakeIndex
+{ typedef typename LDPC_Concat<typename LDPC_MakeIndex<N/2>::Type, typename LDPC_MakeIndex<N-N/2>::Type>::Type Type; } ;
+template <> struct LDPC_MakeIndex<0> { typedef LDPC_Index<>  Type; } ;
+template <> struct LDPC_MakeIndex<1> { typedef LDPC_Index<0> Type; } ;
+
+template <class Index> struct LDPC_ColTable;
+template <int... Bit>
+ struct LDPC_ColTable< LDPC_Index<Bit...> >
+{ static constexpr uint16_t Table[sizeof...(Bit)][7] =
+  { { LDPC_ColEntry(Bit, 0), LDPC_ColEntry(Bit, 1), LDPC_ColEntry(Bit, 2), LDPC_ColEntry(Bit, 3),
+      LDPC_ColEntry(Bit, 4), LDPC_ColEntry(Bit, 5), LDPC_ColEntry(Bit, 6) }... } ; } ;
+template <int... Bit>
+ constexpr uint16_t LDPC_ColTable< LDPC_Index<Bit...> >::Table[sizeof...(Bit)][7];
+
+static_assert(LDPC_ColWeight(0)==6 && LDPC_ColEntry(207, 5)==0x2CB, "column table against the former hand-made table");
+
+const uint16_t (&LDPC_BitCheckIndex_n208k160)[208][7] = LDPC_ColTable<LDPC_MakeIndex<208>::Type>::Table;
+#endif // __AVR__
+
 // every row represents the generator for a parity bit
 static const uint32_t LDPC_ParityGen_n208k160[48][5]
 #ifdef __AVR__
@@ -661,40 +707,35 @@ int8_t LDPC_Check(const uint32_t *Packet)
 
 #else // if not 8-bit AVR
 
-void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[48][5])
-{ uint8_t ParIdx=0; uint8_t ParByte=0; uint8_t Mask=1;
-  for(uint8_t Row=0; Row<48; Row++)
-  { uint8_t Count=0;
-    const uint8_t *Gen = (uint8_t *)(ParityGen[Row]);
-    for(uint8_t Idx=0; Idx<20; Idx++)
-    { Count+=Count1s((uint8_t)(Data[Idx]&Gen[Idx])); }
-    if(Count&1) ParByte|=Mask; Mask<<=1;
-    if(Mask==0) { Parity[ParIdx++]=ParByte; Mask=1; ParByte=0; }
-  }
-  // if(Mask!=1) Parity[ParIdx]=ParByte;
-}
-
-void LDPC_Encode(const uint8_t *Data, uint8_t *Parity)
-{ LDPC_Encode(Data, Parity, LDPC_ParityGen_n208k160); }
-
-void LDPC_Encode(uint8_t *Data)
-{ LDPC_Encode(Data, Data+20); }
+// the 32-bit CPUs run the parity checks word-wide: AND with the generator/check row, XOR-accumulate, one parity per row
+// the byte interface goes through the word one: bytes are the little-endian words, like the byte tables were read so far
 
 // encode Parity from Data: Data is 5x 32-bit words = 160 bits, Parity is 1.5x 32-bit word = 48 bits
 static void LDPC_Encode(const uint32_t *Data, uint32_t *Parity, uint8_t DataWords,  uint8_t Checks, const uint32_t *ParityGen)
-{ // printf("LDPC_Encode: %08X %08X %08X %08X %08X", Data[0], Data[1], Data[2], Data[3], Data[4] );
-  uint8_t ParIdx=0; Parity[ParIdx]=0; uint32_t Mask=1;
+{ uint8_t ParIdx=0; uint32_t ParWord=0; uint32_t Mask=1;
   const uint32_t *Gen=ParityGen;
   for(uint8_t Row=0; Row<Checks; Row++)
-  { uint8_t Count=0;
+  { uint32_t Acc=0;
     for(uint8_t Idx=0; Idx<DataWords; Idx++)
-    { Count+=Count1s(Data[Idx]&Gen[Idx]); }
-    if(Count&1) Parity[ParIdx]|=Mask; Mask<<=1;
-    if(Mask==0) { ParIdx++; Parity[ParIdx]=0; Mask=1; }
+    { Acc^=Data[Idx]&Gen[Idx]; }
+    if(Parity1s(Acc)) ParWord|=Mask;
+    Mask<<=1; if(Mask==0) { Parity[ParIdx++]=ParWord; ParWord=0; Mask=1; }
     Gen+=DataWords; }
-  // printf(" => %08X %08X\n", Parity[0], Parity[1] );
+  if(Mask!=1) Parity[ParIdx]=ParWord;                    // the last, partial word: upper bits cleared
 }
 
+void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[48][5])
+{ uint32_t DataWord[5]; uint32_t ParWord[2];
+  memcpy(DataWord, Data, 20);
+  LDPC_Encode(DataWord, ParWord, 5, 48, (const uint32_t *)ParityGen);
+  memcpy(Parity, ParWord, 6); }
+
+void LDPC_Encode(const uint8_t *Data, uint8_t *Parity)
+{ LDPC_Encode(Data, Parity, LDPC_ParityGen_n208k160); }
+
+void LDPC_Encode(uint8_t *Data)
+{ LDPC_Encode(Data, Data+20); }
+
 void LDPC_Encode(const uint32_t *Data, uint32_t *Parity) { LDPC_Encode(Data, Parity, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); }
 void LDPC_Encode(      uint32_t *Data)                   { LDPC_Encode(Data, Data+5, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); }
 
@@ -707,41 +748,37 @@ void LDPC_Encode_n354k160(      uint32_t *Data)                   { LDPC_Encode(
 uint8_t LDPC_Check(const uint32_t *Data, const uint32_t *Parity) // Data and Parity are 32-bit words
 { uint8_t Errors=0;
   for(uint8_t Row=0; Row<48; Row++)
-  { uint8_t Count=0;
-    const uint32_t *Check=LDPC_ParityCheck_n208k160[Row];
+  { const uint32_t *Check=LDPC_ParityCheck_n208k160[Row];
+    uint32_t Acc=0;
     uint8_t Idx;
     for(Idx=0; Idx<5; Idx++)
-    { Count+=Count1s(Data[Idx]&Check[Idx]); }
-    Count+=Count1s(Parity[0]&Check[Idx++]);
-    Count+=Count1s((Parity[1]&Check[Idx++])&0xFFFF);
-    if(Count&1) Errors++; }
+    { Acc^=Data[Idx]&Check[Idx]; }
+    Acc^=Parity[0]&Check[Idx++];
+    Acc^=Parity[1]&Check[Idx++]&0xFFFF;
+    Errors+=Parity1s(Acc); }
   return Errors; }
 
 uint8_t LDPC_Check(const uint32_t *Data) { return LDPC_Check(Data, Data+5); }
 
 uint8_t LDPC_Check(const uint8_t *Data) // 20 data bytes followed by 6 parity bytes
-{ uint8_t Errors=0;
-  for(uint8_t Row=0; Row<48; Row++)
-  { uint8_t Count=0;
-    const uint8_t *Check = (uint8_t *)LDPC_ParityCheck_n208k160[Row];
-    for(uint8_t Idx=0; Idx<26; Idx++)
-    { uint8_t And = Data[Idx]&Check[Idx]; Count+=Count1s(And); }
-    if(Count&1) Errors++; }
-  return Errors; }
+{ uint32_t Word[7];
+  memcpy(Word, Data, 26);                                // the upper half of the last word is masked out by the check
+  return LDPC_Check(Word, Word+5); }
+
 #ifdef WITH_PPM
 uint8_t LDPC_Check_n354k160(const uint32_t *Data, const uint32_t *Parity) // Data and Parity are 32-bit words
 { uint8_t Errors=0;
   for(uint8_t Row=0; Row<194; Row++)
-  { uint8_t Count=0;
-    const uint32_t *Check=LDPC_ParityCheck_n354k160[Row];
+  { const uint32_t *Check=LDPC_ParityCheck_n354k160[Row];
+    uint32_t Acc=0;
     uint8_t Idx;
     for(Idx=0; Idx<5; Idx++)
-    { Count+=Count1s(Data[Idx]&Check[Idx]); }
+    { Acc^=Data[Idx]&Check[Idx]; }
     uint8_t ParIdx;
     for(ParIdx=0; ParIdx<6; ParIdx++, Idx++)
-    { Count+=Count1s(Parity[ParIdx]&Check[Idx]); }
-    Count+=Count1s((Parity[ParIdx]&Check[Idx])&0x0003);
-    if(Count&1) Errors++; }
+    { Acc^=Parity[ParIdx]&Check[Idx]; }
+    Acc^=Parity[ParIdx]&Check[Idx]&0x0003;
+    Errors+=Parity1s(Acc); }
   return Errors; }
 
 uint8_t LDPC_Check_n354k160(const uint32_t *Data) { return LDPC_Check_n354k160(Data, Data+5); }
@@ -76,7 +76,8 @@ uint8_t LDPC_Check_n354k160(const uint32_t *Data);
 
 #ifndef __AVR__
 
-extern const uint8_t LDPC_ParityCheckIndex_n208k160[48][24];
+extern const uint8_t  LDPC_ParityCheckIndex_n208k160[48][24];
+extern const uint16_t (&LDPC_BitCheckIndex_n208k160)[208][7];
 
 class LDPC_Decoder
 { public:
@@ -92,8 +93,16 @@ class LDPC_Decoder
   public:
 
    int16_t  InpBit[CodeBits]; // a-priori bits
-   int16_t  ExtBit[CodeBits]; // extrinsic inf.
+   union
+   { int16_t  ExtBit[CodeBits]; // extrinsic inf. (flooding schedule)
+     struct                   // check-to-bit messages (layered schedule) in the min-sum compressed form
+     { int16_t  Min [ParityBits]; // smallest amplitude of the check
+       int16_t  Min2[ParityBits]; // second smallest: for the bit which gave the smallest
+       uint32_t Sign[ParityBits]; // bits 0..23: (amplitude>0) per bit, 24..28: the bit which gave Min, 31: parity of bits 0..23
+     } Layer;                 // cleared together with ExtBit by Input()
+   } ;
    int16_t  OutBit[CodeBits]; // a-posteriori bits
+   uint8_t  Iter;             // layered: iterations run by the last ProcessLayers()
 
    void Input(const uint8_t *Data, const uint8_t *Err)
    { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
@@ -116,6 +125,12 @@ class LDPC_Decoder
      }
    }
 
+   void Input(const int8_t *Soft)                     // soft decisions in the order of reception like the float input: +/-127 is certain, 0 is erased
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = InpBit[Bit] = Soft[Bit^7];
+       ExtBit[Bit]=0; }
+   }
+
    void Input(const float *Data, float RefAmpl=1.0)
    { for(int Bit=0; Bit<CodeBits; Bit++)
      { int Inp = floor(128*Data[Bit^7]/RefAmpl+0.5);
@@ -177,6 +192,163 @@ class LDPC_Decoder
        Mask<<=1; }
      return CheckFails?-MinAmpl:MinAmpl; }
 
+   // layered schedule: a-posteriori bits are updated after every check thus the information propagates within one iteration
+   // and it converges in about half the iterations. Stops when all checks pass, when the failed checks do not go down
+   // for several iterations (the decoder oscillates around a wrong codeword or a trapping set), or after MaxIter.
+   int8_t ProcessLayers(uint8_t MaxIter=32)           // returns the number of failed checks like ProcessChecks()
+   { uint8_t Count=CountFails();
+     uint8_t Best=Count, Stall=0;
+     for(Iter=0; Count && Iter<MaxIter; )
+     { for(uint8_t Row=0; Row<ParityBits; Row++)
+         ProcessLayer(Row);
+       Iter++;
+       Count=CountFails();
+       if(Count<Best) { Best=Count; Stall=0; continue; }
+       if(++Stall>=MaxStall) break; }                 // no progress: more iterations would not help
+     return Count; }
+
+   static const uint8_t MaxStall = 6;                 // iterations without fewer failed checks before giving up
+
+   uint8_t CountFails(void) const                     // checks which fail or have a zero-amplitude (erased) bit
+   { uint8_t Count=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+       uint8_t CheckWeight = *CheckIndex++;
+       uint8_t Parity=0; bool Zero=0;
+       for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+       { int16_t Ampl=OutBit[CheckIndex[Bit]];
+         Parity ^= Ampl>0; Zero |= Ampl==0; }
+       Count += Parity|Zero; }
+     return Count; }
+
+   static int16_t Sat(int32_t Ampl) { return Ampl>32767 ? 32767 : Ampl<(-32767) ? -32767 : Ampl; }
+
+   void ProcessLayer(uint8_t Row)                     // one check: remove its old message from the bits, compute the new one, add it back
+   { const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     int16_t  Min=Layer.Min[Row], Min2=Layer.Min2[Row];
+     uint32_t Sign=Layer.Sign[Row];
+     uint8_t  MinBit=(Sign>>24)&0x1F; uint32_t Parity=Sign>>31;
+     int16_t  Ext[MaxCheckWeight];                    // bit amplitudes without the message of this check
+     int16_t  NewMin=32767, NewMin2=32767; uint8_t NewMinBit=0;
+     uint32_t Word=0;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int16_t Msg = Bit==MinBit ? Min2:Min;
+       if(((Sign>>Bit)&1)==Parity) Msg=(-Msg);        // the other bits suggest a zero
+       int16_t Ampl = Ext[Bit] = Sat((int32_t)OutBit[CheckIndex[Bit]]-Msg);
+       if(Ampl>0) Word|=(uint32_t)1<<Bit;
+       if(Ampl<0) Ampl=(-Ampl);
+       if(Ampl<NewMin) { NewMin2=NewMin; NewMin=Ampl; NewMinBit=Bit; }
+       else if(Ampl<NewMin2) { NewMin2=Ampl; }
+     }
+     Parity = Count1s(Word)&1;
+     NewMin  = (NewMin *3)>>2;                        // normalized min-sum: scale the messages by 3/4
+     NewMin2 = (NewMin2*3)>>2;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int16_t Msg = Bit==NewMinBit ? NewMin2:NewMin;
+       if(((Word>>Bit)&1)==Parity) Msg=(-Msg);
+       OutBit[CheckIndex[Bit]] = Sat((int32_t)Ext[Bit]+Msg); }
+     Layer.Min[Row]=NewMin; Layer.Min2[Row]=NewMin2;
+     Layer.Sign[Row] = Word | ((uint32_t)NewMinBit<<24) | (Parity<<31); }
+
+} ;
+
+// the min-sum of LDPC_Decoder in less RAM and fewer passes over it: the check-to-bit messages are saturated int8_t
+// in compressed form (two smallest amplitudes and the signs per check), the a-posteriori bits are summed directly
+// from them by walking the column adjacency LDPC_BitCheckIndex_n208k160 (generated by the compiler from the row table),
+// thus no extrinsic array to clear and rebuild. The gain is the state: 912 against 1252 bytes, not the speed:
+// the indirect message lookups make it slower than LDPC_Decoder, on the x86 host by 10..20% (ldpc_compact_test).
+class LDPC_CompactDecoder
+{ public:
+   const static uint8_t UserBits   = LDPC_Decoder::UserBits;
+   const static uint8_t ParityBits = LDPC_Decoder::ParityBits;
+   const static uint8_t CodeBits   = LDPC_Decoder::CodeBits;
+   const static uint8_t CodeBytes  = LDPC_Decoder::CodeBytes;
+   const static uint8_t CodeWords  = LDPC_Decoder::CodeWords;
+   const static int8_t  InpAmpl    = 32;              // a-priori amplitude of a certain bit: LDPC_Decoder's 128 scaled by 1/4
+
+  public:
+   int8_t   InpBit[CodeBits];   // a-priori bits
+   int16_t  OutBit[CodeBits];   // a-posteriori bits
+   int8_t   Msg [ParityBits];   // per check: message to its bits which are ones: half of the smallest amplitude (LDPC_Decoder adds Ext>>1)
+                                // saturated to 127, negative when the check fails; the bits which are zeros get the negative of it
+   int8_t   Msg2[ParityBits];   // the same with the second smallest amplitude: for the bit which gave the smallest
+   uint32_t Sign[ParityBits];   // bits 0..23: (amplitude>0) per bit, 24..28: the bit which gave the smallest amplitude
+
+   void Input(const uint8_t *Data, const uint8_t *Err)
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
+       int8_t Inp;
+       if(ErrByte&Mask) Inp=0;
+                   else Inp=(DataByte&Mask) ? +InpAmpl:-InpAmpl;
+       OutBit[Bit] = InpBit[Bit] = Inp;
+       Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
+     }
+   }
+
+   void Input(const uint32_t Data[CodeWords])
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=Data[Idx];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = InpBit[Bit] = (Word&Mask) ? +InpAmpl:-InpAmpl;
+       Mask<<=1; if(Mask==0) { Word=Data[++Idx]; Mask=1; }
+     }
+   }
+
+   void Output(uint32_t Data[CodeWords]) const
+   { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit]>0) Word|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Word; Word=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Word;
+   }
+
+   void Output(uint8_t Data[CodeBytes]) const
+   { uint8_t Mask=1; uint8_t Idx=0; uint8_t Byte=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit]>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Byte;
+   }
+
+   int8_t ProcessChecks(void)                          // one iteration, returns the number of failed checks like LDPC_Decoder
+   { uint8_t Count=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+       Count+=ProcessCheck(Row);
+     if(Count==0) return 0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)           // variable nodes: a-priori plus the messages of all checks of this bit
+     { const uint16_t *CheckIndex = LDPC_BitCheckIndex_n208k160[Bit];
+       uint8_t BitWeight = *CheckIndex++;
+       int16_t Sum=InpBit[Bit];
+       for(uint8_t Check=0; Check<BitWeight; Check++)
+       { uint8_t Row=CheckIndex[Check]>>5, Pos=CheckIndex[Check]&0x1F;
+         uint32_t Signs=Sign[Row];
+         int8_t Ampl = Pos==(Signs>>24) ? Msg2[Row]:Msg[Row];
+         Sum += ((Signs>>Pos)&1) ? Ampl:-Ampl; }
+       OutBit[Bit]=Sum; }                              // at most 6 checks x 127 + 32: no overflow
+     return Count; }
+
+   bool ProcessCheck(uint8_t Row)                      // compress the messages of one check, return 1 if it fails (or has an erased bit)
+   { int16_t MinAmpl=32767, MinAmpl2=32767; uint8_t MinBit=0;
+     uint32_t Word=0;
+     const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { int16_t Ampl=OutBit[CheckIndex[Bit]];
+       if(Ampl>0) Word|=(uint32_t)1<<Bit;
+       if(Ampl<0) Ampl=(-Ampl);
+       if(Ampl<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Ampl; MinBit=Bit; }
+       else if(Ampl<MinAmpl2) { MinAmpl2=Ampl; }
+     }
+     uint32_t Parity = Count1s(Word)&1;
+     bool Erased = MinAmpl==0;
+     MinAmpl>>=1;  if(MinAmpl >127) MinAmpl =127;
+     MinAmpl2>>=1; if(MinAmpl2>127) MinAmpl2=127;
+     if(Parity) { MinAmpl=(-MinAmpl); MinAmpl2=(-MinAmpl2); } // failed check: push all bits the other way
+     Msg[Row]=MinAmpl; Msg2[Row]=MinAmpl2;
+     Sign[Row] = Word | ((uint32_t)MinBit<<24);
+     return Parity || Erased; }
+
 } ;
 
 #ifndef ARDUINO
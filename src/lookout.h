@@ -31,6 +31,13 @@ class LookOut_Target           // describes a flying aircrafts
 
    uint8_t     SysMask;        // bit mask for RF systems received: 0=FLR, 1=OGN, 2=PilotAware, 3=FANET, 4=ADS-L, 5=ADS-B
 
+   static const uint8_t SysFLR  = 0x01;
+   static const uint8_t SysOGN  = 0x02;
+   static const uint8_t SysPAW  = 0x04;
+   static const uint8_t SysFNT  = 0x08;
+   static const uint8_t SysADSL = 0x10;
+   static const uint8_t SysADSB = 0x20;
+
    uint8_t AcftType;           // ADS-B, ADSL or FLARN/OGN aircraft-type
    char Call[11];
 
@@ -72,7 +79,7 @@ class LookOut_Target           // describes a flying aircrafts
   uint16_t  MissDist;        // [0.5m]   estimated closest approach distance
 
   public:
-   void Clear(void) { Pred=0; Flags=0; HorDist=0; MissDist=0; Call[0]=0; Rank=0xFFFF; }
+   void Clear(void) { Pred=0; SysMask=0; Flags=0; HorDist=0; MissDist=0; Call[0]=0; Rank=0xFFFF; }
 
    // uint16_t HorRelSpeed(void) const { }
 
@@ -259,6 +266,23 @@ template <const uint8_t MaxTgts=32>
      }
    }
 
+   void WritePFLA(void (*Output)(const char *Msg, uint8_t Len)) // $PFLAU and PFLAA, each sentence as a whole
+   { Output(Line, WritePFLAU(Line));
+     for(uint8_t Idx=0; Idx<MaxTargets; Idx++)
+     { if(!Target[Idx].Alloc) continue;
+       if( Target[Idx].DistMargin) continue;
+       Output(Line, Target[Idx].WritePFLAA(Line)); }
+   }
+
+   uint8_t WriteGDL90(GDL90_REPORT &Report, void (*Output)(const char *Msg, uint8_t Len)) // GDL90 traffic reports: one per target with a new position, each as a whole frame
+   { uint8_t Count=0;
+     for(uint8_t Idx=0; Idx<MaxTargets; Idx++)
+     { LookOut_Target *Tgt = Target+Idx;
+       if(!Tgt->Alloc || Tgt->Reported) continue;          // skip empty slots and those already reported
+       Write(Report, Tgt); Output(Line, Report.Send(Line, 20)); // transmit as traffic position report (not own-ship)
+       Tgt->Reported=1; Count++; }
+     return Count; }
+
    uint8_t WritePFLAU(char *NMEA)                          // produce the FLAM anti-collision status
    { const LookOut_Target *Tgt = 0;
      if(WarnLevel>0) Tgt = Target + WorstTgtIdx;
@@ -437,29 +461,48 @@ template <const uint8_t MaxTgts=32>
      if( (!Tgt->Alloc) || (Tgt->DistMargin>0) ) return 0;                              // return NULL if target is not a thread
      return Tgt; }                                                                     // return the pointer to the most dangerous target
 
-   const LookOut_Target *ProcessTarget(ADSL_Packet &Packet, uint32_t RxTime)           // process a position of another aircraft in ADS-L format
+   LookOut_Target *findTarget(uint32_t TgtID)                                          // the target of given ID or NULL when not on the list
+   { for(uint8_t Idx=0; Idx<MaxTargets; Idx++)
+     { LookOut_Target *Tgt = Target+Idx;
+       if(Tgt->Alloc && Tgt->ID==TgtID) return Tgt; }
+     return 0; }
+
+   const LookOut_Target *mergeReport(uint32_t TgtID, int16_t T, uint8_t SysMask)       // a report not newer than the position already on the list:
+   { LookOut_Target *Old = findTarget(TgtID); if(Old==0) return 0;                     // the same aircraft by another system or relayed,
+     if((Old->Pos.T-Old->Pred)<T) return 0;                                            // only note the system it came by
+     Old->SysMask|=SysMask; return Old; }
+
+   const LookOut_Target *ProcessTarget(ADSL_Packet &Packet, uint32_t RxTime, uint8_t SysMask=LookOut_Target::SysADSL) // process a position of another aircraft in ADS-L format
    { // printf("ProcessTarget(%d) ... entry\n", WeakestIdx);
+     int16_t msTime=0; uint32_t PosTime=Packet.getTime(msTime, RxTime); if(PosTime==0) PosTime=RxTime;
+     int16_t T=2*(int32_t)(PosTime-RefTime)+(msTime>=500);                             // [0.5sec] as Acft_RelPos::Read()
+     uint32_t TgtID = Packet.getAddress() | ((uint32_t)Packet.getAddrTypeOGN()<<24);
+     const LookOut_Target *Old = mergeReport(TgtID, T, SysMask); if(Old) return Old;   // not newer: no need to read and calculate
      LookOut_Target *New = Target+WeakestIdx;                                          // get a free or lowest rank slot
      New->Clear();                                                                     // put the new position there
      if(New->Pos.Read(Packet, RxTime, RefTime, RefLat, RefLon, RefAlt, LatCos, GeoidSepar, DistRange)<0) return 0; // calculate the position against the reference position
      if(!New->Pos.hasStdAlt)                                                           // if no baro altitude
      { if(Pos.hasStdAlt) { New->Pos.dStdAlt=Pos.dStdAlt; New->Pos.hasStdAlt=1; } }     // take it from own
-     New->Address  = Packet.getAddress();
-     New->AddrType = Packet.getAddrTypeOGN();
+     New->ID       = TgtID;
      New->AcftType = Packet.getAcftTypeOGN();
+     New->SysMask  = SysMask;
      return ProcessTarget(New); }
 
    template <class OGNx_Packet>
-    const LookOut_Target *ProcessTarget(OGNx_Packet &Packet, uint32_t RxTime, const char *Call=0)  // process a position of another aircraft in OGN format
+    const LookOut_Target *ProcessTarget(OGNx_Packet &Packet, uint32_t RxTime, const char *Call=0, uint8_t SysMask=LookOut_Target::SysOGN)  // process a position of another aircraft in OGN format
    { // printf("ProcessTarget(%d) ... entry\n", WeakestIdx);
+     uint32_t PosTime=Packet.getTime(RxTime); if(PosTime==0) PosTime=RxTime;
+     int16_t T=2*(int32_t)(PosTime-RefTime);                                           // [0.5sec] as Acft_RelPos::Read()
+     uint32_t TgtID = Packet.Header.Address | ((uint32_t)Packet.Header.AddrType<<24);
+     const LookOut_Target *Old = mergeReport(TgtID, T, SysMask); if(Old) return Old;   // not newer: no need to read and calculate
      LookOut_Target *New = Target+WeakestIdx;                                          // get a free or lowest rank slot
      New->Clear();                                                                     // put the new position there
      if(New->Pos.Read(Packet, RxTime, RefTime, RefLat, RefLon, RefAlt, LatCos, DistRange)<0) return 0; // calculate the position against the reference position
      if(!New->Pos.hasStdAlt)                                                           // if no baro altitude
      { if(Pos.hasStdAlt) { New->Pos.dStdAlt=Pos.dStdAlt; New->Pos.hasStdAlt=1;} }      // take it from own
-     New->Address  = Packet.Header.Address;
-     New->AddrType = Packet.Header.AddrType;
+     New->ID       = TgtID;
      New->AcftType = Packet.Position.AcftType;
+     New->SysMask  = SysMask;
      if(Call) { strncpy(New->Call, Call, 10); New->Call[10]=0; }
          else   New->Call[0]=0;
      return ProcessTarget(New); }
@@ -475,9 +518,10 @@ template <const uint8_t MaxTgts=32>
      if(OldIdx<MaxTargets)                                                             // if found
      { Old = Target+OldIdx;
        if((Old->Pos.T-Old->Pred)>Target[WeakestIdx].Pos.T)                             // if position is not really newer
-         return Old;                                                                   // then stop processing this (not new) position
+       { Old->SysMask|=New->SysMask; return Old; }                                     // then stop processing this (not new) position
+       New->SysMask|=Old->SysMask;                                                     // systems this target has been received by
        Old->Alloc=0; }                                                                 // mark old position as "not allocated"
-     New->Alloc=1;                                                                     // mark this position as allocated
+     New->Alloc=1;                                                                     // mark this position as allocated, not yet reported
 
      if(Old && Old->Call[0] && New->Call[0]==0) { strncpy(New->Call, Old->Call, 10); New->Call[10]=0; } // copy the call
 
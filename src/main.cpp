@@ -361,6 +361,10 @@ FlashParameters Parameters;  // parameters stored in Flash: address, aircraft ty
 
 #ifdef WITH_BT_SPP
 static BluetoothSerial BTserial;
+#ifdef WITH_FANOUT
+static FIFO<char, 1024> BT_TxFIFO;            // filled under CONS_Mutex, drained by loop() outside it: BTserial.write() can wait
+static uint32_t BT_TxDrops = 0;               // [bytes] of console output which did not fit: like BLE, a long dump is cut
+#endif
 #endif
 
 void CONS_UART_Write(char Byte) // write byte to the console (USB serial port)
@@ -369,8 +373,12 @@ void CONS_UART_Write(char Byte) // write byte to the console (USB serial port)
   BT_SPP_Write(Byte);
 #endif
 #ifdef WITH_BT_SPP
+#ifdef WITH_FANOUT
+  if(BTserial.hasClient() && !BT_TxFIFO.Write(Byte)) BT_TxDrops++;
+#else
   BTserial.write(Byte);
 #endif
+#endif
 #ifdef WITH_BLE_SPP
   BLE_SPP_TxFIFO.Write(Byte);
 #endif
@@ -379,6 +387,56 @@ void CONS_UART_Write(char Byte) // write byte to the console (USB serial port)
 int  CONS_UART_Free(void)
 { return Serial.availableForWrite(); }
 
+#ifdef WITH_FANOUT                            // the traffic sentences of the PROC task: each console link drains its own queue
+static uint8_t OUT_ConsSinks = 0;             // the console links are the first sinks, serviced by loop()
+
+static int OUT_SerialWrite(const char *Data, int Len)          // whole sentences or nothing: other tasks print on the console as well
+{ if(Serial.availableForWrite()<Len) return 0;
+  return Serial.write((const uint8_t *)Data, Len); }
+
+#ifdef WITH_BT_SPP
+static bool OUT_BTisOn(void) { return BTserial.hasClient(); }
+static int  OUT_BTWrite(const char *Data, int Len)             // into the BT FIFO: never waits under CONS_Mutex
+{ return OUT_WriteFIFO(BT_TxFIFO, Data, Len); }
+
+static void BT_TxDrain(void)                  // from loop(), outside CONS_Mutex: BluetoothSerial tells not its free space, write() may wait
+{ char *Data; unsigned Len=BT_TxFIFO.getReadBlock(Data); if(Len==0) return;
+  if(!BTserial.hasClient()) { BT_TxFIFO.flushReadBlock(Len); return; } // nobody listens: discard
+  size_t Sent=BTserial.write((const uint8_t *)Data, Len);
+  BT_TxFIFO.flushReadBlock(Sent); }
+#endif
+
+#ifdef WITH_BLE_SPP
+static bool OUT_BLEisOn(void) { return BLE_SPP_isConnected; }
+static int  OUT_BLEWrite(const char *Data, int Len)
+{ return OUT_WriteFIFO(BLE_SPP_TxFIFO, Data, Len); }
+#endif
+
+static void OUT_Setup(void)                   // before the PROC task starts
+{ OUT_FanOut.addSink("USB", OUT_SerialWrite, 0, 0, 1000000);                    // [byte/s] no rate limit, [usec] 1 sec max. age
+#ifdef WITH_BT4_SPP
+  OUT_FanOut.addSink("BT",  BT_SPP_Write, BT_SPP_isConnected, 8000, 1000000);
+#endif
+#ifdef WITH_BT_SPP
+  OUT_FanOut.addSink("BT",  OUT_BTWrite, OUT_BTisOn, 8000, 1000000);
+#endif
+#ifdef WITH_BLE_SPP
+  OUT_FanOut.addSink("BLE", OUT_BLEWrite, OUT_BLEisOn, 2000, 1000000);          // a few 20-byte notifications per connection interval
+#endif
+  OUT_ConsSinks = OUT_FanOut.getSinks(); }
+
+static void OUT_Service(void)                 // from loop(): whole sentences under the console Mut-Ex, none of the writes waits
+{ if(xSemaphoreTake(CONS_Mutex, 0))           // another task is printing: next time
+  { uint32_t usTime = micros();
+    for(uint8_t Idx=0; Idx<OUT_ConsSinks; Idx++)
+      OUT_FanOut.Service(Idx, usTime);
+    xSemaphoreGive(CONS_Mutex); }
+#ifdef WITH_BT_SPP
+  BT_TxDrain();                               // the one write which can wait: not holding the Mut-Ex
+#endif
+}
+#endif // WITH_FANOUT
+
 int  CONS_UART_Read (uint8_t &Byte)
 { char Char;
   int Ret=Serial.read(); if(Ret>=0) { Byte=Ret; return 1; }
@@ -825,6 +883,9 @@ void setup()
   xTaskCreate(vTaskGPS    ,  "GPS"  ,  4000, NULL, 1, NULL);  // read data from GPS
 #if defined(WITH_BMP180) || defined(WITH_BMP280) || defined(WITH_BME280)
   xTaskCreate(vTaskSENS   ,  "SENS" ,  4000, NULL, 1, NULL);  // read data from pressure sensor
+#endif
+#ifdef WITH_FANOUT
+  OUT_Setup();                                                // outputs for the traffic sentences of PROC
 #endif
   xTaskCreate(vTaskPROC   ,  "PROC" ,  4000, NULL, 0, NULL);  // process received packets, prepare packets for transmission
   xTaskCreate(Radio_Task  ,  "RF"   ,  4000, NULL, 1, NULL);  // transmit/receive packets
@@ -1034,6 +1095,29 @@ static void ProcessCtrlC(void)                                  // print system
   Format_SignDec(CONS_UART_Write, (600*BatteryVoltageRate+128)>>8, 3, 1);
   Format_String(CONS_UART_Write, "mV/min\n");
 
+#ifdef WITH_FANOUT
+  for(uint8_t Idx=0; Idx<OUT_FanOut.getSinks(); Idx++)          // traffic sentences per output: sent, dropped, latency
+  { OUT_FanOut.Print(Line, Idx);
+    Format_String(CONS_UART_Write, Line); }
+  OUT_FanOut.PrintPool(Line);                                    // dropped for all: pool empty, too long
+  Format_String(CONS_UART_Write, Line);
+#ifdef WITH_BT_SPP
+  Format_String(CONS_UART_Write, "BT console: ");
+  Format_UnsDec(CONS_UART_Write, BT_TxDrops);
+  Format_String(CONS_UART_Write, " bytes dropped\n");
+#endif
+#endif
+
+  xSemaphoreGive(CONS_Mutex); }
+
+static void ProcessCtrlR(void)                                  // binary snapshot of the RF statistics, see rf-stats.h
+{ xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
+  Radio_Stats.WriteSnapshot(CONS_UART_Write, millis()/1000);
+  xSemaphoreGive(CONS_Mutex); }
+
+static void ProcessCtrlE(void)                                  // binary dump of the RF event trace, see rf-trace.h
+{ xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
+  Radio_Trace.WriteDump(CONS_UART_Write);
   xSemaphoreGive(CONS_Mutex); }
 
 static void ProcessCtrlX(void)
@@ -1054,9 +1138,11 @@ static int ProcessInput(void)
 {
   const uint8_t CtrlB = 'B'-'@';
   const uint8_t CtrlC = 'C'-'@';
+  const uint8_t CtrlE = 'E'-'@';
   const uint8_t CtrlF = 'F'-'@';
   const uint8_t CtrlL = 'L'-'@';
   const uint8_t CtrlO = 'O'-'@';
+  const uint8_t CtrlR = 'R'-'@';
   const uint8_t CtrlT = 'T'-'@';
   const uint8_t CtrlX = 'X'-'@';
 
@@ -1076,6 +1162,8 @@ static int ProcessInput(void)
 #ifdef WITH_LOOKOUT
     if(Byte==CtrlT) ListTraffic();                                 // if Ctrl-T: print traffic
 #endif
+    if(Byte==CtrlR) ProcessCtrlR();                                // if Ctrl-R: binary snapshot of the RF statistics
+    if(Byte==CtrlE) ProcessCtrlE();                                // if Ctrl-E: binary dump of the RF event trace
     if(Byte==CtrlX) ProcessCtrlX();                                // double Ctrl-X restarts the system
 #endif // of WITH_GPS_UBX_PASS
 
@@ -1102,6 +1190,9 @@ void loop()
 #ifdef Button_Pin
   Button.loop();
 #endif
+#ifdef WITH_FANOUT
+  OUT_Service();
+#endif
 #ifdef WITH_BLE_SPP
   BLE_SPP_Check();
 #endif
@@ -1,3 +1,8 @@
+#ifndef __MANCHESTER_H__
+#define __MANCHESTER_H__
+
+#include <stdint.h>
+
 
 const uint8_t ManchesterEncode[0x10] =  // lookup table for 4-bit nibbles for quick Manchester encoding
 {
@@ -39,4 +44,109 @@ const uint8_t ManchesterDecode[0x100] =  // lookup table for quick Manchester de
   0xFC, 0xED, 0xEC, 0xFD, 0xDE, 0xCF, 0xCE, 0xDF, 0xDC, 0xCD, 0xCC, 0xDD, 0xFE, 0xEF, 0xEE, 0xFF
 } ;
 
+// =======================================================================================================
+// Word-wide Manchester coding: a chip pair (b1,b0) carries the data bit b0, the pair is an error when b1==b0.
+// Four Manchester bytes are decoded into two data bytes and two error bytes at once by compacting the bits
+// within each byte of a 32-bit word: same result as the above tables, but with no table lookups.
+
+inline uint32_t Manchester_Nibbles(uint32_t Word)          // in every byte: pick the even bits and pack them into the low nibble
+{ Word &= 0x55555555;
+  Word = (Word | (Word>>1)) & 0x33333333;
+  return (Word | (Word>>2)) & 0x0F0F0F0F; }
+
+inline uint32_t Manchester_Spread(uint32_t Word)           // in every byte: spread the low nibble onto the even bits, reverse of the above
+{ Word &= 0x0F0F0F0F;
+  Word = (Word | (Word<<2)) & 0x33333333;
+  return (Word | (Word<<1)) & 0x55555555; }
+
+inline void Manchester_DecodeWord(uint8_t *Data, uint8_t *Err, uint32_t Chips) // 4 Manchester bytes (little-endian word) => 2 data + 2 error bytes
+{ uint32_t Bits = Manchester_Nibbles(Chips);                // data is the second chip of the pair
+  uint32_t Errs = Manchester_Nibbles(~(Chips^(Chips>>1)));  // error when both chips of the pair are equal
+  Bits = (Bits<<4) | (Bits>>8);                              // bytes 0 and 2 now hold the decoded bytes
+  Errs = (Errs<<4) | (Errs>>8);
+  Data[0] = Bits; Data[1] = Bits>>16;
+  Err [0] = Errs; Err [1] = Errs>>16; }
+
+inline uint32_t Manchester_EncodeWord(uint8_t Byte0, uint8_t Byte1) // 2 data bytes => 4 Manchester bytes (little-endian word): 0 => 10, 1 => 01
+{ uint32_t Word = (Byte0>>4) | ((uint32_t)(Byte0&0x0F)<<8) | ((uint32_t)(Byte1>>4)<<16) | ((uint32_t)(Byte1&0x0F)<<24); // each nibble into its own byte
+  Word = Manchester_Spread(Word);
+  return Word | ((Word^0x55555555)<<1); }
+
+inline void Manchester_DecodeScalar(uint8_t *Data, uint8_t *Err, const uint8_t *Chips, int Bytes) // portable, two bytes at a time
+{ int Idx=0;
+  for( ; Idx+2<=Bytes; Idx+=2, Chips+=4)
+  { uint32_t Word = Chips[0] | ((uint32_t)Chips[1]<<8) | ((uint32_t)Chips[2]<<16) | ((uint32_t)Chips[3]<<24);
+    Manchester_DecodeWord(Data+Idx, Err+Idx, Word); }
+  if(Idx<Bytes)                                            // odd number of bytes: the last one alone
+  { uint8_t Byte[2], ErrByte[2];
+    Manchester_DecodeWord(Byte, ErrByte, Chips[0] | ((uint32_t)Chips[1]<<8) | 0xAAAA0000);
+    Data[Idx] = Byte[0]; Err[Idx] = ErrByte[0]; }
+}
+
+#if defined(__SSE2__) || defined(__ARM_NEON)               // host tools which replay captured packets: 16 bytes at a time
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+inline void Manchester_Decode16(uint8_t *Data, uint8_t *Err, const uint8_t *Chips) // 32 Manchester bytes => 16 data bytes
+{ const __m128i M55 = _mm_set1_epi8(0x55);
+  const __m128i M33 = _mm_set1_epi8(0x33);
+  const __m128i M0F = _mm_set1_epi8(0x0F);
+  const __m128i M00FF = _mm_set1_epi16(0x00FF);
+  __m128i Nibble[2][2];                                    // [data/err][first/second 16 chip bytes]
+  for(int Half=0; Half<2; Half++)
+  { __m128i Inp = _mm_loadu_si128((const __m128i *)(Chips+16*Half));
+    __m128i Bits[2];
+    Bits[0] = Inp;                                                       // data is the second chip of a pair
+    Bits[1] = _mm_andnot_si128(_mm_xor_si128(Inp, _mm_srli_epi16(Inp, 1)), M55); // error when both chips are equal
+    for(int Type=0; Type<2; Type++)                                      // compact each byte into a nibble
+    { __m128i X = _mm_and_si128(Bits[Type], M55);
+      X = _mm_and_si128(_mm_or_si128(X, _mm_srli_epi16(X, 1)), M33);
+      X = _mm_and_si128(_mm_or_si128(X, _mm_srli_epi16(X, 2)), M0F);
+      Nibble[Type][Half] = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(X, M00FF), 4), _mm_srli_epi16(X, 8)); } // (even<<4) | odd
+  }
+  _mm_storeu_si128((__m128i *)Data, _mm_packus_epi16(Nibble[0][0], Nibble[0][1]));
+  _mm_storeu_si128((__m128i *)Err , _mm_packus_epi16(Nibble[1][0], Nibble[1][1])); }
+#else
+#include <arm_neon.h>
+
+inline void Manchester_Decode16(uint8_t *Data, uint8_t *Err, const uint8_t *Chips) // 32 Manchester bytes => 16 data bytes
+{ const uint8x16_t M55 = vdupq_n_u8(0x55);
+  const uint8x16_t M33 = vdupq_n_u8(0x33);
+  const uint8x16_t M0F = vdupq_n_u8(0x0F);
+  uint8x16x2_t Inp = vld2q_u8(Chips);                      // even bytes => upper nibbles, odd bytes => lower nibbles
+  uint8x16_t Nibble[2][2];                                 // [data/err][even/odd]
+  for(int Half=0; Half<2; Half++)
+  { uint8x16_t Bits[2];
+    Bits[0] = Inp.val[Half];
+    Bits[1] = vmvnq_u8(veorq_u8(Inp.val[Half], vshrq_n_u8(Inp.val[Half], 1)));
+    for(int Type=0; Type<2; Type++)
+    { uint8x16_t X = vandq_u8(Bits[Type], M55);
+      X = vandq_u8(vorrq_u8(X, vshrq_n_u8(X, 1)), M33);
+      X = vandq_u8(vorrq_u8(X, vshrq_n_u8(X, 2)), M0F);
+      Nibble[Type][Half] = X; }
+  }
+  vst1q_u8(Data, vorrq_u8(vshlq_n_u8(Nibble[0][0], 4), Nibble[0][1]));
+  vst1q_u8(Err , vorrq_u8(vshlq_n_u8(Nibble[1][0], 4), Nibble[1][1])); }
+#endif
+
+inline void Manchester_Decode(uint8_t *Data, uint8_t *Err, const uint8_t *Chips, int Bytes)
+{ int Idx=0;
+  for( ; Idx+16<=Bytes; Idx+=16)
+    Manchester_Decode16(Data+Idx, Err+Idx, Chips+2*Idx);
+  Manchester_DecodeScalar(Data+Idx, Err+Idx, Chips+2*Idx, Bytes-Idx); }
+#else
+inline void Manchester_Decode(uint8_t *Data, uint8_t *Err, const uint8_t *Chips, int Bytes)
+{ Manchester_DecodeScalar(Data, Err, Chips, Bytes); }
+#endif
+
+inline int Manchester_Encode(uint8_t *Chips, const uint8_t *Data, int Bytes) // returns the number of Manchester bytes
+{ int Idx=0;
+  for( ; Idx+2<=Bytes; Idx+=2, Chips+=4)
+  { uint32_t Word = Manchester_EncodeWord(Data[Idx], Data[Idx+1]);
+    Chips[0]=Word; Chips[1]=Word>>8; Chips[2]=Word>>16; Chips[3]=Word>>24; }
+  if(Idx<Bytes)
+  { uint32_t Word = Manchester_EncodeWord(Data[Idx], 0);
+    Chips[0]=Word; Chips[1]=Word>>8; }
+  return 2*Bytes; }
 
+#endif // __MANCHESTER_H__
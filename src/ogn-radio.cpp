@@ -8,6 +8,7 @@
 #include "manchester.h"
 
 #include "timesync.h"
+#include "proc-wake.h"
 
 #define WITH_FANET
 
@@ -16,11 +17,11 @@
  FreqPlan Radio_FreqPlan;       // RF frequency hopping scheme
 
  // quques for transmitted packets
- FIFO<OGN_TxPacket<OGN_Packet>, 4> OGN_TxFIFO;              // OGN packets to be transmitted
- FIFO<ADSL_Packet,              4> ADSL_TxFIFO;             // ADS-L packets to be transmitted
+ FIFO<OGN_TxFrame,              4> OGN_TxFIFO;              // OGN packets to be transmitted
+ FIFO<ADSL_TxFrame,             4> ADSL_TxFIFO;             // ADS-L packets to be transmitted
  // FIFO<ADSL_RID,                 4> RID_TxFIFO;
  FIFO<FANET_Packet,             4> FNT_TxFIFO;              // FANET packets to be transmitted
- FIFO<PAW_Packet,               4> PAW_TxFIFO;              // PilotAware packets to be transmitted
+ FIFO<PAW_TxFrame,              4> PAW_TxFIFO;              // PilotAware packets to be transmitted
 
  // queues for received packets
  FIFO<FSK_RxPacket,            32> FSK_RxFIFO;              // received packets of OGN, ADS-L, LDR
@@ -49,7 +50,8 @@ static const uint8_t SYNC_LDR [10] = { 0xB4, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x18,
 uint32_t Radio_TxCount[8] = { 0, 0, 0, 0, 0, 0, 0, 0 } ; // transmitted packet counters
 uint32_t Radio_RxCount[8] = { 0, 0, 0, 0, 0, 0, 0, 0 } ; // received packet counters
 
-int32_t Radio_TxCredit = 60000;                        // [ms]
+DutyCycle Radio_Duty;
+RF_Stats Radio_Stats;                                  // cleared by Radio_Task() before the first use
 float   Radio_PktRate = 0.0f;                          // [Hz] received packet rate
 const float Radio_PktUpdate = 0.05f;                   // weight to update the packet rate
 float   Radio_BkgRSSI = -105.0f;                       // [dBm] background noise seen by the receiver
@@ -66,14 +68,43 @@ const float Radio_TxPwrGain = 0;                       // [dBm] gain of a PA or
 #ifdef WITH_SX1276
 static SX1276 Radio = new Module(Radio_PinCS, Radio_PinIRQ, Radio_PinRST, -1);                // create SX1276 RF module
 static bool Radio_IRQ(void) { return digitalRead(Radio_PinIRQ); }
+static const uint8_t Radio_IntrPin = Radio_PinIRQ;
  const char *Radio_ChipType = "SX1276";
 #endif
 #ifdef WITH_SX1262
 static SX1262 Radio = new Module(Radio_PinCS, Radio_PinIRQ1, Radio_PinRST, Radio_PinBusy);    // create sx1262 RF module
 static bool Radio_IRQ(void) { return digitalRead(Radio_PinIRQ1); }
+static const uint8_t Radio_IntrPin = Radio_PinIRQ1;
  const char *Radio_ChipType = "SX1262";
 #endif
 
+static TaskHandle_t      Radio_TaskHandle = 0;    // the RF task: notified by the IRQ interrupt
+static volatile uint32_t Radio_Intr_usTime = 0;   // [us] micros() counter when the IRQ line went up
+static volatile uint32_t Radio_Intr_Count  = 0;   // [count] IRQ edges
+
+static void IRAM_ATTR Radio_Intr(void)            // IRQ line of the RF chip goes up: packet received or sent
+{ Radio_Intr_usTime = micros();                   // [usec] note the time of the packet end
+  Radio_Intr_Count++;
+  BaseType_t Woken = pdFALSE;
+  if(Radio_TaskHandle) vTaskNotifyGiveFromISR(Radio_TaskHandle, &Woken); // wake up the RF task
+  if(Woken) portYIELD_FROM_ISR(); }
+
+RF_Trace Radio_Trace;                             // binary trace of the RF events, dumped with Ctrl-E
+
+static void Radio_Event(uint8_t Type, uint8_t Arg=0, uint16_t Val=0) { Radio_Trace.Add(micros(), Type, Arg, Val); }
+
+static bool Radio_WaitIRQ(uint32_t msTimeout)     // sleep till the IRQ line goes up or the timeout
+{ if(Radio_IRQ()) return 1;
+  if(msTimeout==0) return 0;
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(msTimeout)); // an edge between the check above and here leaves a notification thus we do not miss it
+  return Radio_IRQ(); }                           // notification can be a stale one: check the line again
+
+static uint32_t Radio_IntrTime(void)              // [ms] system time of the last IRQ edge
+{ uint32_t usDelay = micros()-Radio_Intr_usTime;  // [usec] how long ago the edge was
+  uint32_t msTime  = millis();
+  if(usDelay>=100000) return msTime;              // edge too old: most likely the interrupt was missed, take the current time
+  return msTime-usDelay/1000; }
+
  uint8_t Radio_ChipVersion     = 0x00;
  int8_t  Radio_ChipTemperature = -128;
 
@@ -84,77 +115,168 @@ static bool Radio_IRQ(void) { return digitalRead(Radio_PinIRQ1); }
 //  -2 => RADIOLIB_ERR_CHIP_NOT_FOUND
 // -20 => RADIOLIB_ERR_WRONG_MODEM
 
-static int Radio_ConfigManchFSK(uint8_t PktLen, bool RxMode, const uint8_t *SYNC, uint8_t SYNClen=8)         // Radio setup for FLR/OGN/ADS-L
-{ int ErrState=0; int State=0;
-  // uint32_t Time=millis();
-  // Radio.standby();
-  // vTaskDelay(1);
+// FSK modem setup of the RF chip: one object per (protocol, RX/TX) profile, and one to shadow what has been written into the chip
+class Radio_FSKconfig
+{ public:
+   float    BitRate;        // [kbps]
+   float    FreqDev;        // [kHz]  frequency deviation
+   float    RxBW;           // [kHz]  receiver bandwidth, zero => leave as is
+   float    AFCBW;          // [kHz]  AFC bandwidth (SX1276), zero => leave as is
+   uint16_t Preamble;       // [bits]
+   uint8_t  Shaping;        // RADIOLIB_SHAPING_...
+   uint8_t  PktLen;         // [bytes] fixed packet length as seen by the RF chip
+   uint8_t  PreamblePol;    // 0x55 or 0xAA preamble polarity (SX1276), zero => leave as is
+   uint8_t  SYNClen;        // [bytes] SYNC length, zero => this profile is not defined
+   uint8_t  SYNC[8];
+
+  public:
+   void Clear(void) { memset(this, 0, sizeof(Radio_FSKconfig)); }
+
+   void setSYNC(const uint8_t *NewSYNC, uint8_t Len)
+   { if(Len>8) Len=8;
+     SYNClen=Len; memcpy(SYNC, NewSYNC, Len); }
+
+   bool sameSYNC(const Radio_FSKconfig &Ref) const
+   { return SYNClen==Ref.SYNClen && memcmp(SYNC, Ref.SYNC, SYNClen)==0; }
+
+   void setManchFSK(uint8_t Len, bool RxMode, const uint8_t *NewSYNC, uint8_t NewSYNClen=8) // setup for FLR/OGN/ADS-L
+   { Clear();
+     Shaping = RADIOLIB_SHAPING_0_5;                                // [BT]   FSK modulation shaping
+     BitRate = 100.0;                                               // [kpbs] 100kbps bit rate but we transmit Manchester encoded thus effectively 50 kbps
+     FreqDev =  50.0;                                               // [kHz]  +/-50kHz deviation
+#ifdef WITH_SX1262
+     RxBW    = 234.3;                                               // [kHz]  bandwidth - single side
+     Preamble = RxMode?0:FSK_TxFrame::ManchPreamble;                // [bits] minimal preamble
+#endif
 #ifdef WITH_SX1276
-  if(Radio.getActiveModem()!=RADIOLIB_SX127X_FSK_OOK)
-    State=Radio.setActiveModem(RADIOLIB_SX127X_FSK_OOK);
+     if(RxMode) { RxBW = 200.0; AFCBW = 250.0; }                    // [kHz]  bandwidth - single side and auto-frequency-tune bandwidth
+     Preamble = RxMode?8:FSK_TxFrame::ManchPreamble;                // [bits] minimal preamble
+     if(NewSYNC[0]==0x55 || NewSYNC[0]==0xAA) PreamblePol=NewSYNC[0]; // preamble polarity to match the SYNC
 #endif
-#ifdef WITH_SX1262
-  if(Radio.getPacketType()!=RADIOLIB_SX126X_PACKET_TYPE_GFSK)
-    State=Radio.config(RADIOLIB_SX126X_PACKET_TYPE_GFSK);
+     setSYNC(NewSYNC, NewSYNClen);                                  // SYNC sequence: 8 bytes which is equivalent to 4 bytes before Manchester encoding
+     PktLen = Len*2; }                                              // [bytes] Manchester doubles the packet size
+
+   void setLDR(uint8_t Len, bool RxMode, const uint8_t *NewSYNC, uint8_t NewSYNClen=2) // setup for PilotAware: GFSK, 38.4kbps, +/-12.5kHz and ADS-L/OGN LDR
+   { Clear();
+     Shaping = RADIOLIB_SHAPING_1_0;                                // [BT]   FSK modulation shaping
+     BitRate =  38.4;                                               // [kpbs] 38.4kbps bit rate
+     FreqDev =  12.5;                                               // [kHz]  +/-12.5kHz deviation
+     RxBW    =  58.6;                                               // [kHz]  50kHz bandwidth
+#ifdef WITH_SX1276
+     if(RxMode) AFCBW = 58.6;                                       // [kHz]  auto-frequency-tune bandwidth
+     PreamblePol = 0xAA;
+#endif
+     Preamble = RxMode?16:FSK_TxFrame::LDRPreamble;                 // [bits] very long preamble for Pilot-Aware
+     setSYNC(NewSYNC, NewSYNClen);                                  // SYNC sequence: 2 bytes, the rest we have to do in software
+     PktLen = Len; }
+
+} ;
+
+static Radio_FSKconfig Radio_Shadow;          // what has been written into the RF chip
+static bool            Radio_ShadowValid = 0; // when not valid, the next setup writes everything
+static float           Radio_ShadowFreq  = 0; // [MHz] frequency set in the RF chip
+static float           Radio_ShadowTxPwr =-1; // [dBm] TX power set in the RF chip, negative = unknown: 0dBm is a valid setting
+
+static Radio_FSKconfig Radio_Profile[2][10];  // [RxMode][SysID] precomputed setups for FLR, OGN, ADS-L, LDR and the multi-system receptions
+
+static void Radio_InvalidateShadow(void)      // after switching to LoRa or anything else that touches the modem setup
+{ Radio_ShadowValid=0; Radio_ShadowFreq=0; Radio_ShadowTxPwr=(-1); }
+
+static void Radio_InitProfiles(void)
+{ for(uint8_t SysID=0; SysID<10; SysID++)
+  { const uint8_t *SYNC; uint8_t PktLen;
+    int SYNClen = FSK_RxPacket::SysSYNC(SYNC, PktLen, SysID);
+    for(uint8_t RxMode=0; RxMode<2; RxMode++)
+    { Radio_FSKconfig &Conf = Radio_Profile[RxMode][SysID];
+      Conf.Clear();
+      if(SYNClen<=0) continue;
+      if(SysID==Radio_SysID_LDR) Conf.setLDR(PktLen+(RxMode?9:7), RxMode, SYNC, SYNClen); // LDR: 6 bytes of the SYNC and a CRC byte are not in the packet, RX: 2 more for the offset search
+                            else Conf.setManchFSK(PktLen, RxMode, SYNC, SYNClen); }
+  }
+}
+
+// write the modem setup into the RF chip, but only the items which differ from the shadow
+static int Radio_ConfigFSK(const Radio_FSKconfig &Conf)
+{ int ErrState=0; int State=0;
+  bool All = !Radio_ShadowValid;
+  if(All)                                                           // when the shadow is not valid we do not know the modem either
+  {
+#ifdef WITH_SX1276
+    if(Radio.getActiveModem()!=RADIOLIB_SX127X_FSK_OOK)
+      State=Radio.setActiveModem(RADIOLIB_SX127X_FSK_OOK);
 #endif
-  if(State) ErrState=State;
-  State=Radio.setDataShaping(RADIOLIB_SHAPING_0_5);                 // [BT]   FSK modulation shaping
-  if(State) ErrState=State;
-  State=Radio.setBitRate(100.0);                                    // [kpbs] 100kbps bit rate but we transmit Manchester encoded thus effectively 50 kbps
-  if(State) ErrState=State;
-  State=Radio.setFrequencyDeviation(50.0);                          // [kHz]  +/-50kHz deviation
-  if(State) ErrState=State;
 #ifdef WITH_SX1262
-  State=Radio.setRxBandwidth(234.3);                                // [kHz]  bandwidth - single side
-  if(State) ErrState=State;
+    if(Radio.getPacketType()!=RADIOLIB_SX126X_PACKET_TYPE_GFSK)
+      State=Radio.config(RADIOLIB_SX126X_PACKET_TYPE_GFSK);
 #endif
+    if(State) ErrState=State;
+    State=Radio.setEncoding(RADIOLIB_ENCODING_NRZ);
+    if(State) ErrState=State;
+    State=Radio.setCRC(0, 0);                                       // disable CRC: we do it ourselves
+    if(State) ErrState=State;
 #ifdef WITH_SX1276
-  if(RxMode)
-  { State=Radio.setRxBandwidth(200.0);                                // [kHz]  bandwidth - single side
+    State=Radio.disableAddressFiltering();                          // don't want any of such features
     if(State) ErrState=State;
-    State=Radio.setAFCBandwidth(250.0);                               // [kHz]  auto-frequency-tune bandwidth
+    State=Radio.setAFC(0);                                          // AFC off, but the AGC triggered by the preamble
     if(State) ErrState=State;
-    State=Radio.setAFC(0);                                            // enable AFC
+    State=Radio.setAFCAGCTrigger(RADIOLIB_SX127X_RX_TRIGGER_PREAMBLE_DETECT);
+    if(State) ErrState=State;
+    State=Radio.setRSSIConfig(8, 0);                                // set RSSI smoothing (3 bits) and offset (5 bits)
     if(State) ErrState=State;
-    State=Radio.setAFCAGCTrigger(RADIOLIB_SX127X_RX_TRIGGER_PREAMBLE_DETECT); //
-    if(State) ErrState=State; }
 #endif
 #ifdef WITH_SX1262
-  State=Radio.setPreambleLength(RxMode?0:16);                       // [bits] minimal preamble
+    State=Radio.setRxBoostedGainMode(true);                         // 2mA more current but boosts sensitivity
+    if(State) ErrState=State;
 #endif
+  }
+  if(All || Conf.Shaping!=Radio_Shadow.Shaping)
+  { State=Radio.setDataShaping(Conf.Shaping);                       // [BT]   FSK modulation shaping
+    if(State) ErrState=State; }
+  if(All || Conf.BitRate!=Radio_Shadow.BitRate)
+  { State=Radio.setBitRate(Conf.BitRate);                           // [kbps]
+    if(State) ErrState=State; }
+  if(All || Conf.FreqDev!=Radio_Shadow.FreqDev)
+  { State=Radio.setFrequencyDeviation(Conf.FreqDev);                // [kHz]
+    if(State) ErrState=State; }
+  if(Conf.RxBW && (All || Conf.RxBW!=Radio_Shadow.RxBW))
+  { State=Radio.setRxBandwidth(Conf.RxBW);                          // [kHz]  single side
+    if(State) ErrState=State; }
 #ifdef WITH_SX1276
-  State=Radio.setPreambleLength(RxMode?8:16);                       // [bits] minimal preamble
+  if(Conf.AFCBW && (All || Conf.AFCBW!=Radio_Shadow.AFCBW))
+  { State=Radio.setAFCBandwidth(Conf.AFCBW);                        // [kHz]  auto-frequency-tune bandwidth
+    if(State) ErrState=State; }
 #endif
-  if(State) ErrState=State;
-  State=Radio.setSyncWord((uint8_t *)SYNC, SYNClen);                // SYNC sequence: 8 bytes which is equivalent to 4 bytes before Manchester encoding
-  if(State) ErrState=State;
-  State=Radio.setEncoding(RADIOLIB_ENCODING_NRZ);                   //
-  if(State) ErrState=State;
-  State=Radio.setCRC(0, 0);                                         // disable CRC: we do it ourselves
-  if(State) ErrState=State;
-  State=Radio.fixedPacketLengthMode(PktLen*2);                      // [bytes] Fixed packet size mode
-  if(State) ErrState=State;
+  if(All || Conf.Preamble!=Radio_Shadow.Preamble)
+  { State=Radio.setPreambleLength(Conf.Preamble);                   // [bits]
+    if(State) ErrState=State; }
+  if(All || !Conf.sameSYNC(Radio_Shadow))
+  { State=Radio.setSyncWord((uint8_t *)Conf.SYNC, Conf.SYNClen);    // SYNC sequence
+    if(State) ErrState=State; }
+  if(All || Conf.PktLen!=Radio_Shadow.PktLen)
+  { State=Radio.fixedPacketLengthMode(Conf.PktLen);                 // [bytes] Fixed packet size mode
+    if(State) ErrState=State; }
 #ifdef WITH_SX1276
-  State=Radio.disableAddressFiltering();                            // don't want any of such features
-  if(State) ErrState=State;
-  // we could actually use: invertPreamble(true) // true=0xAA, false=0x55
-  if(SYNC[0]==0x55)
-    State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG, RADIOLIB_SX127X_PREAMBLE_POLARITY_55, 5, 5); // preamble polarity
-  else if(SYNC[0]==0xAA)
-    State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG, RADIOLIB_SX127X_PREAMBLE_POLARITY_AA, 5, 5); // preamble polarity
-  State=Radio.setRSSIConfig(8, 0);                                  // set RSSI smoothing (3 bits) and offset (5 bits)
-  if(State) ErrState=State;
-#endif
-#ifdef WITH_SX1262
-  State=Radio.setRxBoostedGainMode(true);                           // 2mA more current but boosts sensitivity
-  if(State) ErrState=State;
+  if(Conf.PreamblePol && (All || Conf.PreamblePol!=Radio_Shadow.PreamblePol))
+  { State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG,
+              Conf.PreamblePol==0x55 ? RADIOLIB_SX127X_PREAMBLE_POLARITY_55 : RADIOLIB_SX127X_PREAMBLE_POLARITY_AA, 5, 5); // preamble polarity
+    if(State) ErrState=State; }
 #endif
-  // Time = millis()-Time;
-  // Serial.printf("Radio_ConfigManchFSK(%d, ) (%d) %dms\n", PktLen, ErrState, Time);
-  return ErrState; }                                                   // this call takes 18-19 ms
+  float RxBW=Radio_Shadow.RxBW, AFCBW=Radio_Shadow.AFCBW; uint8_t PreamblePol=Radio_Shadow.PreamblePol;
+  Radio_Shadow = Conf;                                              // now the chip has this setup
+  if(!Conf.RxBW)        Radio_Shadow.RxBW=RxBW;                     // except for the items we did not touch
+  if(!Conf.AFCBW)       Radio_Shadow.AFCBW=AFCBW;
+  if(!Conf.PreamblePol) Radio_Shadow.PreamblePol=PreamblePol;
+  Radio_ShadowValid = ErrState==0;                                  // if anything went wrong, write everything next time
+  return ErrState; }                                                // full setup takes 18-19 ms, a change of the SYNC and length 3-4 ms
+
+static int Radio_ConfigManchFSK(uint8_t PktLen, bool RxMode, const uint8_t *SYNC, uint8_t SYNClen=8)         // Radio setup for FLR/OGN/ADS-L
+{ Radio_FSKconfig Conf; Conf.setManchFSK(PktLen, RxMode, SYNC, SYNClen);
+  return Radio_ConfigFSK(Conf); }
 
 static int Radio_setFrequency(float Freq)            // set receive/transmit frequency
-{ Freq += (0.0000001f*Parameters.RFchipFreqCorr)*Freq;   // apply frequency correction
+{ if(Freq==Radio_ShadowFreq) return 0;             // already set
+  Radio_ShadowFreq = Freq;
+  Freq += (0.0000001f*Parameters.RFchipFreqCorr)*Freq;   // apply frequency correction
   Radio.setFrequency(Freq);
   return 0; }
 
@@ -167,25 +289,22 @@ static int Radio_setTxPower(float TxPower)         // set trannsmitter power
 #ifdef WITH_SX1262
   else if(TxPower>22) TxPower=22;
 #endif
+  if(TxPower==Radio_ShadowTxPwr) return 0;         // already set
+  bool First = Radio_ShadowTxPwr<0;                // unknown: after the start or a modem change
+  Radio_ShadowTxPwr = TxPower;
   Radio.setOutputPower(TxPower);
-  Radio.setCurrentLimit(140);                      // values are 0 to 140 mA for SX1262, default is 60
+  if(First) Radio.setCurrentLimit(140);            // values are 0 to 140 mA for SX1262, default is 60
   return 0; }
 
-static int ManchEncode(uint8_t *Out, const uint8_t *Inp, uint8_t InpLen) // Encode packet bytes as Manchester
-{ int Len=0;
-  for(int Idx=0; Idx<InpLen; Idx++)                // loop over bytes and encode usinglookup table
-  { uint8_t Byte=Inp[Idx];                         // data byte to be encoded
-    Out[Len++]=ManchesterEncode[Byte>>4];          // use lookup table to encode upper nibble
-    Out[Len++]=ManchesterEncode[Byte&0x0F]; }      // encode lower nibble
-  return Len; }                                    // returns number of bytes in the encoded packet
-
 #ifdef WITH_SX1262
-static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len)
-{ uint32_t usTxTime=Radio.getTimeOnAir(Len);                             // [usec]
-  Radio_TxCredit-=usTxTime/1000;
+static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len, uint8_t Band, uint32_t usTxTime=0) // usTxTime: precomputed time-on-air, zero => ask RadioLib
+{ if(usTxTime==0) usTxTime=Radio.getTimeOnAir(Len);                      // [usec]
+  Radio_Duty.Charge(Band, usTxTime, millis()/1000);
   // uint32_t Time=millis();
   // LED_OGN_Blue();                                                     // 10ms flash for transmission
+  Radio_Event(RF_Trace::TxStart, Band, Len);
   int State=Radio.transmit((const uint8_t *)Packet, Len);                                 // transmit
+  Radio_Event(RF_Trace::TxEnd, Band);
   // LED_OGN_Off();
   // Time = millis()-Time;
   // Serial.printf("Radio_TxManchFSK(, %d=>%d) (%d) %dms\n", Len, TxLen, State, Time);  // for debug
@@ -193,25 +312,27 @@ static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len)
 #endif
 
 #ifdef WITH_SX1276
-static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len)
+static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len, uint8_t Band, uint32_t usTxTime=0) // usTxTime: precomputed time-on-air, zero => ask RadioLib
 { // LED_OGN_Blue();
   // Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK, Len);
+  if(usTxTime==0) usTxTime=Radio.getTimeOnAir(Len);                    // [usec] predicted transmission time
+  Radio_Duty.Charge(Band, usTxTime, millis()/1000);
+  Radio_Event(RF_Trace::TxStart, Band, Len);
   int State=Radio.startTransmit((const uint8_t *)Packet, Len);
   uint32_t usStart = micros();                                         // [usec] when transmission started
-  uint32_t usTxTime=Radio.getTimeOnAir(Len);                           // [usec] predicted transmission time
    int32_t usLeft = usTxTime;                                          // [usec]
-  Radio_TxCredit-=usTxTime/1000;
   for( ; ; )
   { uint32_t usTime = micros()-usStart;                                // [usec] time since transmission started
     usLeft = usTxTime-usTime;                                          // [usec] time left till the end of packet
     if(Radio_IRQ()) break;                                 // raised IRQ => end-of-data
     // uint16_t Flags=Radio.getIRQFlags(); if(Flags & RADIOLIB_SX127X_CLEAR_IRQ_FLAG_TX_DONE) break;
-    if(usLeft>1500) { delay(1); continue; }
+    if(usLeft>1500) { Radio_WaitIRQ(1); continue; }
     if(usLeft<(-40)) break;
     taskYIELD(); }
   // State=Radio.finishTransmit();                         // adds a long delay and leaves a significant tail
   // Radio.clearIRQFlags();
   Radio.standby();
+  Radio_Event(RF_Trace::TxEnd, Band);
   Radio.clearIrqFlags(RADIOLIB_SX127X_FLAGS_ALL);
   // uint8_t RegPktLen = Radio.mod->SPIreadRegister(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK);
   // uint8_t RegFixed = Radio.mod->SPIreadRegister(RADIOLIB_SX127X_REG_PACKET_CONFIG_1);
@@ -221,89 +342,23 @@ static int Radio_TxFSK(const uint8_t *Packet, uint8_t Len)
   return State; }
 #endif
 
-static uint8_t Radio_TxPacket[96];                 // Manchester-encoded packet just before transmission
 static uint8_t Radio_RxPacket[96];                 // Manchester-encoded packet just after reception
 
-static int Radio_TxManchFSK(const uint8_t *Packet, uint8_t Len)          // transmit a packet using Manchester encoding
-{ int TxLen=ManchEncode(Radio_TxPacket, Packet, Len);                    // Manchester encode
-  return Radio_TxFSK(Radio_TxPacket, TxLen); }
+static int Radio_TxFrame(const FSK_TxFrame &Frame, uint8_t Band)         // transmit a frame prepared by the producer
+{ return Radio_TxFSK(Frame.Byte, Frame.Len, Band, Frame.usTime); }
+
+static const FSK_TxFrame *Radio_SlotFrame(uint8_t TxSysID, const OGN_TxFrame *OGN, const ADSL_TxFrame *ADSL) // the frame a half-slot transmits
+{ if(TxSysID==Radio_SysID_OGN ) return OGN  ? &(OGN->Manch)  : 0;
+  if(TxSysID==Radio_SysID_ADSL) return ADSL ? &(ADSL->Manch) : 0;  // M-band
+  if(TxSysID==Radio_SysID_LDR ) return ADSL ? &(ADSL->LDR)   : 0;  // O-band
+  return 0; }
 
 // =======================================================================================================
 
 // Radio setup for PilotAware: GFSK, 38.4kbps, +/-12.5kHz and ADS-L/OGN LDR
 static int Radio_ConfigLDR(uint8_t PktLen=PAW_Packet::Size+7, bool RxMode=0, const uint8_t *SYNC=SYNC_LDR, uint8_t SYNClen=2)
-{ int ErrState=0; int State=0;
-#ifdef WITH_SX1276
-  if(Radio.getActiveModem()!=RADIOLIB_SX127X_FSK_OOK)
-    State=Radio.setActiveModem(RADIOLIB_SX127X_FSK_OOK);
-#endif
-#ifdef WITH_SX1262
-  if(Radio.getPacketType()!=RADIOLIB_SX126X_PACKET_TYPE_GFSK)
-    State=Radio.config(RADIOLIB_SX126X_PACKET_TYPE_GFSK);
-#endif
-  if(State) ErrState=State;
-  State=Radio.setDataShaping(RADIOLIB_SHAPING_1_0);                 // [BT]   FSK modulation shaping
-  if(State) ErrState=State;
-  State=Radio.setBitRate(38.4);                                     // [kpbs] 38.4kbps bit rate
-  if(State) ErrState=State;
-  State=Radio.setFrequencyDeviation(12.5);                           // [kHz]  +/-12.5kHz deviation
-  if(State) ErrState=State;
-  State=Radio.setRxBandwidth(58.6);                                 // [kHz]  50kHz bandwidth
-  if(State) ErrState=State;
-#ifdef WITH_SX1276
-  if(RxMode)
-  { State=Radio.setAFC(0);                                            // disable AFC
-    State=Radio.setAFCBandwidth(58.6);                                // [kHz]  auto-frequency-tune bandwidth
-    if(State) ErrState=State;
-    State=Radio.setAFCAGCTrigger(RADIOLIB_SX127X_RX_TRIGGER_PREAMBLE_DETECT); //
-    if(State) ErrState=State;
-    State=Radio.setAFC(0);                                            // enable AFC
-    if(State) ErrState=State; }
-#endif
-  State=Radio.setPreambleLength(RxMode?16:40);                      // [bits] very long preamble for Pilot-Aware
-  if(State) ErrState=State;
-  State=Radio.setSyncWord((uint8_t *)SYNC, SYNClen);                // SYNC sequence: 2 bytes, the rest we have to do in software
-  if(State) ErrState=State;
-  State=Radio.setEncoding(RADIOLIB_ENCODING_NRZ);
-  if(State) ErrState=State;
-  State=Radio.setCRC(0, 0);                                         // disable CRC: we do it ourselves
-  if(State) ErrState=State;
-  State=Radio.fixedPacketLengthMode(PktLen);                        // [bytes] Fixed packet size mode
-  if(State) ErrState=State;
-#ifdef WITH_SX1276
-  State=Radio.disableAddressFiltering();                            // don't want any of such features
-  if(State) ErrState=State;
-  // we could actually use: invertPreamble(true) // true=0xAA, false=0x55
-  // if(SYNC[0]==0x55)
-  //   State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG, RADIOLIB_SX127X_PREAMBLE_POLARITY_55, 5, 5); // preamble polarity
-  // else if(SYNC[0]==0xAA)
-  // State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG, RADIOLIB_SX127X_PREAMBLE_POLARITY_AA, 5, 5); // preamble polarity
-  State=Radio.invertPreamble(true);                                 // true=0xAA, false=0x55
-  // State = Radio.mod->SPIsetRegValue(RADIOLIB_SX127X_REG_SYNC_CONFIG, RADIOLIB_SX127X_PREAMBLE_POLARITY_AA, 5, 5); // preamble polarity
-  State=Radio.setRSSIConfig(8, 0);                                  // set RSSI smoothing (3 bits) and offset (5 bits)
-  if(State) ErrState=State;
-#endif
-#ifdef WITH_SX1262
-  State=Radio.setRxBoostedGainMode(true);                           // 2mA more current but boosts sensitivity
-  if(State) ErrState=State;
-#endif
-  // Time = millis()-Time;
-  // Serial.printf("Radio_ConfigManchFSK(%d, ) (%d) %dms\n", PktLen, ErrState, Time);
-  return ErrState; }                                                // this call takes 18-19 ms
-
-static int Radio_TxLDR(const uint8_t *Packet, uint8_t PktSize=24)   // transmit a PilotAware packet
-{ memcpy(Radio_TxPacket, SYNC_LDR+2, 6);                            // first copy the remaining 6 bytes of the pre-data part
-  memcpy(Radio_TxPacket+6, Packet, PktSize);                        // copy packet to the buffer (internal CRC is already set)
-  Radio_TxPacket[6+PktSize] = PAW_Packet::CRC8(Radio_TxPacket+6, PktSize); // add external CRC
-  // Radio_TxCount[Radio_SysID_LDR]++;                              // this is counted in the Radio_Slot()
-  return Radio_TxFSK(Radio_TxPacket, 6+PktSize+1); }                // send the packet out
-
-static int Radio_TxPAW(PAW_Packet &Packet)                          // transmit a PilotAware packet, which could be an ADS-L !
-{ if(!Packet.isADSL()) Packet.Whiten();                             // whiten PAW packets, but not ADS-L
-  return Radio_TxLDR(Packet.Byte, Packet.Size); }                   // very dirthy but needs to stay for now
-
-static int Radio_TxLDR(const ADSL_Packet &Packet)                   // transmit an ADS-L packet
-{ return Radio_TxLDR(&Packet.Version, Packet.TxBytes-3); }
+{ Radio_FSKconfig Conf; Conf.setLDR(PktLen, RxMode, SYNC, SYNClen);
+  return Radio_ConfigFSK(Conf); }
 
 // =======================================================================================================
 
@@ -327,22 +382,18 @@ static int Radio_Receive(uint8_t PktLen, int Manch, uint8_t SysID, uint8_t Chann
   // RxPkt->SNR  = 0;
 #endif
   XorShift64(Random.Word);
-  uint32_t msTime = millis();                                            // [ms] current system time
+  Radio_Trace.Add(Radio_Intr_usTime, RF_Trace::IRQ);
+  uint32_t msTime = Radio_IntrTime();                                    // [ms] system time of the packet end, given by the IRQ interrupt
   // RxPkt->PosTime = TimeRef.sysTime;                                      // [ms] 
   RxPkt->msTime = msTime-TimeRef.sysTime;                                // [ms] time since the reference PPS
   RxPkt->Time = TimeRef.UTC;                                             // [sec] UTC PPS
-  RxPkt->SNR  = 0; // PktStat>>8;                                        // this should be SYNC RSSI but it does not fit this way
+  { float SNR = 4*(-0.5f*RxPkt->RSSI-Radio_BkgRSSI);                      // [0.25dB] packet RSSI over the background noise
+    if(SNR<1) SNR=1; else if(SNR>127) SNR=127;                           // 0 would mean: unknown
+    RxPkt->SNR = floorf(SNR+0.5f); }                                     // for the soft decisions of the OGN decoder
   if(Manch)                                                              // if Manchester encoding expected
-  { Radio.readData(Radio_RxPacket, PktLen*2);                              // read packet from the Radio
+  { Radio.readData(Radio_RxPacket, PktLen*2);                            // read packet from the Radio: Manchester doubles the size
     // Radio.startReceive();
-    uint8_t PktIdx=0;
-    for(uint8_t Idx=0; Idx<PktLen; Idx++)                                  // loop over packet bytes
-    { uint8_t ByteH = Radio_RxPacket[PktIdx++];
-      ByteH = ManchesterDecode[ByteH]; uint8_t ErrH=ByteH>>4; ByteH&=0x0F; // decode Manchester, detect errors
-      uint8_t ByteL = Radio_RxPacket[PktIdx++];
-      ByteL = ManchesterDecode[ByteL]; uint8_t ErrL=ByteL>>4; ByteL&=0x0F; // second nibble
-      RxPkt->Data[Idx]=(ByteH<<4) | ByteL;                               // fill Data
-      RxPkt->Err [Idx]=(ErrH <<4) | ErrL ; }                             // and Manchester errors
+    Manchester_Decode(RxPkt->Data, RxPkt->Err, Radio_RxPacket, PktLen);  // decode Manchester into Data, detect errors into Err
   }
   else                                                                   // if no Manchester encoding expected
   { Radio.readData(RxPkt->Data, PktLen);                                 // get packet into the Data
@@ -364,9 +415,13 @@ static int Radio_Receive(uint8_t PktLen, int Manch, uint8_t SysID, uint8_t Chann
 #endif
   RxPkt->Bytes   = PktLen;                                               // [bytes] actual packet size
   RxPkt->SysID   = SysID;                                                // Radio-system-ID
+  uint8_t RxSysID = SysID;
   SysID = RxPkt->DecodeSysID();
   uint8_t ManchErr=RxPkt->ErrCount();
-  if(SysID>=8 || ManchErr>=16) return 0;
+  float RSSI = -0.5f*RxPkt->RSSI;                                        // [dBm]
+  Radio_Event(RF_Trace::Read, SysID>=8 || ManchErr>=16 ? 0xFF:SysID, RxPkt->RSSI);
+  if(SysID>=8 || ManchErr>=16)
+  { Radio_Stats.addRx(Channel, RxSysID, RSSI, millis()/1000, 1); return 0; } // count as failed for the system we listen to
 #ifdef DEBUG_PRINT
   if(xSemaphoreTake(CONS_Mutex, 20))
   { Serial.printf("RadioRx: %5.3fs [#%d:%d:%2d:%c%d] %+4.1fdBm ",
@@ -378,7 +433,9 @@ static int Radio_Receive(uint8_t PktLen, int Manch, uint8_t SysID, uint8_t Chann
       Serial.printf(" %c%c\n", FNT_TxFIFO.isCorrupt()?'!':'_', PAW_TxFIFO.isCorrupt()?'!':'_');
     xSemaphoreGive(CONS_Mutex); }
 #endif
-  FSK_RxFIFO.Write();                                                    // complete the write into the queue of received packets
+  Radio_Stats.addRx(Channel, SysID, RSSI, millis()/1000);                // before the packet is queued: vTaskPROC adds the decode result
+  if(!FSK_RxFIFO.Write()) Radio_Event(RF_Trace::FIFOfull, 0);            // complete the write into the queue of received packets
+  PROC_Notify(PROCevt_RxPacket);                                         // wake up vTaskPROC to decode it
   if(SysID<8) Radio_RxCount[SysID]++;
   return 1; }
 
@@ -397,20 +454,21 @@ static int Radio_Receive(uint32_t msTimeLen, uint8_t PktLen, bool Manch, uint8_t
 { uint32_t msStart = millis();                                     // [ms] start of the slot
   int PktCount=0;
   for( ; ; )
-  { vTaskDelay(1);                                                 // wait 1ms
-    PktCount+=Radio_Receive(PktLen, Manch, SysID, Channel, TimeRef);   // check if a packet has been received
-    uint32_t msTime = millis()-msStart;                            // [ms] time since start
-    if(msTime>=msTimeLen) break; }                                 // [ms] when reached the requesten time length then stop
-  Radio_BkgRSSI+=Radio_BkgUpdate*(Radio_liveRSSI()-Radio_BkgRSSI); // [dBm] measure the noise level at the end of the slot and average
+  { uint32_t msTime = millis()-msStart;                            // [ms] time since start
+    if(msTime>=msTimeLen) break;                                   // [ms] when reached the requesten time length then stop
+    if(Radio_WaitIRQ(msTimeLen-msTime))                            // sleep till a packet arrives or the time runs out
+      PktCount+=Radio_Receive(PktLen, Manch, SysID, Channel, TimeRef); } // read the packet
+  float Noise=Radio_liveRSSI();                                    // [dBm] measure the noise level at the end of the slot
+  Radio_BkgRSSI+=Radio_BkgUpdate*(Noise-Radio_BkgRSSI);            // and average
+  Radio_Stats.addNoise(Channel, SysID, Noise, millis()/1000);
   return PktCount; }                                               // return number of received packets
 
 // =======================================================================================================
 
 // TX/RX slot for a Manchester-encoded protocol
-static int Radio_Slot(uint8_t TxChannel, float TxPower, uint32_t msTimeLen, const uint8_t *TxPacket, uint8_t TxSysID,
+static int Radio_Slot(uint8_t TxChannel, float TxPower, uint32_t msTimeLen, const FSK_TxFrame *TxFrame, uint8_t TxSysID,
                       uint8_t RxChannel, uint8_t RxSysID, TimeSync &TimeRef)
-{ bool TxManch = TxSysID<4;
-  bool RxManch = RxSysID<4 || RxSysID>=8;
+{ bool RxManch = RxSysID<4 || RxSysID>=8;
   uint8_t TxPktLen;
   uint8_t RxPktLen;
   const uint8_t *TxSYNC;
@@ -418,31 +476,36 @@ static int Radio_Slot(uint8_t TxChannel, float TxPower, uint32_t msTimeLen, cons
   int TxSyncLen = FSK_RxPacket::SysSYNC(TxSYNC, TxPktLen, TxSysID);
   int RxSyncLen = FSK_RxPacket::SysSYNC(RxSYNC, RxPktLen, RxSysID);
   if(TxSyncLen<=0 || RxSyncLen<=0) return 0;
-  if(RxSysID==Radio_SysID_LDR) RxPktLen+=7;                         // a hack
+  if(RxSysID==Radio_SysID_LDR) RxPktLen+=9;                         // a hack: 6 bytes of SYNC, CRC and 2 bytes for the offset search
   bool SameChan = TxChannel==RxChannel;
   float TxFreq = 1e-6*Radio_FreqPlan.getChanFrequency(TxChannel);   // Frequency for transmission
   float RxFreq = 1e-6*Radio_FreqPlan.getChanFrequency(RxChannel);   // Frequency for reception
 #ifdef DEBUG_PRINT
   if(xSemaphoreTake(CONS_Mutex, 20))
   { Serial.printf("Radio_Slot: %dms, %s, Tx:%s:%d:%5.1fMHz:%1.0fdBm, Rx:%s:%d:%5.1fMHz\n",
-              msTimeLen, TxPacket?"RX/TX":"RX/--",
+              msTimeLen, TxFrame?"RX/TX":"RX/--",
               FSK_RxPacket::SysName(TxSysID), TxPktLen, TxFreq, TxPower,
               FSK_RxPacket::SysName(RxSysID), RxPktLen, RxFreq);
     xSemaphoreGive(CONS_Mutex); }
 #endif
   int PktCount=0;
   uint32_t msStart = millis();                                      // note then slot starts
+  Radio_Event(RF_Trace::Slot, RxChannel, RxSysID | (uint16_t)(TxFrame && TxFrame->Len ? TxSysID:0xFF)<<8);
   Radio.standby();
-  if(RxManch) Radio_ConfigManchFSK(RxPktLen, 1, RxSYNC, RxSyncLen); // configure for reception
-         else Radio_ConfigLDR     (RxPktLen, 1, RxSYNC, RxSyncLen);
+  Radio_Event(RF_Trace::ConfigStart, RxSysID, 0);
+  Radio_ConfigFSK(Radio_Profile[1][RxSysID]);                       // configure for reception
   Radio_setFrequency(RxFreq);                                       // set frequency
 #ifdef WITH_SX1276
   // Radio.setAFC(0);                                               // enable AFC
 #endif
+  Radio_Event(RF_Trace::ConfigEnd, RxSysID, 0);
   Radio.startReceive();                                             // start receiving
+  Radio_Event(RF_Trace::RxStart, RxChannel, RxSysID);
   XorShift64(Random.Word);                                          // randomize
-  // if(!TxManch) TxPacket=0; // for debug
-  if(TxPacket)                                                      // if there is packet to be sent out
+  if(TxFrame && TxFrame->Len==0) TxFrame=0;                         // empty frame: nothing to transmit
+  uint8_t TxBand = TxSysID==Radio_SysID_LDR ? DutyCycle::Band_O : DutyCycle::Band_M;
+  if(TxFrame && !Radio_Duty.mayTx(TxBand, TxFrame->usTime, msStart/1000)) TxFrame=0; // would exceed the duty-cycle: receive only
+  if(TxFrame)                                                       // if there is packet to be sent out
   { int TxTime;
     if(SameChan) { TxTime = 20+Random.RX%(msTimeLen-200); }
             else { TxTime = 25+Random.RX%(msTimeLen-50); }          // random time to wait before transmission
@@ -454,36 +517,42 @@ static int Radio_Slot(uint8_t TxChannel, float TxPower, uint32_t msTimeLen, cons
       float RSSI=Radio_liveRSSI(); Random.RX+=RSSI;                 // [dBm] Live RSSI
       if(RSSI<Radio_BkgRSSI+TxThres)                                // if RSSI lower than 10dB(+) above average
       { Radio_BkgRSSI+=Radio_BkgUpdate*(RSSI-Radio_BkgRSSI); break; } //then go for transmission
+      Radio_Stats.addLBT(TxChannel, TxSysID, millis()/1000);        // count the deferral
+      Radio_Event(RF_Trace::LBT, TxChannel, (uint16_t)floorf(-2*RSSI+0.5f));
       XorShift64(Random.Word);                                      // but if higher than
       TxTime = 10+Random.RX%19;                                     // wait for a random time
       PktCount+=Radio_Receive(TxTime, RxPktLen, RxManch, RxSysID, RxChannel, TimeRef); // and keep listen a bit more
       TxThres+=3; }
 // #endif
     Radio.standby();
-    if(TxManch) Radio_ConfigManchFSK(TxPktLen, 0, TxSYNC, TxSyncLen); // configure for transmission
-           else Radio_ConfigLDR   (TxPktLen+7, 0, TxSYNC, TxSyncLen);
+    Radio_Event(RF_Trace::ConfigStart, TxSysID, 1);
+    Radio_ConfigFSK(Radio_Profile[0][TxSysID]);                     // configure for transmission
     Radio_setTxPower(TxPower);
     Radio_setFrequency(TxFreq);                         // set frequency
-    if(TxManch) Radio_TxManchFSK(TxPacket, TxPktLen);                 // transmit the packet
-           else Radio_TxLDR     (TxPacket, TxPktLen);
+    Radio_Event(RF_Trace::ConfigEnd, TxSysID, 1);
+    Radio_TxFrame(*TxFrame, TxBand);                                // transmit the packet: already encoded by the producer
     Radio_TxCount[TxSysID]++;
     Radio.standby();
-    if(RxManch) Radio_ConfigManchFSK(RxPktLen, 1, RxSYNC, RxSyncLen); // configure for reception
-           else Radio_ConfigLDR     (RxPktLen, 1, RxSYNC, RxSyncLen);
+    Radio_Event(RF_Trace::ConfigStart, RxSysID, 0);
+    Radio_ConfigFSK(Radio_Profile[1][RxSysID]);                     // configure for reception
     Radio_setFrequency(RxFreq);                          // set frequency
 #ifdef WITH_SX1276
     // Radio.setAFC(0);                                                // enable AFC
 #endif
-    Radio.startReceive(); }                                            // start receiving again
+    Radio_Event(RF_Trace::ConfigEnd, RxSysID, 0);
+    Radio.startReceive();                                              // start receiving again
+    Radio_Event(RF_Trace::RxStart, RxChannel, RxSysID); }
   uint32_t msTime = millis()-msStart;                                  // keep receiving till the end of slot
   if(msTime<msTimeLen) PktCount+=Radio_Receive(msTimeLen-msTime, RxPktLen, RxManch, RxSysID, RxChannel, TimeRef);
   Radio.standby();
+  Radio_Event(RF_Trace::SlotEnd, RxChannel, PktCount);
   return PktCount; }
 
 // =======================================================================================================
 
 static int Radio_ConfigHDR(const uint8_t *SYNC=OBAND_SYNC, uint8_t SYNClen=2) // Radio setup for O-band ADS-L HDR
 { int ErrState=0; int State=0;
+  Radio_InvalidateShadow();                                         // this setup is not tracked by the shadow
 #ifdef WITH_SX1276
   State=Radio.setActiveModem(RADIOLIB_SX127X_FSK_OOK);
 #endif
@@ -527,7 +596,7 @@ static int Radio_ConfigHDR(const uint8_t *SYNC=OBAND_SYNC, uint8_t SYNClen=2) //
   return ErrState; }                                                // this call takes 18-19 ms
 
 static int Radio_TxOBAND(uint8_t *Packet, uint8_t Len)              // transmit a packet on the O-Band
-{ return Radio_TxFSK(Packet, Len); }
+{ return Radio_TxFSK(Packet, Len, DutyCycle::Band_O); }
 
 // =======================================================================================================
 
@@ -535,7 +604,8 @@ static int Radio_TxOBAND(uint8_t *Packet, uint8_t Len)              // transmit
 
 static int Radio_FANETrxPacket(TimeSync &TimeRef)                  // attemp to receive FANET packet
 { if(!Radio_IRQ()) return 0;
-  uint32_t msTime = millis();                                      // [ms] current system time
+  Radio_Trace.Add(Radio_Intr_usTime, RF_Trace::IRQ);
+  uint32_t msTime = Radio_IntrTime();                              // [ms] system time of the packet end
   // LED_Flash(10);
   // LED_OGN_Flash(10);
   FANET_RxPacket *RxPkt = FNT_RxFIFO.getWrite();                   // get space in the queue for the new packet
@@ -557,35 +627,42 @@ static int Radio_FANETrxPacket(TimeSync &TimeRef)                  // attemp to
   RxPkt->FreqOfs = floorf(0.1*FreqOfs+0.5);
   RxPkt->SNR     = floorf(SNR*4+0.5);
   RxPkt->RSSI    = floorf(RSSI+0.5);
-  FNT_RxFIFO.Write();
+  Radio_Event(RF_Trace::Read, RxPkt->badCRC ? 0xFF:Radio_SysID_FNT, (uint16_t)floorf(-2*RSSI+0.5f));
+  if(!FNT_RxFIFO.Write()) Radio_Event(RF_Trace::FIFOfull, 1);
   Radio_RxCount[Radio_SysID_FNT]++;
+  Radio_Stats.addRx(0, Radio_SysID_FNT, RSSI, millis()/1000, RxPkt->badCRC); // FANET sits on channel #0 frequency
+  if(!RxPkt->badCRC) Radio_Stats.addDecode(0, Radio_SysID_FNT, 0);
   return 1; }
 
 static int Radio_RxFANET(uint32_t msTimeLen, TimeSync &TimeRef)    // FANET reception slot
 { uint32_t msStart = millis();                                     // [ms] start of the slot
   int PktCount=0;
   for( ; ; )
-  { vTaskDelay(1);                                                 // wait 1ms
-    PktCount+=Radio_FANETrxPacket(TimeRef);                        // check if a packet has been received
-    uint32_t msTime = millis()-msStart;                            // [ms] time since start
-    if(msTime>=msTimeLen) break; }                                 // [ms] when reached the requesten time length then stop
+  { uint32_t msTime = millis()-msStart;                            // [ms] time since start
+    if(msTime>=msTimeLen) break;                                   // [ms] when reached the requesten time length then stop
+    if(Radio_WaitIRQ(msTimeLen-msTime))                            // sleep till a packet arrives or the time runs out
+      PktCount+=Radio_FANETrxPacket(TimeRef); }                    // read the packet
 #ifdef WITH_SX1262
-  Radio_BkgRSSI += Radio_BkgUpdate*(Radio.getRSSI(false)-Radio_BkgRSSI);      // [dBm] measure the noise level at the end of the slot and average
+  float Noise = Radio.getRSSI(false);                              // [dBm] measure the noise level at the end of the slot
 #endif
 #ifdef WITH_SX1276
-  Radio_BkgRSSI += Radio_BkgUpdate*(Radio.getRSSI(false, true)-Radio_BkgRSSI); // [dBm] measure the noise level at the end of the slot and average
+  float Noise = Radio.getRSSI(false, true);                        // [dBm] measure the noise level at the end of the slot
 #endif
+  Radio_BkgRSSI += Radio_BkgUpdate*(Noise-Radio_BkgRSSI);          // and average
+  Radio_Stats.addNoise(0, Radio_SysID_FNT, Noise, millis()/1000);
   return PktCount; }                                               // return nuber of packets received
 
 static void Radio_TxFANET(FANET_Packet &Packet)                    // transmit a FANET packet
 { // Serial.printf("FNT Tx[%d] %06X\n", Packet.Len, Packet.getAddr());
+  Radio_Event(RF_Trace::TxStart, DutyCycle::Band_FNT, Packet.Len);
   Radio.transmit(Packet.Byte, Packet.Len); Packet.Done=1;          // not clear, if we should wait here for the transmission to complete ?
   uint32_t usTxTime=Radio.getTimeOnAir(Packet.Len);                // [usec]
-  Radio_TxCredit-=usTxTime/1000;
+  Radio_Duty.Charge(DutyCycle::Band_FNT, usTxTime, millis()/1000);
+  Radio_Event(RF_Trace::TxEnd, DutyCycle::Band_FNT);
   Radio_TxCount[Radio_SysID_FNT]++; }
 
 static void Radio_ConfigFANET(uint8_t CRa=4)                       // setup Radio for FANET
-{                                                                  // first swith to LoRa mode
+{ Radio_InvalidateShadow();                                        // first swith to LoRa mode
 #ifdef WITH_SX1262
   if(Radio.getPacketType()!=RADIOLIB_SX126X_PACKET_TYPE_LORA)
     Radio.config(RADIOLIB_SX126X_PACKET_TYPE_LORA);
@@ -616,12 +693,17 @@ static void Radio_ConfigFANET(uint8_t CRa=4)                       // setup Radi
 static int Radio_FANETslot(float Freq, float TxPower, uint32_t msTimeLen, FANET_Packet *TxPacket, TimeSync &TimeRef)
 { // Serial.printf("FANET Slot: %6.3fMHz %dms %c\n", 1e-6*Freq, msTimeLen, TxPacket?'T':'r');
   uint32_t msStart = millis();                       // [ms]
+  Radio_Event(RF_Trace::Slot, 0, Radio_SysID_FNT | (uint16_t)(TxPacket ? Radio_SysID_FNT:0xFF)<<8);
   Radio.standby();
+  Radio_Event(RF_Trace::ConfigStart, Radio_SysID_FNT, 0);
   Radio_ConfigFANET();                               // setup for FANET, includes switching from FSK to LoRa
   Radio_setFrequency(Freq);                          // set frequency
+  Radio_Event(RF_Trace::ConfigEnd, Radio_SysID_FNT, 0);
   Radio.startReceive();                              // start receiving
+  Radio_Event(RF_Trace::RxStart, 0, Radio_SysID_FNT);
   XorShift64(Random.Word);                           // randomize
   int PktCount=0;
+  if(TxPacket && !Radio_Duty.mayTx(DutyCycle::Band_FNT, Radio.getTimeOnAir(TxPacket->Len), msStart/1000)) TxPacket=0;
   if(TxPacket)
   { uint32_t TxTime = 5;
     if(msTimeLen>35) TxTime+=Random.RX%(msTimeLen-35);   // random transmission time
@@ -638,6 +720,7 @@ static int Radio_FANETslot(float Freq, float TxPower, uint32_t msTimeLen, FANET_
   { uint32_t msTime = millis()-msStart;
     if(msTime<msTimeLen) PktCount+=Radio_RxFANET(msTimeLen-msTime, TimeRef); }
   Radio.standby();
+  Radio_Event(RF_Trace::SlotEnd, 0, PktCount);
   return PktCount; }                                 // return number of received packets
 
 #endif // WITH_FANET
@@ -652,17 +735,19 @@ LoRaWANnode WANdev;
 
 static void Radio_TxLoRaWAN(uint8_t *Packet, uint8_t PktLen)
 { // Serial.printf("WAN Tx[%d]\n", PktLen);
-  Radio.transmit(Packet, PktLen); }
+  Radio_Event(RF_Trace::TxStart, DutyCycle::Band_M, PktLen);
+  Radio.transmit(Packet, PktLen);
+  Radio_Event(RF_Trace::TxEnd, DutyCycle::Band_M);
+  Radio_Duty.Charge(DutyCycle::Band_M, Radio.getTimeOnAir(PktLen), millis()/1000); }
 
 static int Radio_RxLoRaWAN(uint8_t *Packet, uint8_t MaxPktLen, uint32_t msTimeLen, float *RSSI=0, float *SNR=0, float *FreqOfs=0)
 { uint32_t msStart=millis();
   // Serial.printf("RxLoRaWAN(%dms)\n", msTimeLen);
   Radio.startReceive();                             // start receiving
   for( ; ; )
-  { vTaskDelay(1);
-    uint32_t msTime = millis()-msStart;             // [ms] time since start
+  { uint32_t msTime = millis()-msStart;             // [ms] time since start
     if(msTime>=msTimeLen) break;                    // [ms] when reached the requesten time length then stop
-    if(Radio_IRQ()) break; }                        // break, when packet arrives
+    if(Radio_WaitIRQ(msTimeLen-msTime)) break; }    // break, when packet arrives
   if(!Radio_IRQ()) return 0;
   int PktLen    = Radio.getPacketLength();          // [bytes]
   // Serial.printf("RxLoRaWAN: [%d]\n", PktLen);
@@ -674,7 +759,7 @@ static int Radio_RxLoRaWAN(uint8_t *Packet, uint8_t MaxPktLen, uint32_t msTimeLe
   return PktLen; }
 
 static void Radio_ConfigLoRaWAN(uint8_t Chan, bool TX, float TxPower, uint8_t CRa=4)
-{
+{ Radio_InvalidateShadow();                    // switch to LoRa mode
 #ifdef WITH_SX1262
   if(Radio.getPacketType()!=RADIOLIB_SX126X_PACKET_TYPE_LORA)
     Radio.config(RADIOLIB_SX126X_PACKET_TYPE_LORA);
@@ -718,7 +803,9 @@ template <class Type>
 
 void Radio_Task(void *Parms)
 {
-
+  Radio_Stats.Clear();
+  Radio_Duty.Clear();
+  Radio_Trace.Clear();
   Radio_FreqPlan.setPlan(Parameters.FreqPlan);
 
 #ifdef WITH_LORAWAN
@@ -785,6 +872,10 @@ void Radio_Task(void *Parms)
   Radio.setDio2AsRfSwitch();
   // Radio.setDio1Action(IRQcall);
 #endif
+  Radio_InvalidateShadow();                              // the FSK setup is not known yet
+  Radio_TaskHandle = xTaskGetCurrentTaskHandle();        // for the IRQ interrupt to wake us up
+  attachInterrupt(digitalPinToInterrupt(Radio_IntrPin), Radio_Intr, RISING);
+  Radio_InitProfiles();                                  // precompute the FSK setups for all systems
 
   TimeSync &TimeRef = GPS_TimeSync;
   char Line[160];
@@ -796,6 +887,7 @@ void Radio_Task(void *Parms)
 
   for( ; ; )
   { if(!HardwareStatus.Radio) { delay(1000); continue; }
+    Radio_Duty.Update(Radio_FreqPlan.Plan<=1, millis()/1000);    // duty-cycle limits only in Europe/Africa
 
     int PktCount=0;
     // char Line[120];
@@ -814,15 +906,20 @@ void Radio_Task(void *Parms)
 #ifdef WITH_FANET
     uint32_t FreqFNT = Radio_FreqPlan.getFreqFANET();           // frequency to transmit FANET
     if(FreqFNT)
-    { Radio_ConfigFANET();
+    { Radio_Event(RF_Trace::Slot, 0, Radio_SysID_FNT | 0xFF00);
+      Radio_Event(RF_Trace::ConfigStart, Radio_SysID_FNT, 0);
+      Radio_ConfigFANET();
       Radio_setFrequency(1e-6*FreqFNT);
+      Radio_Event(RF_Trace::ConfigEnd, Radio_SysID_FNT, 0);
       Radio.startReceive();                                      // start receiving FANET
+      Radio_Event(RF_Trace::RxStart, 0, Radio_SysID_FNT);
       for( ; ; )
       { PktCount+=Radio_FANETrxPacket(TimeRef);                  // any packet received ?
         if(FNT_TxFIFO.Full()) break;                             // when FANET packet to transmit, then stop this loop
         msTime = TimeRef.getFracTime(millis());
         if(msTime>=400) break;
-        vTaskDelay(1); }
+        uint32_t msWait = 400-msTime; if(msWait>5) msWait=5;     // check the FANET TX queue every 5ms
+        Radio_WaitIRQ(msWait); }                                 // but wake up right away when a packet arrives
       FANET_Packet *FNTpacket = FNT_TxFIFO.getRead();            // get the FANET packet to transmit
       if(FNTpacket) FNT_TxFIFO.Read();
       XorShift64(Random.Word);
@@ -847,72 +944,32 @@ void Radio_Task(void *Parms)
     //   xSemaphoreGive(CONS_Mutex); }
 
 #ifdef WITH_PAW
-    PAW_Packet *PawPacket = PAW_TxFIFO.getRead();
+    PAW_TxFrame *PawPacket = PAW_TxFIFO.getRead();
     uint32_t FreqPAW = Radio_FreqPlan.getFreqOBAND();
-    if(PawPacket && FreqPAW)                         // if there is a packet to be transmitted and the frequency plan allows it
+    if(PawPacket && FreqPAW && Radio_Duty.mayTx(DutyCycle::Band_O, PawPacket->LDR.usTime, millis()/1000)) // if there is a packet to be transmitted, the frequency plan and duty-cycle allow it
     { Radio.standby();
       int Ret=Radio_ConfigLDR();
       Radio_setFrequency(1e-6*FreqPAW);
       Radio_setTxPower(Parameters.TxPower+13);       // we can transmit PAW with higher power
       // Serial.printf("TxPAW: Freq:%7.3fMHz/%ddBm (%d) [%X:%X:%08X]\n",
       //          1e-6*FreqPAW, Parameters.TxPower+13, Ret, (int)PAW_TxFIFO.ReadPtr, (int)PAW_TxFIFO.WritePtr, (int)PawPacket);
-      Radio_TxPAW(*PawPacket); }
+      Radio_TxFrame(PawPacket->LDR, DutyCycle::Band_O); }
     if(PawPacket) PAW_TxFIFO.Read();
 #endif
-    const OGN_TxPacket<OGN_Packet> *OgnPacket1 = OGN_TxFIFO.getRead();   // 1st OGN packet (possibly NULL)
-    //const OGN_TxPacket<OGN_Packet> *OgnPacket1 = NULL;   // disable OGN
+    const OGN_TxFrame *OgnPacket1 = OGN_TxFIFO.getRead();                // 1st OGN packet (possibly NULL)
+    //const OGN_TxFrame *OgnPacket1 = NULL;   // disable OGN
     if(OgnPacket1) OGN_TxFIFO.Read();
-    const OGN_TxPacket<OGN_Packet> *OgnPacket2 = OGN_TxFIFO.getRead();   // 2nd OGN packet (possibly NULL)
-    //const OGN_TxPacket<OGN_Packet> *OgnPacket2 = NULL;   // disable OGN
+    const OGN_TxFrame *OgnPacket2 = OGN_TxFIFO.getRead();                // 2nd OGN packet (possibly NULL)
+    //const OGN_TxFrame *OgnPacket2 = NULL;   // disable OGN
     if(OgnPacket2) { OGN_TxFIFO.Read(); if(Random.RX&4) Swap(OgnPacket1, OgnPacket2); }  // randomly swap
               else { OgnPacket2=OgnPacket1; }                                            // or 2nd = 1st
 
-    const ADSL_Packet *AdslPacket1 = ADSL_TxFIFO.getRead();              // 1st ADS-L packet (possibly empty)
+    const ADSL_TxFrame *AdslPacket1 = ADSL_TxFIFO.getRead();             // 1st ADS-L packet (possibly empty)
     if(AdslPacket1) ADSL_TxFIFO.Read();
-    const ADSL_Packet *AdslPacket2 = ADSL_TxFIFO.getRead();              // 2nd ADS-L packet (posisbly empty)
+    const ADSL_TxFrame *AdslPacket2 = ADSL_TxFIFO.getRead();             // 2nd ADS-L packet (posisbly empty)
     if(AdslPacket2) { ADSL_TxFIFO.Read(); if(Random.RX&8) Swap(AdslPacket1, AdslPacket2); } // randomly swap
                else { AdslPacket2=AdslPacket1; }
 
-    bool EU = Radio_FreqPlan.Plan<=1;
-
-    uint32_t Hash = TimeRef.UTC;
-    XorShift32(Hash);
-    Hash *= 48271;
-    XorShift32(Hash);
-    Hash *= 48271;
-
-    const uint8_t *OGN_Pkt  = OgnPacket1  ? OgnPacket1->Byte()      : 0;
-    const uint8_t *ADSL_Pkt = AdslPacket1 ? &(AdslPacket1->Version) : 0;
-    int8_t  TxPwr = Parameters.TxPower;
-    uint8_t TxProt = Radio_SysID_OGN;
-    uint8_t RxProt = Radio_SysID_OGN_ADSL;
-    const uint8_t *TxPkt = 0;
-    bool    Odd=0;
-    uint8_t TxChan=0;
-    uint8_t FLR_Chan  = Radio_FreqPlan.getChannel(TimeRef.UTC, 0, 0);
-    uint8_t OGN_Chan  = Radio_FreqPlan.getChannel(TimeRef.UTC, 0, 1);
-    if(EU)
-    { TxChan = Hash%3;
-           if(TxChan==FLR_Chan) { TxPkt=ADSL_Pkt; TxProt=Radio_SysID_ADSL; RxProt=Radio_SysID_FLR_ADSL; }
-      else if(TxChan==OGN_Chan) { TxPkt=OGN_Pkt; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_OGN_ADSL; }
-      else           { TxPwr+=13; TxPkt=ADSL_Pkt; TxProt=Radio_SysID_LDR; RxProt=Radio_SysID_LDR; }
-    }
-    else
-    { Odd = Count1s(Hash)&1;
-      TxPwr+=13; TxPkt=OGN_Pkt;
-      if(Odd) { TxChan=FLR_Chan; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_FLR; }
-         else { TxChan=OGN_Chan; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_OGN; }
-    }
-
-    msTime = millis()-TimeRef.sysTime;                // [ms] time since PPS
-    uint32_t SlotLen = 800-msTime;
-         if(SlotLen<250) SlotLen=250;
-    else if(SlotLen>480) SlotLen=480;
-
-    PktCount+=Radio_Slot(TxChan, TxPwr, SlotLen, TxPkt, TxProt, TxChan, RxProt, TimeRef);
-
-    msTime = millis()-TimeRef.sysTime;                // [ms] time since PPS
-    SlotLen = 1200-msTime;
 #ifdef WITH_LORAWAN
     static uint8_t WAN_RxPacket[64];                  //
     static uint32_t WAN_RespTick=0;                   // [msec]
@@ -921,37 +978,26 @@ void Radio_Task(void *Parms)
     if(WAN_BackOff) WAN_BackOff--;
     else if(WANdev.Enable && Parameters.TxWAN && Radio_FreqPlan.Plan<=1) // decide to transmit in this slot
     { if(WANdev.State==0 || WANdev.State==2) WANtx=1; } //
-    if(WANtx) SlotLen = 1150-msTime;                    // if decision to transmit then stop the time slot a bit earlier
-    else if(WANdev.State==1 || WANdev.State==3)         // if waiting for a reply
-    { int32_t RespLeft = WAN_RespTick-millis();         // and the reply time getting close
-      if(RespLeft>0 && RespLeft<1000) SlotLen=RespLeft-40; } // then adjust the time slot to be there in time
 #endif
 
-    OGN_Pkt  = OgnPacket2  ? OgnPacket2->Byte()      : 0;
-    ADSL_Pkt = AdslPacket2 ? &(AdslPacket2->Version) : 0;
-    TxPwr = Parameters.TxPower;
-    TxProt = Radio_SysID_OGN;
-    RxProt = Radio_SysID_OGN_ADSL;
-    TxPkt = 0;
-    FLR_Chan  = Radio_FreqPlan.getChannel(TimeRef.UTC, 1, 0);
-    OGN_Chan  = Radio_FreqPlan.getChannel(TimeRef.UTC, 1, 1);
-    if(EU)
-    { if(TxChan==2) TxChan=0;
-           if(TxChan==FLR_Chan) { TxPkt=ADSL_Pkt; TxProt=Radio_SysID_ADSL; RxProt=Radio_SysID_FLR_ADSL; }
-      else if(TxChan==OGN_Chan) { TxPkt=OGN_Pkt; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_OGN_ADSL; }
-      else           { TxPwr+=13; TxPkt=ADSL_Pkt; TxProt=Radio_SysID_LDR; RxProt=Radio_SysID_LDR; }
-    }
-    else
-    { Odd = !Odd;
-      TxPwr+=13; TxPkt=OGN_Pkt;
-      if(Odd) { TxChan=FLR_Chan; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_FLR; }
-         else { TxChan=OGN_Chan; TxProt=Radio_SysID_OGN; RxProt=Radio_SysID_OGN; }
-    }
-
-         if(SlotLen<250) SlotLen=250;
-    else if(SlotLen>480) SlotLen=480;
-
-    PktCount+=Radio_Slot(TxChan, TxPwr, SlotLen, TxPkt, TxProt, TxChan, RxProt, TimeRef);
+    const Radio_SlotRule *SlotRule = Radio_SlotPlan::get(Radio_FreqPlan.Plan).getVariant(TimeRef.UTC); // the half-slots for this second
+    for(uint8_t Slot=0; Slot<Radio_HalfSlots; Slot++)
+    { const Radio_SlotRule &Rule = SlotRule[Slot];
+      const FSK_TxFrame *TxPkt = Radio_SlotFrame(Rule.TxSysID, Slot ? OgnPacket2:OgnPacket1, Slot ? AdslPacket2:AdslPacket1);
+      uint8_t Chan = Rule.getChannel(Radio_FreqPlan, TimeRef.UTC, Slot);
+      msTime = millis()-TimeRef.sysTime;              // [ms] time since PPS
+      uint32_t SlotLen = Rule.msEnd-msTime;
+#ifdef WITH_LORAWAN
+      if(Slot==Radio_HalfSlots-1)
+      { if(WANtx) SlotLen = Rule.msEnd-50-msTime;       // if decision to transmit then stop the time slot a bit earlier
+        else if(WANdev.State==1 || WANdev.State==3)     // if waiting for a reply
+        { int32_t RespLeft = WAN_RespTick-millis();     // and the reply time getting close
+          if(RespLeft>0 && RespLeft<1000) SlotLen=RespLeft-40; } // then adjust the time slot to be there in time
+      }
+#endif
+           if(SlotLen<Rule.msMinLen()) SlotLen=Rule.msMinLen();
+      else if(SlotLen>Rule.msMaxLen()) SlotLen=Rule.msMaxLen();
+      PktCount+=Radio_Slot(Chan, Parameters.TxPower+Rule.TxPwr, SlotLen, TxPkt, Rule.TxSysID, Chan, Rule.RxSysID, TimeRef); }
 
 #ifdef WITH_SX1276
     Radio_ChipTemperature = Radio.getTempRaw()+Parameters.RFchipTempCorr;
@@ -961,7 +1007,9 @@ void Radio_Task(void *Parms)
     if(WANtx)
     { XorShift64(Random.Word);                                        // random
       WANdev.Chan = Random.RX&7;                                      // choose random channel
+      Radio_Event(RF_Trace::ConfigStart, RF_Trace::SysWAN, 1);
       Radio_ConfigLoRaWAN(WANdev.Chan, 1, Parameters.TxPower);        // setup for LoRaWAN on given channel
+      Radio_Event(RF_Trace::ConfigEnd, RF_Trace::SysWAN, 1);
       int RespDelay=0;
       int TxPktLen=0;
       if(WANdev.State==0)                                             // if not joined yet
@@ -1006,13 +1054,16 @@ void Radio_Task(void *Parms)
     }
     if(WANrx)                                              // if reception expected from WAN
     { int RxLen=0;
+      Radio_Event(RF_Trace::ConfigStart, RF_Trace::SysWAN, 0);
       Radio_ConfigLoRaWAN(WANdev.Chan, 0, Parameters.TxPower);  // configure for reception
+      Radio_Event(RF_Trace::ConfigEnd, RF_Trace::SysWAN, 0);
       uint32_t Time=millis();
       // Serial.printf("%5.3fs WAN Rx wait %dms\n", 1e-3*Time, WAN_RespTick-Time);
       // int msMaxTime=(WAN_RespTick-Time) + (Radio.getTimeOnAir(64)/1000) + 50;              // [ms] max-time to wait for the response
       int msMaxTime=(WAN_RespTick-Time) + 120;
       float RSSI=0; float SNR=0; float FreqOfs=0;
       RxLen=Radio_RxLoRaWAN(WAN_RxPacket, 64, msMaxTime, &RSSI, &SNR, &FreqOfs);
+      Radio_Event(RF_Trace::WANrx, WANdev.Chan, RxLen>0 ? RxLen:0);
       // assume nothing received for now
       if(RxLen>0)
       { WANdev.RxCount++;
@@ -1030,17 +1081,18 @@ void Radio_Task(void *Parms)
 #endif
 
     Radio_PktRate += Radio_PktUpdate*(PktCount-Radio_PktRate);
-    Radio_TxCredit+= 10;                                // [ms]
-    if(Radio_TxCredit>60000) Radio_TxCredit=60000;
 
     static uint32_t PktCountSum=0;
     PktCountSum += PktCount;
     if(TimeRef.UTC%10!=5) continue; // only print every 10sec
+    char TxLeft[16];                                     // on-air time left in the M-band, none where there is no limit
+    if(Radio_Duty.Band[DutyCycle::Band_M].Limit) sprintf(TxLeft, "%3.1fs", 1e-6*Radio_Duty.Band[DutyCycle::Band_M].getLeft());
+                                           else strcpy(TxLeft, "unlimited");
     int LineLen=sprintf(Line,
-     "Radio: Tx: %d:%d:%d:%d:%d:%d:%d  Rx: %d:%d:%d:%d:%d:%d:%d  %3.1fdBm %d pkts %3.1f pkt/s %3.1fs [%d]",
+     "Radio: Tx: %d:%d:%d:%d:%d:%d:%d  Rx: %d:%d:%d:%d:%d:%d:%d  %3.1fdBm %d pkts %3.1f pkt/s %s [%d]",
        Radio_TxCount[0], Radio_TxCount[1], Radio_TxCount[2], Radio_TxCount[3], Radio_TxCount[4], Radio_TxCount[5], Radio_TxCount[6],
        Radio_RxCount[0], Radio_RxCount[1], Radio_RxCount[2], Radio_RxCount[3], Radio_RxCount[4], Radio_RxCount[5], Radio_RxCount[6],
-       Radio_BkgRSSI, PktCountSum, Radio_PktRate, 0.001*Radio_TxCredit,
+       Radio_BkgRSSI, PktCountSum, Radio_PktRate, TxLeft,
        uxTaskGetStackHighWaterMark(NULL));
              // FNT_TxFIFO.isCorrupt()?'!':'_', FNT_RxFIFO.isCorrupt()?'!':'_',
              // OGN_TxFIFO.isCorrupt()?'!':'_', ADSL_TxFIFO.isCorrupt()?'!':'_',
@@ -14,6 +14,11 @@
 #include "rx-pkt.h"
 
 #include "paw.h"
+#include "manchester.h"
+#include "rf-stats.h"
+#include "duty-cycle.h"
+#include "slot-plan.h"
+#include "rf-trace.h"
 
 /* moved to rx-pkt.h
 const uint8_t Radio_SysID_FLR  = 0;  //
@@ -30,11 +35,75 @@ const uint8_t Radio_SysID_OGN_ADSL  = 0x11; // OGN with ADS-L
 extern const char *Radio_SysName[8];
 */
 
-extern FIFO<OGN_TxPacket<OGN_Packet>, 4> OGN_TxFIFO;
-extern FIFO<ADSL_Packet,              4> ADSL_TxFIFO;
+// a packet in the form the RF chip sends it out after the SYNC: prepared by the producer, thus the RF task only bursts it out
+class FSK_TxFrame
+{ public:
+   static const uint8_t MaxBytes      = 64;
+   static const uint8_t ManchPreamble = 16;        // [bits] preamble for Manchester-encoded FLR/OGN/ADS-L
+   static const uint8_t ManchSYNClen  =  8;        // [bytes] SYNC set in the RF chip, Manchester-encoded
+   static const uint8_t LDRPreamble   = 40;        // [bits] very long preamble for PilotAware/LDR
+   static const uint8_t LDRSYNClen    =  2;        // [bytes] SYNC set in the RF chip, the remaining 6 bytes are in the frame
+
+   uint8_t  Len;                                   // [bytes] to be written into the RF chip, zero => no frame
+   uint16_t usTime;                                // [usec] time-on-air including the preamble and SYNC
+   uint8_t  Byte[MaxBytes];
+
+  public:
+   void Clear(void) { Len=0; usTime=0; }
+
+   static uint16_t usAirTime(uint16_t Bits, uint32_t BitRate) { return ((uint32_t)Bits*1000000+BitRate/2)/BitRate; } // [usec] for [bps]
+
+   void setManch(const uint8_t *Packet, uint8_t PktLen)    // FLR/OGN/ADS-L on the M-band: 100kbps Manchester
+   { Len = Manchester_Encode(Byte, Packet, PktLen);
+     usTime = usAirTime(ManchPreamble+8*(ManchSYNClen+Len), 100000); }
+
+   void setLDR(const uint8_t *Packet, uint8_t PktLen)      // PAW or ADS-L/OGN LDR on the O-band: 38.4kbps
+   { const uint8_t *SYNC; uint8_t SyncPktLen;
+     FSK_RxPacket::SysSYNC(SYNC, SyncPktLen, Radio_SysID_LDR);
+     memcpy(Byte, SYNC+LDRSYNClen, 6);                          // the remaining 6 bytes of the pre-data part
+     memcpy(Byte+6, Packet, PktLen);                            // the packet with its internal CRC already set
+     Byte[6+PktLen] = PAW_Packet::CRC8(Byte+6, PktLen);         // add the external CRC
+     Len = 6+PktLen+1;
+     usTime = usAirTime(LDRPreamble+8*(LDRSYNClen+Len), 38400); }
+
+} ;
+
+class OGN_TxFrame : public OGN_TxPacket<OGN_Packet>             // OGN packet with FEC and its on-air form
+{ public:
+   FSK_TxFrame Manch;
+
+  public:
+   OGN_TxFrame &operator = (const OGN_TxPacket<OGN_Packet> &Packet) { OGN_TxPacket<OGN_Packet>::operator = (Packet); return *this; }
+   void Encode(void) { Manch.setManch(Byte(), Bytes); }         // call after calcFEC()
+} ;
+
+class ADSL_TxFrame : public ADSL_Packet                         // ADS-L packet: the slot decides whether M-band or O-band
+{ public:
+   FSK_TxFrame Manch;
+   FSK_TxFrame LDR;
+
+  public:
+   ADSL_TxFrame &operator = (const ADSL_Packet &Packet) { ADSL_Packet::operator = (Packet); return *this; }
+   void Encode(void)                                            // call after setCRC()
+   { Manch.setManch(&Version, TxBytes-3);
+     LDR.setLDR(&Version, TxBytes-3); }
+} ;
+
+class PAW_TxFrame : public PAW_Packet                           // PilotAware packet, which could be an ADS-L !
+{ public:
+   FSK_TxFrame LDR;
+
+  public:
+   void Encode(void)
+   { if(!isADSL()) Whiten();                                    // whiten PAW packets, but not ADS-L
+     LDR.setLDR(Byte, Size); }
+} ;
+
+extern FIFO<OGN_TxFrame,              4> OGN_TxFIFO;
+extern FIFO<ADSL_TxFrame,             4> ADSL_TxFIFO;
 // extern FIFO<ADSL_RID,                 4> RID_TxFIFO;
 extern FIFO<FANET_Packet,             4> FNT_TxFIFO;
-extern FIFO<PAW_Packet,               4> PAW_TxFIFO;
+extern FIFO<PAW_TxFrame,              4> PAW_TxFIFO;
 
 extern FIFO<FSK_RxPacket,            32> FSK_RxFIFO;
 extern FIFO<FANET_RxPacket,           8> FNT_RxFIFO;
@@ -44,7 +113,9 @@ extern QueueHandle_t Radio_SlotMsg;   // to tell the Radio_Task about the new ti
 
 extern uint32_t Radio_TxCount[8];     // transmitted packet counters
 extern uint32_t Radio_RxCount[8];     // received packet counters
-extern  int32_t Radio_TxCredit;
+extern DutyCycle Radio_Duty;          // time-on-air per band over the last hour
+extern RF_Trace Radio_Trace;          // binary trace of the RF task events: slots, configs, IRQ to read-out, TX
+extern RF_Stats Radio_Stats;          // per channel and system: packet counts, RSSI and noise histograms, LBT deferrals
 extern float    Radio_BkgRSSI;        // [dBm] background noise seen by the receiver
 extern float    Radio_PktRate;        // [Hz]
 
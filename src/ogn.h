@@ -584,103 +584,7 @@ class OGN_PPM_Packet                                        // OGN packet with F
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-template<class PacketType, uint8_t Size=16>
- class Relay_PrioQueue
-{ public:
-   PacketType           Packet[Size];        // OGN packets
-   uint16_t             Sum;                 // sum of all ranks
-   uint8_t              Low, LowIdx;         // the lowest rank and the index of it
-
-  public:
-   void Clear(void)                                                           // clear (reset) the queue
-   { for(uint8_t Idx=0; Idx<Size; Idx++)                                      // clear every packet
-     { Packet[Idx].Clear(); }
-     Sum=0; Low=0; LowIdx=0; }                                                // clear the rank sum, lowest rank
-
-   PacketType * operator [](uint8_t Idx) { return Packet+Idx; }
-
-   uint8_t getNew(void)                                                       // get (index of) a free or lowest rank packet
-   { Sum-=Packet[LowIdx].Rank; Packet[LowIdx].Rank=0; Low=0; return LowIdx; } // remove old packet from the rank sum
-
-   uint8_t size(void)                                                        // count all slots with Alloc flag set
-   { uint8_t Count=0;
-     for(uint8_t Idx=0; Idx<Size; Idx++)
-     { if(Packet[Idx].Alloc) Count++; }
-     return Count; }
-
-   PacketType *addNew(uint8_t NewIdx)                                         // add the new packet to the queue
-   { PacketType *Prev = 0;
-     Packet[NewIdx].Alloc=1;                                                  // mark this clot as allocated
-     uint32_t AddressAndType = Packet[NewIdx].Packet.getAddressAndType();     // get ID of this packet: ID is address-type and address (2+24 = 26 bits)
-     for(uint8_t Idx=0; Idx<Size; Idx++)                                      // look for other packets with same ID
-     { if(Idx==NewIdx) continue;                                              // avoid the new packet
-       if(Packet[Idx].Packet.getAddressAndType() == AddressAndType)           // if another packet with same ID:
-       { Prev=Packet+Idx; clean(Idx); }                                       // then remove it: set rank to zero
-     }
-     uint8_t Rank=Packet[NewIdx].Rank; Sum+=Rank;                             // add the new packet to the rank sum
-     if(NewIdx==LowIdx) reCalc();
-     else { if(Rank<Low) { Low=Rank; LowIdx=NewIdx; } }
-     // if(NewIdx!=LowIdx)                                                       //
-     // { if(Rank<=Low) { Low=Rank; LowIdx=NewIdx; } }
-     // else reCalc();
-     return Prev; }
-
-   uint8_t getRand(uint32_t Rand) const                                       // get a position by random selection but probabilities prop. to ranks
-   { if(Sum==0) return Rand%Size;                                             //
-     uint16_t RankIdx = Rand%Sum;
-     uint8_t Idx; uint16_t RankSum=0;
-     for(Idx=0; Idx<Size; Idx++)
-     { if(Packet[Idx].Alloc==0) continue;
-       uint8_t Rank=Packet[Idx].Rank; if(Rank==0) continue;
-       RankSum+=Rank; if(RankSum>RankIdx) return Idx; }
-     return Rand%Size; }
-
-   void reCalc(void)                                                           // find the lowest rank and calc. the sum of all ranks
-   { Sum=Low=Packet[0].Rank; LowIdx=0;                                         // take minimum at the first slot
-     for(uint8_t Idx=1; Idx<Size; Idx++)                                       // loop over all other slots
-     { if(Packet[Idx].Alloc==0) { Low=0; LowIdx=Idx; continue; }
-       uint8_t Rank=Packet[Idx].Rank;
-       Sum+=Rank;                                                              // sum up the ranks
-       if(Rank<Low) { Low=Rank; LowIdx=Idx; }                                  // update the minimum
-     }
-   }
-
-   void cleanTime(uint8_t Time)                                                // clean up slots of given Time
-   { for(int Idx=0; Idx<Size; Idx++)
-     { if(Packet[Idx].Alloc==0) continue;
-       uint8_t PktTime=Packet[Idx].PosTime(); // Packet.Position.Time;
-       if( PktTime==Time || PktTime>=60) clean(Idx);
-     }
-   }
-
-   void clean(uint8_t Idx)                                                      // clean given slot, remove it from the sum
-   { Sum-=Packet[Idx].Rank; Packet[Idx].Rank=0; Packet[Idx].Alloc=0; Low=0; LowIdx=Idx; }
-
-   void decrRank(uint8_t Idx, uint8_t Decr=1)                                   // decrement rank of given slot
-   { uint8_t Rank=Packet[Idx].Rank; if(Rank==0) return;                         // if zero already: do nothing
-     if(Decr>Rank) Decr=Rank;                                                   // if to decrement by more than the rank already: reduce the decrement
-     Rank-=Decr; Sum-=Decr;                                                     // decrement the rank and the sum of ranks
-     if(Rank<Low) { Low=Rank; LowIdx=Idx; }                                     // if new minimum: update the minimum.
-     Packet[Idx].Rank=Rank; }                                                   // update the rank of this slot
-
-   uint8_t Print(char *Out)
-   { uint8_t Len=0;
-     for(uint8_t Idx=0; Idx<Size; Idx++)                                        // loop through the slots
-     { if(Packet[Idx].Alloc==0) continue;
-       uint8_t Rank=Packet[Idx].Rank;
-       Out[Len++]=' '; Len+=Format_Hex(Out+Len, Rank);                          // print the slot Rank
-       // if(Rank)                                                                 // if Rank is none-zero
-       { Out[Len++]='/'; Len+=Format_Hex(Out+Len, Packet[Idx].Packet.getAddressAndType() );   // print address-type and address
-         Out[Len++]=':';
-         if(Packet[Idx].Packet.Header.Encrypted) Len+=Format_String(Out+Len, "ee");
-         else Len+=Format_UnsDec(Out+Len, (uint32_t)Packet[Idx].Packet.Position.Time, 2); // [sec] print time
-       }
-     }
-     Out[Len++]=' '; Len+=Format_Hex(Out+Len, Sum);                             // sum of all Ranks
-     Out[Len++]='/'; Len+=Format_Hex(Out+Len, LowIdx);                          // index of the lowest Rank or a free slot
-     Out[Len++]='\n'; Out[Len]=0; return Len; }
-
-} ;
+#include "relay-queue.h"
 
 // ---------------------------------------------------------------------------------------------------------------------
 
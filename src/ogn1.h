@@ -1037,8 +1037,8 @@ class OGN1_Packet          // Packet structure for the OGN tracker
    void Encrypt (const uint32_t Key[4]) { XXTEA_Encrypt(Data, 4, Key, 8); }              // encrypt with given Key
    void Decrypt (const uint32_t Key[4]) { XXTEA_Decrypt(Data, 4, Key, 8); }              // decrypt with given Key
 
-   void Whiten  (void) { TEA_Encrypt_Key0(Data, 8); TEA_Encrypt_Key0(Data+2, 8); } // whiten the position
-   void Dewhiten(void) { TEA_Decrypt_Key0(Data, 8); TEA_Decrypt_Key0(Data+2, 8); } // de-whiten the position
+   void Whiten  (void) { TEA_Encrypt_Key0(Data, Data+2, 8); }  // whiten the position: both blocks at once
+   void Dewhiten(void) { TEA_Decrypt_Key0(Data, Data+2, 8); }  // de-whiten the position
 
    void Whiten2 (void) { XXTEA_Encrypt_Key0(Data-1, 5, 6); }
    void Dewhite2(void) { XXTEA_Decrypt_Key0(Data-1, 5, 6); }
@@ -4,6 +4,7 @@
 
 #include "format.h"
 #include "ognconv.h"
+#include "tea-batch.h"
 
 // ==============================================================================================
 // Coordinate scales:
@@ -272,6 +273,16 @@ void TEA_Decrypt_Key0 (uint32_t* Data, int Loops)
   Data[0]=v0; Data[1]=v1;
 }
 
+void TEA_Encrypt_Key0 (uint32_t* Data0, uint32_t* Data1, int Loops) // two blocks with the rounds interleaved
+{ uint32_t V0[2] = { Data0[0], Data1[0] }, V1[2] = { Data0[1], Data1[1] };
+  TEA_Encrypt_Key0_Lanes<uint32_t, 2>(V0, V1, Loops);
+  Data0[0]=V0[0]; Data0[1]=V1[0]; Data1[0]=V0[1]; Data1[1]=V1[1]; }
+
+void TEA_Decrypt_Key0 (uint32_t* Data0, uint32_t* Data1, int Loops)
+{ uint32_t V0[2] = { Data0[0], Data1[0] }, V1[2] = { Data0[1], Data1[1] };
+  TEA_Decrypt_Key0_Lanes<uint32_t, 2>(V0, V1, Loops);
+  Data0[0]=V0[0]; Data0[1]=V1[0]; Data1[0]=V0[1]; Data1[1]=V1[1]; }
+
 // ==============================================================================================
 // XXTEA encryption/decryption
 
@@ -93,6 +93,8 @@ void TEA_Decrypt (uint32_t* Data, const uint32_t *Key, int Loops);
 
 void TEA_Encrypt_Key0 (uint32_t* Data, int Loops);
 void TEA_Decrypt_Key0 (uint32_t* Data, int Loops);
+void TEA_Encrypt_Key0 (uint32_t* Data0, uint32_t* Data1, int Loops); // two blocks at once: the rounds interleaved
+void TEA_Decrypt_Key0 (uint32_t* Data0, uint32_t* Data1, int Loops); // for many blocks and packets see tea-batch.h
 
 void XXTEA_Encrypt(uint32_t *Data, uint8_t Words, const uint32_t Key[4], uint8_t Loops);
 void XXTEA_Decrypt(uint32_t *Data, uint8_t Words, const uint32_t Key[4], uint8_t Loops);
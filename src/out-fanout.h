@@ -0,0 +1,206 @@
+#ifndef __OUT_FANOUT_H__
+#define __OUT_FANOUT_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "format.h"
+#include "fifo.h"
+
+// Fan-out of the traffic sentences ($PFLAA, $POGNT, $PXFLM, GDL90) to the outputs: USB console, Bluetooth, AP clients.
+// The producer (the PROC task) formats a message once into a buffer of the pool and posts it: every enabled sink
+// gets the index of the buffer in its own queue and one reference, the buffer returns to the pool with the last reference.
+// The producer never waits: a sink with its queue full or over its rate limit misses the message (and counts it),
+// an empty pool drops the message for all. Each sink is drained by Service() from the one task which owns its link,
+// at the pace of the link: a message which waited longer than MaxAge is dropped unsent, traffic positions get stale.
+// Every sink queue is single-producer/single-consumer (fifo.h), the reference counts are atomic as the sinks
+// release the buffers from different tasks. A sink holds at most QueueSize-1 buffers and the pool outlasts
+// all sink queues full: stalled sinks can not starve the others. The queues take the burst of the per-slot reports.
+
+// The Write() of a sink which feeds a byte FIFO of its link: the whole sentence or nothing, and only while the FIFO
+// holds less than OUT_FIFOmaxFull bytes. A sentence left in the sink queue can still be dropped by MaxAge, once in
+// the link FIFO it goes out however late: so the FIFO is kept short and the waiting is done in the sink queue.
+
+const unsigned OUT_FIFOmaxFull = 256;                  // [bytes] the link FIFO takes no more sentences above that
+
+template <class LinkFIFO>
+ int OUT_WriteFIFO(LinkFIFO &FIFO, const char *Data, int Len)
+{ if(FIFO.Full()+(unsigned)Len>OUT_FIFOmaxFull) return 0;  // not short anymore: the sentence waits in the sink queue
+  if(FIFO.Free()<(unsigned)Len) return 0;                   // does not fit: a FIFO smaller than OUT_FIFOmaxFull
+  return FIFO.Write(Data, Len); }
+
+template <uint8_t Buffers=128, uint16_t BufSize=128, uint8_t MaxSinks=4, unsigned QueueSize=32>
+ class Out_FanOut
+{ public:
+   static_assert(MaxSinks*(QueueSize-1)<Buffers, "the pool must outlast all sink queues full");
+   static_assert(Buffers<=255, "buffer index must fit 8 bits");
+
+   class Buffer
+   { public:
+      std::atomic<uint8_t> Refs;                 // producer and sinks still holding it, zero = free
+      uint16_t Len;                              // [bytes] of the message
+      uint32_t usTime;                           // [usec] when posted, for the latency
+      char     Data[BufSize];
+   } ;
+
+   class Sink
+   { public:
+      const char *Name;
+      int  (*Write)(const char *Data, int Len);  // must not block: returns the number of bytes the link took
+      bool (*isOn)(void);                        // zero for always on: nothing is queued while the link is off
+      uint32_t Rate;                             // [byte/sec] token bucket, zero for no limit
+      uint32_t Burst;                            // [byte] token bucket depth
+      uint32_t MaxAge;                           // [usec] drop messages waiting longer, zero for no limit
+
+      uint32_t Posted;                           // queued messages                    - producer side
+      uint32_t QueueDrops;                       // not queued: the queue was full
+      uint32_t RateDrops;                        // not queued: over the rate limit
+      uint32_t Tokens;                           // [byte]
+      uint32_t usRefill;                         // [usec] time of the last refill
+
+      uint32_t Sent;                             // messages sent completely            - consumer side
+      uint32_t Bytes;                            // [byte] sent
+      uint32_t AgeDrops;                         // dropped unsent: too old
+      uint64_t LatencySum;                       // [usec] post to sent
+      uint32_t LatencyMax;                       // [usec]
+      uint16_t Offset;                           // [byte] of the head message already taken by the link
+
+      FIFO<uint8_t, QueueSize> Queue;            // indices of the buffers to send
+
+     public:
+      void Clear(void)
+      { Posted=QueueDrops=RateDrops=0; Tokens=Burst; usRefill=0;
+        Sent=Bytes=AgeDrops=0; LatencySum=0; LatencyMax=0; Offset=0;
+        Queue.Clear(); }
+
+      uint32_t Drops(void) const { return QueueDrops+RateDrops+AgeDrops; }
+      uint32_t LatencyAver(void) const { return Sent ? LatencySum/Sent:0; }   // [usec]
+
+      bool takeTokens(uint16_t Len, uint32_t usTime)   // token bucket: refill by the time since the last refill
+      { if(Rate==0) return 1;
+        uint32_t usDiff=usTime-usRefill;
+        uint32_t Add=(uint64_t)usDiff*Rate/1000000;
+        if(Add) { usRefill+=(uint64_t)Add*1000000/Rate; Tokens+=Add; }      // keep the fraction for the next refill
+        if(Tokens>=Burst) { Tokens=Burst; usRefill=usTime; }
+        if(Tokens<Len) return 0;
+        Tokens-=Len; return 1; }
+   } ;
+
+   Buffer   Pool[Buffers];
+   Sink     Sinks[MaxSinks];
+   std::atomic<uint8_t> SinkCount;               // sinks added: visible to the producer only when set up
+   uint8_t  AllocIdx;                            // where the search for a free buffer starts
+   uint32_t PoolDrops;                           // messages dropped for all: no free buffer
+   uint32_t LongDrops;                           // messages dropped for all: longer than BufSize
+
+  public:
+   Out_FanOut() { Clear(); }
+
+   void Clear(void)                              // not while any task is using it
+   { for(uint8_t Idx=0; Idx<Buffers; Idx++) { Pool[Idx].Refs.store(0, std::memory_order_relaxed); Pool[Idx].Len=0; }
+     SinkCount.store(0, std::memory_order_release); AllocIdx=0; PoolDrops=0; LongDrops=0; }
+
+   int8_t addSink(const char *Name, int (*Write)(const char *, int), bool (*isOn)(void)=0,
+                  uint32_t Rate=0, uint32_t MaxAge=0, uint32_t Burst=0) // one task at a time: the producer sees the sink once set up
+   { uint8_t Idx=SinkCount.load(std::memory_order_relaxed); if(Idx>=MaxSinks) return -1;
+     Sink &New=Sinks[Idx];
+     New.Name=Name; New.Write=Write; New.isOn=isOn;
+     New.Rate=Rate; New.MaxAge=MaxAge; New.Burst = Burst ? Burst : Rate/4+BufSize;  // by default 1/4 sec of the rate and one message
+     New.Clear();
+     SinkCount.store(Idx+1, std::memory_order_release);
+     return Idx; }
+
+   uint8_t getSinks(void) const { return SinkCount.load(std::memory_order_acquire); }
+
+   // producer side
+
+   char *getBuffer(void)                         // a free buffer to format a message into, zero when the pool is empty
+   { for(uint8_t Count=0; Count<Buffers; Count++)
+     { uint8_t Idx=AllocIdx; if((++AllocIdx)>=Buffers) AllocIdx=0;
+       if(Pool[Idx].Refs.load(std::memory_order_acquire)) continue;          // the sinks are done with it when zero
+       Pool[Idx].Refs.store(1, std::memory_order_relaxed);                   // only the producer takes free buffers
+       return Pool[Idx].Data; }
+     PoolDrops++; return 0; }
+
+   uint8_t Post(char *Data, uint16_t Len, uint32_t usTime)   // post a buffer from getBuffer(), returns to how many sinks
+   { uint8_t BufIdx = ((uint8_t *)Data-(uint8_t *)Pool)/sizeof(Buffer);
+     Buffer &Buf=Pool[BufIdx];
+     Buf.Len=Len; Buf.usTime=usTime;
+     uint8_t Count=0;
+     uint8_t SinkNum=getSinks();
+     for(uint8_t Idx=0; Idx<SinkNum; Idx++)
+     { Sink &Out=Sinks[Idx];
+       if(Out.isOn && !(*Out.isOn)()) continue;                              // link off: skip this sink
+       if(Out.Queue.isFull()) { Out.QueueDrops++; continue; }                // stays not full: only the sink reads
+       if(!Out.takeTokens(Len, usTime)) { Out.RateDrops++; continue; }
+       Buf.Refs.fetch_add(1, std::memory_order_relaxed);                     // the reference of this sink
+       Out.Queue.Write(BufIdx);                                              // the buffer visible to the sink
+       Out.Posted++; Count++; }
+     Release(BufIdx);                                                        // the reference of the producer
+     return Count; }
+
+   uint8_t PostCopy(const char *Msg, uint16_t Len, uint32_t usTime) // copy a message formatted elsewhere into the pool and post it
+   { if(Len>BufSize) { LongDrops++; return 0; }
+     char *Data=getBuffer(); if(Data==0) return 0;
+     memcpy(Data, Msg, Len);
+     return Post(Data, Len, usTime); }
+
+   // consumer side: each sink from one task only
+
+   uint16_t Service(uint8_t Idx, uint32_t usTime)   // send what the link takes now, returns the number of bytes
+   { Sink &Out=Sinks[Idx];
+     uint16_t Total=0;
+     for( ; ; )
+     { uint8_t *Head=Out.Queue.getRead(); if(Head==0) break;
+       uint8_t BufIdx=(*Head);
+       const Buffer &Buf=Pool[BufIdx];
+       uint32_t Age=usTime-Buf.usTime;
+       if(Out.Offset==0 && Out.MaxAge && Age>Out.MaxAge) Out.AgeDrops++;      // too old: drop it unless started already
+       else
+       { int Len=(*Out.Write)(Buf.Data+Out.Offset, Buf.Len-Out.Offset);
+         if(Len<=0) break;                                                   // the link is busy: try again later
+         Out.Offset+=Len; Out.Bytes+=Len; Total+=Len;
+         if(Out.Offset<Buf.Len) break;                                       // the rest of this message next time
+         Out.Sent++; Out.LatencySum+=Age; if(Age>Out.LatencyMax) Out.LatencyMax=Age; }
+       Out.Offset=0;
+       Out.Queue.Read();
+       Release(BufIdx); }
+     return Total; }
+
+   uint8_t Print(char *Out, uint8_t Idx) const   // statistics of a sink, to be read when it is quiet
+   { const Sink &Stat=Sinks[Idx];
+     uint8_t Len=0;
+     Len+=Format_String(Out+Len, Stat.Name);
+     Len+=Format_String(Out+Len, ": sent ");
+     Len+=Format_UnsDec(Out+Len, Stat.Sent);
+     Len+=Format_String(Out+Len, ", dropped ");
+     Len+=Format_UnsDec(Out+Len, Stat.QueueDrops); Out[Len++]='/';          // queue full / rate / age
+     Len+=Format_UnsDec(Out+Len, Stat.RateDrops);  Out[Len++]='/';
+     Len+=Format_UnsDec(Out+Len, Stat.AgeDrops);
+     Len+=Format_String(Out+Len, ", latency ");
+     Len+=Format_UnsDec(Out+Len, (Stat.LatencyAver()+50)/100, 2, 1); Out[Len++]='/';
+     Len+=Format_UnsDec(Out+Len, (Stat.LatencyMax+50)/100, 2, 1);
+     Len+=Format_String(Out+Len, "ms\n"); Out[Len]=0;
+     return Len; }
+
+   uint8_t PrintPool(char *Out) const            // messages dropped for all the sinks
+   { uint8_t Len=0;
+     Len+=Format_String(Out+Len, "Pool: ");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)Buffers);
+     Len+=Format_String(Out+Len, " x ");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)BufSize);
+     Len+=Format_String(Out+Len, " bytes, dropped ");
+     Len+=Format_UnsDec(Out+Len, PoolDrops); Out[Len++]='/';                // pool empty / too long
+     Len+=Format_UnsDec(Out+Len, LongDrops);
+     Out[Len++]='\n'; Out[Len]=0;
+     return Len; }
+
+  private:
+   void Release(uint8_t BufIdx)                  // the last reference frees the buffer: writes before it seen by the producer
+   { Pool[BufIdx].Refs.fetch_sub(1, std::memory_order_acq_rel); }
+
+} ;
+
+#endif // __OUT_FANOUT_H__
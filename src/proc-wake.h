@@ -0,0 +1,39 @@
+#ifndef __PROC_WAKE_H__
+#define __PROC_WAKE_H__
+
+#include <Arduino.h>
+#include <stdint.h>
+
+// vTaskPROC sleeps till there is work: the RF task and the GPS set bits in its task notification value,
+// the time-slot boundary is the timeout of the wait. Thus no 1 ms polling and no 1 ms latency on a received packet.
+// A notification given before vTaskPROC registers its handle is lost, but the FIFO is still drained at the next wake-up.
+
+extern TaskHandle_t PROC_TaskHandle;                  // set by vTaskPROC itself, zero till then
+
+const uint32_t PROCevt_RxPacket = 0x01;               // RF:  a new packet in FSK_RxFIFO
+const uint32_t PROCevt_NewPos   = 0x02;               // GPS: a new position is ready in the pipe
+
+#if defined(WITH_GPS_MTK)
+const uint16_t PROC_SlotOffset = 300;                 // [ms] the time slot starts this long after the PPS: the GPS burst is over
+#elif defined(WITH_GPS_UBX)
+const uint16_t PROC_SlotOffset = 200;
+#else
+const uint16_t PROC_SlotOffset =   0;
+#endif
+
+inline void PROC_Notify(uint32_t Events)              // called from the RF and GPS tasks, not from an interrupt
+{ if(PROC_TaskHandle) xTaskNotify(PROC_TaskHandle, Events, eSetBits); }
+
+inline uint32_t PROC_SlotTime(uint32_t Time, uint16_t msTime) // [sec] the time slot which is on at the given time
+{ return msTime<PROC_SlotOffset ? Time-1:Time; }
+
+inline uint16_t PROC_msToSlot(uint16_t msTime)        // [ms] till the next time slot starts, 1..1000
+{ if(msTime>=1000) return 1;
+  return msTime<PROC_SlotOffset ? PROC_SlotOffset-msTime : 1000+PROC_SlotOffset-msTime; }
+
+inline uint32_t PROC_Wait(uint16_t msTime)            // sleep till notified or till the next time slot, returns the PROCevt_ bits
+{ uint32_t Events=0;
+  xTaskNotifyWait(0, 0xFFFFFFFF, &Events, pdMS_TO_TICKS(PROC_msToSlot(msTime)));
+  return Events; }
+
+#endif // __PROC_WAKE_H__
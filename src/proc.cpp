@@ -10,6 +10,7 @@
 #include "flarm.h"                    // CRC, error correction and $PXFLM NMEA
 #include "ogn-radio.h"                // RF task: transmission and reception of radio packets
 #include "gps.h"                      // GPS task: get own time and position, set the GPS baudrate and navigation mode
+#include "proc-wake.h"                // RF and GPS wake up the PROC task
 
 #include "fifo.h"
 
@@ -78,7 +79,23 @@ uint32_t BatteryVoltage = 0;          // [1/256 mV] low-pass filtered battery vo
 
 static char           Line[160];      // for printing out to the console, etc.
 
+#ifdef WITH_FANOUT
+PROC_FanOut OUT_FanOut;               // traffic sentences: queued once for every output, each output drains its own queue
+#endif
+
+static void OUT_Sentence(const char *Msg, uint8_t Len) // traffic sentence ($PFLAU/$PFLAA, $POGNT, $PXFLM, GDL90) or $POGNR to the console and its links
+{
+#ifdef WITH_FANOUT
+  OUT_FanOut.PostCopy(Msg, Len, micros());                            // the PROC task does not wait for a slow output
+#else
+  xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
+  for(uint8_t Idx=0; Idx<Len; Idx++) CONS_UART_Write(Msg[Idx]);       // GDL90 is binary: not Format_String()
+  xSemaphoreGive(CONS_Mutex);
+#endif
+}
+
 static LDPC_Decoder     Decoder;      // decoder and error corrector for the OGN Gallager/LDPC code
+static int8_t           DecoderSoft[LDPC_Decoder::CodeBits]; // soft decisions from the Manchester errors and the SNR: OGN and ADS-L
 
 // FlightMonitor Flight;
 
@@ -128,7 +145,7 @@ static void PrintRelayQueue(uint8_t Idx)                    // for debug
   xSemaphoreGive(CONS_Mutex); }
 #endif
 
-static bool GetRelayPacket(OGN_TxPacket<OGN_Packet> *Packet)      // prepare a packet to be relayed
+static bool GetRelayPacket(OGN_TxFrame *Packet)                   // prepare a packet to be relayed
 { if(OGN_RelayQueue.Sum==0) return 0;                     // if no packets in the relay queue
   XorShift32(Random.RX);                                  // produce a new random number
   uint8_t Idx=OGN_RelayQueue.getRand(Random.RX);          // get weight-random packet from the relay queue
@@ -137,12 +154,13 @@ static bool GetRelayPacket(OGN_TxPacket<OGN_Packet> *Packet)      // prepare a p
   Packet->Packet.Header.Relay=1;                          // increment the relay count (in fact we only do single relay)
   // Packet->Packet.calcAddrParity();
   if(!Packet->Packet.Header.Encrypted) Packet->Packet.Whiten(); // whiten but only for non-encrypted packets
-  Packet->calcFEC();                                      // Calc. the FEC code => packet ready for transmission
+  Packet->calcFEC();                                      // Calc. the FEC code
+  Packet->Encode();                                       // and the on-air frame => packet ready for transmission
   // PrintRelayQueue(Idx);  // for debug
   OGN_RelayQueue.decrRank(Idx);                           // reduce the rank of the packet selected for relay
   return 1; }
 
-static bool GetRelayPacket(ADSL_Packet *Packet)           // prepare a packet to be relayed
+static bool GetRelayPacket(ADSL_TxFrame *Packet)          // prepare a packet to be relayed
 { if(ADSL_RelayQueue.Sum==0) return 0;                    // if no packets in the relay queue
   XorShift32(Random.RX);                                  // produce a new random number
   uint8_t Idx=ADSL_RelayQueue.getRand(Random.RX);         // get weight-random packet from the relay queue
@@ -151,6 +169,7 @@ static bool GetRelayPacket(ADSL_Packet *Packet)           // prepare a packet to
   Packet->setRelay();
   Packet->Scramble();
   Packet->setCRC();
+  Packet->Encode();
   ADSL_RelayQueue.decrRank(Idx);                           // reduce the rank of the packet selected for relay
   return 1; }
 
@@ -367,7 +386,8 @@ static void ReadStatus(OGN_Packet &Packet)
     Line[Len++]=',';
     // Len+=Format_SignDec(Line+Len, -5*TRX.averRSSI, 2, 1);                     // average RF level (over all channels)
     Line[Len++]=',';
-    Len+=Format_SignDec(Line+Len, Radio_TxCredit/100, 2, 1);                       // [sec] transmitter on-air time counter
+    if(Radio_Duty.Band[DutyCycle::Band_M].Limit)                              // empty where the band has no duty-cycle limit
+      Len+=Format_SignDec(Line+Len, Radio_Duty.Band[DutyCycle::Band_M].getLeft()/100000, 2, 1); // [sec] transmitter on-air time left
     Line[Len++]=',';
     // Len+=Format_SignDec(Line+Len, (int16_t)TRX.chipTemp);                     // the temperature of the RF chip
     Line[Len++]=',';
@@ -383,10 +403,7 @@ static void ReadStatus(OGN_Packet &Packet)
 
     Len+=NMEA_AppendCheckCRNL(Line, Len);                                    // append NMEA check-sum and CR+NL
     // LogLine(Line);
-    // if(CONS_UART_Free()>=128)
-    { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line, 0, Len);                          // send the NMEA out to the console
-      xSemaphoreGive(CONS_Mutex); }
+    OUT_Sentence(Line, Len);                                                 // send the NMEA out to the console: queued, not waiting on a slow link
 #ifdef WITH_SDLOG
     if(Log_Free()>=128)
     { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -425,7 +442,7 @@ static uint8_t WritePFLAU(char *NMEA, uint8_t GPS=1)    // produce the (mostly d
 // ---------------------------------------------------------------------------------------------------------------------------------------
 
 // process received OGN packets
-static void ProcessRxOGN(OGN_RxPacket<OGN_Packet> *RxPacket, uint8_t RxPacketIdx, uint32_t RxTime)
+static void ProcessRxOGN(OGN_RxPacket<OGN_Packet> *RxPacket, uint8_t RxPacketIdx, uint32_t RxTime, bool PAW=0)
 { int32_t LatDist=0, LonDist=0; uint8_t Warn=0;
   if( RxPacket->Packet.Header.NonPos)                                                 // status or info packet
   {
@@ -453,10 +470,7 @@ static void ProcessRxOGN(OGN_RxPacket<OGN_Packet> *RxPacket, uint8_t RxPacketIdx
     //          RxPacket->Packet.Header.AddrType, RxPacket->Packet.Header.Address, LatDist, LonDist);
 #ifdef WITH_POGNT
     { uint8_t Len=RxPacket->WritePOGNT(Line);                                         // print on the console as $POGNT
-      if(Parameters.Verbose)
-      { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-        Format_String(CONS_UART_Write, Line, 0, Len);
-        xSemaphoreGive(CONS_Mutex); }
+      if(Parameters.Verbose) OUT_Sentence(Line, Len);
 #ifdef WITH_SDLOG
       if(Log_Free()>=128)
       { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -470,16 +484,10 @@ static void ProcessRxOGN(OGN_RxPacket<OGN_Packet> *RxPacket, uint8_t RxPacketIdx
 //     Format_String(CONS_UART_Write, Line, 0, Len);
 //     xSemaphoreGive(CONS_Mutex);
 #ifdef WITH_LOOKOUT
-    const LookOut_Target *Tgt=Look.ProcessTarget(RxPacket->Packet, RxTime);           // process the received target postion
+    const LookOut_Target *Tgt=Look.ProcessTarget(RxPacket->Packet, RxTime, 0,         // process the received target postion, GDL90 report once per slot
+                      PAW ? LookOut_Target::SysPAW:LookOut_Target::SysOGN);           // same aircraft by OGN, PAW and ADS-L goes into one target
     if(Tgt) Warn=Tgt->WarnLevel;                                                      // remember warning level of this target
     RxPacket->Warn = Warn>0;
-#ifdef WITH_GDL90
-    if(Tgt)
-    { Look.Write(GDL_REPORT, Tgt);                                                    // produce GDL90 report for this target
-      xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      GDL_REPORT.Send(CONS_UART_Write, 20);                                           // transmit as traffic position report (not own-ship)
-      xSemaphoreGive(CONS_Mutex); }
-#endif
 #ifdef WITH_BEEPER
     if(KNOB_Tick>12) Play(Play_Vol_1 | Play_Oct_2 | (7+2*Warn), 3+16*Warn);
 #endif
@@ -506,9 +514,7 @@ static void ProcessRxOGN(OGN_RxPacket<OGN_Packet> *RxPacket, uint8_t RxPacketIdx
 #endif
     )
     { uint8_t Len=RxPacket->WritePFLAA(Line, Warn, LatDist, LonDist, RxPacket->Packet.DecodeAltitude()-GPS_Altitude/10);
-      xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line, 0, Len);
-      xSemaphoreGive(CONS_Mutex);
+      OUT_Sentence(Line, Len);
 #ifdef WITH_SDLOG
     if(Log_Free()>=128)
     { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -552,16 +558,9 @@ static void ProcessRxADSL(ADSL_RxPacket *RxPacket, uint8_t RxPacketIdx, uint32_t
     // Serial.printf("ProcessRxADSL: %02X:%06X [%+5d,%+5d]m\n",
     //          RxPacket->Packet.getAddrTable(), RxPacket->Packet.getAddress(), LatDist, LonDist);
 #ifdef WITH_LOOKOUT
-    const LookOut_Target *Tgt=Look.ProcessTarget(RxPacket->Packet, RxTime);           // process the received target postion
+    const LookOut_Target *Tgt=Look.ProcessTarget(RxPacket->Packet, RxTime);           // process the received target postion, GDL90 report once per slot
     if(Tgt) Warn=Tgt->WarnLevel;                                                      // remember warning level of this target
     RxPacket->Warn = Warn>0;
-#ifdef WITH_GDL90
-    if(Tgt)
-    { Look.Write(GDL_REPORT, Tgt);                                                    // produce GDL90 report for this target
-      xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      GDL_REPORT.Send(CONS_UART_Write, 20);                                           // transmit as traffic position report (not own-ship)
-      xSemaphoreGive(CONS_Mutex); }
-#endif
 #ifdef WITH_BEEPER
     if(KNOB_Tick>12) Play(Play_Vol_1 | Play_Oct_2 | (7+2*Warn), 3+16*Warn);
 #endif
@@ -590,13 +589,19 @@ static void ProcessRxADSL(ADSL_RxPacket *RxPacket, uint8_t RxPacketIdx, uint32_t
 static void DecodeRxOGN(FSK_RxPacket *RxPkt)
 { uint8_t RxPacketIdx  = OGN_RelayQueue.getNew();                   // get place for this new packet
   OGN_RxPacket<OGN_Packet> *RxPacket = OGN_RelayQueue[RxPacketIdx];
+#ifdef WITH_LDPC_HARD
   uint8_t Check = RxPkt->Decode(*RxPacket, Decoder);
+#else
+  uint8_t Check = RxPkt->Decode(*RxPacket, Decoder, DecoderSoft);
+#endif
 #ifdef DEBUG_PRINT
   Serial.printf("DecodeRxOGN : #%d [%d] %02X:%06X Err:%d Corr:%d Check:%d [%d]\n",
      RxPkt->Channel, RxPkt->Bytes, RxPacket->Packet.Header.AddrType, RxPacket->Packet.Header.Address,
      RxPkt->ErrCount(), RxPacket->RxErr, Check, RxPacketIdx);
 #endif
-  if(Check!=0 || RxPacket->RxErr>=15) return;                     // what limit on number of detected bit errors ?
+  if(Check!=0 || RxPacket->RxErr>=15)                             // what limit on number of detected bit errors ?
+  { Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, -1); return; }
+  Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, RxPacket->RxErr);
   RxPacket->Packet.Dewhiten();
   ProcessRxOGN(RxPacket, RxPacketIdx, RxPkt->Time); }
 
@@ -604,11 +609,14 @@ static void DecodeRxADSL(FSK_RxPacket *RxPkt)
 { uint8_t RxPacketIdx  = ADSL_RelayQueue.getNew();                   // get place for this new packet
   ADSL_RxPacket *RxPacket = ADSL_RelayQueue[RxPacketIdx];
   int CorrErr=RxPkt->ErrCount();
-  if(RxPkt->Manchester) CorrErr=ADSL_Packet::Correct(RxPkt->Data, RxPkt->Err);
+  if(RxPkt->Manchester)
+  { RxPkt->getSoft(DecoderSoft, (ADSL_Packet::TxBytes-3)*8);          // the 10 least reliable bits: Manchester errors first
+    CorrErr=ADSL_Packet::Correct(RxPkt->Data, DecoderSoft, 10); }
 #ifdef DEBUG_PRINT
   Serial.printf("DecodeRxADSL: #%d [%d] Err:%d Corr:%d [%d]\n",
           RxPkt->Channel, RxPkt->Bytes, RxPkt->ErrCount(), CorrErr, RxPacketIdx);
 #endif
+  Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, CorrErr);    // LDR when called from DecodeRxLDR()
   if(CorrErr<0) return;
   memcpy(&(RxPacket->Packet.Version), RxPkt->Data, RxPacket->Packet.TxBytes-3);
   RxPacket->RxErr   = CorrErr;
@@ -621,24 +629,15 @@ static void DecodeRxADSL(FSK_RxPacket *RxPkt)
   ProcessRxADSL(RxPacket, RxPacketIdx, RxPkt->Time); }
 
 static void DecodeRxLDR(FSK_RxPacket *RxPkt)
-{ if(RxPkt->Bytes!=25 || RxPkt->Manchester) return;
-  uint32_t CRC = ADSL_Packet::checkPI(RxPkt->Data, 24);
-  uint8_t CRC8 = PAW_Packet::CRC8(RxPkt->Data, 24);
-  if(CRC!=0 && CRC8!=RxPkt->Data[24])
-  { uint8_t ErrBit=ADSL_Packet::FindCRCsyndrome(CRC);
-    if(ErrBit!=0xFF)
-    { ADSL_Packet::FlipBit(RxPkt->Data, ErrBit);
-      ADSL_Packet::FlipBit(RxPkt->Err , ErrBit);
-      CRC=0x000000;
-      CRC8 = PAW_Packet::CRC8(RxPkt->Data, 24); }
-  }
-  if(CRC8!=RxPkt->Data[24]) return;
-  if(CRC==0)
+{ if(RxPkt->Bytes!=25 || RxPkt->Manchester) { Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, -1); return; }
+  bool ADSL=0;
+  int CorrBits = PAW_Packet::CorrectLDR(RxPkt->Data, RxPkt->Err, ADSL);
+  if(CorrBits>=0 && ADSL)
   { // Serial.printf("LDR: good ADS-L\n");
     DecodeRxADSL(RxPkt);
     return; }
-  PAW_Packet::Whiten(RxPkt->Data, 24);
-  if(PAW_Packet::IntCRC(RxPkt->Data, 24)!=0x00) return;
+  Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, CorrBits);
+  if(CorrBits<0) return;
   // Serial.printf("LDR: good PAW\n");
   PAW_Packet *PAW = (PAW_Packet *)RxPkt->Data;
   uint8_t RxPacketIdx  = OGN_RelayQueue.getNew();
@@ -648,28 +647,29 @@ static void DecodeRxLDR(FSK_RxPacket *RxPkt)
   RxPacket->RxChan = RxPkt->Channel;
   RxPacket->RxRSSI = RxPkt->RSSI;
   RxPacket->Correct = 1;
-  ProcessRxOGN(RxPacket, RxPacketIdx, RxPkt->Time); }
+  ProcessRxOGN(RxPacket, RxPacketIdx, RxPkt->Time, 1); }
 
 static void DecodeRxPacket(FSK_RxPacket *RxPkt)
 { if(RxPkt->SysID==Radio_SysID_OGN ) return DecodeRxOGN (RxPkt);
   if(RxPkt->SysID==Radio_SysID_ADSL) return DecodeRxADSL(RxPkt);
   if(RxPkt->SysID==Radio_SysID_LDR ) return DecodeRxLDR (RxPkt);
   if(RxPkt->SysID==Radio_SysID_FLR)
-  { int CorrBits=Flarm_Packet::Correct(RxPkt->Data, RxPkt->Err, 4);
+  { int CorrBits=Flarm_Packet::Correct(RxPkt->Data, RxPkt->Err, 4);   // hard input: the soft one recovers no more packets (fec_bench)
     uint16_t CRC=Flarm_Packet::checkCRC(RxPkt->Data, Flarm_Packet::Bytes);
+    Radio_Stats.addDecode(RxPkt->Channel, RxPkt->SysID, CRC==0x0000 ? CorrBits:-1);
     if(CorrBits>=0 && CRC==0x0000)
     { int Len=sprintf(Line, "$PXFLM,");
       for(uint8_t Idx=0; Idx<Flarm_Packet::Bytes; Idx++)
         Len+=sprintf(Line+Len, "%02X", RxPkt->Data[Idx]);
       Len+=NMEA_AppendCheckCRNL(Line, Len); Line[Len]=0;
-      xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-      Format_String(CONS_UART_Write, Line);
-      xSemaphoreGive(CONS_Mutex); }
+      OUT_Sentence(Line, Len); }
     return; }
   return; }
 
 // -------------------------------------------------------------------------------------------------------------------
 
+TaskHandle_t PROC_TaskHandle = 0;                                      // the PROC task: notified by the RF and GPS tasks
+
 #ifdef __cplusplus
   extern "C"
 #endif
@@ -696,8 +696,10 @@ void vTaskPROC(void* pvParameters)
   OGN_TxPacket<OGN_Packet> StatPacket;                                 // status report packet
   // OGN_TxPacket<OGN_Packet> InfoPacket;                                 // information packet
 
+  PROC_TaskHandle = xTaskGetCurrentTaskHandle();                       // for the RF and GPS tasks to wake us up
+
   for( ; ; )
-  { vTaskDelay(1);
+  { uint32_t Events = PROC_Wait(TimeSync_msTime());                    // sleep till a packet, a position or the next time slot
 
     for( ; ; )
     { FSK_RxPacket *RxPkt = FSK_RxFIFO.getRead();                        // check for new received packets
@@ -719,12 +721,12 @@ void vTaskPROC(void* pvParameters)
     uint32_t     Time;                                                  // [sec] time slot
     TickType_t msTime;                                                  // [msec]
     TimeSync_Time(Time, msTime);
-    uint32_t SlotTime=Time;
-#ifdef WITH_GPS_UBX
-    if(msTime<200) SlotTime--;                                          // lasts up to 0.300sec after the PPS
-#endif
-#ifdef WITH_GPS_MTK
-    if(msTime<300) SlotTime--;                                          // lasts up to 0.300sec after the PPS
+    uint32_t SlotTime=PROC_SlotTime(Time, msTime);                      // lasts up to 0.200sec (UBX) or 0.300sec (MTK) after the PPS
+#ifndef WITH_MAVLINK
+    if(SlotTime!=Time)                                                  // position of this second ready before the slot boundary:
+    { uint8_t BestIdx; int16_t BestResid;                               // no need to wait for the boundary, once started the slot stays on
+      if(PrevSlotTime==Time) SlotTime=Time;
+      else if((Events&PROCevt_NewPos) && GPS_getPosition(BestIdx, BestResid, Time%60, 0) && BestResid==0) SlotTime=Time; }
 #endif
 
     if(SlotTime==PrevSlotTime) continue;                                // stil same time slot, go back to RX processing
@@ -774,10 +776,11 @@ void vTaskPROC(void* pvParameters)
     if(Parameters.Reg[0]) GDL_REPORT.setAcftCall(Parameters.Reg);
                      // else GDL_REPORT.setAcftCall();
     if(Position && Position->isValid()) Position->Encode(GDL_REPORT);
-    xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-    GDL_HEARTBEAT.Send(CONS_UART_Write);
-    GDL_REPORT.Send(CONS_UART_Write);
-    xSemaphoreGive(CONS_Mutex);
+    OUT_Sentence(Line, GDL_HEARTBEAT.Send(Line));
+    OUT_Sentence(Line, GDL_REPORT.Send(Line));
+#ifdef WITH_LOOKOUT
+    Look.WriteGDL90(GDL_REPORT, OUT_Sentence);                          // traffic: one report per aircraft with a new position
+#endif
 #endif
     if(Position)
     { Position->EncodeStatus(StatPacket.Packet);             // encode GPS altitude and pressure/temperature/humidity
@@ -831,7 +834,7 @@ void vTaskPROC(void* pvParameters)
         Format_String(CONS_UART_Write, Line, 0, Len);
         xSemaphoreGive(CONS_Mutex); }
 #endif // DEBUG_PRINT
-      OGN_TxPacket<OGN_Packet> *TxPacket = OGN_TxFIFO.getWrite();
+      OGN_TxFrame *TxPacket = OGN_TxFIFO.getWrite();
       TxPacket->Packet = PosPacket.Packet;                             // copy the position packet to the TxFIFO
 
 #ifdef WITH_ENCRYPT
@@ -841,6 +844,7 @@ void vTaskPROC(void* pvParameters)
       TxPacket->Packet.Whiten();                                              // just whiten if there is no encryption
 #endif // WITH_ENCRYPT
       TxPacket->calcFEC();                                                    // calculate FEC code
+      TxPacket->Encode();                                                     // and the on-air frame
       bool FloatAcft = Parameters.AcftType==3 || ( Parameters.AcftType>=0xB && Parameters.AcftType<=0xD);  // heli, balloon or drone
       XorShift32(Random.RX);
       static uint8_t TxBackOff=0;
@@ -849,11 +853,11 @@ void vTaskPROC(void* pvParameters)
       { OGN_TxFIFO.Write();                                                // complete the write into the TxFIFO
         TxBackOff = 0;
         if(AverSpeed<10 && !FloatAcft) TxBackOff += 3+(Random.RX&0x1);
-        if(Radio_TxCredit<=0) TxBackOff+=1; }
+        TxBackOff += Radio_Duty.BackOff(DutyCycle::Band_M); }              // and more when the duty-cycle fills up
       Position->Sent=1;
 #ifdef WITH_ADSL
       XorShift32(Random.RX);
-      ADSL_Packet *AdslPacket=0;                                               // keep the pointer to the 
+      ADSL_TxFrame *AdslPacket=0;                                              // keep the pointer to the 
       { static uint8_t TxBackOff=0;
         if(TxBackOff) TxBackOff--;
         else if(Radio_FreqPlan.Plan<=1)                                         // ADS-L only in Europe/Africa
@@ -866,9 +870,10 @@ void vTaskPROC(void* pvParameters)
           Position->Encode(*AdslPacket);                                       // encode position packet from the GPS
           AdslPacket->Scramble();
           AdslPacket->setCRC();
+          AdslPacket->Encode();                                                // on-air frames for the M-band and O-band
           ADSL_TxFIFO.Write();
           if(AverSpeed<10 && !FloatAcft) TxBackOff += 3+(Random.RX&0x1);       // if stationary then don't transmit position every second
-          if(Radio_TxCredit<=0) TxBackOff+=1; }
+          TxBackOff += Radio_Duty.BackOff(DutyCycle::Band_M); }
       }
 #endif
 #ifdef WITH_FANET
@@ -880,21 +885,22 @@ void vTaskPROC(void* pvParameters)
         Position->EncodeAirPos(*Packet, Parameters.AcftType, !Parameters.Stealth);
         XorShift32(Random.RX);
         FNT_TxFIFO.Write();
-        FNTbackOff = 8+(Random.RX&0x1); }                                   // every 9 or 10sec
+        FNTbackOff = 8+(Random.RX&0x1)+Radio_Duty.BackOff(DutyCycle::Band_FNT); } // every 9 or 10sec, or less often when the duty-cycle fills up
 #endif // WITH_FANET
 #ifdef WITH_PAW
       XorShift32(Random.RX);
       static uint8_t PAW_BackOff=0;
       if(PAW_BackOff) PAW_BackOff--;
       else if(Parameters.TxFNT && Position->isValid() && Radio_FreqPlan.Plan<=1 && FNT_TxFIFO.Full()==0)
-      { PAW_Packet *TxPacket = PAW_TxFIFO.getWrite();                    // get place for a new PAW packet in the transmitter queue
+      { PAW_TxFrame *TxPacket = PAW_TxFIFO.getWrite();                   // get place for a new PAW packet in the transmitter queue
         int Good=TxPacket->Read(PosPacket.Packet);                       // convert OGN position packet to PilotAware
 // #ifdef WITH_ADSL
 //         if(AdslPacket && (RX&10)) { TxPacket->Copy(&(AdslPacket->Version)); Good=1; }
 // #endif
         if(Good)
-        { PAW_TxFIFO.Write();                                            // complete the write into the transmitter queue
-          PAW_BackOff = 3+Random.RX%3; }                                 // randomly choose time to transmit next PAW packet
+        { TxPacket->Encode();                                            // whiten (unless ADS-L) and prepare the on-air frame
+          PAW_TxFIFO.Write();                                            // complete the write into the transmitter queue
+          PAW_BackOff = 3+Random.RX%3+Radio_Duty.BackOff(DutyCycle::Band_O); } // randomly choose time to transmit next PAW packet
       }
 #endif
 
@@ -903,9 +909,7 @@ void vTaskPROC(void* pvParameters)
       const LookOut_Target *Tgt=Look.ProcessOwn(PosPacket.Packet, PosTime, Position->GeoidSeparation/10);
 #ifdef WITH_PFLAA
       if(Parameters.Verbose)
-      { xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-        Look.WritePFLA(CONS_UART_Write);                                  // produce PFLAU and PFLAA for all tracked targets
-        xSemaphoreGive(CONS_Mutex);
+      { Look.WritePFLA(OUT_Sentence);                                     // produce PFLAU and PFLAA for all tracked targets
 #ifdef WITH_SDLOG
         if(Log_Free()>=512)
         { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -916,9 +920,7 @@ void vTaskPROC(void* pvParameters)
 #else // WITH_PFLAA
       if(Parameters.Verbose)
       { uint8_t Len=Look.WritePFLAU(Line);                                // $PFLAU, overall status
-        xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-        Format_String(CONS_UART_Write, Line, 0, Len);
-        xSemaphoreGive(CONS_Mutex);
+        OUT_Sentence(Line, Len);
 #ifdef WITH_SDLOG
         if(Log_Free()>=128)
         { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -958,9 +960,7 @@ void vTaskPROC(void* pvParameters)
 #ifdef WITH_PFLAA
       if(Parameters.Verbose)
       { uint8_t Len=Look.WritePFLAU(Line);                                // $PFLAU, overall status
-        xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
-        Format_String(CONS_UART_Write, Line, 0, Len);
-        xSemaphoreGive(CONS_Mutex);
+        OUT_Sentence(Line, Len);
 #ifdef WITH_SDLOG
         if(Log_Free()>=128)
         { xSemaphoreTake(Log_Mutex, portMAX_DELAY);
@@ -992,9 +992,10 @@ void vTaskPROC(void* pvParameters)
       }
     } else // if GPS position is not complete, contains no valid position, etc.
     { if((SlotTime-PosTime)>=30) { PosPacket.Packet.Position.Time=0x3F; } // if no valid position for more than 30 seconds then set the time as unknown for the transmitted packet
-      OGN_TxPacket<OGN_Packet> *TxPacket = OGN_TxFIFO.getWrite();
+      OGN_TxFrame *TxPacket = OGN_TxFIFO.getWrite();
       TxPacket->Packet = PosPacket.Packet;                            // copy the position packet
       TxPacket->Packet.Whiten(); TxPacket->calcFEC();                 // whiten and calculate FEC code
+      TxPacket->Encode();                                             // prepare the on-air frame
 #ifdef DEBUG_PRINT
       xSemaphoreTake(CONS_Mutex, portMAX_DELAY);
       Format_UnsDec(CONS_UART_Write, PosTime);
@@ -1038,7 +1039,7 @@ void vTaskPROC(void* pvParameters)
     ReadStatus(StatPacket.Packet);                               // read status data and put them into the StatPacket
     XorShift32(Random.RX);                                       // generate a new random number
     if( StatTxBackOff==0 && OGN_TxFIFO.Full()<2 )                 // decide whether to transmit the status/info packet
-    { OGN_TxPacket<OGN_Packet> *StatusPacket = OGN_TxFIFO.getWrite(); // ask for space in the Tx queue
+    { OGN_TxFrame *StatusPacket = OGN_TxFIFO.getWrite();         // ask for space in the Tx queue
       uint8_t doTx=1;
       if(Parameters.AddrType && Random.RX&0x10)                  // decide to transmit info or status packet ?
       { doTx=ReadInfo(StatPacket.Packet); }                      // and overwrite the StatPacket with the Info data
@@ -1053,13 +1054,14 @@ void vTaskPROC(void* pvParameters)
        *StatusPacket = StatPacket;                               // copy status packet into the Tx queue
         StatusPacket->Packet.Whiten();                           // whiten for transmission
         StatusPacket->calcFEC();                                 // calc. the FEC code
+        StatusPacket->Encode();                                  // prepare the on-air frame
         OGN_TxFIFO.Write();                                       // finalize write into the Tx queue
       }
     }
     if(StatTxBackOff) StatTxBackOff--;
 
     while(OGN_TxFIFO.Full()<2)                                   // any received OGN positions to be relayed ?
-    { OGN_TxPacket<OGN_Packet> *RelayPacket = OGN_TxFIFO.getWrite();
+    { OGN_TxFrame *RelayPacket = OGN_TxFIFO.getWrite();
       if(!GetRelayPacket(RelayPacket)) break;
       OGN_TxFIFO.Write(); }
 
@@ -1069,18 +1071,19 @@ void vTaskPROC(void* pvParameters)
       XorShift32(Random.RX);
       if(StatTxBackOff) StatTxBackOff--;
       else if(ADSL_TxFIFO.Full()<2 )                    // decide whether to transmit the status/info packet
-      { ADSL_Packet *Packet = ADSL_TxFIFO.getWrite();
+      { ADSL_TxFrame *Packet = ADSL_TxFIFO.getWrite();
         if(StatTxPkt==0) getTelemStatus(*Packet, Position);
         else if(StatTxPkt==1) getTelemSatSNR(*Packet);
         else if(!getTelemSatPPS(*Packet)) getTelemSatSNR(*Packet);
         StatTxPkt++; if(StatTxPkt>=3) StatTxPkt=0;
         Packet->Scramble();
         Packet->setCRC();
+        Packet->Encode();
         ADSL_TxFIFO.Write();
         StatTxBackOff = 10+Random.RX%5; }
     }
     while(ADSL_TxFIFO.Full()<2)                                  // any received ADS-L pasition to be relayed ?
-    { ADSL_Packet *RelayPacket = ADSL_TxFIFO.getWrite();
+    { ADSL_TxFrame *RelayPacket = ADSL_TxFIFO.getWrite();
       if(!GetRelayPacket(RelayPacket)) break;
       ADSL_TxFIFO.Write(); }
 #endif
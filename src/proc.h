@@ -10,14 +10,39 @@ extern  int32_t BatteryVoltageRate;   // [1/256 mV] averaged
 
 // extern FlightMonitor Flight;
 
+#ifndef RELAY_QUEUE_SIZE                    // can be set up to 256 for crowded places: all queue operations are O(log N)
 #ifdef WITH_ESP32
-const uint8_t RelayQueueSize = 32;
+#define RELAY_QUEUE_SIZE 32
 #else
-const uint8_t RelayQueueSize = 16;
+#define RELAY_QUEUE_SIZE 16
 #endif
+#endif
+const uint16_t RelayQueueSize = RELAY_QUEUE_SIZE;
 
 extern Relay_PrioQueue<OGN_RxPacket<OGN_Packet>, RelayQueueSize> OGN_RelayQueue;       // received packets and candidates to be relayed
 
+#ifdef WITH_FANOUT                          // traffic sentences queued for each output: a slow link does not hold the PROC task
+#include "out-fanout.h"
+const uint8_t OUT_Sinks = 1                 // outputs compiled in: USB console
+#ifdef WITH_BT4_SPP
+                        + 1
+#endif
+#ifdef WITH_BT_SPP
+                        + 1
+#endif
+#ifdef WITH_BLE_SPP
+                        + 1
+#endif
+#ifdef WITH_AP
+                        + 1
+#endif
+                        ;
+const uint8_t OUT_QueueSize = 32;           // 31 sentences waiting per output: the burst of the per-slot reports
+// the pool outlasts all queues full plus the one the producer holds: RAM about 4.5kB per output, 128-byte buffers
+typedef Out_FanOut<OUT_Sinks*(OUT_QueueSize-1)+1, 128, OUT_Sinks, OUT_QueueSize> PROC_FanOut;
+extern PROC_FanOut OUT_FanOut;
+#endif
+
 #ifdef __cplusplus
   extern "C"
 #endif
@@ -0,0 +1,158 @@
+#ifndef __RELAY_QUEUE_H__
+#define __RELAY_QUEUE_H__
+
+#include <stdint.h>
+
+#include "format.h"
+
+// The relay queue: the received packets, those with a non-zero rank are candidates to be relayed,
+// picked at random with the probability proportional to the rank (calcRelayRank() of the packet).
+// All per-packet operations are O(log Size), thus the queue can be 128..256 packets deep for crowded starts:
+// - a binary indexed (Fenwick) tree over the ranks: rank sum of the first slots, random selection by a descent of the tree,
+//   the slot picked for a given random number is the same as with a walk through the slots summing the ranks
+// - a tournament tree over the slot keys: the free slot or the one of lowest rank for the next packet
+// - an open-addressing hash of (AddrType, Address) to the slot of the most recent packet of that ID: duplicates
+// Rank and Alloc of a packet are changed only through the queue, except calcRelayRank() between getNew() and addNew().
+// cleanTime() stays a walk through the slots: it is called once per second.
+
+template<class PacketType, uint16_t Size=16>
+ class Relay_PrioQueue
+{ public:
+   static_assert(Size>=2 && Size<=256, "slot index must fit 8 bits");
+
+   static const uint16_t HashSize = Size<=8 ? 16 : Size<=16 ? 32 : Size<=32 ? 64 : Size<=64 ? 128 : Size<=128 ? 256 : 512; // load at most 1/2
+   static const uint16_t HashMask = HashSize-1;
+   static const uint16_t TreeTop  = Size<=16 ? 16 : Size<=32 ? 32 : Size<=64 ? 64 : Size<=128 ? 128 : 256; // highest power of 2 not below Size
+
+   static const uint32_t HashEmpty = 0xFFFFFFFF;                              // IDs are 26-bit
+
+   PacketType           Packet[Size];        // OGN packets
+   uint16_t             Sum;                 // sum of all ranks
+
+  private:
+   uint16_t SlotKey[Size];                   // zero for a free slot, rank+1 for an allocated one
+   uint16_t RankTree[Size+1];                // Fenwick tree of the ranks, 1-based
+   uint8_t  LowTree[Size];                   // [1..Size-1] the slot of the lowest key under this node, the leaves are implicit
+   uint32_t HashID[HashSize];                // the ID (AddrType, Address) or HashEmpty
+   uint8_t  HashSlot[HashSize];              // the slot of the most recent packet of this ID
+
+  public:
+   void Clear(void)                                                           // clear (reset) the queue
+   { for(uint16_t Idx=0; Idx<Size; Idx++)                                     // clear every packet
+     { Packet[Idx].Clear(); }
+     Sum=0;                                                                   // clear the rank sum
+     for(uint16_t Idx=0; Idx<Size; Idx++) SlotKey[Idx]=0;
+     for(uint16_t Idx=0; Idx<=Size; Idx++) RankTree[Idx]=0;
+     for(uint16_t Idx=0; Idx<HashSize; Idx++) HashID[Idx]=HashEmpty;
+     for(uint16_t Node=Size-1; Node; Node--) LowTree[Node]=Lower(Node);
+   }
+
+   PacketType * operator [](uint8_t Idx) { return Packet+Idx; }
+
+   uint8_t getLow(void) const { return LowTree[1]; }                          // a free slot or the one of the lowest rank
+
+   uint8_t getNew(void)                                                       // get (index of) a free or lowest rank packet
+   { uint8_t Idx=getLow();                                                    // the slot is free till addNew()
+     uint16_t Pos=hashFind(Packet[Idx].Packet.getAddressAndType());           // its packet is going to be overwritten:
+     if(HashID[Pos]!=HashEmpty && HashSlot[Pos]==Idx) hashErase(Pos);         // remove it from the hash
+     setSlot(Idx, 0, 0);
+     return Idx; }
+
+   uint16_t size(void) const                                                  // count all slots with Alloc flag set
+   { uint16_t Count=0;
+     for(uint16_t Idx=0; Idx<Size; Idx++)
+     { if(Packet[Idx].Alloc) Count++; }
+     return Count; }
+
+   PacketType *addNew(uint8_t NewIdx)                                         // add the new packet to the queue
+   { PacketType *Prev = 0;                                                    // returns the previous packet of the same ID
+     uint32_t AddressAndType = Packet[NewIdx].Packet.getAddressAndType();     // get ID of this packet: ID is address-type and address (2+24 = 26 bits)
+     uint16_t Pos=hashFind(AddressAndType);
+     if(HashID[Pos]!=HashEmpty)                                               // another packet with same ID:
+     { uint8_t PrevIdx=HashSlot[Pos];
+       if(PrevIdx!=NewIdx) { Prev=Packet+PrevIdx; clean(PrevIdx); } }         // then remove it: set rank to zero
+     HashID[Pos]=AddressAndType; HashSlot[Pos]=NewIdx;                        // now the new packet for this ID
+     setSlot(NewIdx, 1, Packet[NewIdx].Rank);                                 // mark as allocated, add the rank set by calcRelayRank()
+     return Prev; }
+
+   uint8_t getRand(uint32_t Rand) const                                       // get a position by random selection but probabilities prop. to ranks
+   { if(Sum==0) return Rand%Size;                                             //
+     uint16_t RankIdx = Rand%Sum;                                             // the first slot where the rank sum exceeds RankIdx
+     uint16_t Pos=0;
+     for(uint16_t Step=TreeTop; Step; Step>>=1)                               // descend the Fenwick tree
+     { uint16_t Next=Pos+Step; if(Next>Size) continue;
+       uint16_t Part=RankTree[Next]; bool Take = Part<=RankIdx;               // no branch on the random data
+       Pos = Take ? Next:Pos; RankIdx -= Take ? Part:0; }
+     return Pos; }                                                            // Pos slots sum up to no more than RankIdx
+
+   void cleanTime(uint8_t Time)                                                // clean up slots of given Time
+   { for(uint16_t Idx=0; Idx<Size; Idx++)
+     { if(Packet[Idx].Alloc==0) continue;
+       uint8_t PktTime=Packet[Idx].PosTime(); // Packet.Position.Time;
+       if( PktTime==Time || PktTime>=60) clean(Idx);
+     }
+   }
+
+   void clean(uint8_t Idx)                                                      // clean given slot, remove it from the sum
+   { setSlot(Idx, 0, 0); }                                                      // stays in the hash: the previous packet of its ID
+
+   void decrRank(uint8_t Idx, uint8_t Decr=1)                                   // decrement rank of given slot
+   { uint8_t Rank=Packet[Idx].Rank; if(Rank==0) return;                         // if zero already: do nothing
+     if(Decr>Rank) Decr=Rank;                                                   // if to decrement by more than the rank already: reduce the decrement
+     setSlot(Idx, 1, Rank-Decr); }                                              // update the rank of this slot
+
+   uint16_t Print(char *Out)
+   { uint16_t Len=0;
+     for(uint16_t Idx=0; Idx<Size; Idx++)                                       // loop through the slots
+     { if(Packet[Idx].Alloc==0) continue;
+       uint8_t Rank=Packet[Idx].Rank;
+       Out[Len++]=' '; Len+=Format_Hex(Out+Len, Rank);                          // print the slot Rank
+       // if(Rank)                                                                 // if Rank is none-zero
+       { Out[Len++]='/'; Len+=Format_Hex(Out+Len, Packet[Idx].Packet.getAddressAndType() );   // print address-type and address
+         Out[Len++]=':';
+         if(Packet[Idx].Packet.Header.Encrypted) Len+=Format_String(Out+Len, "ee");
+         else Len+=Format_UnsDec(Out+Len, (uint32_t)Packet[Idx].Packet.Position.Time, 2); // [sec] print time
+       }
+     }
+     Out[Len++]=' '; Len+=Format_Hex(Out+Len, Sum);                             // sum of all Ranks
+     Out[Len++]='/'; Len+=Format_Hex(Out+Len, getLow());                        // index of the lowest Rank or a free slot
+     Out[Len++]='\n'; Out[Len]=0; return Len; }
+
+  private:
+   void setSlot(uint8_t Idx, bool Alloc, uint8_t Rank)                          // new state of a slot into the trees and the rank sum
+   { Packet[Idx].Alloc=Alloc; Packet[Idx].Rank=Rank;
+     uint16_t Key = Alloc ? (uint16_t)Rank+1 : 0;                               // free slots first, then by rank
+     uint16_t OldKey = SlotKey[Idx]; if(Key==OldKey) return;
+     SlotKey[Idx]=Key;
+     int16_t Delta = (int16_t)(Key?Key-1:0) - (int16_t)(OldKey?OldKey-1:0);
+     if(Delta)
+     { Sum+=Delta;
+       for(uint16_t Pos=Idx+1; Pos<=Size; Pos+=Pos&(-Pos)) RankTree[Pos]+=Delta; }
+     for(uint16_t Node=(Idx+Size)>>1; Node; Node>>=1) LowTree[Node]=Lower(Node); }
+
+   uint8_t Slot(uint16_t Node) const                                            // the lowest slot under a node, leaves are Size..2*Size-1
+   { return Node>=Size ? Node-Size : LowTree[Node]; }
+
+   uint8_t Lower(uint16_t Node) const                                           // the lower of the two children
+   { uint8_t Left=Slot(2*Node), Right=Slot(2*Node+1);
+     return SlotKey[Right]<SlotKey[Left] ? Right:Left; }
+
+   static uint16_t hashHome(uint32_t AddressAndType)                            // multiplicative hash of the 26-bit ID
+   { return (uint16_t)((AddressAndType*0x9E3779B1)>>16)&HashMask; }
+
+   uint16_t hashFind(uint32_t AddressAndType) const                             // position of the ID or the empty one where it would go
+   { uint16_t Pos=hashHome(AddressAndType);
+     for( ; HashID[Pos]!=HashEmpty; Pos=(Pos+1)&HashMask)
+       if(HashID[Pos]==AddressAndType) break;
+     return Pos; }
+
+   void hashErase(uint16_t Pos)                                                 // linear probing: shift back the entries which follow
+   { for(uint16_t Next=(Pos+1)&HashMask; HashID[Next]!=HashEmpty; Next=(Next+1)&HashMask)
+     { uint16_t Home=hashHome(HashID[Next]);
+       if(((Next-Home)&HashMask) < ((Next-Pos)&HashMask)) continue;            // Home is between Pos and Next: stays
+       HashID[Pos]=HashID[Next]; HashSlot[Pos]=HashSlot[Next]; Pos=Next; }
+     HashID[Pos]=HashEmpty; }
+
+} ;
+
+#endif // __RELAY_QUEUE_H__
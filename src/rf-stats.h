@@ -0,0 +1,241 @@
+#ifndef __RF_STATS_H__
+#define __RF_STATS_H__
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef ARDUINO
+#include "freertos/FreeRTOS.h"
+#endif
+
+#include "format.h"
+#include "crc1021.h"
+
+// RF statistics per channel and radio system: time-binned packet counts, RSSI and noise histograms, LBT deferrals.
+// Fixed memory: a table of (channel,system) cells, the least recently used cell is taken over by a new pair.
+// Cells are created only by the RF task, vTaskPROC only adds the decode results into existing cells.
+// The RF task takes over cells and advances the bins while vTaskPROC counts and HTTP or the console read:
+// every update and every read of a cell runs within a short critical section, the readers format from a copy.
+
+#ifndef RF_STATS_CELLS
+#define RF_STATS_CELLS 24
+#endif
+
+class RF_StatCell
+{ public:
+   static const uint8_t Bins      =    6;             // time bins in the ring
+   static const uint8_t BinSec    =   10;             // [sec] per bin => one minute of history
+   static const uint8_t HistBins  =    8;             // bins in the dBm histograms, the first and last are open-ended
+   static const  int8_t RSSImin   = -120;             // [dBm] packet RSSI: <-120, -120..-111, ... , >=-60
+   static const uint8_t RSSIstep  =   10;             // [dB]
+   static const  int8_t NoiseMin  = -115;             // [dBm] background noise: <-115, -115..-113, ... , >=-97
+   static const uint8_t NoiseStep =    3;             // [dB]
+
+   static const uint8_t Rx        = 0;                // packets read out of the RF chip
+   static const uint8_t Decoded   = 1;                // packets which passed the FEC/CRC, including the corrected ones
+   static const uint8_t Corrected = 2;                // decoded packets which needed bit corrections
+   static const uint8_t Failed    = 3;                // packets which failed system resolution, FEC or CRC
+   static const uint8_t LBT       = 4;                // transmissions deferred by listen-before-talk
+   static const uint8_t Counts    = 5;
+
+   uint8_t  Chan;                                     // radio channel as given to Radio_Slot()
+   uint8_t  SysID;                                    // Radio_SysID_..., 0xFF => free cell
+   uint8_t  Bin;                                      // current (most recent) bin of the ring
+   uint32_t BinTime;                                  // [sec] start of the current bin
+   uint32_t LastTime;                                 // [sec] most recent update: to pick a cell for reuse
+   uint16_t Count[Bins][Counts];                      // packet counts per time bin
+   uint16_t RSSI[HistBins];                           // RSSI of received packets
+   uint16_t Noise[HistBins];                          // background noise samples
+
+  public:
+   void Clear(void) { memset(this, 0, sizeof(RF_StatCell)); SysID=0xFF; }
+   bool isFree(void) const { return SysID==0xFF; }
+
+   void Init(uint8_t NewChan, uint8_t NewSysID, uint32_t Now)
+   { Clear(); Chan=NewChan; SysID=NewSysID; BinTime=Now-Now%BinSec; LastTime=Now; }
+
+   void Advance(uint32_t Now)                         // move the ring to the bin of the given time, clear the bins skipped
+   { uint32_t Steps = (Now-BinTime)/BinSec; if(Steps==0) return;
+     BinTime += Steps*BinSec;
+     if(Steps>Bins) Steps=Bins;
+     for( ; Steps; Steps--)
+     { Bin++; if(Bin>=Bins) Bin=0;
+       memset(Count[Bin], 0, sizeof(Count[Bin])); }
+   }
+
+   void Inc(uint8_t Idx) { uint16_t &Cnt=Count[Bin][Idx]; if(Cnt<0xFFFF) Cnt++; }
+
+   static uint8_t HistIdx(float dBm, int8_t Min, uint8_t Step)
+   { int Idx = (int)floorf((dBm-Min)/Step)+1;
+     if(Idx<0) Idx=0; else if(Idx>=HistBins) Idx=HistBins-1;
+     return Idx; }
+
+   static void HistAdd(uint16_t *Hist, uint8_t Idx) { if(Hist[Idx]<0xFFFF) Hist[Idx]++; }
+
+   uint16_t getSum(uint8_t Idx) const                 // sum over all bins
+   { uint16_t Sum=0; for(uint8_t Bin=0; Bin<Bins; Bin++) Sum+=Count[Bin][Idx]; return Sum; }
+
+   int WriteJSON(char *Out) const                     // one cell as a JSON object, bins oldest first
+   { static const char *Name[Counts] = { "rx", "dec", "corr", "fail", "lbt" } ;
+     int Len=Format_String(Out, "{\"chan\":");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)Chan);
+     Len+=Format_String(Out+Len, ",\"sys\":");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)SysID);
+     Len+=Format_String(Out+Len, ",\"time\":");
+     Len+=Format_UnsDec(Out+Len, BinTime);
+     for(uint8_t Idx=0; Idx<Counts; Idx++)
+     { Out[Len++]=','; Out[Len++]='\"'; Len+=Format_String(Out+Len, Name[Idx]); Out[Len++]='\"'; Out[Len++]=':';
+       Out[Len++]='[';
+       for(uint8_t Age=0; Age<Bins; Age++)
+       { if(Age) Out[Len++]=',';
+         Len+=Format_UnsDec(Out+Len, (uint32_t)Count[(Bin+1+Age)%Bins][Idx]); }
+       Out[Len++]=']'; }
+     Len+=Format_String(Out+Len, ",\"rssi\":"); Len+=WriteJSON(Out+Len, RSSI);
+     Len+=Format_String(Out+Len, ",\"noise\":"); Len+=WriteJSON(Out+Len, Noise);
+     Out[Len++]='}'; Out[Len]=0;
+     return Len; }
+
+   static int WriteJSON(char *Out, const uint16_t *Hist)
+   { int Len=0;
+     Out[Len++]='[';
+     for(uint8_t Idx=0; Idx<HistBins; Idx++)
+     { if(Idx) Out[Len++]=',';
+       Len+=Format_UnsDec(Out+Len, (uint32_t)Hist[Idx]); }
+     Out[Len++]=']';
+     return Len; }
+
+} ;
+
+class RF_Stats
+{ public:
+   static const uint8_t Cells = RF_STATS_CELLS;
+   static const uint8_t SnapVersion = 1;
+   static const int     MaxJSON = 512;                // [bytes] buffer for one cell in JSON
+
+   RF_StatCell Cell[Cells];
+
+#ifdef ARDUINO
+   mutable portMUX_TYPE Mux = portMUX_INITIALIZER_UNLOCKED;
+   void Lock(void)   const { portENTER_CRITICAL(&Mux); }
+   void Unlock(void) const { portEXIT_CRITICAL(&Mux); }
+#else
+   void Lock(void)   const { }                        // host tests: single task
+   void Unlock(void) const { }
+#endif
+
+  public:
+   void Clear(void) { Lock(); for(uint8_t Idx=0; Idx<Cells; Idx++) Cell[Idx].Clear(); Unlock(); }
+
+   bool getCell(RF_StatCell &Copy, uint8_t Idx) const // copy of a cell for the readers, false when the cell is free
+   { Lock(); Copy=Cell[Idx]; Unlock(); return !Copy.isFree(); }
+
+   RF_StatCell *Find(uint8_t Chan, uint8_t SysID)     // existing cell or NULL: under Lock() when the table is in use
+   { for(uint8_t Idx=0; Idx<Cells; Idx++)
+     { RF_StatCell &Stat=Cell[Idx];
+       if(Stat.SysID==SysID && Stat.Chan==Chan) return &Stat; }
+     return 0; }
+
+   RF_StatCell *Get(uint8_t Chan, uint8_t SysID, uint32_t Now) // existing cell, else a free or the least recently used one: RF task only, under Lock()
+   { RF_StatCell *Stat=Find(Chan, SysID);
+     if(Stat) { Stat->Advance(Now); Stat->LastTime=Now; return Stat; }
+     Stat=Cell;
+     for(uint8_t Idx=0; Idx<Cells; Idx++)
+     { if(Cell[Idx].isFree()) { Stat=Cell+Idx; break; }
+       if((int32_t)(Cell[Idx].LastTime-Stat->LastTime)<0) Stat=Cell+Idx; }
+     Stat->Init(Chan, SysID, Now);
+     return Stat; }
+
+   void addRx(uint8_t Chan, uint8_t SysID, float RSSI, uint32_t Now, bool Fail=0) // a packet read from the RF chip
+   { uint8_t Hist=RF_StatCell::HistIdx(RSSI, RF_StatCell::RSSImin, RF_StatCell::RSSIstep);
+     Lock();
+     RF_StatCell *Stat=Get(Chan, SysID, Now);
+     Stat->Inc(RF_StatCell::Rx); if(Fail) Stat->Inc(RF_StatCell::Failed);
+     RF_StatCell::HistAdd(Stat->RSSI, Hist);
+     Unlock(); }
+
+   void addNoise(uint8_t Chan, uint8_t SysID, float Noise, uint32_t Now) // background noise sample
+   { uint8_t Hist=RF_StatCell::HistIdx(Noise, RF_StatCell::NoiseMin, RF_StatCell::NoiseStep);
+     Lock(); RF_StatCell::HistAdd(Get(Chan, SysID, Now)->Noise, Hist); Unlock(); }
+
+   void addLBT(uint8_t Chan, uint8_t SysID, uint32_t Now) // transmission deferred by listen-before-talk
+   { Lock(); Get(Chan, SysID, Now)->Inc(RF_StatCell::LBT); Unlock(); }
+
+   void addDecode(uint8_t Chan, uint8_t SysID, int CorrBits) // decode result: <0 => failed, 0 => good, >0 => corrected
+   { Lock();
+     RF_StatCell *Stat=Find(Chan, SysID);             // the cell can be gone already: then do not count
+     if(Stat)
+     { if(CorrBits<0) Stat->Inc(RF_StatCell::Failed);
+       else
+       { Stat->Inc(RF_StatCell::Decoded);
+         if(CorrBits>0) Stat->Inc(RF_StatCell::Corrected); }
+     }
+     Unlock(); }
+
+   uint8_t Used(void) const
+   { uint8_t Count=0;
+     Lock(); for(uint8_t Idx=0; Idx<Cells; Idx++) if(!Cell[Idx].isFree()) Count++; Unlock();
+     return Count; }
+
+   // binary snapshot: "RFS", version, time, layout, then the used cells and CRC16 (0x1021) over all preceding bytes
+   // cell: Chan, SysID, BinTime[4], Count[Bins][Counts][2] (oldest bin first), RSSI[HistBins][2], Noise[HistBins][2]
+   // all multi-byte values are little-endian
+   static void Write(void (*Output)(char), uint16_t &CRC, uint8_t Byte) { (*Output)(Byte); CRC=crc1021(CRC, Byte); }
+   static void Write(void (*Output)(char), uint16_t &CRC, uint16_t Word) { Write(Output, CRC, (uint8_t)Word); Write(Output, CRC, (uint8_t)(Word>>8)); }
+   static void Write(void (*Output)(char), uint16_t &CRC, uint32_t Word) { Write(Output, CRC, (uint16_t)Word); Write(Output, CRC, (uint16_t)(Word>>16)); }
+
+   static int SnapshotLen(uint8_t Used)
+   { return 3+1+4+9 + Used*(2+4+2*RF_StatCell::Bins*RF_StatCell::Counts+4*RF_StatCell::HistBins) + 2; }
+
+   int WriteSnapshot(void (*Output)(char), uint32_t Now) const
+   { uint16_t CRC=0xFFFF;
+     Write(Output, CRC, (uint8_t)'R'); Write(Output, CRC, (uint8_t)'F'); Write(Output, CRC, (uint8_t)'S');
+     Write(Output, CRC, SnapVersion);
+     Write(Output, CRC, Now);
+     Write(Output, CRC, RF_StatCell::BinSec);
+     Write(Output, CRC, RF_StatCell::Bins);
+     Write(Output, CRC, RF_StatCell::Counts);
+     Write(Output, CRC, RF_StatCell::HistBins);
+     Write(Output, CRC, (uint8_t)RF_StatCell::RSSImin);
+     Write(Output, CRC, RF_StatCell::RSSIstep);
+     Write(Output, CRC, (uint8_t)RF_StatCell::NoiseMin);
+     Write(Output, CRC, RF_StatCell::NoiseStep);
+     uint8_t Count=Used();                            // cells are never freed, only taken over, thus Count can only grow
+     Write(Output, CRC, Count);
+     uint8_t Left=Count;
+     for(uint8_t Idx=0; Idx<Cells && Left; Idx++)     // a cell created meanwhile does not fit the count: skip it
+     { RF_StatCell Stat; if(!getCell(Stat, Idx)) continue; // a copy: the output can be slow
+       Left--;
+       Write(Output, CRC, Stat.Chan);
+       Write(Output, CRC, Stat.SysID);
+       Write(Output, CRC, Stat.BinTime);
+       for(uint8_t Age=0; Age<RF_StatCell::Bins; Age++)
+       { const uint16_t *Bin=Stat.Count[(Stat.Bin+1+Age)%RF_StatCell::Bins];
+         for(uint8_t Cnt=0; Cnt<RF_StatCell::Counts; Cnt++) Write(Output, CRC, Bin[Cnt]); }
+       for(uint8_t Bin=0; Bin<RF_StatCell::HistBins; Bin++) Write(Output, CRC, Stat.RSSI[Bin]);
+       for(uint8_t Bin=0; Bin<RF_StatCell::HistBins; Bin++) Write(Output, CRC, Stat.Noise[Bin]); }
+     uint16_t Check=CRC;
+     Write(Output, CRC, Check);
+     return SnapshotLen(Count); }
+
+   int WriteJSONhead(char *Out, uint32_t Now) const   // opens the JSON document, cells follow with WriteJSON() and ',' between
+   { int Len=Format_String(Out, "{\"time\":");
+     Len+=Format_UnsDec(Out+Len, Now);
+     Len+=Format_String(Out+Len, ",\"binsec\":");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)RF_StatCell::BinSec);
+     Len+=Format_String(Out+Len, ",\"rssi_min\":");
+     Len+=Format_SignDec(Out+Len, (int32_t)RF_StatCell::RSSImin, 1, 0, 1);
+     Len+=Format_String(Out+Len, ",\"rssi_step\":");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)RF_StatCell::RSSIstep);
+     Len+=Format_String(Out+Len, ",\"noise_min\":");
+     Len+=Format_SignDec(Out+Len, (int32_t)RF_StatCell::NoiseMin, 1, 0, 1);
+     Len+=Format_String(Out+Len, ",\"noise_step\":");
+     Len+=Format_UnsDec(Out+Len, (uint32_t)RF_StatCell::NoiseStep);
+     Len+=Format_String(Out+Len, ",\"cells\":[");
+     return Len; }
+
+   static int WriteJSONtail(char *Out) { return Format_String(Out, "]}"); }
+
+} ;
+
+#endif // __RF_STATS_H__
@@ -0,0 +1,116 @@
+#ifndef __RF_TRACE_H__
+#define __RF_TRACE_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rf-stats.h"
+
+// Binary trace of the RF task events: a fixed ring of 8-byte timestamped records, cheap enough to be always on.
+// Single writer (the RF task): the event is stored first, then the write index is advanced,
+// the reader (console dump) detects the records overwritten while it was reading them out.
+// The IRQ time is taken in the interrupt but recorded by the RF task when it reads the packet out.
+
+#ifndef RF_TRACE_SIZE
+#define RF_TRACE_SIZE 1024                            // [events] must be a power of 2
+#endif
+
+class RF_TraceEvent
+{ public:
+   uint32_t usTime;                                   // [usec] micros() when the event happened
+   uint8_t  Type;                                     // RF_Trace::Slot, ...
+   uint8_t  Arg;                                      // channel, system or band: depends on the Type
+   uint16_t Val;                                      // value: depends on the Type
+} ;
+
+class RF_Trace
+{ public:
+   static const uint32_t Size    = RF_TRACE_SIZE;
+   static const uint32_t Mask    = Size-1;
+   static const uint8_t  Version = 1;
+
+   //                                   Arg              Val
+   static const uint8_t Slot       =  1; // channel         RxSysID | TxSysID<<8 (0xFF => no TX)
+   static const uint8_t SlotEnd    =  2; // channel         packets received in the slot
+   static const uint8_t ConfigStart=  3; // SysID           0=RX, 1=TX
+   static const uint8_t ConfigEnd  =  4; // SysID           0=RX, 1=TX
+   static const uint8_t RxStart    =  5; // channel         SysID
+   static const uint8_t IRQ        =  6; // -               -         (time of the IRQ edge)
+   static const uint8_t Read       =  7; // SysID           RSSI [-0.5dBm], SysID=0xFF => not resolved
+   static const uint8_t TxStart    =  8; // band            packet length [bytes]
+   static const uint8_t TxEnd      =  9; // band            -
+   static const uint8_t FIFOfull   = 10; // 0=FSK, 1=FANET  -         (received packet dropped)
+   static const uint8_t LBT        = 11; // channel         RSSI [-0.5dBm] (transmission deferred)
+   static const uint8_t WANrx      = 12; // channel         packet length [bytes], 0 => nothing received
+   static const uint8_t Types      = 13;
+
+   static const uint8_t SysWAN     = 0xFE;           // SysID of the LoRaWAN config events
+
+   volatile uint32_t WriteIdx;                        // total number of events recorded so far
+   RF_TraceEvent Event[Size];
+
+  public:
+   void Clear(void) { WriteIdx=0; }
+
+   void Add(uint32_t usTime, uint8_t Type, uint8_t Arg=0, uint16_t Val=0) // RF task only
+   { uint32_t Idx=WriteIdx;
+     RF_TraceEvent &Ev=Event[Idx&Mask];
+     Ev.usTime=usTime; Ev.Type=Type; Ev.Arg=Arg; Ev.Val=Val;
+     __atomic_store_n(&WriteIdx, Idx+1, __ATOMIC_RELEASE); }
+
+   static const char *TypeName(uint8_t Type)
+   { static const char *Name[Types] = { "?", "Slot", "SlotEnd", "ConfStart", "ConfEnd", "RxStart", "IRQ", "Read",
+                                        "TxStart", "TxEnd", "FIFOfull", "LBT", "WANrx" } ;
+     return Type<Types ? Name[Type]:Name[0]; }
+
+   // binary dump: "RFT", version, Size[2], Start[4], End[4], (End-Start) events of 8 bytes, After[4], CRC16 (0x1021) over all preceding bytes
+   // event: usTime[4], Type, Arg, Val[2], all multi-byte values are little-endian
+   // events with index below After-Size have been overwritten while being dumped: the reader should drop them
+   static int DumpLen(uint32_t Events) { return 3+1+2+4+4+8*Events+4+2; }
+
+   int WriteDump(void (*Output)(char)) const
+   { uint16_t CRC=0xFFFF;
+     uint32_t End=__atomic_load_n(&WriteIdx, __ATOMIC_ACQUIRE);
+     uint32_t Start = End>Size ? End-Size:0;
+     RF_Stats::Write(Output, CRC, (uint8_t)'R'); RF_Stats::Write(Output, CRC, (uint8_t)'F'); RF_Stats::Write(Output, CRC, (uint8_t)'T');
+     RF_Stats::Write(Output, CRC, Version);
+     RF_Stats::Write(Output, CRC, (uint16_t)Size);
+     RF_Stats::Write(Output, CRC, Start);
+     RF_Stats::Write(Output, CRC, End);
+     for(uint32_t Idx=Start; Idx!=End; Idx++)
+     { const RF_TraceEvent &Ev=Event[Idx&Mask];
+       RF_Stats::Write(Output, CRC, Ev.usTime);
+       RF_Stats::Write(Output, CRC, Ev.Type);
+       RF_Stats::Write(Output, CRC, Ev.Arg);
+       RF_Stats::Write(Output, CRC, Ev.Val); }
+     uint32_t After=__atomic_load_n(&WriteIdx, __ATOMIC_ACQUIRE);
+     RF_Stats::Write(Output, CRC, After);
+     uint16_t Check=CRC;
+     RF_Stats::Write(Output, CRC, Check);
+     return DumpLen(End-Start); }
+
+   static uint32_t get32(const uint8_t *Data) { return Data[0] | (uint32_t)Data[1]<<8 | (uint32_t)Data[2]<<16 | (uint32_t)Data[3]<<24; }
+   static uint16_t get16(const uint8_t *Data) { return Data[0] | (uint16_t)Data[1]<<8; }
+
+   // parse a dump: returns the number of valid events written to Out or negative on a format/CRC error, Len set to the dump length
+   static int ReadDump(RF_TraceEvent *Out, int MaxOut, const uint8_t *Data, int &Len)
+   { if(Len<DumpLen(0) || memcmp(Data, "RFT", 3)!=0 || Data[3]!=Version) return -1;
+     uint32_t DumpSize=get16(Data+4);
+     uint32_t Start=get32(Data+6), End=get32(Data+10);
+     uint32_t Events=End-Start;
+     if(Events>DumpSize || DumpLen(Events)>Len) return -1;
+     Len=DumpLen(Events);
+     if(crc1021(0xFFFF, Data, Len-2)!=get16(Data+Len-2)) return -2;
+     uint32_t After=get32(Data+Len-6);
+     uint32_t Valid = After>DumpSize ? After-DumpSize:0;  // the oldest index not overwritten during the dump
+     const uint8_t *Ev=Data+14;
+     int Count=0;
+     for(uint32_t Idx=Start; Idx!=End; Idx++, Ev+=8)
+     { if((int32_t)(Idx-Valid)<0 || Count>=MaxOut) continue;
+       RF_TraceEvent &Event=Out[Count++];
+       Event.usTime=get32(Ev); Event.Type=Ev[4]; Event.Arg=Ev[5]; Event.Val=get16(Ev+6); }
+     return Count; }
+
+} ;
+
+#endif // __RF_TRACE_H__
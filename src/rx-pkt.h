@@ -1,3 +1,6 @@
+#ifndef __RX_PKT_H__
+#define __RX_PKT_H__
+
 #include <stdint.h>
 #include <string.h>
 
@@ -16,6 +19,34 @@ const uint8_t Radio_SysID_HDR  = 6;  // ADS-L HDR
 const uint8_t Radio_SysID_FLR_ADSL  = 8; // FLARM with ADS-L
 const uint8_t Radio_SysID_OGN_ADSL  = 9; // OGN with ADS-L
 
+// A multi-system SYNC is shorter than the SYNC of each system, thus the packet is received with the rest
+// of its own SYNC in front: this signature tells the system and where the packet starts.
+class FSK_SyncSign
+{ public:
+   uint64_t Sign;                     // signature bits, right-aligned
+   uint8_t  RxSysID;                  // reception mode: which SYNC the RF chip was looking for
+   uint8_t  SysID;                    // system this signature resolves into
+   uint8_t  Bits;                     // [bits] signature length, the packet starts right after it
+   uint8_t  MaxErr;                   // [bits] Hamming distance tolerance
+   uint8_t  MaxOfs;                   // [bits] search this many bits around the nominal position
+   uint8_t  Bytes;                    // [bytes] packet size after the signature
+
+  public:
+   constexpr FSK_SyncSign(uint8_t RxSysID, uint8_t SysID, uint8_t Bits, uint64_t Sign, uint8_t MaxErr, uint8_t MaxOfs, uint8_t Bytes)
+     : Sign(Sign), RxSysID(RxSysID), SysID(SysID), Bits(Bits), MaxErr(MaxErr), MaxOfs(MaxOfs), Bytes(Bytes) { }
+} ;
+
+constexpr FSK_SyncSign FSK_SyncSignTable[] =
+{ //           reception mode        resolves into     bits signature        err ofs bytes
+  FSK_SyncSign(Radio_SysID_OGN_ADSL, Radio_SysID_ADSL, 20,      0x24B18ULL,  1,  2,  24 ),
+  FSK_SyncSign(Radio_SysID_OGN_ADSL, Radio_SysID_OGN , 21,     0x13656CULL,  1,  2,  26 ),
+  FSK_SyncSign(Radio_SysID_FLR_ADSL, Radio_SysID_ADSL, 23,     0x724B18ULL,  1,  2,  24 ),
+  FSK_SyncSign(Radio_SysID_FLR_ADSL, Radio_SysID_FLR , 23,     0x31FAB6ULL,  1,  2,  26 ),
+  FSK_SyncSign(Radio_SysID_LDR     , Radio_SysID_LDR , 48, 0x000000001871ULL, 2, 16,  25 )  // 6 bytes left of the LDR SYNC, 24 bytes plus the CRC
+} ;
+
+const int FSK_SyncSigns = sizeof(FSK_SyncSignTable)/sizeof(FSK_SyncSign);
+
 class FSK_RxPacket                    // Radio packet received by the RF chip
 { public:
    static const uint8_t MaxBytes=48;  // [bytes] max. number of bytes in the packet
@@ -57,7 +88,7 @@ class FSK_RxPacket                    // Radio packet received by the RF chip
      if(SysID==Radio_SysID_FLR)      { SYNC=SYNC_FLR6;     PktLen=26;   return 8; }
      if(SysID==Radio_SysID_OGN)      { SYNC=SYNC_OGN1;     PktLen=26;   return 8; }
      if(SysID==Radio_SysID_ADSL)     { SYNC=SYNC_ADSL;     PktLen=24;   return 8; }
-     if(SysID==Radio_SysID_LDR)      { SYNC=SYNC_LDR;      PktLen=24;   return 2; }
+     if(SysID==Radio_SysID_LDR)      { SYNC=SYNC_LDR;      PktLen=24;   return 2; } // receive PktLen+9: 6 bytes of SYNC, CRC and 2 bytes for the bit-offset search
      if(SysID==Radio_SysID_FLR_ADSL) { SYNC=SYNC_FLR_ADSL; PktLen=26+3; return 2; }
      if(SysID==Radio_SysID_OGN_ADSL) { SYNC=SYNC_OGN_ADSL; PktLen=26+3; return 2; }
      return 0; }
@@ -74,32 +105,45 @@ class FSK_RxPacket                    // Radio packet received by the RF chip
      { Count+=Count1s(Data[Idx]^Ref[Idx]); }
      return Count; }
 
+   static uint64_t getBits(const uint8_t *Data, int Pos, int Len) // get Len (up to 56) bits starting at bit Pos, MSB first
+   { uint64_t Word=0;
+     int Idx=Pos>>3; int Skip=Pos&7;
+     int Need=Skip+Len;
+     for( ; Need>0; Need-=8) Word = (Word<<8) | Data[Idx++];
+     Word >>= (-Need);                                     // drop the bits past the end
+     if(Len<64) Word &= ((uint64_t)1<<Len)-1;
+     return Word; }
+
+   // find the signature and its position which best match the data received with the given multi-system SYNC
+   // returns the Hamming distance or -1 when nothing within the tolerance
+   static int Classify(const FSK_SyncSign * &Match, int &Ofs, const uint8_t *Data, uint8_t Bytes, uint8_t RxSysID)
+   { int BestErr=(-1); int BestDist=0; Match=0; Ofs=0;
+     for(int Idx=0; Idx<FSK_SyncSigns; Idx++)
+     { const FSK_SyncSign &Sign = FSK_SyncSignTable[Idx];
+       if(Sign.RxSysID!=RxSysID) continue;
+       for(int Dist=0; Dist<=Sign.MaxOfs; Dist++)         // search from the nominal position outwards
+       { for(int Dir=0; Dir<2; Dir++)
+         { if(Dist==0 && Dir) break;
+           int Pos = Dir ? -Dist:Dist;                     // [bits] where the signature starts in Data
+           int End = Pos+Sign.Bits;                        // [bits] where the packet starts
+           if(End+8*Sign.Bytes>8*Bytes) continue;          // packet would not fit into what was received
+           int Bits = Sign.Bits;                           // when the signature starts before the Data
+           if(Pos<0) { Bits+=Pos; Pos=0; if(Bits<16) continue; } // then compare only its tail but not less than 16 bits
+           uint64_t Ref = Sign.Sign; if(Bits<64) Ref &= ((uint64_t)1<<Bits)-1;
+           int Err = Count1s(getBits(Data, Pos, Bits)^Ref);
+           if(Err>Sign.MaxErr) continue;
+           if(BestErr>=0 && (Err>BestErr || (Err==BestErr && Dist>=BestDist))) continue; // equal: keep the closer to nominal or the earlier in the table
+           BestErr=Err; BestDist=Dist; Match=&Sign; Ofs=Dir ? -Dist:Dist;
+           if(Err==0 && Dist==0) return 0; }               // can not be any better
+       }
+     }
+     return BestErr; }
+
    uint8_t DecodeSysID(void) // resolve multi-system receptions into unique types
-   { if(SysID==Radio_SysID_OGN_ADSL)                       // if OGN+ADSL SYNC
-     { const uint8_t SignADSL[3] = { 0x24, 0xB1, 0x80 } ;
-       const uint8_t MaskADSL[3] = { 0xFF, 0xFF, 0xF0 } ;
-       const uint8_t SignOGN [3] = { 0x9B, 0x2B, 0x60 } ;
-       const uint8_t MaskOGN [3] = { 0xFF, 0xFF, 0xF8 } ;
-            if(DiffBits(Data, SignADSL, MaskADSL, 3)<=1)
-       { BitShift(20); Bytes=24; SysID=Radio_SysID_ADSL; }
-       else if(DiffBits(Data, SignOGN, MaskOGN, 3)<=1)
-       { BitShift(21); Bytes=26; SysID=Radio_SysID_OGN; }
-       return SysID; }
-     if(SysID==Radio_SysID_FLR_ADSL)                       // if FLARM+ADSL SYNC
-     { const uint8_t SignADSL[3] = { 0xE4, 0x96, 0x30 } ;
-       const uint8_t MaskADSL[3] = { 0xFF, 0xFF, 0xFE } ;
-       const uint8_t SignFLR [3] = { 0x63, 0xF5, 0x6C } ;
-       const uint8_t MaskFLR [3] = { 0xFF, 0xFF, 0xFE } ;
-            if(DiffBits(Data, SignADSL, MaskADSL, 3)<=1)
-       { BitShift(23); Bytes=24; SysID=Radio_SysID_ADSL; }
-       else if(DiffBits(Data, SignFLR, MaskFLR, 3)<=1)
-       { BitShift(23); Bytes=26; SysID=Radio_SysID_FLR; }
-       return SysID; }
-     if(SysID==Radio_SysID_LDR && Bytes>=31)
-     { const uint8_t SignLDR[6] = { 0x00, 0x00, 0x00, 0x00, 0x18, 0x71 };
-       if(DiffBits(Data, SignLDR, 6)<=2)
-       { ByteShift(6); }
-       return SysID; }
+   { const FSK_SyncSign *Sign; int Ofs;
+     if(Classify(Sign, Ofs, Data, Bytes, SysID)<0) return SysID; // no signature within the tolerance: leave as is
+     BitShift(Sign->Bits+Ofs);                             // skip the signature: the packet starts right after it
+     Bytes=Sign->Bytes; SysID=Sign->SysID;
      return SysID; }
 
    static uint8_t ByteShift(uint8_t *Data, uint8_t Bytes, uint8_t Shift)
@@ -183,14 +227,65 @@ class FSK_RxPacket                    // Radio packet received by the RF chip
        Count+=Count1s((uint8_t)((Data[Idx]^Corr[Idx])&(~Err[Idx])));
      return Count; }
 
+   // Soft decisions for the LDPC decoder, in the order of reception (MSB first) like LDPC_Decoder::Input(const int8_t *).
+   // The RF chip gives hard chips: a pair hit by one chip error shows as a Manchester error (erased, soft value 0),
+   // a pair hit by two flips passes as a valid but wrong bit. How likely that is follows from the chip error rate,
+   // estimated from the Manchester errors around the bit (bursts: collisions, fading) blended with the packet-wide rate
+   // and the rate expected from the SNR, the confidence of a valid bit is then the log-likelihood ratio of both flips.
+   static const uint8_t SoftSpan   = 16;                // [bits] neighbours where the Manchester errors are counted
+   static const uint8_t SoftPrior  = 16;                // [bits] weight of the packet-wide error rate against the neighbours
+   static const uint8_t SoftScale  = 16;                // [1/LLR] soft value per unit of log-likelihood ratio
+
+   static float ChipErrRate(float PairErrRate)          // pair error rate 2p(1-p) => chip error rate p
+   { if(PairErrRate>0.49f) PairErrRate=0.49f;
+     return 0.5f*(1.0f-sqrtf(1.0f-2.0f*PairErrRate)); }
+
+   void getSoft(int8_t *Soft, uint8_t Bits) const       // Bits must be more than SoftSpan and not more than 8*Bytes
+   { uint8_t Errors=0;
+     for(uint8_t Idx=0; Idx<Bits/8; Idx++) Errors+=Count1s(Err[Idx]);
+     float Prior = (Errors+0.5f)/Bits;                  // pair error rate over the packet
+     if(SNR)                                            // [0.25dB] SNR known: average with what a hard decision on the chips would give
+     { float ChipErr = 0.5f*erfcf(sqrtf(powf(10.0f, 0.025f*SNR)));
+       Prior = 0.5f*(Prior + 2*ChipErr*(1-ChipErr)); }
+     float Expect = SoftSpan*Prior;                     // Manchester errors expected among the neighbours
+     float Burst  = Expect + 2*sqrtf(Expect) + 1;       // more than that: a burst, else just the spread of the noise
+     int8_t Ampl[SoftSpan+1];                           // soft value of a valid bit vs. Manchester errors among its neighbours
+     for(uint8_t Count=0; Count<=SoftSpan; Count++)
+     { float ChipErr = ChipErrRate(Count>Burst ? (Count+SoftPrior*Prior)/(SoftSpan+SoftPrior) : Prior);
+       int Val = floorf(SoftScale*2*logf((1-ChipErr)/ChipErr)+0.5f);    // both chips must flip for a wrong valid bit
+       if(Val>127) Val=127; else if(Val<1) Val=1;
+       Ampl[Count]=Val; }
+     for(uint8_t Bit=0; Bit<Bits; Bit++)                // Bit in the order of reception
+     { uint8_t Mask = 0x80>>(Bit&7);
+       if(Err[Bit>>3]&Mask) { Soft[Bit]=0; continue; }  // Manchester error: no information on this bit
+       int Start = Bit-SoftSpan/2;                      // the window stays inside the packet: always SoftSpan neighbours
+       if(Start<0) Start=0; else if(Start>Bits-1-SoftSpan) Start=Bits-1-SoftSpan;
+       uint8_t Count = Count1s(getBits(Err, Start, SoftSpan+1));         // the bit itself is not an error
+       Soft[Bit] = (Data[Bit>>3]&Mask) ? Ampl[Count]:-Ampl[Count]; }
+   }
+
  template <class OGNx_Packet>
   uint8_t Decode(OGN_RxPacket<OGNx_Packet> &Packet, LDPC_Decoder &Decoder, uint8_t Iter=32) const
+  { Decoder.Input(Data, Err);                                  // put data into the FEC decoder: hard bits and erasures
+    return DecodeInput(Packet, Decoder, Iter); }
+
+ template <class OGNx_Packet>
+  uint8_t Decode(OGN_RxPacket<OGNx_Packet> &Packet, LDPC_Decoder &Decoder, int8_t *Soft, uint8_t Iter=32) const
+  { getSoft(Soft, LDPC_Decoder::CodeBits);                     // Soft: space for LDPC_Decoder::CodeBits soft decisions
+    Decoder.Input(Soft);                                       // graded by the Manchester error density and the SNR
+    return DecodeInput(Packet, Decoder, Iter); }
+
+ template <class OGNx_Packet>
+  uint8_t DecodeInput(OGN_RxPacket<OGNx_Packet> &Packet, LDPC_Decoder &Decoder, uint8_t Iter) const // with the input already in the Decoder
   { uint8_t Check=0;
     uint8_t RxErr = ErrCount();                                // conunt Manchester decoding errors
-    Decoder.Input(Data, Err);                                  // put data into the FEC decoder
+#ifdef WITH_LDPC_FLOODING
     for( ; Iter; Iter--)                                       // more loops is more chance to recover the packet
     { Check=Decoder.ProcessChecks();                           // do an iteration
       if(Check==0) break; }                                    // if FEC all fine: break
+#else
+    Check=Decoder.ProcessLayers(Iter);                         // layered schedule: stops when all checks pass or no progress
+#endif
     Decoder.Output(Packet.Packet.Byte());                      // get corrected bytes into the OGN packet
     RxErr += ErrCount(Packet.Packet.Byte());
     if(RxErr>15) RxErr=15;
@@ -202,3 +297,4 @@ class FSK_RxPacket                    // Radio packet received by the RF chip
 
 } __attribute__((packed)) ;
 
+#endif // __RX_PKT_H__
@@ -0,0 +1,78 @@
+#ifndef __SLOT_PLAN_H__
+#define __SLOT_PLAN_H__
+
+#include <stdint.h>
+
+#include "freqplan.h"
+#include "ognconv.h"
+#include "rx-pkt.h"
+
+// The FSK half-slots of every second as tables per frequency plan: Radio_Task() picks a variant by a hash of the UTC second
+// and executes its two half-slots. Each half-slot tells where to listen, what to transmit and with which power offset.
+// FANET (LoRa, before the first half-slot) and LoRaWAN (after the second one) are not part of the tables.
+
+class Radio_SlotRule
+{ public:
+   static const uint8_t Chan_FLR   = 0;           // FLARM hopping channel of this half-slot
+   static const uint8_t Chan_OGN   = 1;           // OGN hopping channel of this half-slot
+   static const uint8_t Chan_OBAND = 2;           // O-band: the channel number just above the plan's channels
+
+   uint16_t msStart;                              // [ms] time window relative to the PPS
+   uint16_t msEnd;
+   uint8_t  Chan;                                 // channel rule: Chan_FLR, Chan_OGN or Chan_OBAND
+   uint8_t  TxSysID;                              // what to transmit (if a packet is ready): OGN, ADS-L or ADS-L over LDR
+   uint8_t  RxSysID;                              // what to receive: single or multi-system SYNC
+    int8_t  TxPwr;                                // [dB] on top of the user TxPower
+
+  public:
+   constexpr Radio_SlotRule(uint16_t msStart, uint16_t msEnd, uint8_t Chan, uint8_t TxSysID, uint8_t RxSysID, int8_t TxPwr)
+     : msStart(msStart), msEnd(msEnd), Chan(Chan), TxSysID(TxSysID), RxSysID(RxSysID), TxPwr(TxPwr) { }
+
+   uint8_t getChannel(const FreqPlan &Plan, uint32_t UTC, uint8_t Slot) const
+   { if(Chan==Chan_OBAND) return Plan.Channels;  // getChanFrequency() gives the O-band frequency for it
+     return Plan.getChannel(UTC, Slot, Chan==Chan_OGN); }
+
+   uint16_t msMinLen(void) const { return 250; }                      // [ms] shortest and longest half-slot when the previous one ran late or early
+   uint16_t msMaxLen(void) const { return msEnd-msStart+80; }
+} ;
+
+const uint8_t Radio_HalfSlots = 2;
+
+//                                    time window    channel                    transmit          receive                power
+constexpr Radio_SlotRule Radio_SlotPlanEU[][Radio_HalfSlots] =           // Europe/Africa: M-band and O-band, ADS-L with FLARM and OGN
+{ { Radio_SlotRule( 400,  800, Radio_SlotRule::Chan_FLR  , Radio_SysID_ADSL, Radio_SysID_FLR_ADSL,  0 ),
+    Radio_SlotRule( 800, 1200, Radio_SlotRule::Chan_OGN  , Radio_SysID_OGN , Radio_SysID_OGN_ADSL,  0 ) },
+  { Radio_SlotRule( 400,  800, Radio_SlotRule::Chan_OGN  , Radio_SysID_OGN , Radio_SysID_OGN_ADSL,  0 ),
+    Radio_SlotRule( 800, 1200, Radio_SlotRule::Chan_FLR  , Radio_SysID_ADSL, Radio_SysID_FLR_ADSL,  0 ) },
+  { Radio_SlotRule( 400,  800, Radio_SlotRule::Chan_OBAND, Radio_SysID_LDR , Radio_SysID_LDR     , 13 ),
+    Radio_SlotRule( 800, 1200, Radio_SlotRule::Chan_OGN  , Radio_SysID_OGN , Radio_SysID_OGN_ADSL,  0 ) }
+} ;
+
+constexpr Radio_SlotRule Radio_SlotPlanHop[][Radio_HalfSlots] =          // hopping plans (USA, Australia, ...) and single-channel plans
+{ { Radio_SlotRule( 400,  800, Radio_SlotRule::Chan_OGN  , Radio_SysID_OGN , Radio_SysID_OGN     , 13 ),
+    Radio_SlotRule( 800, 1200, Radio_SlotRule::Chan_FLR  , Radio_SysID_OGN , Radio_SysID_FLR     , 13 ) },
+  { Radio_SlotRule( 400,  800, Radio_SlotRule::Chan_FLR  , Radio_SysID_OGN , Radio_SysID_FLR     , 13 ),
+    Radio_SlotRule( 800, 1200, Radio_SlotRule::Chan_OGN  , Radio_SysID_OGN , Radio_SysID_OGN     , 13 ) }
+} ;
+
+class Radio_SlotPlan
+{ public:
+   const Radio_SlotRule (*Variant)[Radio_HalfSlots];
+   uint8_t Variants;
+
+  public:
+   static Radio_SlotPlan get(uint8_t Plan)        // the table for the given FreqPlan::Plan
+   { Radio_SlotPlan SlotPlan;
+     if(Plan<=1) { SlotPlan.Variant=Radio_SlotPlanEU;  SlotPlan.Variants=sizeof(Radio_SlotPlanEU )/sizeof(Radio_SlotPlanEU [0]); }
+            else { SlotPlan.Variant=Radio_SlotPlanHop; SlotPlan.Variants=sizeof(Radio_SlotPlanHop)/sizeof(Radio_SlotPlanHop[0]); }
+     return SlotPlan; }
+
+   static uint32_t Hash(uint32_t UTC)             // pseudo-random but the same for everybody in the given second
+   { XorShift32(UTC); UTC*=48271;
+     XorShift32(UTC); UTC*=48271;
+     return UTC; }
+
+   const Radio_SlotRule *getVariant(uint32_t UTC) const { return Variant[Hash(UTC)%Variants]; }
+} ;
+
+#endif // __SLOT_PLAN_H__
@@ -116,6 +116,12 @@ class DataServer
      if(Idx>=MaxConn) { close(New); return -1; }   // if no free slots then close the new client and give up
      Client[Idx]=New; return New; }
 
+   int Clients(void) const                         // number of connected clients
+   { int Count=0;
+     for(int Idx=0; Idx<MaxConn; Idx++)
+       if(Client[Idx]>=0) Count++;
+     return Count; }
+
    // static int Send(int Link, void *Buff, int Len)
    // { if(Link<0) return -1;
    //   return send(Link, Buff, Len, 0); }
@@ -0,0 +1,135 @@
+#ifndef __TEA_BATCH_H__
+#define __TEA_BATCH_H__
+
+#include <stdint.h>
+#include <string.h>
+
+// Batch TEA and XXTEA with the zero key of ognconv.cpp: OGN whitening (TEA_Encrypt_Key0() on two blocks of the position)
+// and ADS-L scrambling (XXTEA_Encrypt_Key0() over 5 words), for many packets at once on the host or in the relay.
+// One lane carries one block (TEA) or one packet (XXTEA), the rounds of all lanes run interleaved: the dependency chain
+// of one block is long and serial, a group of lanes fills the pipeline. Results are bit-exact with the scalar functions.
+// GCC vector extensions map a part of the lanes onto SSE2 (4 lanes per register) or AVX2 (8 lanes) depending on the
+// -m/-march flags, two parts are interleaved. With TEA_BATCH_SCALAR or a compiler without the extensions a part
+// is a plain uint32_t and four of them are interleaved. The firmware runs the two blocks of Whiten() through the same kernel.
+
+#if defined(__GNUC__) && !defined(TEA_BATCH_SCALAR)
+#define TEA_BATCH_VECTOR
+#endif
+
+#ifdef TEA_BATCH_VECTOR
+#ifdef __AVX2__
+typedef uint32_t TEA_BatchReg __attribute__((vector_size(32)));  // one register: 8 lanes with AVX2
+#else
+typedef uint32_t TEA_BatchReg __attribute__((vector_size(16)));  // 4 lanes with SSE2 (or NEON)
+#endif
+#endif
+
+const uint32_t TEA_Delta = 0x9e3779b9;                           // the key schedule constant
+
+// the kernels: Parts independent parts of the lanes, a Part is uint32_t or a vector register, Sum is the same in all lanes
+
+template <class Part, int Parts>
+ inline void TEA_Encrypt_Key0_Lanes(Part *V0, Part *V1, int Loops)
+{ uint32_t Sum=0;
+  for(int Loop=0; Loop<Loops; Loop++)
+  { Sum += TEA_Delta;
+    for(int Idx=0; Idx<Parts; Idx++) V0[Idx] += (V1[Idx]<<4) ^ (V1[Idx] + Sum) ^ (V1[Idx]>>5);
+    for(int Idx=0; Idx<Parts; Idx++) V1[Idx] += (V0[Idx]<<4) ^ (V0[Idx] + Sum) ^ (V0[Idx]>>5); }
+}
+
+template <class Part, int Parts>
+ inline void TEA_Decrypt_Key0_Lanes(Part *V0, Part *V1, int Loops)
+{ uint32_t Sum=TEA_Delta*Loops;
+  for(int Loop=0; Loop<Loops; Loop++)
+  { for(int Idx=0; Idx<Parts; Idx++) V1[Idx] -= (V0[Idx]<<4) ^ (V0[Idx] + Sum) ^ (V0[Idx]>>5);
+    for(int Idx=0; Idx<Parts; Idx++) V0[Idx] -= (V1[Idx]<<4) ^ (V1[Idx] + Sum) ^ (V1[Idx]>>5);
+    Sum -= TEA_Delta; }
+}
+
+template <class Part>
+ inline Part XXTEA_MX_Key0(Part Y, Part Z, uint32_t Sum)
+{ return (((Z>>5) ^ (Y<<2)) + ((Y>>3) ^ (Z<<4))) ^ ((Y ^ Sum) + Z); }
+
+template <class Part, int Parts>
+ inline void XXTEA_Encrypt_Key0_Lanes(Part V[][Parts], int Words, int Loops)   // V[Word][Part]
+{ uint32_t Sum=0; Part Z[Parts];
+  for(int Idx=0; Idx<Parts; Idx++) Z[Idx]=V[Words-1][Idx];
+  for( ; Loops; Loops--)
+  { Sum += TEA_Delta;
+    for(int P=0; P<Words-1; P++)
+      for(int Idx=0; Idx<Parts; Idx++) Z[Idx] = V[P][Idx] += XXTEA_MX_Key0(V[P+1][Idx], Z[Idx], Sum);
+    for(int Idx=0; Idx<Parts; Idx++) Z[Idx] = V[Words-1][Idx] += XXTEA_MX_Key0(V[0][Idx], Z[Idx], Sum); }
+}
+
+template <class Part, int Parts>
+ inline void XXTEA_Decrypt_Key0_Lanes(Part V[][Parts], int Words, int Loops)
+{ uint32_t Sum=TEA_Delta*Loops; Part Y[Parts];
+  for(int Idx=0; Idx<Parts; Idx++) Y[Idx]=V[0][Idx];
+  for( ; Loops; Loops--)
+  { for(int P=Words-1; P; P--)
+      for(int Idx=0; Idx<Parts; Idx++) Y[Idx] = V[P][Idx] -= XXTEA_MX_Key0(Y[Idx], V[P-1][Idx], Sum);
+    for(int Idx=0; Idx<Parts; Idx++) Y[Idx] = V[0][Idx] -= XXTEA_MX_Key0(Y[Idx], V[Words-1][Idx], Sum);
+    Sum -= TEA_Delta; }
+}
+
+// the batch: gathers the lanes from the packets, runs a kernel on a group of lanes, scatters them back
+
+class TEA_Batch
+{ public:
+#ifdef TEA_BATCH_VECTOR
+   typedef TEA_BatchReg Part;
+   static const int Parts = 2;                                   // two registers interleaved
+#else
+   typedef uint32_t Part;
+   static const int Parts = 4;                                   // four words interleaved
+#endif
+   static const int PartLanes = sizeof(Part)/sizeof(uint32_t);
+   static const int Lanes     = Parts*PartLanes;                 // blocks or packets per kernel call
+   static const int MaxWords  = 16;                              // XXTEA: the largest packet in words
+
+   // TEA with the zero key on Blocks blocks of two words, Data[Block] points to each, like TEA_Encrypt_Key0(Data[Block], Loops)
+   static void Encrypt_Key0(uint32_t * const *Data, int Blocks, int Loops) { RunTEA(Data, Blocks, Loops, 0); }
+   static void Decrypt_Key0(uint32_t * const *Data, int Blocks, int Loops) { RunTEA(Data, Blocks, Loops, 1); }
+
+   // XXTEA with the zero key on Packets packets of Words words (2..MaxWords), like XXTEA_Encrypt_Key0(Data[Packet], Words, Loops)
+   static void XXTEA_Encrypt_Key0(uint32_t * const *Data, int Packets, int Words, int Loops) { RunXXTEA(Data, Packets, Words, Loops, 0); }
+   static void XXTEA_Decrypt_Key0(uint32_t * const *Data, int Packets, int Words, int Loops) { RunXXTEA(Data, Packets, Words, Loops, 1); }
+
+  private:
+   union Group                                                   // Words x Lanes, seen as parts for the kernel or as words to gather and scatter
+   { Part     P[MaxWords][Parts];
+     uint32_t W[MaxWords][Lanes];
+   } ;
+
+   static void RunTEA(uint32_t * const *Data, int Blocks, int Loops, bool Decrypt)
+   { Group G;
+     for(int First=0; First<Blocks; First+=Lanes)
+     { int Used = Blocks-First; if(Used>Lanes) Used=Lanes;    // the last group may be partly empty: zero lanes, not stored
+       memset(G.W, 0, 2*sizeof(G.W[0]));
+       for(int Lane=0; Lane<Used; Lane++)
+       { G.W[0][Lane]=Data[First+Lane][0]; G.W[1][Lane]=Data[First+Lane][1]; }
+       if(Decrypt) TEA_Decrypt_Key0_Lanes<Part, Parts>(G.P[0], G.P[1], Loops);
+              else TEA_Encrypt_Key0_Lanes<Part, Parts>(G.P[0], G.P[1], Loops);
+       for(int Lane=0; Lane<Used; Lane++)
+       { Data[First+Lane][0]=G.W[0][Lane]; Data[First+Lane][1]=G.W[1][Lane]; }
+     }
+   }
+
+   static void RunXXTEA(uint32_t * const *Data, int Packets, int Words, int Loops, bool Decrypt)
+   { if(Words<2 || Words>MaxWords) return;
+     Group G;
+     for(int First=0; First<Packets; First+=Lanes)
+     { int Used = Packets-First; if(Used>Lanes) Used=Lanes;
+       memset(G.W, 0, Words*sizeof(G.W[0]));
+       for(int Lane=0; Lane<Used; Lane++)
+         for(int Word=0; Word<Words; Word++) G.W[Word][Lane]=Data[First+Lane][Word];
+       if(Decrypt) XXTEA_Decrypt_Key0_Lanes<Part, Parts>(G.P, Words, Loops);
+              else XXTEA_Encrypt_Key0_Lanes<Part, Parts>(G.P, Words, Loops);
+       for(int Lane=0; Lane<Used; Lane++)
+         for(int Word=0; Word<Words; Word++) Data[First+Lane][Word]=G.W[Word][Lane];
+     }
+   }
+
+} ;
+
+#endif // __TEA_BATCH_H__
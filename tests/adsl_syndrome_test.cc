@@ -0,0 +1,145 @@
+// ADSL_Packet::FindCRCpattern(): the perfect hash of adsl.cpp (regenerated by utils/adsl_syndrome_gen and compared first, see the makefile) against a brute-force search over all 1-bit and 2-bit error patterns,
+// all 3-bit patterns must be rejected (the PI has distance 6), random syndromes must match the brute-force result.
+// Then ADSL_Packet::Correct() and PAW_Packet::CorrectLDR() on packets with double bit errors not marked as Manchester errors,
+// and the lookup time against the binary search of the single-bit syndrome table it replaced.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <map>
+
+#include "adsl.h"
+#include "paw.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x13579BDF;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int Bytes = ADSL_Packet::TxBytes-3;
+const int Bits  = Bytes*8;
+
+static std::map<uint32_t, uint16_t> RefPattern;        // brute force: syndrome => (Bit1<<8)|Bit2
+
+static uint16_t RefFind(uint32_t Syndr)
+{ std::map<uint32_t, uint16_t>::const_iterator It=RefPattern.find(Syndr);
+  return It==RefPattern.end() ? 0xFFFF : It->second; }
+
+static uint8_t RefFindSingle(uint32_t Syndr)           // what FindCRCsyndrome() did: binary search of the sorted single-bit syndromes
+{ static uint32_t Syndrome[Bits]; static bool Init=0;
+  if(!Init)
+  { for(int Bit=0; Bit<Bits; Bit++) Syndrome[Bit]=(ADSL_Packet::CRCsyndrome(Bit)<<8) | Bit;
+    qsort(Syndrome, Bits, 4, [](const void *A, const void *B) { uint32_t a=*(const uint32_t *)A, b=*(const uint32_t *)B; return a<b ? -1 : a>b; } );
+    Init=1; }
+  uint16_t Bot=0, Top=Bits;
+  for( ; ; )
+  { uint16_t Mid=(Bot+Top)>>1;
+    uint32_t MidSyndr = Syndrome[Mid]>>8;
+    if(Syndr==MidSyndr) return (uint8_t)Syndrome[Mid];
+    if(Mid==Bot) break;
+    if(Syndr< MidSyndr) Top=Mid;
+                   else Bot=Mid; }
+  return 0xFF; }
+
+static void MakePacket(uint8_t *Data)                  // random ADS-L packet with a valid PI
+{ for(int Idx=0; Idx<Bytes-3; Idx++) Data[Idx]=getRand();
+  uint32_t PI=ADSL_Packet::calcPI(Data, Bytes-3);
+  Data[Bytes-3]=PI>>16; Data[Bytes-2]=PI>>8; Data[Bytes-1]=PI; }
+
+static void Test_Patterns(void)
+{ for(int Bit1=0; Bit1<Bits; Bit1++)
+  { RefPattern[ADSL_Packet::CRCsyndrome(Bit1)] = (Bit1<<8) | 0xFF;
+    for(int Bit2=Bit1+1; Bit2<Bits; Bit2++)
+      RefPattern[ADSL_Packet::CRCsyndrome(Bit1)^ADSL_Packet::CRCsyndrome(Bit2)] = (Bit1<<8) | Bit2; }
+  Check("all 1-bit and 2-bit syndromes distinct", RefPattern.size()==(size_t)(Bits+Bits*(Bits-1)/2) && RefFind(0)==0xFFFF);
+
+  int Wrong=0, Single=0;
+  for(std::map<uint32_t, uint16_t>::const_iterator It=RefPattern.begin(); It!=RefPattern.end(); It++)
+  { if(ADSL_Packet::FindCRCpattern(It->first)!=It->second) Wrong++;
+    if(ADSL_Packet::FindCRCsyndrome(It->first)!=RefFindSingle(It->first)) Single++; }
+  Check("lookup finds every 1-bit and 2-bit pattern", Wrong==0);
+  Check("single-bit lookup as the binary search", Single==0);
+
+  int Alias=0;
+  for(int Bit1=0; Bit1<Bits; Bit1++)
+    for(int Bit2=Bit1+1; Bit2<Bits; Bit2++)
+    { uint32_t Syndr2 = ADSL_Packet::CRCsyndrome(Bit1)^ADSL_Packet::CRCsyndrome(Bit2);
+      for(int Bit3=Bit2+1; Bit3<Bits; Bit3++)
+        if(ADSL_Packet::FindCRCpattern(Syndr2^ADSL_Packet::CRCsyndrome(Bit3))!=0xFFFF) Alias++; }
+  Check("all 3-bit patterns rejected", Alias==0);
+
+  int Diff=0, Found=0;
+  for(int Test=0; Test<1000000; Test++)
+  { uint32_t Syndr=getRand()&0xFFFFFF;
+    uint16_t Pattern=ADSL_Packet::FindCRCpattern(Syndr);
+    if(Pattern!=RefFind(Syndr)) Diff++;
+    if(Pattern!=0xFFFF) Found++; }
+  printf("random syndromes: %d out of 1000000 are 1-bit or 2-bit patterns\n", Found);
+  Check("random syndromes as the brute force", Diff==0); }
+
+static void Test_Correct(void)
+{ const int Packets = 20000;
+  int Single=0, Double=0, Keep=0, Erased=0, LDR=0, PAW=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint8_t Data[Bytes], Rx[Bytes], Err[Bytes];
+    MakePacket(Data);
+    int Bit1=getRand()%Bits, Bit2=getRand()%Bits; while(Bit2==Bit1) Bit2=getRand()%Bits;
+    memset(Err, 0, Bytes);
+    memcpy(Rx, Data, Bytes); ADSL_Packet::FlipBit(Rx, Bit1);
+    if(ADSL_Packet::Correct(Rx, Err)==1 && memcmp(Rx, Data, Bytes)==0) Single++;
+    ADSL_Packet::FlipBit(Rx, Bit1); ADSL_Packet::FlipBit(Rx, Bit2);
+    if(ADSL_Packet::Correct(Rx, Err)<0) Keep++;                                // by default only one unmarked bit error
+    if(ADSL_Packet::Correct(Rx, Err, 6, 2)==2 && memcmp(Rx, Data, Bytes)==0) Double++;
+    memcpy(Rx, Data, Bytes); ADSL_Packet::FlipBit(Rx, Bit1);
+    int Bit3=getRand()%Bits; ADSL_Packet::FlipBit(Rx, Bit3); ADSL_Packet::FlipBit(Err, Bit3); // one marked plus one unmarked
+    if(ADSL_Packet::Correct(Rx, Err)==2 && memcmp(Rx, Data, Bytes)==0) Erased++;
+    else if(Bit3==Bit1) Erased++;                                               // then it is the single marked bit error
+
+    uint8_t Frame[Bytes+1];                                                    // LDR: the ADS-L packet plus the external CRC8
+    memcpy(Frame, Data, Bytes); Frame[Bytes]=PAW_Packet::CRC8(Frame, Bytes);
+    uint8_t RxFrame[Bytes+1], RxErr[Bytes+1];
+    memcpy(RxFrame, Frame, Bytes+1); memset(RxErr, 0, Bytes+1);
+    ADSL_Packet::FlipBit(RxFrame, Bit1); ADSL_Packet::FlipBit(RxFrame, Bit2);
+    bool ADSL=0;
+    if(PAW_Packet::CorrectLDR(RxFrame, RxErr, ADSL)==2 && ADSL && memcmp(RxFrame, Frame, Bytes+1)==0) LDR++;
+
+    Frame[Bytes-1]=PAW_Packet::IntCRC(Frame, Bytes-1);                         // a PAW packet: internal CRC, whitened, external CRC8
+    PAW_Packet::Whiten(Frame, Bytes);
+    Frame[Bytes]=PAW_Packet::CRC8(Frame, Bytes);
+    memcpy(RxFrame, Frame, Bytes+1);
+    if(PAW_Packet::CorrectLDR(RxFrame, RxErr, ADSL)==0 && !ADSL) PAW++; }
+  Check("Correct(): single unmarked bit error", Single==Packets);
+  Check("Correct(): double unmarked error only when asked", Keep==Packets && Double==Packets);
+  Check("Correct(): marked plus unmarked bit error", Erased==Packets);
+  Check("CorrectLDR(): ADS-L with two bit errors", LDR>=Packets-Packets/1000); // CRC8 blind to the error and the XOR check passes: taken for PAW
+  Check("CorrectLDR(): PAW packets still pass", PAW==Packets); }
+
+static uint32_t Sink=0;
+
+static void Benchmark(void)
+{ const int Syndr = 1<<16;
+  static uint32_t Syndrome[Syndr];
+  for(int Idx=0; Idx<Syndr; Idx++)                                             // half of them single bit errors
+    Syndrome[Idx] = (Idx&1) ? ADSL_Packet::CRCsyndrome(getRand()%Bits) : getRand()&0xFFFFFF;
+  double Time[2];
+  for(int Test=0; Test<2; Test++)
+  { int Rounds=0; double Start=getTime();
+    do
+    { for(int Idx=0; Idx<Syndr; Idx++)
+        Sink += Test ? ADSL_Packet::FindCRCsyndrome(Syndrome[Idx]) : RefFindSingle(Syndrome[Idx]);
+      Rounds++; Time[Test]=getTime()-Start; } while(Time[Test]<0.3);
+    Time[Test]/=(double)Rounds*Syndr; }
+  printf("single-bit lookup: binary search %5.1f ns, perfect hash %5.1f ns\n", 1e9*Time[0], 1e9*Time[1]); }
+
+int main(int argc, char *argv[])
+{ Test_Patterns();
+  Test_Correct();
+  Benchmark();
+  return CheckResult(); }
@@ -0,0 +1,22 @@
+#ifndef __CHECK_H__
+#define __CHECK_H__
+
+#include <stdio.h>
+
+// The harness of the host tests: one line per check with the name and OK or FAIL, the test ends with CheckResult():
+// the last line is OK or FAIL, for the makefile the exit code is non-zero when any check failed.
+
+static int Fail=0;                                      // checks failed so far
+
+static inline void Check(const char *Name, bool OK)     // a condition
+{ printf("%-56s %s\n", Name, OK?"OK":"FAIL"); Fail+=!OK; }
+
+static inline void Check(const char *Name, double Value, double Min, double Max) // a measured value within [Min..Max]
+{ bool OK = Value>=Min && Value<=Max;
+  printf("%-44s %10.3f  [%g..%g] %s\n", Name, Value, Min, Max, OK?"OK":"FAIL"); Fail+=!OK; }
+
+static inline int CheckResult(void)                     // to return from main()
+{ printf("%s\n", Fail?"FAIL":"OK");
+  return Fail ? 1 : 0; }
+
+#endif // __CHECK_H__
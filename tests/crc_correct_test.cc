@@ -0,0 +1,207 @@
+// CRC_Corrector of crc-correct.h: the hard input against the former Flarm_Packet::Correct() and ADSL_Packet::Correct()
+// (same Gray-code order, so the same result), getWeakest() against a full sort, the soft input on packets with
+// Manchester errors and weak unmarked bit errors, and the time of the full search per budget.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include "flarm.h"
+#include "adsl.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x2468ACE1;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+// ---------------------------------------------------------------------------------------------------
+// the reference: the former erasure search of both packets, Word is the syndrome, Bytes data plus CRC
+
+template <class Word, int Bytes, Word (*Syndrome)(uint8_t), uint8_t (*FindSyndrome)(Word)>
+ static int RefCorrect(uint8_t *PktData, const uint8_t *PktErr, Word CRC, const int MaxBadBits=6)
+{ if(CRC==0) return 0;
+  uint8_t ErrBit=FindSyndrome(CRC);
+  if(ErrBit!=0xFF) { Flarm_Packet::FlipBit(PktData, ErrBit); return 1; }
+  uint8_t BadBitIdx[16], BadBitMask[16]; Word BitSyndr[16];
+  uint8_t BadBits=0;
+  for(uint8_t ByteIdx=0; ByteIdx<Bytes; ByteIdx++)
+  { uint8_t Byte=PktErr[ByteIdx];
+    uint8_t Mask=0x80;
+    for(uint8_t BitIdx=0; BitIdx<8; BitIdx++)
+    { if(Byte&Mask)
+      { if(BadBits<MaxBadBits)
+        { BadBitIdx[BadBits]=ByteIdx; BadBitMask[BadBits]=Mask; BitSyndr[BadBits]=Syndrome(ByteIdx*8+BitIdx); }
+        BadBits++; }
+      Mask>>=1; }
+    if(BadBits>MaxBadBits) break; }
+  if(BadBits>MaxBadBits) return -1;
+  uint16_t Loops = 1<<BadBits; uint16_t PrevGrayIdx=0;
+  for(uint16_t Idx=1; Idx<Loops; Idx++)
+  { uint16_t GrayIdx= Idx ^ (Idx>>1);
+    uint16_t BitExp = GrayIdx^PrevGrayIdx;
+    uint8_t Bit=0; while(BitExp>>=1) Bit++;
+    PktData[BadBitIdx[Bit]]^=BadBitMask[Bit];
+    CRC^=BitSyndr[Bit]; if(CRC==0) return Count1s(GrayIdx);
+    ErrBit=FindSyndrome(CRC);
+    if(ErrBit!=0xFF) { Flarm_Packet::FlipBit(PktData, ErrBit); return Count1s(GrayIdx)+1; }
+    PrevGrayIdx=GrayIdx; }
+  return -1; }
+
+const int FLR_Bytes  = Flarm_Packet::Bytes+2;
+const int ADSL_Bytes = ADSL_Packet::TxBytes-3;
+
+static void MakeFLR(uint8_t *Data)
+{ Flarm_Packet Pkt;
+  for(int Idx=0; Idx<Flarm_Packet::Bytes; Idx++) Pkt.Byte[Idx]=getRand();
+  Pkt.setCRC();
+  memcpy(Data, Pkt.Byte, FLR_Bytes); }
+
+static void MakeADSL(uint8_t *Data)
+{ for(int Idx=0; Idx<ADSL_Bytes-3; Idx++) Data[Idx]=getRand();
+  uint32_t PI=ADSL_Packet::calcPI(Data, ADSL_Bytes-3);
+  Data[ADSL_Bytes-3]=PI>>16; Data[ADSL_Bytes-2]=PI>>8; Data[ADSL_Bytes-1]=PI; }
+
+static void Damage(uint8_t *Rx, uint8_t *Err, int Bytes)  // 0..9 marked bits, each wrong by half, and sometimes one unmarked
+{ memset(Err, 0, Bytes);
+  int Marked=getRand()%10;
+  for(int Idx=0; Idx<Marked; Idx++)
+  { int Bit=getRand()%(8*Bytes); Err[Bit>>3]|=0x80>>(Bit&7);
+    if(getRand()&1) Flarm_Packet::FlipBit(Rx, Bit); }
+  if((getRand()&3)==0) Flarm_Packet::FlipBit(Rx, getRand()%(8*Bytes)); }
+
+static void Test_Hard(void)
+{ int Diff[2]={0,0}, Corr[2]={0,0};
+  for(int Test=0; Test<100000; Test++)
+  { uint8_t Data[32], Rx[32], Ref[32], Err[32];
+    MakeFLR(Data); memcpy(Rx, Data, FLR_Bytes); Damage(Rx, Err, FLR_Bytes); memcpy(Ref, Rx, FLR_Bytes);
+    int MaxBits=4+Test%4;
+    int Res=Flarm_Packet::Correct(Rx, Err, MaxBits);
+    int RefRes=RefCorrect<uint16_t, FLR_Bytes, Flarm_Packet::CRCsyndrome, Flarm_Packet::FindCRCsyndrome>
+                 (Ref, Err, Flarm_Packet::checkCRC(Ref, Flarm_Packet::Bytes), MaxBits);
+    if(Res!=RefRes || (Res>=0 && memcmp(Rx, Ref, FLR_Bytes))) Diff[0]++;
+    if(Res>=0 && memcmp(Rx, Data, FLR_Bytes)==0) Corr[0]++;
+
+    MakeADSL(Data); memcpy(Rx, Data, ADSL_Bytes); Damage(Rx, Err, ADSL_Bytes); memcpy(Ref, Rx, ADSL_Bytes);
+    Res=ADSL_Packet::Correct(Rx, Err, MaxBits);
+    uint32_t CRC=ADSL_Packet::checkPI(Ref, ADSL_Bytes);                    // the former ADS-L Correct() took two unmarked bits first
+    RefRes = CRC ? ADSL_Packet::CorrectSyndrome(Ref, CRC, 1) : 0;
+    if(RefRes<0) RefRes=RefCorrect<uint32_t, ADSL_Bytes, ADSL_Packet::CRCsyndrome, ADSL_Packet::FindCRCsyndrome>(Ref, Err, CRC, MaxBits);
+    if(Res!=RefRes || (Res>=0 && memcmp(Rx, Ref, ADSL_Bytes))) Diff[1]++;
+    if(Res>=0 && memcmp(Rx, Data, ADSL_Bytes)==0) Corr[1]++; }
+  printf("hard input, 100000 packets: FLARM %d corrected, ADS-L %d corrected\n", Corr[0], Corr[1]);
+  Check("FLARM hard input as the former Correct()", Diff[0]==0);
+  Check("ADS-L hard input as the former Correct()", Diff[1]==0); }
+
+static void Test_Weakest(void)
+{ typedef Flarm_Packet::Corrector FLR;
+  int Diff=0, Gate=0;
+  for(int Test=0; Test<20000; Test++)
+  { int8_t Soft[8*FLR_Bytes]; int Erased=0;
+    for(int Bit=0; Bit<8*FLR_Bytes; Bit++)
+    { int Val = (getRand()%64==0) ? 0 : (int)(getRand()%80)-40;
+      Soft[Bit]=Val; Erased+=Val==0; }
+    int MaxBits=1+Test%FLR::MaxSearchBits;
+    uint8_t BitIdx[FLR::MaxSearchBits];
+    int Bits=FLR::getWeakest(BitIdx, Soft, MaxBits);
+    if(Erased>MaxBits) { Gate+=Bits==-1; continue; }
+    int Order[8*FLR_Bytes];
+    for(int Bit=0; Bit<8*FLR_Bytes; Bit++) Order[Bit]=Bit;
+    std::stable_sort(Order, Order+8*FLR_Bytes, [&](int A, int B) { return abs(Soft[A])<abs(Soft[B]); } );
+    bool Same = Bits==MaxBits;
+    for(int Idx=0; Same && Idx<MaxBits; Idx++) Same = BitIdx[Idx]==Order[Idx];
+    if(Same) Gate++; else Diff++; }
+  Check("getWeakest(): the stable sort by |Soft|, gated", Diff==0 && Gate==20000); }
+
+static void Test_Soft(void)
+{ const int Packets=20000;
+  int Fixed[2]={0,0}, Hard[2]={0,0}, Noise=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)                                        // ADS-L: a burst of 12 weak bits, up to 6 Manchester errors and 3 wrong valid bits
+  { uint8_t Data[32], Rx[32], Err[32]; int8_t Soft[8*ADSL_Bytes];
+    MakeADSL(Data); memcpy(Rx, Data, ADSL_Bytes); memset(Err, 0, ADSL_Bytes);
+    for(int Bit=0; Bit<8*ADSL_Bytes; Bit++) Soft[Bit] = (Data[Bit>>3]&(0x80>>(Bit&7))) ? 60:-60;
+    int Burst=getRand()%(8*ADSL_Bytes-12);
+    for(int Idx=0; Idx<6; Idx++)                                           // Manchester errors within the burst, each wrong by half
+    { int Bit=Burst+getRand()%12; Err[Bit>>3]|=0x80>>(Bit&7); Soft[Bit]=0;
+      if(getRand()&1) { Flarm_Packet::FlipBit(Rx, Bit); } }
+    for(int Idx=0; Idx<3; Idx++)                                           // valid but wrong bits, in the burst thus weak
+    { int Bit=Burst+getRand()%12; if(Soft[Bit]==0) continue;
+      Flarm_Packet::FlipBit(Rx, Bit); Soft[Bit] = Soft[Bit]>0 ? -8:8; }
+    for(int Bit=Burst; Bit<Burst+12; Bit++)                                // the other valid bits of the burst: as weak
+      if(Soft[Bit]==60 || Soft[Bit]==-60) Soft[Bit] = Soft[Bit]>0 ? 8:-8;
+    uint8_t Copy[32]; memcpy(Copy, Rx, ADSL_Bytes);
+    if(ADSL_Packet::Correct(Copy, Err)>=0 && memcmp(Copy, Data, ADSL_Bytes)==0) Hard[0]++;
+    memcpy(Copy, Rx, ADSL_Bytes);
+    if(ADSL_Packet::Correct(Copy, Soft, 12)>=0 && memcmp(Copy, Data, ADSL_Bytes)==0) Fixed[0]++;
+
+    MakeFLR(Data); memcpy(Rx, Data, FLR_Bytes); memset(Err, 0, FLR_Bytes);  // FLARM: 2 Manchester errors and one weak wrong bit
+    int8_t FSoft[8*FLR_Bytes];
+    for(int Bit=0; Bit<8*FLR_Bytes; Bit++) FSoft[Bit] = (Data[Bit>>3]&(0x80>>(Bit&7))) ? 60:-60;
+    Burst=getRand()%(8*FLR_Bytes-4);
+    Err[Burst>>3]|=0x80>>(Burst&7); FSoft[Burst]=0; Flarm_Packet::FlipBit(Rx, Burst);
+    Err[(Burst+2)>>3]|=0x80>>((Burst+2)&7); FSoft[Burst+2]=0;
+    Flarm_Packet::FlipBit(Rx, Burst+1); FSoft[Burst+1] = FSoft[Burst+1]>0 ? -8:8;
+    Flarm_Packet::FlipBit(Rx, (Burst+100)%(8*FLR_Bytes));                   // and a strong one: the free bit of the search
+    memcpy(Copy, Rx, FLR_Bytes);
+    if(Flarm_Packet::Correct(Copy, Err, 4)>=0 && memcmp(Copy, Data, FLR_Bytes)==0) Hard[1]++;
+    memcpy(Copy, Rx, FLR_Bytes);
+    if(Flarm_Packet::Correct(Copy, FSoft, 4)==3 && memcmp(Copy, Data, FLR_Bytes)==0) Fixed[1]++;
+
+    for(int Bit=0; Bit<8*ADSL_Bytes; Bit++) Soft[Bit] = (getRand()%8) ? (int8_t)(getRand()|1) : 0; // noise: about 24 erased bits
+    for(int Idx=0; Idx<ADSL_Bytes; Idx++) Rx[Idx]=getRand();
+    if(ADSL_Packet::Correct(Rx, Soft, 10)>=0) Noise++; }
+  printf("ADS-L, Manchester errors and weak bit errors in a burst: hard input %d, soft input %d of %d corrected\n", Hard[0], Fixed[0], Packets);
+  printf("FLARM, 2 Manchester errors, a weak and a strong bit error: hard input %d, soft input %d of %d corrected\n", Hard[1], Fixed[1], Packets);
+  Check("ADS-L soft input: all within the budget", Fixed[0]==Packets);
+  Check("FLARM soft input: all within the budget", Fixed[1]==Packets);
+  Check("soft input rejects noise", Noise<=Packets/10000); }
+
+static void Test_Gated(void)                                               // more Manchester errors than the budget: no search,
+{ const int Packets=20000;                                                  // but a single unmarked bit error still like the hard input
+  int Hard=0, Soft=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint8_t Data[32], Rx[32], Err[32], Copy[32]; int8_t FSoft[8*FLR_Bytes];
+    MakeFLR(Data); memcpy(Rx, Data, FLR_Bytes); memset(Err, 0, FLR_Bytes);
+    for(int Bit=0; Bit<8*FLR_Bytes; Bit++) FSoft[Bit] = (Data[Bit>>3]&(0x80>>(Bit&7))) ? 60:-60;
+    for(int Idx=0; Idx<6; Idx++)                                           // Manchester errors which guessed right
+    { int Bit=getRand()%(8*FLR_Bytes); Err[Bit>>3]|=0x80>>(Bit&7); FSoft[Bit]=0; }
+    int Bit=getRand()%(8*FLR_Bytes); if(FSoft[Bit]==0) { Pkt--; continue; }
+    Flarm_Packet::FlipBit(Rx, Bit);                                         // one strong wrong bit
+    memcpy(Copy, Rx, FLR_Bytes);
+    if(Flarm_Packet::Correct(Copy, Err, 4)==1 && memcmp(Copy, Data, FLR_Bytes)==0) Hard++;
+    memcpy(Copy, Rx, FLR_Bytes);
+    if(Flarm_Packet::Correct(Copy, FSoft, 4)==1 && memcmp(Copy, Data, FLR_Bytes)==0) Soft++; }
+  printf("FLARM, 6 Manchester errors and a single bit error: hard input %d, soft input %d of %d corrected\n", Hard, Soft, Packets);
+  Check("gated soft input: single bit error as hard input", Hard==Packets && Soft==Packets); }
+
+static void Benchmark(void)
+{ printf("budget   ADS-L full search   FLARM full search\n");
+  for(int Bits=4; Bits<=12; Bits+=2)
+  { double Time[2];
+    for(int Code=0; Code<2; Code++)
+    { int Rounds=0; double Start=getTime();
+      do
+      { uint8_t Rx[32]; int8_t Soft[8*FLR_Bytes];
+        for(int Idx=0; Idx<FLR_Bytes; Idx++) Rx[Idx]=getRand();
+        for(int Bit=0; Bit<8*FLR_Bytes; Bit++) Soft[Bit] = Bit<Bits ? 0 : (int8_t)(getRand()|1);
+        if(Code) Flarm_Packet::Correct(Rx, Soft, Bits);
+            else ADSL_Packet::Correct(Rx, Soft, Bits);
+        Rounds++; Time[Code]=getTime()-Start; } while(Time[Code]<0.1);
+      Time[Code]/=Rounds; }
+    printf("%4d bits %12.1f us %17.1f us\n", Bits, 1e6*Time[0], 1e6*Time[1]); }
+}
+
+int main(int argc, char *argv[])
+{ Test_Hard();
+  Test_Weakest();
+  Test_Soft();
+  Test_Gated();
+  Benchmark();
+  return CheckResult(); }
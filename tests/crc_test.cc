@@ -0,0 +1,170 @@
+// CRC_Engine of crc.h against the bit-by-bit and nibble implementations it replaced: ADS-L PI (checkPI/calcPI), CRC-1021 of FLARM,
+// GDL90 (the remainder form) and the PAW CRC8, for every table size CRC_SLICES can select and random blocks of 0..64 bytes.
+// Then the rate of each polynomial on 24-byte packets and 1 kB blocks, per table size, against the former code.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "crc.h"
+#include "crc1021.h"
+#include "gdl90.h"
+#include "adsl.h"
+#include "paw.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x7654321F;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+// ---------------------------------------------------------------------------------------------------
+// the reference: the former implementations
+
+static uint32_t RefPolyPass(uint32_t CRC, uint8_t Byte)   // ADSL_Packet::PolyPass()
+{ const uint32_t Poly = 0xFFFA0480;
+  CRC |= Byte;
+  for(uint8_t Bit=0; Bit<8; Bit++)
+  { if(CRC&0x80000000) CRC ^= Poly;
+    CRC<<=1; }
+  return CRC; }
+
+static uint32_t RefCheckPI(const uint8_t *Byte, int Bytes)
+{ uint32_t CRC = 0;
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { CRC = RefPolyPass(CRC, Byte[Idx]); }
+  return CRC>>8; }
+
+static uint32_t RefCalcPI(const uint8_t *Byte, int Bytes)
+{ uint32_t CRC = 0;
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { CRC = RefPolyPass(CRC, Byte[Idx]); }
+  CRC=RefPolyPass(CRC, 0); CRC=RefPolyPass(CRC, 0); CRC=RefPolyPass(CRC, 0);
+  return CRC>>8; }
+
+static uint16_t Ref1021(uint16_t CRC, const uint8_t *Data, int Size) // crc1021(): nibble arithmetic
+{ for(int Idx=0; Idx<Size; Idx++)
+  { uint16_t X = ((CRC>>8) ^ Data[Idx]) & 0xFF;
+    X ^= X>>4;
+    CRC = (CRC<<8) ^ (X<<12) ^ (X<<5) ^ X; }
+  return CRC; }
+
+static uint16_t RefGDL90(uint16_t CRC, const uint8_t *Data, int Len) // GDL90_CRC16() with the CCITT table of the GDL90 specification
+{ static uint16_t Table[256]; static bool Init=0;
+  if(!Init)
+  { for(int Idx=0; Idx<256; Idx++)
+    { uint16_t Reg=Idx<<8;
+      for(int Bit=0; Bit<8; Bit++) Reg = (Reg&0x8000) ? (Reg<<1)^0x1021 : Reg<<1;
+      Table[Idx]=Reg; }
+    Init = Table[1]==0x1021 && Table[255]==0x1EF0; }
+  for(int Idx=0; Idx<Len; Idx++)
+    CRC = Table[CRC>>8] ^ (CRC<<8) ^ Data[Idx];
+  return CRC; }
+
+static uint8_t RefCRC8(uint8_t CRC, const uint8_t *Data, int Len) // PAW_Packet::CRC8() bit by bit
+{ const uint8_t Poly = 0x07;
+  for(int Idx=0; Idx<Len; Idx++)
+  { CRC ^= Data[Idx];
+    for(uint8_t Bit=0; Bit<8; Bit++)
+    { if(CRC&0x80) { CRC = (CRC<<1) ^ Poly; }
+              else { CRC = (CRC<<1)       ; }
+    }
+  }
+  return CRC; }
+
+// ---------------------------------------------------------------------------------------------------
+
+const int MaxLen = 64;
+
+template <int Slices>
+ static int Compare(void)                              // number of mismatches of this table size against the references
+{ typedef CRC_Engine<uint32_t, 24, 0xFFF409, Slices> ADSL;
+  typedef CRC_Engine<uint16_t, 16, 0x1021,   Slices> C1021;
+  typedef CRC_Engine<uint8_t ,  8, 0x07,     Slices> PAW8;
+  int Diff=0;
+  for(int Test=0; Test<20000; Test++)
+  { uint8_t Data[MaxLen]; int Len=getRand()%(MaxLen+1);
+    for(int Idx=0; Idx<Len; Idx++) Data[Idx]=getRand();
+    uint16_t Init16=getRand(); uint8_t Init8=getRand();
+    if(ADSL::Shift(0, Data, Len)!=RefCheckPI(Data, Len)) Diff++;
+    if(ADSL::Pass (0, Data, Len)!=RefCalcPI (Data, Len)) Diff++;
+    if(C1021::Pass (Init16, Data, Len)!=Ref1021 (Init16, Data, Len)) Diff++;
+    if(C1021::Shift(Init16, Data, Len)!=RefGDL90(Init16, Data, Len)) Diff++;
+    if(PAW8::Pass  (Init8 , Data, Len)!=RefCRC8 (Init8 , Data, Len)) Diff++;
+    uint32_t CRC24=0; uint16_t CRC16=Init16; uint8_t CRC8=Init8;             // byte by byte as the callers do
+    for(int Idx=0; Idx<Len; Idx++)
+    { CRC24=ADSL::Shift(CRC24, Data[Idx]); CRC16=C1021::Pass(CRC16, Data[Idx]); CRC8=PAW8::Pass(CRC8, Data[Idx]); }
+    if(CRC24!=RefCheckPI(Data, Len) || CRC16!=Ref1021(Init16, Data, Len) || CRC8!=RefCRC8(Init8, Data, Len)) Diff++; }
+  return Diff; }
+
+static void Test_Firmware(void)                        // the functions the firmware calls, with the default CRC_SLICES
+{ int Diff=0;
+  for(int Test=0; Test<20000; Test++)
+  { uint8_t Data[MaxLen]; int Len=getRand()%(MaxLen+1);
+    for(int Idx=0; Idx<Len; Idx++) Data[Idx]=getRand();
+    if(ADSL_Packet::checkPI(Data, Len)!=RefCheckPI(Data, Len)) Diff++;
+    if(ADSL_Packet::calcPI (Data, Len)!=RefCalcPI (Data, Len)) Diff++;
+    if(crc1021(0xFFFF, Data, Len)!=Ref1021(0xFFFF, Data, Len)) Diff++;
+    if(crc1021((uint16_t)0x1234, Data[0])!=Ref1021(0x1234, Data, 1)) Diff++;
+    if(GDL90_CRC16(Data, Len)!=RefGDL90(0, Data, Len)) Diff++;
+    if(Len && GDL90_CRC16(Data[0], 0x4321)!=RefGDL90(0x4321, Data, 1)) Diff++;
+    if(PAW_Packet::CRC8(Data, Len)!=RefCRC8(0x71, Data, Len)) Diff++; }
+  Check("checkPI/calcPI/crc1021/GDL90_CRC16/CRC8", Diff==0); }
+
+// ---------------------------------------------------------------------------------------------------
+
+static uint32_t Sink=0;
+
+template <class Func>
+ static double Rate(Func Calc, uint8_t *Data, int Len) // [MB/s]
+{ int Rounds=0; double Start=getTime(), Time;
+  do
+  { for(int Rep=0; Rep<64; Rep++) { Data[Rep%Len]++; Sink+=Calc(Data, Len); } // new data every time: the CRC can not be hoisted
+    Rounds+=64; Time=getTime()-Start; } while(Time<0.1);
+  return 1e-6*Rounds*Len/Time; }
+
+template <int Slices>
+ static void Benchmark(const char *Name, uint8_t *Data, int Len, double *Ref)
+{ typedef CRC_Engine<uint32_t, 24, 0xFFF409, Slices> ADSL;
+  typedef CRC_Engine<uint16_t, 16, 0x1021,   Slices> C1021;
+  typedef CRC_Engine<uint8_t ,  8, 0x07,     Slices> PAW8;
+  double R[4] =
+  { Rate([](const uint8_t *D, int L) { return (uint32_t)ADSL::Shift(0, D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)C1021::Pass(0xFFFF, D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)C1021::Shift(0, D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)PAW8::Pass(0x71, D, L); }, Data, Len) } ;
+  printf("%-10s", Name);
+  for(int Idx=0; Idx<4; Idx++) printf("  %7.1f x%5.1f", R[Idx], R[Idx]/Ref[Idx]);
+  printf("\n"); }
+
+static void Benchmark(int Len)
+{ uint8_t Data[1024];
+  for(int Idx=0; Idx<Len; Idx++) Data[Idx]=getRand();
+  double Ref[4] =
+  { Rate([](const uint8_t *D, int L) { return RefCheckPI(D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)Ref1021(0xFFFF, D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)RefGDL90(0, D, L); }, Data, Len),
+    Rate([](const uint8_t *D, int L) { return (uint32_t)RefCRC8(0x71, D, L); }, Data, Len) } ;
+  printf("%4d bytes [MB/s]  ADS-L PI        CRC-1021        GDL90           PAW CRC8\n", Len);
+  printf("%-10s", "former");
+  for(int Idx=0; Idx<4; Idx++) printf("  %7.1f       ", Ref[Idx]);
+  printf("\n");
+  Benchmark<0>("bitwise", Data, Len, Ref);
+  Benchmark<1>("table",   Data, Len, Ref);
+  Benchmark<4>("slice-4", Data, Len, Ref);
+  Benchmark<8>("slice-8", Data, Len, Ref); }
+
+int main(int argc, char *argv[])
+{ Check("CRC_SLICES=0: bit-exact", Compare<0>()==0);
+  Check("CRC_SLICES=1: bit-exact", Compare<1>()==0);
+  Check("CRC_SLICES=4: bit-exact", Compare<4>()==0);
+  Check("CRC_SLICES=8: bit-exact", Compare<8>()==0);
+  Test_Firmware();
+  Benchmark(24);
+  Benchmark(1024);
+  return CheckResult(); }
@@ -0,0 +1,52 @@
+// DutyCycle of duty-cycle.h: the sliding one-hour window, the limits per band, FANET within the M-band, the back-off.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "duty-cycle.h"
+#include "check.h"
+
+// ===================================================================================================
+
+
+static DutyCycle Duty;
+
+static void TestWindow(void)
+{ Duty.Clear(); Duty.Update(1, 0);
+  const uint32_t usPkt = 5000;                             // [usec] a typical M-band packet
+  uint32_t Now=0; int Sent=0;
+  for( ; Now<3600; Now++)                                  // try two packets per second for an hour
+    for(int Pkt=0; Pkt<2; Pkt++)
+      if(Duty.mayTx(DutyCycle::Band_M, usPkt, Now)) { Duty.Charge(DutyCycle::Band_M, usPkt, Now); Sent++; }
+  Check("M-band limited to 1% over the hour", (uint64_t)Sent*usPkt<=DutyCycle::Hour_us/100 && Sent==7200);
+  for(int Pkt=0; Pkt<10000; Pkt++)                         // now try to burst within the same second
+    if(Duty.mayTx(DutyCycle::Band_M, usPkt, Now-1)) { Duty.Charge(DutyCycle::Band_M, usPkt, Now-1); Sent++; }
+  Check("burst stops at the limit", Duty.Band[DutyCycle::Band_M].getLeft()<usPkt && Duty.Band[DutyCycle::Band_M].getFill()==1000);
+  Check("back-off at the limit", Duty.BackOff(DutyCycle::Band_M)==7);
+  Check("O-band not affected", Duty.mayTx(DutyCycle::Band_O, usPkt, Now) && Duty.Band[DutyCycle::Band_O].getFill()==0);
+  Duty.Update(1, Now);                                     // next second, next minute: the first minute left the window
+  Check("window slides by a minute", Duty.mayTx(DutyCycle::Band_M, usPkt, Now) &&
+                                     Duty.Band[DutyCycle::Band_M].Sum==DutyCycle::Hour_us/100-120*usPkt);
+  Duty.Update(1, Now+5*3600);                              // long gap: all clear
+  Check("long gap clears the window", Duty.Band[DutyCycle::Band_M].Sum==0 && Duty.BackOff(DutyCycle::Band_M)==0); }
+
+static void TestFANET(void)
+{ Duty.Clear(); Duty.Update(1, 1000);
+  Duty.Charge(DutyCycle::Band_FNT, 20000, 1000);
+  Check("FANET charged to the M-band as well", Duty.Band[DutyCycle::Band_M].Sum==20000 && Duty.Band[DutyCycle::Band_FNT].Sum==20000);
+  Duty.Charge(DutyCycle::Band_M, DutyCycle::Hour_us/100-20000, 1001);
+  Check("full M-band blocks FANET", !Duty.mayTx(DutyCycle::Band_FNT, 20000, 1002) && Duty.BackOff(DutyCycle::Band_FNT)==7); }
+
+static void TestRegion(void)
+{ Duty.Clear(); Duty.Update(0, 0);                         // outside Europe: no limits
+  for(uint32_t Now=0; Now<100; Now++) Duty.Charge(DutyCycle::Band_M, 500000, Now);
+  Check("no limit outside Europe", Duty.mayTx(DutyCycle::Band_M, 500000, 100) && Duty.BackOff(DutyCycle::Band_M)==0);
+  Duty.Update(1, 100);
+  Check("limit applies when the plan changes", !Duty.mayTx(DutyCycle::Band_M, 500000, 100)); }
+
+int main(int argc, char *argv[])
+{ TestWindow();
+  TestFANET();
+  TestRegion();
+  printf("%d bands x %d bytes = %d bytes of RAM\n", DutyCycle::Bands, (int)sizeof(DutyCycle_Band), (int)sizeof(DutyCycle));
+  return CheckResult(); }
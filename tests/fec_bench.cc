@@ -0,0 +1,224 @@
+// Monte Carlo benchmark of every FSK code the tracker decodes, with the decoders of the firmware:
+//   ogn        OGN n208k160 LDPC, FSK_RxPacket::Decode() with hard bits and erasures
+//   ogn-soft   the same with the soft decisions of FSK_RxPacket::getSoft()
+//   adsl       ADS-L M-band 24-bit PI, ADSL_Packet::Correct() with the marked Manchester errors
+//   adsl-soft  the same with the 10 least reliable bits of FSK_RxPacket::getSoft() like DecodeRxADSL()
+//   flarm      FLARM CRC-1021, Flarm_Packet::Correct() with 4 marked Manchester errors
+//   flarm-soft the same with the 4 least reliable bits of FSK_RxPacket::getSoft() (DecodeRxPacket() stays on the hard input)
+//   ldr-adsl   ADS-L on the O-band LDR: PI plus the external CRC8, PAW_Packet::CorrectLDR() like DecodeRxLDR()
+//   ldr-paw    PilotAware on LDR: whitened, internal and external CRC, PAW_Packet::CorrectLDR()
+// Random packets go through a channel of chips with hard decisions: white Gaussian noise (awgn, level is Eb/N0 [dB] per data bit)
+// or random chip flips (bsc, level is the chip error rate). M-band codes are Manchester encoded, LDR is sent bit by bit.
+// Output is CSV, one line per code, channel and level: frame error rate, undetected error rate, bit error rate of the frame
+// as received (raw_ber, Manchester errors give their second chip) and of the data delivered by the decoder (ber: the bits
+// which pass to the application, in accepted but wrong packets) and the decoder CPU time per packet.
+// fec_bench [frames per point] [threads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include "rx-pkt.h"
+#include "manchester.h"
+#include "flarm.h"
+#include "paw.h"
+
+// ===================================================================================================
+
+class Random                                           // per thread: xorshift64 and Gaussian noise
+{ public:
+   uint64_t State;
+   Random(uint64_t Seed) { State = Seed*0x9E3779B97F4A7C15ULL + 1; }
+   uint32_t get(void) { State^=State<<13; State^=State>>7; State^=State<<17; return State>>32; }
+   double Uniform(void) { return (get()+0.5)/4294967296.0; }
+   double Gauss(void) { return sqrt(-2*log(Uniform()))*cos(2*M_PI*Uniform()); }
+} ;
+
+static double getCPU(void)                             // [sec] CPU time of the calling thread
+{ struct timespec now; clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+const int MaxBytes = FSK_RxPacket::MaxBytes;
+
+class Code                                             // a code: how to make a random packet and how the firmware decodes it
+{ public:
+   const char *Name;
+   uint8_t Bytes;                                      // [bytes] on the air
+   uint8_t DataBytes;                                  // [bytes] delivered when decoded: compared for undetected errors
+   bool    Manch;                                      // Manchester encoded (M-band) or not (LDR)
+   void (*Make)(uint8_t *Data, uint8_t *Frame, Random &Rand); // the data to be delivered and the frame to go on the air
+   bool (*Decode)(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder); // false when the decoder rejects the packet
+} ;
+
+static void MakeOGN(uint8_t *Data, uint8_t *Frame, Random &Rand)
+{ for(int Idx=0; Idx<20; Idx++) Data[Idx]=Rand.get();
+  LDPC_Encode(Data);
+  memcpy(Frame, Data, 26); }
+
+static bool DecodeOGN(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ OGN_RxPacket<OGN1_Packet> OGN;
+  uint8_t Check=RxPkt.Decode(OGN, Decoder);
+  memcpy(Out, OGN.Packet.Byte(), 26);
+  return Check==0 && OGN.RxErr<15; }                   // as DecodeRxOGN()
+
+static bool DecodeOGNsoft(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ OGN_RxPacket<OGN1_Packet> OGN; int8_t Soft[LDPC_Decoder::CodeBits];
+  uint8_t Check=RxPkt.Decode(OGN, Decoder, Soft);
+  memcpy(Out, OGN.Packet.Byte(), 26);
+  return Check==0 && OGN.RxErr<15; }
+
+static void MakeADSL(uint8_t *Data, uint8_t *Frame, Random &Rand) // 21 bytes and the 24-bit PI
+{ for(int Idx=0; Idx<21; Idx++) Data[Idx]=Rand.get();
+  uint32_t PI=ADSL_Packet::calcPI(Data, 21);
+  Data[21]=PI>>16; Data[22]=PI>>8; Data[23]=PI;
+  memcpy(Frame, Data, 24); }
+
+static bool DecodeADSL(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ int CorrErr=ADSL_Packet::Correct(RxPkt.Data, RxPkt.Err);
+  memcpy(Out, RxPkt.Data, 24);
+  return CorrErr>=0; }
+
+static bool DecodeADSLsoft(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ int8_t Soft[24*8]; RxPkt.getSoft(Soft, 24*8);
+  int CorrErr=ADSL_Packet::Correct(RxPkt.Data, Soft, 10);
+  memcpy(Out, RxPkt.Data, 24);
+  return CorrErr>=0; }
+
+static void MakeFLR(uint8_t *Data, uint8_t *Frame, Random &Rand)
+{ Flarm_Packet Pkt;
+  for(int Idx=0; Idx<Flarm_Packet::Bytes; Idx++) Pkt.Byte[Idx]=Rand.get();
+  Pkt.setCRC();
+  memcpy(Data, Pkt.Byte, Flarm_Packet::Bytes+2);
+  memcpy(Frame, Data, Flarm_Packet::Bytes+2); }
+
+static bool DecodeFLR(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ int CorrBits=Flarm_Packet::Correct(RxPkt.Data, RxPkt.Err, 4);
+  memcpy(Out, RxPkt.Data, Flarm_Packet::Bytes+2);
+  return CorrBits>=0 && Flarm_Packet::checkCRC(RxPkt.Data, Flarm_Packet::Bytes)==0; }
+
+static bool DecodeFLRsoft(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ int8_t Soft[(Flarm_Packet::Bytes+2)*8]; RxPkt.getSoft(Soft, (Flarm_Packet::Bytes+2)*8);
+  int CorrBits=Flarm_Packet::Correct(RxPkt.Data, Soft, 4);
+  memcpy(Out, RxPkt.Data, Flarm_Packet::Bytes+2);
+  return CorrBits>=0 && Flarm_Packet::checkCRC(RxPkt.Data, Flarm_Packet::Bytes)==0; }
+
+static void MakeLDR_ADSL(uint8_t *Data, uint8_t *Frame, Random &Rand)
+{ MakeADSL(Data, Frame, Rand);
+  Frame[24]=PAW_Packet::CRC8(Frame, 24); }
+
+static void MakeLDR_PAW(uint8_t *Data, uint8_t *Frame, Random &Rand) // delivered dewhitened, sent whitened
+{ for(int Idx=0; Idx<23; Idx++) Data[Idx]=Rand.get();
+  Data[23]=PAW_Packet::IntCRC(Data, 23);
+  memcpy(Frame, Data, 24); PAW_Packet::Whiten(Frame, 24);
+  Frame[24]=PAW_Packet::CRC8(Frame, 24); }
+
+static bool DecodeLDR_ADSL(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ bool ADSL=0; int CorrBits=PAW_Packet::CorrectLDR(RxPkt.Data, RxPkt.Err, ADSL);
+  memcpy(Out, RxPkt.Data, 24);
+  return CorrBits>=0 && ADSL; }
+
+static bool DecodeLDR_PAW(FSK_RxPacket &RxPkt, uint8_t *Out, LDPC_Decoder &Decoder)
+{ bool ADSL=0; int CorrBits=PAW_Packet::CorrectLDR(RxPkt.Data, RxPkt.Err, ADSL);
+  memcpy(Out, RxPkt.Data, 24);
+  return CorrBits>=0 && !ADSL; }
+
+static const Code CodeTable[] =
+{ { "ogn",        26, 26, 1, MakeOGN,      DecodeOGN      },
+  { "ogn-soft",   26, 26, 1, MakeOGN,      DecodeOGNsoft  },
+  { "adsl",       24, 24, 1, MakeADSL,     DecodeADSL     },
+  { "adsl-soft",  24, 24, 1, MakeADSL,     DecodeADSLsoft },
+  { "flarm",      26, 26, 1, MakeFLR,      DecodeFLR      },
+  { "flarm-soft", 26, 26, 1, MakeFLR,      DecodeFLRsoft  },
+  { "ldr-adsl",   25, 24, 0, MakeLDR_ADSL, DecodeLDR_ADSL },
+  { "ldr-paw",    25, 24, 0, MakeLDR_PAW,  DecodeLDR_PAW  }
+} ;
+const int Codes = sizeof(CodeTable)/sizeof(Code);
+
+static const double AWGN[] = { 10.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0 } ;   // [dB] Eb/N0
+static const double BSC[]  = { 0.001, 0.002, 0.005, 0.01, 0.02, 0.03, 0.05, 0.08 } ;       // chip error rate
+const int AWGNlevels = sizeof(AWGN)/sizeof(double);
+const int BSClevels  = sizeof(BSC)/sizeof(double);
+
+class Point                                            // one code, channel and level: the job of one thread at a time
+{ public:
+   int    CodeIdx;
+   bool   isBSC;
+   double Level;
+   int    Frames, Errors, Undetected;
+   long   RawErr;                                      // bit errors in the frame as received
+   long   BitErr;                                      // bit errors in the delivered data
+   double CPU;                                         // [sec] in the decoder
+} ;
+
+static void Channel(uint8_t *Air, int Bits, const Point &Pt, bool Manch, Random &Rand) // chips through the channel, hard decisions
+{ double Sigma=0;
+  if(!Pt.isBSC)
+  { double EcN0 = pow(10, Pt.Level/10)/(Manch?2:1);   // two chips per data bit with Manchester
+    Sigma = sqrt(1/(2*EcN0)); }
+  for(int Idx=0; Idx<Bits; Idx++)
+  { uint8_t Mask = 0x80>>(Idx&7);
+    bool Flip;
+    if(Pt.isBSC) Flip = Rand.Uniform()<Pt.Level;
+            else Flip = 1.0+Sigma*Rand.Gauss()<0;      // the chip sent as +1, a wrong decision when it goes negative
+    if(Flip) Air[Idx>>3]^=Mask; }
+}
+
+static void Run(Point &Pt, uint64_t Seed)
+{ const Code &C = CodeTable[Pt.CodeIdx];
+  Random Rand(Seed);
+  static thread_local LDPC_Decoder Decoder;
+  for(int Count=0; Count<Pt.Frames; Count++)
+  { uint8_t Data[MaxBytes], Frame[MaxBytes], Air[2*MaxBytes], Out[MaxBytes];
+    C.Make(Data, Frame, Rand);
+    FSK_RxPacket RxPkt;
+    if(C.Manch)
+    { Manchester_Encode(Air, Frame, C.Bytes);
+      Channel(Air, 16*C.Bytes, Pt, 1, Rand);
+      Manchester_Decode(RxPkt.Data, RxPkt.Err, Air, C.Bytes); }
+    else
+    { memcpy(Air, Frame, C.Bytes);
+      Channel(Air, 8*C.Bytes, Pt, 0, Rand);
+      memcpy(RxPkt.Data, Air, C.Bytes); memset(RxPkt.Err, 0, C.Bytes); }
+    RxPkt.Bytes=C.Bytes; RxPkt.Manchester=C.Manch; RxPkt.SNR=0;   // SNR unknown on the BSC
+    if(!Pt.isBSC) RxPkt.SNR=floor(4*(Pt.Level-(C.Manch?3.0103:0.0))+0.5); // [0.25dB] per chip, as Radio_Receive() estimates it
+    for(int Idx=0; Idx<C.Bytes; Idx++) Pt.RawErr+=Count1s((uint8_t)(RxPkt.Data[Idx]^Frame[Idx]));
+    double Start=getCPU();
+    bool OK=C.Decode(RxPkt, Out, Decoder);
+    Pt.CPU+=getCPU()-Start;
+    int BitErr=0;
+    for(int Idx=0; Idx<C.DataBytes; Idx++) BitErr+=Count1s((uint8_t)(Out[Idx]^Data[Idx]));
+    if(OK && BitErr==0) continue;
+    Pt.Errors++;
+    if(OK) { Pt.Undetected++; Pt.BitErr+=BitErr; } }
+}
+
+int main(int argc, char *argv[])
+{ int Frames  = argc>1 ? atoi(argv[1]) : 2000;
+  int Threads = argc>2 ? atoi(argv[2]) : std::thread::hardware_concurrency();
+  if(Frames<1) Frames=1;
+  if(Threads<1) Threads=1;
+
+  std::vector<Point> Pts;
+  for(int CodeIdx=0; CodeIdx<Codes; CodeIdx++)
+  { for(int Lev=0; Lev<AWGNlevels; Lev++) { Point Pt; memset(&Pt, 0, sizeof(Pt)); Pt.CodeIdx=CodeIdx; Pt.isBSC=0; Pt.Level=AWGN[Lev]; Pt.Frames=Frames; Pts.push_back(Pt); }
+    for(int Lev=0; Lev<BSClevels;  Lev++) { Point Pt; memset(&Pt, 0, sizeof(Pt)); Pt.CodeIdx=CodeIdx; Pt.isBSC=1; Pt.Level=BSC[Lev];  Pt.Frames=Frames; Pts.push_back(Pt); }
+  }
+
+  std::atomic<int> Next(0);                            // points are taken by the threads one at a time
+  std::vector<std::thread> Pool;
+  for(int Thr=0; Thr<Threads; Thr++)
+    Pool.push_back(std::thread([&]() { for(int Idx; (Idx=Next++)<(int)Pts.size(); ) Run(Pts[Idx], Idx+1); }));
+  for(size_t Thr=0; Thr<Pool.size(); Thr++) Pool[Thr].join();
+
+  printf("code,channel,level,frames,fer,undetected,raw_ber,ber,us_per_packet\n");
+  for(size_t Idx=0; Idx<Pts.size(); Idx++)
+  { const Point &Pt=Pts[Idx]; const Code &C=CodeTable[Pt.CodeIdx];
+    printf("%s,%s,%g,%d,%.5f,%.6f,%.3e,%.3e,%.3f\n", C.Name, Pt.isBSC?"bsc":"awgn", Pt.Level, Pt.Frames,
+           (double)Pt.Errors/Pt.Frames, (double)Pt.Undetected/Pt.Frames, (double)Pt.RawErr/((double)Pt.Frames*8*C.Bytes),
+           (double)Pt.BitErr/((double)Pt.Frames*8*C.DataBytes), 1e6*Pt.CPU/Pt.Frames); }
+  return 0; }
@@ -0,0 +1,111 @@
+// FIFO of fifo.h between two threads at full speed: a producer and a consumer like the RF task and vTaskPROC on the two cores.
+// Every element carries its sequence number and words derived from it: the consumer checks the order and that no element
+// is seen before it is completely written. All the ways the firmware uses the FIFO: single elements, in place with
+// getWrite()/Write() and getRead()/Read(), blocks, and getReadBlock()/flushReadBlock().
+// Built also with -fsanitize=thread, which reports any access not ordered by the acquire/release of the pointers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <thread>
+
+#include "fifo.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+class Element                                          // a packet-like element: a torn one has words not matching its Seq
+{ public:
+   uint32_t Seq;
+   uint32_t Word[7];
+
+  public:
+   static uint32_t Hash(uint32_t Seq, int Idx) { uint32_t X=Seq*0x9E3779B1+Idx; X^=X>>15; X*=0x85EBCA6B; X^=X>>13; return X; }
+   void Set(uint32_t New) { Seq=New; for(int Idx=0; Idx<7; Idx++) Word[Idx]=Hash(New, Idx); }
+   bool isGood(void) const { for(int Idx=0; Idx<7; Idx++) if(Word[Idx]!=Hash(Seq, Idx)) return 0; return 1; }
+} ;
+
+static void Wait(void) { std::this_thread::yield(); }  // full or empty: let the other side run, there may be a single CPU
+
+enum Mode { Single, InPlace, Block, ReadBlock };
+static const char *ModeName[4] = { "single Write()/Read()", "getWrite()/getRead() in place", "block Write()/Read()", "block Write()/getReadBlock()" };
+
+#ifdef __SANITIZE_THREAD__
+static const uint32_t Count =  200000;                 // elements per run: the sanitizer is slow
+#else
+static const uint32_t Count = 2000000;
+#endif
+
+template <unsigned Size>
+ static void Producer(FIFO<Element, Size> &Queue, Mode How)
+{ uint32_t Seq=0, Rand=0x13579BDF;
+  Element Buff[Size];
+  while(Seq<Count)
+  { if(How==Single)
+    { Element Elem; Elem.Set(Seq);
+      if(Queue.Write(Elem)) Seq++; else Wait(); }
+    else if(How==InPlace)
+    { if(Queue.isFull()) { Wait(); continue; }
+      Queue.getWrite()->Set(Seq);
+      if(Queue.Write()) Seq++; }
+    else
+    { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5;
+      unsigned Len=1+Rand%Size; if(Len>Count-Seq) Len=Count-Seq;
+      for(unsigned Idx=0; Idx<Len; Idx++) Buff[Idx].Set(Seq+Idx);
+      unsigned Done=Queue.Write(Buff, Len); if(Done==0) Wait();
+      Seq+=Done; }                                     // the ones not written go again next time
+  }
+}
+
+template <unsigned Size>
+ static uint32_t Consumer(FIFO<Element, Size> &Queue, Mode How)   // returns the number of bad elements
+{ uint32_t Seq=0, Bad=0, Rand=0x2468ACE0;
+  Element Buff[Size];
+  while(Seq<Count)
+  { if(How==Single)
+    { Element Elem;
+      if(Queue.Read(Elem)==0) { Wait(); continue; }
+      Bad+=(Elem.Seq!=Seq || !Elem.isGood()); Seq++; }
+    else if(How==InPlace)
+    { Element *Elem=Queue.getRead(); if(Elem==0) { Wait(); continue; }
+      Bad+=(Elem->Seq!=Seq || !Elem->isGood()); Seq++;
+      Queue.Read(); }
+    else if(How==Block)
+    { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5;
+      unsigned Len=Queue.Read(Buff, 1+Rand%Size); if(Len==0) Wait();
+      for(unsigned Idx=0; Idx<Len; Idx++)
+      { Bad+=(Buff[Idx].Seq!=Seq || !Buff[Idx].isGood()); Seq++; }
+    }
+    else
+    { Element *Elem; unsigned Len=Queue.getReadBlock(Elem); if(Len==0) Wait();
+      for(unsigned Idx=0; Idx<Len; Idx++)
+      { Bad+=(Elem[Idx].Seq!=Seq || !Elem[Idx].isGood()); Seq++; }
+      Queue.flushReadBlock(Len); }
+  }
+  if(!Queue.isEmpty()) Bad++;
+  return Bad; }
+
+template <unsigned Size>
+ static void Test(Mode How)
+{ static FIFO<Element, Size> Queue;
+  Queue.Clear();
+  uint32_t Bad=0;
+  double Start=getTime();
+  std::thread Prod(Producer<Size>, std::ref(Queue), How);
+  Bad=Consumer<Size>(Queue, How);
+  Prod.join();
+  double Time=getTime()-Start;
+  char Name[80]; sprintf(Name, "FIFO of %2d, %s", Size, ModeName[How]);
+  printf("%-56s %6.2f Melem/s\n", Name, 1e-6*Count/Time);
+  Check(Name, Bad==0 && !Queue.isCorrupt()); }
+
+int main(int argc, char *argv[])
+{ for(int How=Single; How<=ReadBlock; How++)
+  { Test< 4>((Mode)How);
+    Test<32>((Mode)How); }
+  return CheckResult(); }
@@ -0,0 +1,110 @@
+// LDPC_BatchDecoder of ldpc-batch.h against LDPC_Decoder: the same corrected bytes and failed-check counts for every packet
+// of a corpus with bit errors and Manchester erasures, then the decode throughput of both in packets per second on one core.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "ldpc-batch.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x13579BDF;
+static uint32_t getRand(uint32_t Range) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand%Range; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int Bytes   = LDPC_Decoder::CodeBytes;
+const int Packets = 4096;                              // corpus size: multiple of the widest batch
+const int Iter    = 32;                                // as FSK_RxPacket::Decode()
+
+static uint8_t Data[Packets][Bytes];                   // received bytes
+static uint8_t Err [Packets][Bytes];                   // Manchester errors: erased bits
+static uint8_t Ref [Packets][Bytes];                   // LDPC_Decoder output
+static uint8_t RefCheck[Packets];                      // LDPC_Decoder failed checks after the last iteration
+
+static void makeCorpus(void)                           // from clean packets to hopeless ones
+{ for(int Pkt=0; Pkt<Packets; Pkt++)
+  { for(int Idx=0; Idx<20; Idx++) Data[Pkt][Idx]=getRand(256);
+    LDPC_Encode(Data[Pkt]);
+    memset(Err[Pkt], 0, Bytes);
+    int Flips  = getRand(16);
+    int Erased = getRand(12);
+    for(int Idx=0; Idx<Flips; Idx++)  { int Bit=getRand(8*Bytes); Data[Pkt][Bit>>3]^=1<<(Bit&7); }
+    for(int Idx=0; Idx<Erased; Idx++) { int Bit=getRand(8*Bytes); Err[Pkt][Bit>>3]|=1<<(Bit&7); if(getRand(2)) Data[Pkt][Bit>>3]^=1<<(Bit&7); }
+  }
+}
+
+static LDPC_Decoder Decoder;
+
+static int DecodeRef(int Pkt, uint8_t *Out)            // the way FSK_RxPacket::Decode() runs it
+{ uint8_t Check=0;
+  Decoder.Input(Data[Pkt], Err[Pkt]);
+  for(int Loop=Iter; Loop; Loop--)
+  { Check=Decoder.ProcessChecks();
+    if(Check==0) break; }
+  Decoder.Output(Out);
+  return Check; }
+
+template <int Lanes>
+ static int DecodeBatch(LDPC_BatchDecoder<Lanes> &Batch, int Pkt, uint8_t (*Out)[Bytes], uint8_t *OutCheck)
+{ for(int Lane=0; Lane<Lanes; Lane++) Batch.Input(Lane, Data[Pkt+Lane], Err[Pkt+Lane]);
+  int Left=Batch.Decode(Iter);
+  for(int Lane=0; Lane<Lanes; Lane++) { Batch.Output(Lane, Out[Lane]); OutCheck[Lane]=Batch.getCount(Lane); }
+  return Left; }
+
+template <int Lanes>
+ static void TestBatch(double RefRate)
+{ static LDPC_BatchDecoder<Lanes> Batch;
+  static uint8_t Out[Packets][Bytes]; static uint8_t OutCheck[Packets];
+  int Diff=0;
+  for(int Pkt=0; Pkt<Packets; Pkt+=Lanes)
+    DecodeBatch(Batch, Pkt, Out+Pkt, OutCheck+Pkt);
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+    if(memcmp(Out[Pkt], Ref[Pkt], Bytes)!=0 || OutCheck[Pkt]!=RefCheck[Pkt]) Diff++;
+  char Name[64]; sprintf(Name, "%2d lanes bit-exact with LDPC_Decoder", Lanes);
+  Check(Name, Diff==0);
+  int Rounds=0; double Start=getTime(), Time=0;
+  do
+  { for(int Pkt=0; Pkt<Packets; Pkt+=Lanes) DecodeBatch(Batch, Pkt, Out+Pkt, OutCheck+Pkt);
+    Rounds++; Time=getTime()-Start; } while(Time<0.5);
+  double Rate=Rounds*Packets/Time;
+  printf("%2d lanes: %8.0f packets/s  x%4.1f\n", Lanes, Rate, Rate/RefRate); }
+
+int main(int argc, char *argv[])
+{ makeCorpus();
+  int Correct=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { RefCheck[Pkt]=DecodeRef(Pkt, Ref[Pkt]); Correct+=RefCheck[Pkt]==0; }
+  printf("%d packets, %d decode correctly with %d iterations\n", Packets, Correct, Iter);
+  printf("lanes: %s\n",
+#ifdef LDPC_BATCH_VECTOR
+#if defined(__AVX2__)
+         "vector (AVX2)"
+#elif defined(__SSE2__)
+         "vector (SSE2)"
+#else
+         "vector"
+#endif
+#else
+         "scalar"
+#endif
+         );
+
+  uint8_t Out[Bytes];
+  int Rounds=0; double Start=getTime(), Time=0;
+  do
+  { for(int Pkt=0; Pkt<Packets; Pkt++) DecodeRef(Pkt, Out);
+    Rounds++; Time=getTime()-Start; } while(Time<0.5);
+  double RefRate=Rounds*Packets/Time;
+  printf("LDPC_Decoder: %8.0f packets/s\n", RefRate);
+
+  TestBatch< 8>(RefRate);
+  TestBatch<16>(RefRate);
+  TestBatch<32>(RefRate);
+  return CheckResult(); }
@@ -0,0 +1,105 @@
+// LDPC_CompactDecoder against LDPC_Decoder: the column table against the row table, then the decode results
+// on Manchester packets through white Gaussian noise (hard decisions and erasures), the RAM and the CPU time of both.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "manchester.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint64_t Rand = 0xFEDCBA9876543210ULL;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>7; Rand^=Rand<<17; return Rand>>32; }
+static double getUniform(void) { return (getRand()+0.5)/4294967296.0; }
+static double getGauss(void) { return sqrt(-2*log(getUniform()))*cos(2*M_PI*getUniform()); }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int Bytes   = LDPC_Decoder::CodeBytes;
+const int Packets = 6000;
+const int Iter    = 32;
+
+static uint8_t Packet[Packets][Bytes];                 // transmitted
+static uint8_t Data[Packets][Bytes];                   // received bytes
+static uint8_t Err [Packets][Bytes];                   // Manchester errors: erased bits
+
+static void makeCorpus(void)                           // Eb/N0 from +2dB down to -4dB over the corpus
+{ for(int Pkt=0; Pkt<Packets; Pkt++)
+  { for(int Idx=0; Idx<20; Idx++) Packet[Pkt][Idx]=getRand();
+    LDPC_Encode(Packet[Pkt]);
+    double EbN0 = 2.0-6.0*Pkt/Packets;
+    double Sigma = sqrt(1.0/(2*2*pow(10, EbN0/10)));
+    uint8_t Chips[2*Bytes];
+    Manchester_Encode(Chips, Packet[Pkt], Bytes);
+    for(int Bit=0; Bit<16*Bytes; Bit++)
+    { uint8_t Mask = 1<<(Bit&7);
+      double Sample = ((Chips[Bit>>3]&Mask) ? 1.0:-1.0) + Sigma*getGauss();
+      if(Sample>0) Chips[Bit>>3]|=Mask; else Chips[Bit>>3]&=~Mask; }
+    Manchester_Decode(Data[Pkt], Err[Pkt], Chips, Bytes); }
+}
+
+static bool TestColumns(void)                          // every (row, position) of the row table exactly once in the column table
+{ int Found[48][24]; memset(Found, 0, sizeof(Found));
+  for(int Bit=0; Bit<LDPC_Decoder::CodeBits; Bit++)
+  { const uint16_t *Col=LDPC_BitCheckIndex_n208k160[Bit];
+    for(int Idx=1; Idx<=Col[0]; Idx++)
+    { int Row=Col[Idx]>>5, Pos=Col[Idx]&0x1F;
+      if(Row>=48 || Pos>=LDPC_ParityCheckIndex_n208k160[Row][0] || LDPC_ParityCheckIndex_n208k160[Row][1+Pos]!=Bit) return 0;
+      Found[Row][Pos]++; }
+  }
+  for(int Row=0; Row<48; Row++)
+    for(int Pos=0; Pos<LDPC_ParityCheckIndex_n208k160[Row][0]; Pos++)
+      if(Found[Row][Pos]!=1) return 0;
+  return 1; }
+
+template <class Decoder>
+ static int Decode(Decoder &Dec, int Pkt, uint8_t *Out, int &Loops)   // the loop of FSK_RxPacket::Decode() with the flooding schedule
+{ int Check=0;
+  Dec.Input(Data[Pkt], Err[Pkt]);
+  for(Loops=0; Loops<Iter; )
+  { Check=Dec.ProcessChecks(); Loops++;
+    if(Check==0) break; }
+  Dec.Output(Out);
+  return Check; }
+
+static LDPC_Decoder        Ref;
+static LDPC_CompactDecoder Compact;
+
+int main(int argc, char *argv[])
+{ Check("column table is the transposed row table", TestColumns());
+  makeCorpus();
+  int RefOK=0, CompactOK=0, Same=0, Differ=0, RefLoops=0, CompactLoops=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint8_t RefOut[Bytes], CompactOut[Bytes]; int Loops;
+    int RefCheck=Decode(Ref, Pkt, RefOut, Loops); RefLoops+=Loops;
+    int CompactCheck=Decode(Compact, Pkt, CompactOut, Loops); CompactLoops+=Loops;
+    bool RefGood     = RefCheck==0     && memcmp(RefOut,     Packet[Pkt], Bytes)==0;
+    bool CompactGood = CompactCheck==0 && memcmp(CompactOut, Packet[Pkt], Bytes)==0;
+    RefOK+=RefGood; CompactOK+=CompactGood;
+    if(RefGood==CompactGood) Same++;
+    if(RefCheck==0 && CompactCheck==0 && memcmp(RefOut, CompactOut, Bytes)!=0) Differ++; }
+  printf("%d packets: LDPC_Decoder %d decoded (%4.2f loops), LDPC_CompactDecoder %d decoded (%4.2f loops), same result for %d\n",
+         Packets, RefOK, (double)RefLoops/Packets, CompactOK, (double)CompactLoops/Packets, Same);
+  Check("same decode result for 99% of the packets", Same>=Packets*99/100);
+  Check("decodes as many packets (-0.5%)", CompactOK>=RefOK-Packets/200);
+  printf("both pass but on different codewords: %d\n", Differ);
+  Check("rarely a different codeword when both pass", Differ<=Packets/1000);
+
+  uint8_t Out[Bytes]; int Loops;
+  double Start=getTime();
+  for(int Pkt=0; Pkt<Packets; Pkt++) Decode(Ref, Pkt, Out, Loops);
+  double RefTime=getTime()-Start;
+  Start=getTime();
+  for(int Pkt=0; Pkt<Packets; Pkt++) Decode(Compact, Pkt, Out, Loops);
+  double CompactTime=getTime()-Start;
+  printf("LDPC_Decoder:        %4d bytes, %5.1f us/packet\n", (int)sizeof(LDPC_Decoder), 1e6*RefTime/Packets);
+  printf("LDPC_CompactDecoder: %4d bytes, %5.1f us/packet\n", (int)sizeof(LDPC_CompactDecoder), 1e6*CompactTime/Packets);
+  Check("smaller", sizeof(LDPC_CompactDecoder)<sizeof(LDPC_Decoder));
+  return CheckResult(); }
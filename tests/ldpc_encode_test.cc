@@ -0,0 +1,168 @@
+// The word-wide LDPC_Encode()/LDPC_Check() of ldpc.cpp against the byte/word Count1s() loops they replaced:
+// identical parity bits and failed-check counts for random packets with random bit errors, for n208k160 and (WITH_PPM) n354k160,
+// then the encode/check rate of both on one core.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ldpc.cpp"                                    // the generator/check tables are static in there
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x2468ACE1;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+// ---------------------------------------------------------------------------------------------------
+// the reference: the former implementation, one Count1s() per byte or word and a count per row
+
+static void RefEncode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[48][5])
+{ uint8_t ParIdx=0; uint8_t ParByte=0; uint8_t Mask=1;
+  for(uint8_t Row=0; Row<48; Row++)
+  { uint8_t Count=0;
+    const uint8_t *Gen = (uint8_t *)(ParityGen[Row]);
+    for(uint8_t Idx=0; Idx<20; Idx++)
+    { Count+=Count1s((uint8_t)(Data[Idx]&Gen[Idx])); }
+    if(Count&1) ParByte|=Mask; Mask<<=1;
+    if(Mask==0) { Parity[ParIdx++]=ParByte; Mask=1; ParByte=0; }
+  }
+}
+
+static void RefEncode(const uint32_t *Data, uint32_t *Parity, uint8_t DataWords,  uint8_t Checks, const uint32_t *ParityGen)
+{ uint8_t ParIdx=0; Parity[ParIdx]=0; uint32_t Mask=1;
+  const uint32_t *Gen=ParityGen;
+  for(uint8_t Row=0; Row<Checks; Row++)
+  { uint8_t Count=0;
+    for(uint8_t Idx=0; Idx<DataWords; Idx++)
+    { Count+=Count1s(Data[Idx]&Gen[Idx]); }
+    if(Count&1) Parity[ParIdx]|=Mask; Mask<<=1;
+    if(Mask==0) { ParIdx++; Parity[ParIdx]=0; Mask=1; }
+    Gen+=DataWords; }
+}
+
+static uint8_t RefCheck(const uint32_t *Data, const uint32_t *Parity)
+{ uint8_t Errors=0;
+  for(uint8_t Row=0; Row<48; Row++)
+  { uint8_t Count=0;
+    const uint32_t *Check=LDPC_ParityCheck_n208k160[Row];
+    uint8_t Idx;
+    for(Idx=0; Idx<5; Idx++)
+    { Count+=Count1s(Data[Idx]&Check[Idx]); }
+    Count+=Count1s(Parity[0]&Check[Idx++]);
+    Count+=Count1s((Parity[1]&Check[Idx++])&0xFFFF);
+    if(Count&1) Errors++; }
+  return Errors; }
+
+static uint8_t RefCheck(const uint8_t *Data)
+{ uint8_t Errors=0;
+  for(uint8_t Row=0; Row<48; Row++)
+  { uint8_t Count=0;
+    const uint8_t *Check = (uint8_t *)LDPC_ParityCheck_n208k160[Row];
+    for(uint8_t Idx=0; Idx<26; Idx++)
+    { uint8_t And = Data[Idx]&Check[Idx]; Count+=Count1s(And); }
+    if(Count&1) Errors++; }
+  return Errors; }
+
+#ifdef WITH_PPM
+static uint8_t RefCheck_n354k160(const uint32_t *Data, const uint32_t *Parity)
+{ uint8_t Errors=0;
+  for(uint8_t Row=0; Row<194; Row++)
+  { uint8_t Count=0;
+    const uint32_t *Check=LDPC_ParityCheck_n354k160[Row];
+    uint8_t Idx;
+    for(Idx=0; Idx<5; Idx++)
+    { Count+=Count1s(Data[Idx]&Check[Idx]); }
+    uint8_t ParIdx;
+    for(ParIdx=0; ParIdx<6; ParIdx++, Idx++)
+    { Count+=Count1s(Parity[ParIdx]&Check[Idx]); }
+    Count+=Count1s((Parity[ParIdx]&Check[Idx])&0x0003);
+    if(Count&1) Errors++; }
+  return Errors; }
+#endif
+
+// ---------------------------------------------------------------------------------------------------
+
+const int Packets = 20000;
+
+static void FlipBits(uint32_t *Word, int Bits)         // 0..3 random bit errors in the first Bits of the packet
+{ int Flips=getRand()%4;
+  for(int Idx=0; Idx<Flips; Idx++) { int Bit=getRand()%Bits; Word[Bit>>5]^=(uint32_t)1<<(Bit&31); } }
+
+static void Test_n208k160(void)
+{ int EncDiff=0, CheckDiff=0, Valid=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint32_t Word[7], RefWord[7];
+    for(int Idx=0; Idx<7; Idx++) RefWord[Idx]=Word[Idx]=getRand();             // garbage in the parity words: must be overwritten
+    LDPC_Encode(Word);
+    RefEncode(RefWord, RefWord+5, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160);
+    if(memcmp(Word, RefWord, 7*4)!=0) EncDiff++;
+    uint8_t Byte[26], RefByte[26];
+    memcpy(Byte, Word, 20); memcpy(RefByte, Word, 20);
+    LDPC_Encode(Byte); RefEncode(RefByte, RefByte+20, LDPC_ParityGen_n208k160);
+    if(memcmp(Byte, RefByte, 26)!=0 || memcmp(Byte, Word, 26)!=0) EncDiff++;
+    Valid += LDPC_Check(Word)==0;
+    FlipBits(Word, 208);
+    if(Pkt&1) Word[6]^=getRand()<<16;                                          // bits beyond the codeword do not count
+    memcpy(Byte, Word, 26);
+    uint8_t Ref=RefCheck(Word, Word+5);
+    if(LDPC_Check(Word)!=Ref || LDPC_Check(Word, Word+5)!=Ref) CheckDiff++;
+    if(LDPC_Check(Byte)!=RefCheck(Byte) || LDPC_Check(Byte)!=Ref) CheckDiff++; }
+  Check("n208k160: encoder bit-exact, words and bytes", EncDiff==0);
+  Check("n208k160: encoded packets pass all checks", Valid==Packets);
+  Check("n208k160: same failed-check counts", CheckDiff==0); }
+
+#ifdef WITH_PPM
+static void Test_n354k160(void)
+{ int EncDiff=0, CheckDiff=0, Valid=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { uint32_t Word[12], RefWord[12];
+    for(int Idx=0; Idx<12; Idx++) RefWord[Idx]=Word[Idx]=getRand();
+    LDPC_Encode_n354k160(Word);
+    RefEncode(RefWord, RefWord+5, 5, 194, (uint32_t *)LDPC_ParityGen_n354k160);
+    if(memcmp(Word, RefWord, 12*4)!=0) EncDiff++;
+    Valid += LDPC_Check_n354k160(Word)==0;
+    FlipBits(Word, 354);
+    if(LDPC_Check_n354k160(Word)!=RefCheck_n354k160(Word, Word+5)) CheckDiff++; }
+  Check("n354k160: encoder bit-exact", EncDiff==0);
+  Check("n354k160: encoded packets pass all checks", Valid==Packets);
+  Check("n354k160: same failed-check counts", CheckDiff==0); }
+#endif
+
+static uint32_t Sink=0;                                // keeps the benchmark loops from being optimized away
+
+static void Benchmark(void)
+{ static uint32_t Word[Packets][7];
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+    for(int Idx=0; Idx<7; Idx++) Word[Pkt][Idx]=getRand();
+  double Time[4];
+  for(int Test=0; Test<4; Test++)
+  { int Rounds=0; double Start=getTime();
+    do
+    { for(int Pkt=0; Pkt<Packets; Pkt++)
+      { uint32_t *Pack=Word[Pkt];
+        switch(Test)
+        { case 0: RefEncode(Pack, Pack+5, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); break;
+          case 1: LDPC_Encode(Pack); break;
+          case 2: Sink+=RefCheck(Pack, Pack+5); break;
+          case 3: Sink+=LDPC_Check(Pack); break; }
+        Sink+=Pack[5]; }
+      Rounds++; Time[Test]=getTime()-Start; } while(Time[Test]<0.3);
+    Time[Test]/=(double)Rounds*Packets; }
+  printf("encode: %6.3f us => %6.3f us/packet x%4.1f\n", 1e6*Time[0], 1e6*Time[1], Time[0]/Time[1]);
+  printf("check:  %6.3f us => %6.3f us/packet x%4.1f\n", 1e6*Time[2], 1e6*Time[3], Time[2]/Time[3]);
+  Check("word-wide encoder faster", Time[1]<Time[0]);
+  Check("word-wide check faster", Time[3]<Time[2]); }
+
+int main(int argc, char *argv[])
+{ Test_n208k160();
+#ifdef WITH_PPM
+  Test_n354k160();
+#endif
+  Benchmark();
+  return CheckResult(); }
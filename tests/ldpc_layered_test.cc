@@ -0,0 +1,99 @@
+// LDPC_Decoder::ProcessLayers() against the flooding ProcessChecks() loop of FSK_RxPacket::Decode() on simulated packets:
+// Manchester chips through white Gaussian noise, hard decisions, Manchester decoding into data and erasures like the RF chip path.
+// Per noise level: frame error rate, undetected errors, iterations and CPU time of both schedules.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ldpc.h"
+#include "manchester.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint64_t Rand = 0x0123456789ABCDEFULL;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>7; Rand^=Rand<<17; return Rand>>32; }
+static double getUniform(void) { return (getRand()+0.5)/4294967296.0; }
+static double getGauss(void) { return sqrt(-2*log(getUniform()))*cos(2*M_PI*getUniform()); }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int Bytes = LDPC_Decoder::CodeBytes;
+const int Iter  = 32;                                  // as FSK_RxPacket::Decode()
+
+static void Receive(uint8_t *Data, uint8_t *Err, const uint8_t *Packet, double Sigma) // packet through the noisy channel
+{ uint8_t Chips[2*Bytes];
+  Manchester_Encode(Chips, Packet, Bytes);
+  for(int Bit=0; Bit<16*Bytes; Bit++)
+  { uint8_t Mask = 1<<(Bit&7);
+    double Sample = ((Chips[Bit>>3]&Mask) ? 1.0:-1.0) + Sigma*getGauss();
+    if(Sample>0) Chips[Bit>>3]|=Mask; else Chips[Bit>>3]&=~Mask; }
+  Manchester_Decode(Data, Err, Chips, Bytes); }
+
+class Result
+{ public:
+   int Frames, Errors, Undetected;
+   int Iter, IterOK;                                   // iterations: all frames, correctly decoded frames
+   double Time;                                        // [sec]
+   void Clear(void) { memset(this, 0, sizeof(Result)); }
+   double FER(void) const { return (double)Errors/Frames; }
+   double avgIter(void) const { return (double)Iter/Frames; }
+   double avgIterOK(void) const { return Frames>Errors ? (double)IterOK/(Frames-Errors) : 0; }
+   void Add(int Check, bool Same, int Loops)
+   { Frames++; Iter+=Loops;
+     if(Check==0 && Same) { IterOK+=Loops; return; }
+     Errors++; if(Check==0) Undetected++; }
+} ;
+
+static LDPC_Decoder Decoder;
+
+int main(int argc, char *argv[])
+{ const int Frames = 2000;
+  const int Levels = 7;
+  const double EbN0[Levels] = { 2.0, 1.0, 0.0, -1.0, -2.0, -3.0, -4.0 } ;   // [dB] per data bit, i.e. per two Manchester chips
+  Result Flood[Levels], Layer[Levels];
+  printf("Eb/N0  FER flood layer  undetected   iterations: all  decoded     CPU [us/packet]\n");
+  for(int Lev=0; Lev<Levels; Lev++)
+  { double Sigma = sqrt(1.0/(2*2*pow(10, EbN0[Lev]/10)));  // two chips per bit
+    Flood[Lev].Clear(); Layer[Lev].Clear();
+    for(int Frame=0; Frame<Frames; Frame++)
+    { uint8_t Packet[Bytes], Data[Bytes], Err[Bytes], Out[Bytes];
+      for(int Idx=0; Idx<20; Idx++) Packet[Idx]=getRand();
+      LDPC_Encode(Packet);
+      Receive(Data, Err, Packet, Sigma);
+
+      double Start=getTime();
+      Decoder.Input(Data, Err);                         // the flooding loop as in FSK_RxPacket::Decode()
+      int Check=0, Loops=0;
+      for( ; Loops<Iter; )
+      { Check=Decoder.ProcessChecks(); Loops++;
+        if(Check==0) break; }
+      Decoder.Output(Out);
+      Flood[Lev].Time+=getTime()-Start;
+      Flood[Lev].Add(Check, memcmp(Out, Packet, Bytes)==0, Loops-(Check==0)); // the last loop which finds all checks pass is no iteration
+
+      Start=getTime();
+      Decoder.Input(Data, Err);
+      Check=Decoder.ProcessLayers(Iter);
+      Decoder.Output(Out);
+      Layer[Lev].Time+=getTime()-Start;
+      Layer[Lev].Add(Check, memcmp(Out, Packet, Bytes)==0, Decoder.Iter); }
+    printf("%4.1fdB  %5.3f %5.3f     %3d %3d   %5.2f %5.2f  %5.2f %5.2f   %5.1f %5.1f\n", EbN0[Lev],
+           Flood[Lev].FER(), Layer[Lev].FER(), Flood[Lev].Undetected, Layer[Lev].Undetected,
+           Flood[Lev].avgIter(), Layer[Lev].avgIter(), Flood[Lev].avgIterOK(), Layer[Lev].avgIterOK(),
+           1e6*Flood[Lev].Time/Frames, 1e6*Layer[Lev].Time/Frames); }
+
+  bool FER=1, Fewer=1; double FloodTime=0, LayerTime=0;
+  for(int Lev=0; Lev<Levels; Lev++)
+  { if(Layer[Lev].Errors > Flood[Lev].Errors + Frames/100) FER=0;                // not worse by more than 1% absolute: the statistical spread
+    if(Flood[Lev].avgIterOK()>2 && Layer[Lev].avgIterOK() > 0.7*Flood[Lev].avgIterOK()) Fewer=0;
+    FloodTime+=Flood[Lev].Time; LayerTime+=Layer[Lev].Time; }
+  Check("layered FER not worse than flooding", FER);
+  Check("layered: fewer iterations to decode", Fewer);
+  Check("layered: less CPU time over all levels", LayerTime<FloodTime);
+  return CheckResult(); }
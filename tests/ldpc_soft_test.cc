@@ -0,0 +1,86 @@
+// FSK_RxPacket::Decode() with the soft decisions of getSoft() against the hard bits and erasures of LDPC_Decoder::Input(Data, Err)
+// on simulated OGN packets: Manchester chips through white Gaussian noise with hard decisions like the RF chip,
+// and the same with a collision: an interferer at the signal level over a random part of the packet.
+// Frame error rate of both inputs versus Eb/N0, the soft input must not lose on plain noise and must gain with collisions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rx-pkt.h"
+#include "manchester.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint64_t Rand = 0x0FEDCBA987654321ULL;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>7; Rand^=Rand<<17; return Rand>>32; }
+static double getUniform(void) { return (getRand()+0.5)/4294967296.0; }
+static double getGauss(void) { return sqrt(-2*log(getUniform()))*cos(2*M_PI*getUniform()); }
+
+
+const int Bytes = LDPC_Decoder::CodeBytes;
+const int Chips = 16*Bytes;
+
+// chips in the order of transmission through the noise, Sigma per chip, raised by the interferer within [BurstStart, BurstEnd)
+static void Receive(FSK_RxPacket &RxPkt, const uint8_t *Packet, double Sigma, int BurstStart, int BurstEnd)
+{ uint8_t Chip[2*Bytes];
+  Manchester_Encode(Chip, Packet, Bytes);
+  double SigmaBurst = sqrt(Sigma*Sigma + 1.0);            // interferer as strong as the signal: its chips act as extra noise
+  for(int Idx=0; Idx<Chips; Idx++)
+  { uint8_t Mask = 0x80>>(Idx&7);
+    double Noise = (Idx>=BurstStart && Idx<BurstEnd) ? SigmaBurst:Sigma;
+    double Sample = ((Chip[Idx>>3]&Mask) ? 1.0:-1.0) + Noise*getGauss();
+    if(Sample>0) Chip[Idx>>3]|=Mask; else Chip[Idx>>3]&=~Mask; }
+  Manchester_Decode(RxPkt.Data, RxPkt.Err, Chip, Bytes);
+  RxPkt.Bytes = Bytes;
+  RxPkt.SysID = Radio_SysID_OGN;
+  RxPkt.SNR   = floor(4*10*log10(1/(2*Sigma*Sigma))+0.5); } // [0.25dB] per chip, as the receiver would see it off the RSSI
+
+static LDPC_Decoder Decoder;
+
+int main(int argc, char *argv[])
+{ const int Frames = 2000;
+  const int Levels = 8;
+  const double EbN0[Levels] = { 4.0, 3.0, 2.0, 1.0, 0.0, -1.0, -2.0, -3.0 } ;  // [dB] per data bit, i.e. per two Manchester chips
+  int Errors[2][2][Levels], Undetected[2][2][Levels];                         // [plain/collision][hard/soft][level]
+  memset(Errors, 0, sizeof(Errors)); memset(Undetected, 0, sizeof(Undetected));
+  printf("Eb/N0   FER noise: hard  soft   collision: hard  soft\n");
+  for(int Lev=0; Lev<Levels; Lev++)
+  { double Sigma = sqrt(1.0/(2*2*pow(10, EbN0[Lev]/10)));  // as ldpc_layered_test
+    for(int Chan=0; Chan<2; Chan++)
+    { for(int Frame=0; Frame<Frames; Frame++)
+      { uint8_t Packet[Bytes];
+        for(int Idx=0; Idx<20; Idx++) Packet[Idx]=getRand();
+        LDPC_Encode(Packet);
+        int BurstStart=0, BurstEnd=0;
+        if(Chan)                                             // collision over 10..30% of the packet
+        { int Len = Chips/10 + getRand()%(Chips/5);
+          BurstStart = getRand()%(Chips-Len); BurstEnd = BurstStart+Len; }
+        FSK_RxPacket RxPkt;
+        Receive(RxPkt, Packet, Sigma, BurstStart, BurstEnd);
+        for(int Soft=0; Soft<2; Soft++)
+        { OGN_RxPacket<OGN1_Packet> OGN;
+          int8_t SoftBit[LDPC_Decoder::CodeBits];
+          uint8_t Check = Soft ? RxPkt.Decode(OGN, Decoder, SoftBit) : RxPkt.Decode(OGN, Decoder);
+          if(Check==0 && memcmp(OGN.Packet.Byte(), Packet, Bytes)==0) continue;
+          Errors[Chan][Soft][Lev]++; if(Check==0) Undetected[Chan][Soft][Lev]++; }
+      }
+    }
+    printf("%4.1fdB             %5.3f %5.3f              %5.3f %5.3f\n", EbN0[Lev],
+           (double)Errors[0][0][Lev]/Frames, (double)Errors[0][1][Lev]/Frames,
+           (double)Errors[1][0][Lev]/Frames, (double)Errors[1][1][Lev]/Frames); }
+
+  bool NotWorse=1, Gain=1, Undet=1; int Hard=0, Soft=0;
+  for(int Lev=0; Lev<Levels; Lev++)
+  { if(Errors[0][1][Lev] > Errors[0][0][Lev] + Frames/100) NotWorse=0;      // not worse by more than 1% absolute: the statistical spread
+    if(Errors[1][0][Lev]<Frames/2) { Hard+=Errors[1][0][Lev]; Soft+=Errors[1][1][Lev]; } // where the hard input still decodes most packets
+    for(int Chan=0; Chan<2; Chan++)
+      if(Undetected[Chan][1][Lev] > Undetected[Chan][0][Lev] + Frames/200) Undet=0; }
+  if(Soft > 0.8*Hard) Gain=0;
+  printf("collisions, levels with FER below 50%%: %d failed frames with the hard input, %d with the soft input\n", Hard, Soft);
+  Check("soft input not worse in plain noise", NotWorse);
+  Check("soft input: 20% fewer failures with collisions", Gain);
+  Check("soft input: no more undetected errors", Undet);
+  return CheckResult(); }
@@ -0,0 +1,236 @@
+// LookOut as the one table of the traffic: positions of the same aircraft by OGN, PilotAware and ADS-L, and the relayed
+// copies, go into one target; a report not newer than the position on the list only adds its system to SysMask;
+// the GDL90 traffic report goes out once per aircraft per time slot by WriteGDL90().
+// A fleet circles around us transmitting OGN, ADS-L, both or PilotAware with ADS-L, a part of the packets is lost, a part comes again relayed
+// a second later. Counted: GDL90 reports per aircraft per second formerly (one per accepted packet) and now,
+// targets per aircraft, the systems noted for each. Then the CPU time of a new and of a repeated report.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#include "ogn.h"
+#include "lookout.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x5A5A1234;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const uint32_t StartTime = 1700000000;                 // [sec] UTC
+const int32_t  RefLat    = 46*600000;                  // [1/600000deg]
+const int32_t  RefLon    =  7*600000;
+const int16_t  RefLatCos = 2845;                       // [2^-12] cos(46deg)
+
+const uint8_t  ProtoOGN = 1, ProtoADSL = 2, ProtoPAW = 4; // what each aircraft transmits
+
+class Aircraft                                          // circles around a center, 10..60 m/s, at 500..2500 m
+{ public:
+   uint32_t Address;
+   uint8_t  AddrType;
+   uint8_t  AcftType;
+   uint8_t  Proto;
+   int32_t  CenterX, CenterY;                           // [m] north, east
+   int32_t  Radius;                                     // [m]
+   int32_t  Altitude;                                   // [m]
+   float    Omega;                                      // [rad/s] positive: clockwise
+   float    Phase;                                      // [rad]
+   GPS_Position Pos;
+
+  public:
+   void Random(uint8_t Type)
+   { Address=getRand()&0xFFFFFF; AddrType=2+getRand()%2; AcftType=1+getRand()%8; Proto=Type;
+     CenterX=(int32_t)(getRand()%8000)-4000; CenterY=(int32_t)(getRand()%8000)-4000;
+     Radius=200+getRand()%800; Altitude=500+getRand()%2000;
+     float Speed=10+getRand()%50; Omega=Speed/Radius; if(getRand()&1) Omega=-Omega;
+     Phase=(getRand()%6283)*1e-3; }
+
+   void Move(uint32_t Time)                             // the GPS position at given second
+   { float Angle=Phase+Omega*(Time-StartTime);
+     int32_t X=CenterX+Radius*cosf(Angle), Y=CenterY+Radius*sinf(Angle);
+     Pos.Clear(); setTime(Pos, Time);
+     Pos.Latitude  = RefLat+(X*27)/5;
+     Pos.Longitude = RefLon+(((Y<<12)/RefLatCos)*27)/5;
+     Pos.Altitude  = Altitude*10;
+     float Speed = fabsf(Omega)*Radius;
+     float Track = Angle*(180/M_PI) + (Omega>0 ? 90:-90);
+     Track=fmodf(Track, 360); if(Track<0) Track+=360;
+     Pos.Speed=Speed*10; Pos.Heading=Track*10; Pos.ClimbRate=0; Pos.TurnRate=Omega*(1800/M_PI);
+     Pos.FixQuality=1; Pos.FixMode=3; Pos.Satellites=10; Pos.PDOP=15; Pos.HDOP=10; Pos.VDOP=20; }
+
+   static void setTime(GPS_Position &Pos, uint32_t Time)
+   { Pos.Hour=(Time/3600)%24; Pos.Min=(Time/60)%60; Pos.Sec=Time%60; Pos.mSec=0; }
+
+   void Write(OGN1_Packet &Packet) const
+   { Packet.Clear();
+     Packet.Header.Address=Address; Packet.Header.AddrType=AddrType;
+     Packet.Position.AcftType=AcftType;
+     Pos.Encode(Packet); }
+
+   void Write(ADSL_Packet &Packet) const
+   { Packet.Init();
+     Packet.setAddress(Address); Packet.setAddrTypeOGN(AddrType); Packet.setAcftTypeOGN(AcftType);
+     Pos.Encode(Packet); }
+
+   uint32_t ID(void) const { return Address | ((uint32_t)AddrType<<24); }
+} ;
+
+class RxReport                                          // a packet as it comes to ProcessRxOGN() or ProcessRxADSL()
+{ public:
+   uint8_t     Proto;
+   uint16_t    Acft;
+   uint32_t    Time;                                    // [sec] of the position
+   OGN1_Packet OGN;
+   ADSL_Packet ADSL;
+} ;
+
+const int MaxAcft = 64;
+static Aircraft Acft[MaxAcft];
+
+const int MaxReports = 4*MaxAcft;
+static RxReport Report[MaxReports], Relay[MaxReports];
+static int Reports, Relays;
+
+static LookOut<32> Look;
+static GDL90_REPORT GDL_Report;
+static uint32_t GDL_Bytes;
+static void GDL_Output(const char *Msg, uint8_t Len) { GDL_Bytes+=Len; }
+
+static const LookOut_Target *Process(const RxReport &Rep, uint32_t RxTime)    // as ProcessRxOGN() and ProcessRxADSL()
+{ RxReport Pkt=Rep;                                                           // ProcessTarget() takes the packets by non-const reference
+  if(Pkt.Proto==ProtoADSL) return Look.ProcessTarget(Pkt.ADSL, RxTime);
+  return Look.ProcessTarget(Pkt.OGN, RxTime, 0, Pkt.Proto==ProtoPAW ? LookOut_Target::SysPAW:LookOut_Target::SysOGN); }
+
+static void Own(uint32_t Time)                         // our own position: straight north at 1000 m, 25 m/s, as the PROC slot
+{ GPS_Position Pos; Pos.Clear(); Aircraft::setTime(Pos, Time);
+  Pos.Latitude=RefLat+(25*(int32_t)(Time-StartTime)*27)/5; Pos.Longitude=RefLon; Pos.Altitude=10000;
+  Pos.Speed=250; Pos.Heading=0; Pos.FixQuality=1; Pos.FixMode=3; Pos.Satellites=10; Pos.PDOP=15; Pos.HDOP=10; Pos.VDOP=20;
+  OGN1_Packet Packet; Packet.Clear(); Packet.Header.Address=0x123456; Packet.Header.AddrType=3; Pos.Encode(Packet);
+  Look.ProcessOwn(Packet, Time, 0); }
+
+// ===================================================================================================
+
+class RunStats
+{ public:
+   uint32_t Seconds;
+   uint32_t PerPacket;                                  // formerly: a GDL90 report for every packet ProcessTarget() returns a target for
+   uint32_t PerSlot;                                    // now: WriteGDL90() once per slot
+   uint32_t Expected;                                   // aircraft with a new position since the previous slot
+   uint32_t SlotMismatch;                               // slots where PerSlot != Expected
+   uint32_t DupTargets;                                 // targets with the ID of another target
+   uint32_t MaxTargets;                                 // most targets allocated at once
+} ;
+
+static RunStats Run(int Acfts, float Loss, float RelayProb, int Seconds)
+{ RunStats Stats; memset(&Stats, 0, sizeof(Stats));
+  Look.Clear(); Relays=0;
+  bool Heard[MaxAcft]; uint32_t Last[MaxAcft];       // a new position since the previous slot, the time of the newest one
+  for(int Idx=0; Idx<MaxAcft; Idx++) { Heard[Idx]=0; Last[Idx]=0; }
+  for(int Sec=0; Sec<Seconds; Sec++)
+  { uint32_t Time=StartTime+Sec;
+    if(Sec)                                             // the slot: GDL90 of the positions received in the previous second
+    { uint8_t Count=Look.WriteGDL90(GDL_Report, GDL_Output);
+      uint32_t Exp=0; for(int Idx=0; Idx<Acfts; Idx++) { Exp+=Heard[Idx]; Heard[Idx]=0; }
+      Stats.PerSlot+=Count; Stats.Expected+=Exp; Stats.SlotMismatch+=(Count!=Exp); }
+    Own(Time);
+    Reports=0;
+    for(int Idx=0; Idx<Acfts; Idx++)                    // the packets of this second: every protocol of every aircraft
+    { Acft[Idx].Move(Time);
+      for(uint8_t Proto=1; Proto<=ProtoPAW; Proto<<=1)
+      { if((Acft[Idx].Proto&Proto)==0) continue;
+        RxReport &Rep=Report[Reports++]; Rep.Proto=Proto; Rep.Acft=Idx; Rep.Time=Time;
+        if(Proto==ProtoADSL) Acft[Idx].Write(Rep.ADSL); else Acft[Idx].Write(Rep.OGN); }
+    }
+    for(int Idx=Reports-1; Idx>0; Idx--) std::swap(Report[Idx], Report[getRand()%(Idx+1)]);  // in random order
+    for(int Idx=0; Idx<Relays; Idx++)                   // the relayed copies of the previous second come among them
+    { const RxReport &Rep=Relay[Idx];
+      const LookOut_Target *Tgt=Process(Rep, Time); Stats.PerPacket+=(Tgt!=0);
+      if(Rep.Time>Last[Rep.Acft]) { Last[Rep.Acft]=Rep.Time; Heard[Rep.Acft]=1; } } // all direct ones were lost
+    int NewRelays=0;
+    for(int Idx=0; Idx<Reports; Idx++)
+    { const RxReport &Rep=Report[Idx];
+      if(getRand()<RelayProb*4294967296.0) Relay[NewRelays++]=Rep;
+      if(getRand()<Loss*4294967296.0) continue;         // lost on the way
+      const LookOut_Target *Tgt=Process(Rep, Time); Stats.PerPacket+=(Tgt!=0);
+      if(Rep.Time>Last[Rep.Acft]) { Last[Rep.Acft]=Rep.Time; Heard[Rep.Acft]=1; } }
+    Relays=NewRelays;
+    uint32_t Targets=0;
+    for(int Idx=0; Idx<Look.MaxTargets; Idx++)
+    { const LookOut_Target &Tgt=Look.Target[Idx]; if(!Tgt.Alloc) continue;
+      Targets++;
+      for(int Other=Idx+1; Other<Look.MaxTargets; Other++)
+        if(Look.Target[Other].Alloc && Look.Target[Other].ID==Tgt.ID) Stats.DupTargets++; }
+    if(Targets>Stats.MaxTargets) Stats.MaxTargets=Targets;
+    Stats.Seconds++; }
+  return Stats; }
+
+static void Fleet(int Acfts)                           // a mix: OGN only, ADS-L only, both, PilotAware and ADS-L
+{ const uint8_t Mix[4] = { ProtoOGN, ProtoADSL, ProtoOGN|ProtoADSL, ProtoPAW|ProtoADSL };
+  for(int Idx=0; Idx<Acfts; Idx++) Acft[Idx].Random(Mix[Idx%4]); }
+
+static bool SystemsNoted(int Acfts)                    // every target has exactly the systems its aircraft transmits
+{ int Wrong=0, Found=0;
+  for(int Idx=0; Idx<Acfts; Idx++)
+  { const LookOut_Target *Tgt=Look.findTarget(Acft[Idx].ID()); if(Tgt==0) continue;
+    Found++;
+    uint8_t Mask=0;
+    if(Acft[Idx].Proto&ProtoOGN)  Mask|=LookOut_Target::SysOGN;
+    if(Acft[Idx].Proto&ProtoADSL) Mask|=LookOut_Target::SysADSL;
+    if(Acft[Idx].Proto&ProtoPAW)  Mask|=LookOut_Target::SysPAW;
+    Wrong+=(Tgt->SysMask!=Mask); }
+  return Found==Acfts && Wrong==0; }
+
+static void Test_Merge(void)
+{ const int Seconds=60;
+  Fleet(24);
+  RunStats Stats=Run(24, 0.2, 0.3, Seconds);
+  const char *Fmt="%2d aircraft, %2.0f%% lost, %2.0f%% relayed: GDL90 reports per aircraft per second: per packet %4.2f, per slot %4.2f\n";
+  printf(Fmt, 24, 20.0, 30.0, (double)Stats.PerPacket/(24*Seconds), (double)Stats.PerSlot/(24*Seconds));
+  Check("one target per aircraft", Stats.DupTargets==0 && Stats.MaxTargets==24);
+  Check("one report per aircraft with a new position per slot", Stats.SlotMismatch==0 && Stats.PerSlot==Stats.Expected);
+  Check("fewer reports than packets", Stats.PerSlot*3<Stats.PerPacket*2);
+  Check("systems noted for each aircraft", SystemsNoted(24));
+
+  Fleet(48);                                           // more aircraft than targets
+  Stats=Run(48, 0.2, 0.3, Seconds);
+  printf(Fmt, 48, 20.0, 30.0, (double)Stats.PerPacket/(48*Seconds), (double)Stats.PerSlot/(48*Seconds));
+  Check("table full: one target per aircraft", Stats.DupTargets==0 && Stats.MaxTargets<=Look.MaxTargets);
+  Check("table full: no more reports than targets", Stats.PerSlot<=(uint32_t)Look.MaxTargets*(Seconds-1)); }
+
+// ---------------------------------------------------------------------------------------------------
+
+static void Benchmark(void)                            // [ns] a new position against a repeated one: a relay or another system
+{ const int Acfts=32, Loops=2000;
+  Fleet(Acfts);
+  double Time[2] = { 0, 0 };
+  uint32_t Sum=0;
+  for(int Loop=0; Loop<Loops; Loop++)
+  { if(Loop%30==0) Look.Clear();                      // start again before we fly away from the fleet
+    uint32_t Sec=StartTime+Loop%30;
+    Own(Sec);
+    Reports=0;
+    for(int Idx=0; Idx<Acfts; Idx++)
+    { Acft[Idx].Move(Sec);
+      RxReport &Rep=Report[Reports++]; Rep.Proto=ProtoOGN; Rep.Acft=Idx; Acft[Idx].Write(Rep.OGN);
+      RxReport &Rep2=Report[Reports++]; Rep2.Proto=ProtoADSL; Rep2.Acft=Idx; Acft[Idx].Write(Rep2.ADSL); }
+    for(int Pass=0; Pass<2; Pass++)                    // first the OGN: new positions, then the ADS-L of the same second
+    { double Start=getTime();
+      for(int Idx=Pass; Idx<Reports; Idx+=2) Sum+=(Process(Report[Idx], Sec)!=0);
+      Time[Pass]+=getTime()-Start; }
+    Look.WriteGDL90(GDL_Report, GDL_Output); }
+  double New=1e9*Time[0]/(Acfts*Loops), Rep=1e9*Time[1]/(Acfts*Loops);
+  printf("ProcessTarget() [ns/pkt]: new position %6.1f, repeated %6.1f\n", New, Rep);
+  Check("every report finds its target", Sum==2*Acfts*Loops);
+  Check("repeated report cheaper than a new position", Rep<New); }
+
+int main(int argc, char *argv[])
+{ Test_Merge();
+  Benchmark();
+  return CheckResult(); }
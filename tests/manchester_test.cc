@@ -0,0 +1,119 @@
+// Word-wide and SIMD Manchester decoder of manchester.h against the original nibble-table loop:
+// exhaustive check over all two-byte chip patterns, random packets with errors and a speed comparison.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "manchester.h"
+
+// ===================================================================================================
+
+static void TableDecode(uint8_t *Data, uint8_t *Err, const uint8_t *Chips, int Bytes) // as done so far in Radio_Receive()
+{ int PktIdx=0;
+  for(int Idx=0; Idx<Bytes; Idx++)
+  { uint8_t ByteH = Chips[PktIdx++];
+    ByteH = ManchesterDecode[ByteH]; uint8_t ErrH=ByteH>>4; ByteH&=0x0F;
+    uint8_t ByteL = Chips[PktIdx++];
+    ByteL = ManchesterDecode[ByteL]; uint8_t ErrL=ByteL>>4; ByteL&=0x0F;
+    Data[Idx]=(ByteH<<4) | ByteL;
+    Err [Idx]=(ErrH <<4) | ErrL ; }
+}
+
+static int TableEncode(uint8_t *Out, const uint8_t *Inp, int InpLen)
+{ int Len=0;
+  for(int Idx=0; Idx<InpLen; Idx++)
+  { uint8_t Byte=Inp[Idx];
+    Out[Len++]=ManchesterEncode[Byte>>4];
+    Out[Len++]=ManchesterEncode[Byte&0x0F]; }
+  return Len; }
+
+static uint32_t Rand = 0x12345678;
+static uint8_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand>>8; }
+
+static double CPUtime(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+// ===================================================================================================
+
+static const int MaxBytes = 48;                      // as FSK_RxPacket::MaxBytes
+
+static int CheckExhaustive(void)                     // all 65536 patterns of two Manchester bytes => one data byte
+{ int Fail=0;
+  for(uint32_t Word=0; Word<0x10000; Word++)
+  { uint8_t Chips[2] = { (uint8_t)(Word>>8), (uint8_t)Word };
+    uint8_t RefData, RefErr, Data, Err;
+    TableDecode(&RefData, &RefErr, Chips, 1);
+    Manchester_DecodeScalar(&Data, &Err, Chips, 1);
+    if(Data!=RefData || Err!=RefErr) Fail++; }
+  printf("Exhaustive two-byte patterns: %d mismatches\n", Fail);
+  return Fail; }
+
+static int CheckRandom(int Packets)                  // random lengths, random data with random chip errors
+{ int Fail=0;
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+  { int Bytes = 1+getRand()%MaxBytes;
+    uint8_t Inp[MaxBytes], Chips[2*MaxBytes], RefChips[2*MaxBytes];
+    for(int Idx=0; Idx<Bytes; Idx++) Inp[Idx]=getRand();
+    int Len=Manchester_Encode(Chips, Inp, Bytes);
+    int RefLen=TableEncode(RefChips, Inp, Bytes);
+    if(Len!=RefLen || memcmp(Chips, RefChips, Len)) Fail++;
+    int Flips = getRand()%8;
+    for(int Flip=0; Flip<Flips; Flip++) { int Bit=(getRand()*256+getRand())%(8*Len); Chips[Bit>>3]^=0x80>>(Bit&7); }
+    uint8_t RefData[MaxBytes], RefErr[MaxBytes], Data[MaxBytes], Err[MaxBytes], ScalarData[MaxBytes], ScalarErr[MaxBytes];
+    TableDecode(RefData, RefErr, Chips, Bytes);
+    Manchester_Decode(Data, Err, Chips, Bytes);
+    Manchester_DecodeScalar(ScalarData, ScalarErr, Chips, Bytes);
+    if(memcmp(Data, RefData, Bytes) || memcmp(Err, RefErr, Bytes)) Fail++;
+    if(memcmp(ScalarData, RefData, Bytes) || memcmp(ScalarErr, RefErr, Bytes)) Fail++;
+    if(Flips==0)
+    { if(memcmp(Data, Inp, Bytes)) Fail++;
+      for(int Idx=0; Idx<Bytes; Idx++) if(Err[Idx]) { Fail++; break; } }
+  }
+  printf("Random packets: %d, %d mismatches\n", Packets, Fail);
+  return Fail; }
+
+// ===================================================================================================
+
+static const int BenchPackets = 4096;                // a set of captured-like packets, replayed many times
+static uint8_t BenchChips[BenchPackets][2*MaxBytes];
+static uint8_t BenchData[MaxBytes], BenchErr[MaxBytes];
+
+template <void (*Decode)(uint8_t *, uint8_t *, const uint8_t *, int)>
+ static double Bench(int Bytes, int Rounds, uint32_t &Check)
+{ double Start=CPUtime();
+  for(int Round=0; Round<Rounds; Round++)
+  { for(int Pkt=0; Pkt<BenchPackets; Pkt++)
+    { (*Decode)(BenchData, BenchErr, BenchChips[Pkt], Bytes);
+      Check += BenchData[Pkt%Bytes] + BenchErr[0]; }
+  }
+  return 1e9*(CPUtime()-Start)/((double)Rounds*BenchPackets); } // [ns] per packet
+
+static void Benchmark(int Bytes, int Rounds)
+{ for(int Pkt=0; Pkt<BenchPackets; Pkt++)
+    for(int Idx=0; Idx<2*Bytes; Idx++) BenchChips[Pkt][Idx]=getRand();
+  uint32_t Check=0;
+  double Table  = Bench<TableDecode>(Bytes, Rounds, Check);
+  double Scalar = Bench<Manchester_DecodeScalar>(Bytes, Rounds, Check);
+  double Vector = Bench<Manchester_Decode>(Bytes, Rounds, Check);
+  printf("%2d-byte packet: table %6.1fns, word %6.1fns (x%3.1f), %s %6.1fns (x%3.1f) [%08X]\n",
+         Bytes, Table, Scalar, Table/Scalar,
+#if defined(__SSE2__)
+         "SSE2",
+#elif defined(__ARM_NEON)
+         "NEON",
+#else
+         "word",
+#endif
+         Vector, Table/Vector, Check); }
+
+int main(int argc, char *argv[])
+{ int Rounds = argc>1 ? atoi(argv[1]) : 1000;
+  int Fail=0;
+  Fail+=CheckExhaustive();
+  Fail+=CheckRandom(100000);
+  Benchmark(24, Rounds);                             // ADS-L
+  Benchmark(26, Rounds);                             // OGN/FLARM
+  Benchmark(48, Rounds);                             // the largest FSK_RxPacket
+  printf("%s\n", Fail?"FAIL":"OK");
+  return Fail ? 1 : 0; }
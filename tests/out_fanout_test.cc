@@ -0,0 +1,361 @@
+// Output fan-out of out-fanout.h: the PROC task posts the traffic sentences, each sink drains its queue at the pace of its link.
+// 1) a model on a virtual 1 ms clock, like loop() servicing the console links every tick: USB at 115200 bps, BLE at 1.6 kB/s
+//    with a 2 kB/s rate limit, a BT client which stops reading for 3 s every 10 s, an AP sink which comes on after 20 s.
+//    Against the former path: PROC writes every sentence into every link, waits while Serial or BluetoothSerial is full,
+//    and the BLE FIFO loses the bytes which do not fit.
+// 2) the console Mut-Ex: loop() services the console links under CONS_Mutex while PROC prints a status line under it
+//    every second and a BT client stalls: with BluetoothSerial written under the Mut-Ex PROC waits for the stall,
+//    with the BT FIFO filled under the Mut-Ex and drained outside it PROC does not wait.
+// 3) threads: the producer and three sinks (fast, slow with partial writes, stalling) at full speed,
+//    also under the thread sanitizer: the buffers, their references and the queues between the tasks.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "out-fanout.h"
+#include "check.h"
+
+typedef Out_FanOut<> FanOut;                            // the sizes of the firmware with all four outputs
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x2468ACE1;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+static uint16_t MakeMsg(char *Out, uint32_t Seq, uint16_t Len)   // "$PTEST,<seq>,<len>,ABC...\n" of exactly Len bytes
+{ int Pos=sprintf(Out, "$PTEST,%06u,%03u,", Seq%1000000, Len);
+  for( ; Pos<Len-1; Pos++) Out[Pos]='A'+(Seq+Pos)%26;
+  Out[Pos++]='\n'; return Pos; }
+
+class Receiver                                          // the client at the other end of a link: whole sentences, in order
+{ public:
+   char     Line[256];
+   uint16_t Len;
+   int64_t  LastSeq;
+   uint32_t Good, Bad;
+
+  public:
+   void Clear(void) { Len=0; LastSeq=(-1); Good=Bad=0; }
+
+   void Write(const char *Data, int Count)
+   { for(int Idx=0; Idx<Count; Idx++)
+     { char Byte=Data[Idx]; Line[Len++]=Byte;
+       if(Byte=='\n') { Check(); Len=0; continue; }
+       if(Len>=sizeof(Line)) { Bad++; Len=0; } }
+   }
+
+   void Check(void)
+   { unsigned Seq, MsgLen; char Ref[256];
+     if(sscanf(Line, "$PTEST,%u,%u,", &Seq, &MsgLen)!=2 || MsgLen!=Len) { Bad++; return; }
+     MakeMsg(Ref, Seq, MsgLen);
+     if(memcmp(Ref, Line, Len)!=0 || (int64_t)Seq<=LastSeq) Bad++; else Good++;
+     LastSeq=Seq; }
+} ;
+
+// ===================================================================================================
+// the model on the virtual clock
+
+class LinkModel                                         // a link buffer drained at a fixed rate, except when the client stalls
+{ public:
+   double Size;                                         // [byte]
+   double Rate;                                         // [byte/s]
+   double StallPeriod, StallTime;                       // [s] the client stops reading for StallTime every StallPeriod
+   double Level;                                        // [byte] waiting in the buffer
+   double Time;                                         // [s]
+
+  public:
+   void Clear(void) { Level=0; Time=0; }
+   bool isStalled(double T) const { return StallPeriod>0 && fmod(T, StallPeriod)>=StallPeriod-StallTime; }
+   void Advance(double T)                               // drain till time T
+   { while(Time<T)
+     { double Step=T-Time; if(Step>0.001) Step=0.001;
+       if(!isStalled(Time)) { Level-=Rate*Step; if(Level<0) Level=0; }
+       Time+=Step; }
+   }
+   int Free(void) const { return (int)(Size-Level); }
+   int Take(int Len, bool Partial)                      // how much of a message the link takes now
+   { int Space=Free(); if(Space<=0) return 0;
+     if(Space<Len) { if(!Partial) return 0; Len=Space; }
+     Level+=Len; return Len; }
+} ;
+
+class SinkModel
+{ public:
+   const char *Name;
+   LinkModel   Link;
+   bool        Partial;                                 // takes a part of a message or all of it
+   Receiver    Rx;
+} ;
+
+static const int SimTime = 60;                          // [s]
+static const int Sinks = 4;
+static SinkModel Model[Sinks];
+static double    Now;                                   // [s] the virtual time
+
+template <int Idx>
+ static int ModelWrite(const char *Data, int Len)
+{ SinkModel &Sink=Model[Idx];
+  int Took=Sink.Link.Take(Len, Sink.Partial);
+  if(Took>0) Sink.Rx.Write(Data, Took);
+  return Took; }
+
+static bool AP_isOn(void) { return Now>=20.0; }
+
+class Event { public: uint32_t usTime; uint16_t Len; } ;
+
+static void MakeTraffic(std::vector<Event> &Events)    // 50 packets/s with POGNT/PFLAA/PXFLM, the per-slot reports of 10 aircraft
+{ double Time=0;
+  for( ; ; )
+  { double Uni=(getRand()+0.5)/4294967296.0;
+    Time+=-log(Uni)/50;
+    if(Time>=SimTime) break;
+    uint32_t usTime=(uint32_t)(Time*1e6);
+    uint32_t Sec=usTime/1000000;
+    if(Events.size() && Events.back().usTime/1000000<Sec)              // slot start: PFLAU, PFLAA and GDL90 for all aircraft
+    { uint32_t usSlot=Sec*1000000+300000;
+      Events.push_back( { usSlot, 40 } );
+      for(int Acft=0; Acft<10; Acft++) Events.push_back( { usSlot, 70 } );
+      for(int Acft=0; Acft<10; Acft++) Events.push_back( { usSlot, 44 } ); }
+    Events.push_back( { usTime, (uint16_t)(60+getRand()%47) } ); }
+  std::stable_sort(Events.begin(), Events.end(), [](const Event &A, const Event &B) { return A.usTime<B.usTime; } );
+}
+
+static void SetupLinks(void)
+{ Model[0].Name="USB"; Model[0].Link={  256,  11520,  0, 0 }; Model[0].Partial=0;
+  Model[1].Name="BLE"; Model[1].Link={  256,   1600,  0, 0 }; Model[1].Partial=0;
+  Model[2].Name="BT";  Model[2].Link={  512,   8000, 10, 3 }; Model[2].Partial=1;
+  Model[3].Name="AP";  Model[3].Link={ 1024, 100000,  0, 0 }; Model[3].Partial=1;
+  for(int Idx=0; Idx<Sinks; Idx++) { Model[Idx].Link.Clear(); Model[Idx].Rx.Clear(); }
+}
+
+static void FormerPath(const std::vector<Event> &Events)   // PROC writes into every link itself
+{ SetupLinks();
+  Model[1].Link.Size=2048;                             // the BLE FIFO took all the console output
+  double ProcTime=0, DelaySum=0, DelayMax=0; uint32_t Torn=0;
+  for(size_t Idx=0; Idx<Events.size(); Idx++)
+  { double Time=1e-6*Events[Idx].usTime; if(ProcTime<Time) ProcTime=Time;
+    int Len=Events[Idx].Len;
+    for(int Sink=0; Sink<Sinks; Sink++)
+    { LinkModel &Link=Model[Sink].Link;
+      if(Sink==3 && Time<20.0) continue;               // AP client not there yet
+      Link.Advance(ProcTime);
+      if(Sink==1) { if(Link.Take(Len, 1)<Len) Torn++; continue; }     // BLE FIFO: what does not fit is lost
+      while(Link.Free()<Len) { ProcTime+=0.001; Link.Advance(ProcTime); } // Serial/BluetoothSerial: wait for the space
+      Link.Take(Len, 0); }
+    double Delay=ProcTime-Time; DelaySum+=Delay; if(Delay>DelayMax) DelayMax=Delay; }
+  printf("former path: PROC delayed by %6.1f ms aver, %6.0f ms max, %u torn BLE sentences out of %u\n",
+         1e3*DelaySum/Events.size(), 1e3*DelayMax, Torn, (unsigned)Events.size()); }
+
+static void ModelRun(void)
+{ std::vector<Event> Events; MakeTraffic(Events);
+  FormerPath(Events);
+
+  static FanOut Out;
+  SetupLinks();
+  Out.addSink("USB", ModelWrite<0>,       0,    0, 1000000);
+  Out.addSink("BLE", ModelWrite<1>,       0, 2000, 1000000);
+  Out.addSink("BT",  ModelWrite<2>,       0,    0, 1000000);
+  Out.addSink("AP",  ModelWrite<3>, AP_isOn,    0, 1000000);
+  uint32_t Total=Events.size(), APExpected=0;
+  size_t Ev=0;
+  for(uint32_t msTime=0; msTime<(SimTime+3)*1000; msTime++)   // 3 more seconds to drain the queues
+  { Now=1e-3*msTime; uint32_t usNow=msTime*1000;
+    for( ; Ev<Events.size() && Events[Ev].usTime<=usNow; Ev++)  // PROC: format into the pool and post
+    { char *Buf=Out.getBuffer(); if(Buf==0) continue;
+      uint16_t Len=MakeMsg(Buf, Ev, Events[Ev].Len);
+      if(AP_isOn()) APExpected++;
+      Out.Post(Buf, Len, Events[Ev].usTime); }
+    for(int Sink=0; Sink<Sinks; Sink++)                // the link tasks, every 1 ms
+    { Model[Sink].Link.Advance(Now); Out.Service(Sink, usNow); }
+  }
+
+  char Line[128];
+  for(int Sink=0; Sink<Sinks; Sink++)
+  { Out.Print(Line, Sink); printf("fan-out %s", Line); }
+  uint32_t Held=0;
+  for(const FanOut::Buffer &Buf: Out.Pool) Held+=Buf.Refs.load();
+  uint32_t Bad=0, Lost=0;
+  for(int Sink=0; Sink<Sinks; Sink++)
+  { const FanOut::Sink &Stat=Out.Sinks[Sink];
+    Bad+=Model[Sink].Rx.Bad+(Model[Sink].Rx.Good!=Stat.Sent);
+    Lost+=Stat.Posted!=Stat.Sent+Stat.AgeDrops; }      // every queued message is sent or dropped for its age
+  const FanOut::Sink &USB=Out.Sinks[0], &BLE=Out.Sinks[1], &BT=Out.Sinks[2], &AP=Out.Sinks[3];
+  Check("sentences torn or out of order",            Bad, 0, 0);
+  Check("queued but neither sent nor dropped",        Lost, 0, 0);
+  Check("pool empty: dropped for all",                Out.PoolDrops, 0, 0);
+  Check("buffers not back in the pool",               Held, 0, 0);
+  Check("USB: sent/posted",                           (double)USB.Sent/Total, 1, 1);
+  Check("USB: max. latency [ms]",                     1e-3*USB.LatencyMax, 0, 300);
+  Check("BLE: posted+dropped/posted",                 (double)(BLE.Posted+BLE.QueueDrops+BLE.RateDrops)/Total, 1, 1);
+  Check("BLE: rate drops/posted",                     (double)BLE.RateDrops/Total, 0.3, 0.9);
+  Check("BLE: sent bytes [byte/s]",                   (double)BLE.Bytes/SimTime, 1000, 1650);
+  Check("BLE: max. latency [ms]",                     1e-3*BLE.LatencyMax, 0, 1000);
+  Check("BT stalls: dropped for age",                 BT.AgeDrops, 1, Total);
+  Check("BT stalls: sent/posted",                     (double)BT.Sent/Total, 0.5, 0.95);
+  Check("AP: posted+dropped/posted while on",         (double)(AP.Posted+AP.QueueDrops+AP.RateDrops)/APExpected, 1, 1);
+  Check("AP: sent/posted while on",                   (double)AP.Sent/APExpected, 1, 1);
+}
+
+// ===================================================================================================
+// the console Mut-Ex with a stalled BT client
+
+static LinkModel        BTLink;                         // BluetoothSerial and its client
+static FIFO<char, 1024> BTFifo;                         // BT_TxFIFO of main.cpp
+static double           WriteTime;                      // [s] the virtual time of the task which writes: advanced while it waits
+
+static void BTWait(int Len)                             // BluetoothSerial.write(): waits till the link took all
+{ while(BTLink.Free()<Len) { WriteTime+=0.001; BTLink.Advance(WriteTime); }
+  BTLink.Take(Len, 0); }
+
+static int USBWrite(const char *Data, int Len) { return Len; }             // the USB is not the subject here
+static int BTWriteWait(const char *Data, int Len) { BTWait(Len); return Len; } // the former sink: waits under the Mut-Ex
+static int BTWriteFIFO(const char *Data, int Len)       // OUT_BTWrite(): whole sentences or nothing, never waits
+{ return OUT_WriteFIFO(BTFifo, Data, Len); }
+
+static double MutexRun(bool Former)                     // returns PROC's max. delay [s] of the status line
+{ static FanOut Out; Out.Clear();
+  std::vector<Event> Events; MakeTraffic(Events);
+  BTLink = { 512, 8000, 10, 3 }; BTLink.Clear(); BTFifo.Clear();
+  Out.addSink("USB", USBWrite, 0, 0, 1000000);
+  Out.addSink("BT",  Former ? BTWriteWait:BTWriteFIFO, 0, 8000, 1000000);
+  const int StatusLen = 60;                             // $POGNR or another console line of PROC
+  double MutexFree=0, LoopFree=0, ProcFree=0;           // [s] when the Mut-Ex, loop() and PROC are free again
+  double DelaySum=0, DelayMax=0; int Status=0;
+  size_t Ev=0;
+  for(uint32_t msTime=0; msTime<SimTime*1000; msTime++)
+  { double Time=1e-3*msTime; uint32_t usNow=msTime*1000;
+    BTLink.Advance(Time);
+    if(Time>=ProcFree)                                  // PROC: the traffic into the pool, never waits
+    { for( ; Ev<Events.size() && Events[Ev].usTime<=usNow; Ev++)
+      { char *Buf=Out.getBuffer(); if(Buf==0) continue;
+        Out.Post(Buf, MakeMsg(Buf, Ev, Events[Ev].Len), Events[Ev].usTime); }
+    }
+    if(msTime%1000==500)                                // PROC: the status line under the Mut-Ex, through CONS_UART_Write()
+    { double Start = std::max(std::max(Time, ProcFree), MutexFree);
+      WriteTime=Start;
+      if(Former) BTWait(StatusLen);                     // BTserial.write() byte by byte
+            else { char Line[StatusLen]; memset(Line, 'S', StatusLen); BTFifo.Write(Line, StatusLen); }
+      MutexFree=ProcFree=WriteTime;
+      double Delay=WriteTime-Time; DelaySum+=Delay; if(Delay>DelayMax) DelayMax=Delay; Status++; }
+    if(Time>=LoopFree && Time>=MutexFree)               // loop(): OUT_Service()
+    { WriteTime=Time;
+      Out.Service(0, usNow); Out.Service(1, usNow);     // under the Mut-Ex
+      MutexFree=WriteTime;
+      if(!Former)                                       // BT_TxDrain(): outside the Mut-Ex
+      { char *Data; unsigned Len=BTFifo.getReadBlock(Data); if(Len>256) Len=256;
+        if(Len) { BTWait(Len); BTFifo.flushReadBlock(Len); } }
+      LoopFree=WriteTime; }
+  }
+  const FanOut::Sink &BT=Out.Sinks[1];
+  printf("%s: PROC status line delayed by %6.1f ms aver, %6.0f ms max, BT sent %u, dropped %u/%u/%u\n",
+         Former ? "BT write under the Mut-Ex":"BT FIFO outside the Mut-Ex", 1e3*DelaySum/Status, 1e3*DelayMax,
+         BT.Sent, BT.QueueDrops, BT.RateDrops, BT.AgeDrops);
+  if(!Former)
+  { Check("BT FIFO: sentences sent over BT",           (double)BT.Sent/Events.size(), 0.5, 1);
+    char Long[sizeof(FanOut::Buffer::Data)+1]; memset(Long, 'L', sizeof(Long));
+    uint32_t PoolDrops=Out.PoolDrops;
+    Out.PostCopy(Long, sizeof(Long), 0);
+    Check("too long for a buffer: counted",             Out.LongDrops, 1, 1);
+    Check("too long for a buffer: not a pool drop",     Out.PoolDrops-PoolDrops, 0, 0); }
+  return DelayMax; }
+
+static void WriteFIFORun(void)                          // OUT_WriteFIFO(): the sinks of bt4.cpp, main.cpp and ap.cpp
+{ static FIFO<char, 1024> Large; static FIFO<char, 64> Small;
+  char Msg[100]; memset(Msg, 'M', sizeof(Msg));
+  int Taken=0;
+  for(int Idx=0; Idx<8; Idx++) Taken+=OUT_WriteFIFO(Large, Msg, sizeof(Msg));
+  Check("link FIFO kept short: whole sentences taken",  Taken==(int)(OUT_FIFOmaxFull/sizeof(Msg)*sizeof(Msg)) && Large.Full()==(unsigned)Taken);
+  Check("small link FIFO: a sentence too long for it", OUT_WriteFIFO(Small, Msg, sizeof(Msg))==0 && Small.Full()==0);
+  Check("small link FIFO: a sentence which fits",      OUT_WriteFIFO(Small, Msg, 40)==40); }
+
+static void MutexRun(void)
+{ double Former=MutexRun(1);
+  double Now=MutexRun(0);
+  Check("BT write under the Mut-Ex: PROC waits [ms]",  1e3*Former, 1000, 3100);
+  Check("BT FIFO: PROC max. delay [ms]",                1e3*Now, 0, 1); }
+
+// ===================================================================================================
+// threads at full speed
+
+#ifdef __SANITIZE_THREAD__
+static const uint32_t Count =  50000;                  // messages: the sanitizer is slow
+#else
+static const uint32_t Count = 500000;
+#endif
+
+static FanOut           Out;
+static Receiver         ThreadRx[3];
+static std::atomic<bool> Done;
+
+static int FastWrite(const char *Data, int Len) { ThreadRx[0].Write(Data, Len); return Len; }
+
+static int SlowWrite(const char *Data, int Len)         // takes a few bytes at a time
+{ static uint32_t Rand=0x13579BDF;
+  Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5;
+  int Took=1+Rand%40; if(Took>Len) Took=Len;
+  ThreadRx[1].Write(Data, Took);
+  std::this_thread::yield();
+  return Took; }
+
+static int StallWrite(const char *Data, int Len)        // takes nothing for 2000 calls, then everything for 2000 calls
+{ static uint32_t Calls=0;
+  if(((Calls++)/2000)%2==0) return 0;
+  ThreadRx[2].Write(Data, Len); return Len; }
+
+static void SinkTask(int Sink)
+{ for( ; ; )
+  { bool Last=Done.load(std::memory_order_acquire);
+    uint16_t Bytes=Out.Service(Sink, 0);
+    if(Last && Out.Sinks[Sink].Queue.getRead()==0) break;
+    if(Bytes==0) std::this_thread::yield(); }
+}
+
+static void ThreadRun(void)
+{ Out.addSink("fast",  FastWrite);
+  Out.addSink("slow",  SlowWrite);
+  Out.addSink("stall", StallWrite);
+  for(int Sink=0; Sink<3; Sink++) ThreadRx[Sink].Clear();
+  Done.store(0);
+  std::thread Task[3] = { std::thread(SinkTask, 0), std::thread(SinkTask, 1), std::thread(SinkTask, 2) };
+  double PostTime=0;
+  for(uint32_t Seq=0; Seq<Count; Seq++)                // PROC: never waits for the sinks
+  { double Start=getTime();
+    char *Buf=Out.getBuffer();
+    if(Buf) { uint16_t Len=MakeMsg(Buf, Seq, 30+Seq%90); Out.Post(Buf, Len, 0); }
+    PostTime+=getTime()-Start;
+    if(Seq%16==15) std::this_thread::yield(); }         // between the packets the sinks get the CPU
+  Done.store(1, std::memory_order_release);
+  for(int Sink=0; Sink<3; Sink++) Task[Sink].join();
+
+  char Line[128];
+  printf("threads: %u messages, %.2f us per getBuffer()+Post(), %u dropped for all\n", Count, 1e6*PostTime/Count, Out.PoolDrops);
+  uint32_t Bad=0;
+  for(int Sink=0; Sink<3; Sink++)
+  { const FanOut::Sink &Stat=Out.Sinks[Sink];
+    Out.Print(Line, Sink); printf("threads %s", Line);
+    Bad+=ThreadRx[Sink].Bad + (ThreadRx[Sink].Good!=Stat.Sent) + (Stat.Posted!=Stat.Sent)
+       + (Stat.Posted+Stat.QueueDrops!=Count-Out.PoolDrops); }
+  uint32_t Held=0;
+  for(const FanOut::Buffer &Buf: Out.Pool) Held+=Buf.Refs.load();
+  Check("threads: messages lost, torn or out of order", Bad, 0, 0);
+  Check("threads: buffers not back in the pool",       Held, 0, 0);
+  Check("threads: fast sink sent/posted",              (double)Out.Sinks[0].Sent/(Count-Out.PoolDrops), 0.9, 1);
+}
+
+int main(int argc, char *argv[])
+{ ModelRun();
+  MutexRun();
+  WriteFIFORun();
+  ThreadRun();
+  return CheckResult(); }
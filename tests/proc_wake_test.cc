@@ -0,0 +1,183 @@
+// The wake-up of vTaskPROC on the virtual clock of the FreeRTOS shim: the former loop polling every 1 ms with vTaskDelay(1)
+// against the wait on the task notification of proc-wake.h with the time-slot boundary as the timeout.
+// The RF task is modelled by random packet arrivals into a FIFO, the GPS by a position ready some 50..150 ms after the PPS.
+// Measured: latency from a packet in the FIFO to its decode, task wake-ups per second, when the time slot starts.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Arduino.h>
+
+#include "fifo.h"
+#include "proc-wake.h"
+#include "check.h"
+
+SimClock     Sim_Clock;
+TaskHandle_t PROC_TaskHandle = 0;
+
+// ===================================================================================================
+
+static const uint64_t usStart  = 10000000;              // [usec] virtual time at the start: whole seconds from the PPS
+static const int      SimTime  = 60;                    // [sec] how long to run each case
+static const int      SkipTime = 2;                     // [sec] do not count the start-up
+
+static uint32_t Rand = 0x2468ACE1;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+// ===================================================================================================
+// the models of the RF and GPS tasks: called whenever the virtual time advances
+
+static FIFO<uint64_t, 32> RxFIFO;                       // stands for FSK_RxFIFO: the time each packet arrived
+static float    PktRate;                                // [1/sec] packets received
+static uint64_t usNextPkt;                              // [usec] next packet arrival
+static uint32_t RxCount, RxLost;
+
+static bool     GPS_Lock;                               // with the position every second or without
+static uint64_t usNextPos;                              // [usec] next position ready
+static uint32_t PosReadySec;                            // [sec] the second of the most recent position ready
+
+static uint64_t NextPacket(uint64_t usNow)              // exponential inter-arrival times
+{ if(PktRate<=0) return 0;
+  double Uni = (getRand()+0.5)/4294967296.0;
+  return usNow+1+(uint64_t)(-log(Uni)/PktRate*1e6); }
+
+static uint64_t NextPosition(uint64_t usNow)            // 50..150ms after the next PPS
+{ uint64_t usPPS = (usNow/1000000+1)*1000000;
+  return usPPS+50000+getRand()%100000; }
+
+static void RF_Model(uint64_t usTime)
+{ while(usNextPkt && usNextPkt<=usTime)
+  { uint64_t *Pkt=RxFIFO.getWrite(); *Pkt=usNextPkt;
+    if(RxFIFO.Write()) RxCount++; else RxLost++;
+    PROC_Notify(PROCevt_RxPacket);                      // as Radio_Task after FSK_RxFIFO.Write()
+    usNextPkt=NextPacket(usNextPkt); }
+  if(usNextPkt) Sim_Clock.Wake(usNextPkt); }
+
+static void GPS_Model(uint64_t usTime)
+{ if(!GPS_Lock) return;
+  if(usNextPos<=usTime)
+  { PosReadySec=usNextPos/1000000;
+    PROC_Notify(PROCevt_NewPos);                        // as GPS_BurstComplete()
+    usNextPos=NextPosition(usNextPos); }
+  Sim_Clock.Wake(usNextPos); }
+
+static void getTime(uint32_t &Time, uint16_t &msTime)  // TimeSync_Time(): the PPS is at whole seconds of the virtual time
+{ Time=Sim_Clock.usTime/1000000; msTime=(Sim_Clock.usTime/1000)%1000; }
+
+// ===================================================================================================
+// the PROC task: the slot logic of vTaskPROC, the packet decode is only the latency record
+
+class ProcStats
+{ public:
+   double   LatencySum, LatencyMax;                     // [ms]
+   uint32_t Decoded;
+   uint32_t Wakeups;
+   uint32_t Slots;
+   double   SlotSum;                                    // [ms] slot start after the PPS
+   uint16_t SlotMin, SlotMax;
+
+  public:
+   void Clear(void) { LatencySum=LatencyMax=0; Decoded=Wakeups=Slots=0; SlotSum=0; SlotMin=1000; SlotMax=0; }
+   double Latency(void) const { return Decoded ? LatencySum/Decoded:0; }
+   double SlotAver(void) const { return Slots ? SlotSum/Slots:0; }
+} ;
+
+static ProcStats Stats;
+static bool Counting;
+
+static void Decode(void)                                // drain the FIFO like vTaskPROC
+{ for( ; ; )
+  { uint64_t *Pkt=RxFIFO.getRead(); if(Pkt==0) break;
+    if(Counting)
+    { double Latency=1e-3*(Sim_Clock.usTime-*Pkt);
+      Stats.LatencySum+=Latency; if(Latency>Stats.LatencyMax) Stats.LatencyMax=Latency;
+      Stats.Decoded++; }
+    RxFIFO.Read(); }
+}
+
+static void Slot(uint16_t msTime)                      // once per time slot
+{ Counting = Sim_Clock.usTime>=usStart+SkipTime*1000000;
+  if(!Counting) return;
+  Stats.Slots++; Stats.SlotSum+=msTime;                // the slot of this second: at the boundary or earlier when the position is ready
+  if(msTime<Stats.SlotMin) Stats.SlotMin=msTime;
+  if(msTime>Stats.SlotMax) Stats.SlotMax=msTime; }
+
+static void PROC_Poll(void)                             // the former loop: vTaskDelay(1) then check everything
+{ uint32_t PrevSlotTime=0;
+  for( ; ; )
+  { vTaskDelay(1);
+    Decode();
+    uint32_t Time; uint16_t msTime; getTime(Time, msTime);
+    uint32_t SlotTime=PROC_SlotTime(Time, msTime);
+    if(SlotTime==PrevSlotTime) continue;
+    PrevSlotTime=SlotTime;
+    Slot(msTime); }
+}
+
+static void PROC_Event(void)                            // the loop of vTaskPROC now
+{ PROC_TaskHandle = xTaskGetCurrentTaskHandle();
+  uint32_t PrevSlotTime=0;
+  for( ; ; )
+  { uint32_t Time; uint16_t msTime; getTime(Time, msTime);
+    uint32_t Events=PROC_Wait(msTime);
+    Decode();
+    getTime(Time, msTime);
+    uint32_t SlotTime=PROC_SlotTime(Time, msTime);
+    if(SlotTime!=Time)                                  // position of this second ready: the slot starts now and stays on
+    { if(PrevSlotTime==Time || ((Events&PROCevt_NewPos) && PosReadySec==Time)) SlotTime=Time; }
+    if(SlotTime==PrevSlotTime) continue;
+    PrevSlotTime=SlotTime;
+    Slot(msTime); }
+}
+
+static ProcStats Run(void (*Task)(void), float Rate, bool Lock)
+{ Sim_Clock.usTime=usStart; Sim_Clock.usEnd=usStart+(uint64_t)SimTime*1000000; Sim_Clock.usNext=0;
+  Sim_Clock.Notify=0; Sim_Clock.NotifyBits=0; Sim_Clock.Wakeups=0;
+  PROC_TaskHandle=0; RxFIFO.Clear(); RxCount=RxLost=0;
+  PktRate=Rate; usNextPkt=NextPacket(usStart);
+  GPS_Lock=Lock; usNextPos=NextPosition(usStart); PosReadySec=0;
+  Stats.Clear(); Counting=0;
+  try { (*Task)(); }
+  catch(SimEnd) { }
+  Stats.Wakeups=Sim_Clock.Wakeups;
+  return Stats; }
+
+// ===================================================================================================
+
+int main(int argc, char *argv[])
+{ Sim_Clock.addHook(RF_Model);
+  Sim_Clock.addHook(GPS_Model);
+
+  printf("PROC slot boundary %dms after the PPS\n", PROC_SlotOffset);
+  printf("                       latency [ms]   wakeups  slot start [ms]\n");
+  printf("case         loop       aver    max     [1/s]   aver  min..max\n");
+  const float Rate[3] = { 0, 50, 50 };
+  const bool  Lock[3] = { 1,  1,  0 };
+  const char *Name[3] = { "empty band", "busy band", "busy, no GPS" };
+  ProcStats Poll[3], Event[3];
+  for(int Case=0; Case<3; Case++)
+  { Poll[Case]  = Run(PROC_Poll,  Rate[Case], Lock[Case]); uint32_t PollLost=RxLost;
+    Event[Case] = Run(PROC_Event, Rate[Case], Lock[Case]); uint32_t EventLost=RxLost;
+    for(int Loop=0; Loop<2; Loop++)
+    { const ProcStats &S = Loop ? Event[Case]:Poll[Case];
+      printf("%-12s %-6s  %7.3f %7.3f  %8.1f  %6.1f %4d..%d\n", Loop?"":Name[Case], Loop?"event":"poll",
+             S.Latency(), S.LatencyMax, (double)S.Wakeups/SimTime, S.SlotAver(), S.SlotMin, S.SlotMax); }
+    Fail+=(PollLost!=0 || EventLost!=0); }
+
+  const int Slots = SimTime-SkipTime;
+  Check("poll: RX latency [ms]",            Poll[1].Latency(),  0.3, 0.7);
+  Check("event: RX latency [ms]",           Event[1].Latency(), 0.0, 0.01);
+  Check("event: max. RX latency [ms]",      Event[1].LatencyMax, 0.0, 0.01);
+  Check("event: packets decoded/received",  (double)Event[1].Decoded/Poll[1].Decoded, 0.8, 1.2);
+  Check("poll: wakeups on empty band [1/s]", (double)Poll[0].Wakeups/SimTime, 990, 1001);
+  Check("event: wakeups on empty band [1/s]", (double)Event[0].Wakeups/SimTime, 1, 3);
+  Check("event: wakeups on busy band [1/s]", (double)Event[1].Wakeups/SimTime, 1, 50+3+10);
+  for(int Case=0; Case<3; Case++)
+  { Check("poll: slots per second",  (double)Poll[Case].Slots/Slots,  0.98, 1.02);
+    Check("event: slots per second", (double)Event[Case].Slots/Slots, 0.98, 1.02); }
+  Check("poll: slot start [ms]",            Poll[0].SlotMax,  PROC_SlotOffset, PROC_SlotOffset+1);
+  Check("event: slot start with GPS [ms]",  Event[0].SlotMax, 50, PROC_SlotOffset);
+  Check("event: slot start, no GPS [ms]",   Event[2].SlotMin, PROC_SlotOffset, PROC_SlotOffset);
+  Check("event: slot start, no GPS [ms]",   Event[2].SlotMax, PROC_SlotOffset, PROC_SlotOffset);
+
+  return CheckResult(); }
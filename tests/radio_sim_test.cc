@@ -0,0 +1,234 @@
+// Radio_Task() running on the host against the simulated RF chip (sim/RadioLib.h):
+// measures slot utilization, time lost on reconfiguration and the reception coverage
+// of injected OGN, ADS-L, FLARM, LDR and FANET traffic.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#include "ogn-radio.h"
+#include "manchester.h"
+#include "timesync.h"
+
+#include "RadioLib.h"
+#include "check.h"
+
+// ===================================================================================================
+// what the firmware normally provides from main.cpp and other tasks
+
+FlashParameters   Parameters;
+SemaphoreHandle_t CONS_Mutex = 0;
+Word32x2          Random;
+HardItems         HardwareStatus;
+TimeSync          GPS_TimeSync;
+TaskHandle_t      PROC_TaskHandle = 0;                  // no PROC task: the received packets stay in FSK_RxFIFO
+
+uint32_t getUniqueAddress(void) { return 0x123456; }
+
+// ===================================================================================================
+
+static const uint32_t UTC0 = 1700000000;               // [sec] UTC at the start of the simulation
+static const int      SimTime = 60;                     // [sec] how long to run
+static const int      SkipTime = 2;                     // [sec] do not count the start-up
+
+static const uint8_t Tag_FLR  = Radio_SysID_FLR;        // tags for the injected traffic
+static const uint8_t Tag_OGN  = Radio_SysID_OGN;
+static const uint8_t Tag_ADSL = Radio_SysID_ADSL;
+static const uint8_t Tag_FNT  = Radio_SysID_FNT;
+static const uint8_t Tag_LDR  = Radio_SysID_LDR;
+
+static uint32_t Rand = 0x87654321;                      // deterministic traffic
+static uint32_t getRand(uint32_t Range) { XorShift32(Rand); return Rand%Range; }
+
+static FreqPlan Plan;
+
+static int ManchEncode(uint8_t *Out, const uint8_t *Inp, int Len)
+{ for(int Idx=0; Idx<Len; Idx++)
+  { Out[2*Idx  ] = ManchesterEncode[Inp[Idx]>>4];
+    Out[2*Idx+1] = ManchesterEncode[Inp[Idx]&0x0F]; }
+  return 2*Len; }
+
+static void addManch(SimAirPacket *Pkt, uint64_t usStart, uint32_t Freq, uint8_t SysID)
+{ const uint8_t *SYNC; uint8_t PktLen;
+  int SyncLen=FSK_RxPacket::SysSYNC(SYNC, PktLen, SysID);
+  uint8_t Data[32]; for(int Idx=0; Idx<PktLen; Idx++) Data[Idx]=getRand(256);
+  uint8_t Air[96];
+  memcpy(Air, SYNC, SyncLen);
+  int Len = SyncLen+ManchEncode(Air+SyncLen, Data, PktLen);
+  Pkt->setFSK(usStart, Freq, 100.0, 16, Air, Len);
+  Pkt->Tag=SysID; }
+
+static void addLDR(SimAirPacket *Pkt, uint64_t usStart, uint32_t Freq)
+{ const uint8_t *SYNC; uint8_t PktLen;
+  FSK_RxPacket::SysSYNC(SYNC, PktLen, Radio_SysID_LDR);
+  uint8_t Air[48];
+  memcpy(Air, SYNC, 8);                                  // two radio SYNC bytes then the net-address and length
+  for(int Idx=0; Idx<PktLen+1; Idx++) Air[8+Idx]=getRand(256);
+  Pkt->setFSK(usStart, Freq, 38.4, 40, Air, 8+PktLen+1);
+  Pkt->Tag=Tag_LDR; }
+
+static void addFANET(SimAirPacket *Pkt, uint64_t usStart, uint32_t Freq)
+{ uint8_t Data[20]; for(int Idx=0; Idx<20; Idx++) Data[Idx]=getRand(256);
+  Pkt->setLoRa(usStart, Freq, 7, 250.0, 8, 0xF1, 5, Data, 20);
+  Pkt->Tag=Tag_FNT; }
+
+static bool EarlierStart(const SimAirPacket &A, const SimAirPacket &B) { return A.usStart<B.usStart; }
+
+static const int Aircraft = 3;                           // how many of each system around
+
+static void addTraffic(int Sec)                          // inject the traffic for the given second
+{ uint64_t usPPS = (uint64_t)Sec*1000000;
+  uint32_t UTC = UTC0+Sec;
+  int First = SimRadio::AirLen;
+  for(int Acft=0; Acft<Aircraft; Acft++)
+  { for(int Slot=0; Slot<2; Slot++)
+    { uint64_t usSlot = usPPS + 400000 + Slot*400000;    // FLARM/OGN/ADS-L transmit in two 400ms slots
+      uint32_t FreqFLR = Plan.getFrequency(UTC, Slot, 0);
+      uint32_t FreqOGN = Plan.getFrequency(UTC, Slot, 1);
+      addManch(SimRadio::addAir(), usSlot+getRand(390000), FreqOGN, Radio_SysID_OGN);
+      addManch(SimRadio::addAir(), usSlot+getRand(390000), FreqFLR, Radio_SysID_FLR);
+      addManch(SimRadio::addAir(), usSlot+getRand(390000), FreqFLR, Radio_SysID_ADSL); }
+    uint32_t FreqLDR = Plan.getFreqOBAND();
+    if(FreqLDR) addLDR(SimRadio::addAir(), usPPS+400000+getRand(790000), FreqLDR);
+    uint32_t FreqFNT = Plan.getFreqFANET();
+    if(FreqFNT) addFANET(SimRadio::addAir(), usPPS+getRand(990000), FreqFNT); }
+  for(int Idx=First; Idx<SimRadio::AirLen; Idx++)
+    SimRadio::Air[Idx].RSSI = -100.0f+getRand(30);
+  std::sort(SimRadio::Air+First, SimRadio::Air+SimRadio::AirLen, EarlierStart); }
+
+static void addTxPackets(void)                           // what vTaskPROC would give for transmission every second
+{ for(int Pkt=0; Pkt<2; Pkt++)
+  { if(OGN_TxFIFO.Free())
+    { OGN_TxFrame *Packet = OGN_TxFIFO.getWrite();
+      Packet->Packet.Clear(); Packet->Packet.Header.Address=0x123456; Packet->Packet.Header.AddrType=3;
+      Packet->calcFEC(); Packet->Encode(); OGN_TxFIFO.Write(); }
+    if(ADSL_TxFIFO.Free())
+    { ADSL_TxFrame *Packet = ADSL_TxFIFO.getWrite();
+      Packet->Init(); Packet->setAddress(0x123456); Packet->setCRC(); Packet->Encode(); ADSL_TxFIFO.Write(); }
+  }
+}
+
+// ===================================================================================================
+
+class SecondStats                                        // radio statistics for one second
+{ public:
+   float RxFrac;                                         // fraction of time in receive
+   float msConfig;                                       // [ms] spent on configuration
+   float msTx;                                           // [ms] spent transmitting
+   int   Reconfig;
+   int   Wakeups;                                        // how many times the RF task woke up
+} ;
+
+static SecondStats   Second[SimTime];
+static SimRadioStats PrevStats;
+static uint32_t      PrevWakeups;
+static int           RxSysCount[16];
+
+static void PPS(uint64_t usNow)                          // second boundaries, traffic and the consumers of the RX queues
+{ static int Sec=(-1);
+  FSK_RxPacket *RxPkt;
+  while((RxPkt=FSK_RxFIFO.getRead())) { RxSysCount[RxPkt->SysID&15]++; FSK_RxFIFO.Read(); }
+  FANET_RxPacket *FntPkt;
+  while((FntPkt=FNT_RxFIFO.getRead())) { RxSysCount[Radio_SysID_FNT]++; FNT_RxFIFO.Read(); }
+  int Now = usNow/1000000;
+  if(Sec<0) { Plan.setPlan(Parameters.FreqPlan); addTraffic(0); }
+  for( ; Sec<Now; )
+  { if(Sec>=0 && Sec<SimTime && Sim_Radio)
+    { const SimRadioStats &Stats=Sim_Radio->Stats;
+      SecondStats &Stat=Second[Sec];
+      uint64_t usTotal = Stats.usTotal()-PrevStats.usTotal();
+      Stat.RxFrac   = usTotal ? (float)(Stats.usRx-PrevStats.usRx)/usTotal : 0;
+      Stat.msConfig = 0.001f*(Stats.usConfig-PrevStats.usConfig);
+      Stat.msTx     = 0.001f*(Stats.usTx-PrevStats.usTx);
+      Stat.Reconfig = Stats.Reconfig-PrevStats.Reconfig;
+      Stat.Wakeups  = Sim_Clock.Wakeups-PrevWakeups;
+      PrevStats = Stats; PrevWakeups = Sim_Clock.Wakeups; }
+    Sec++;
+    GPS_TimeSync.UTC     = UTC0+Sec;
+    GPS_TimeSync.sysTime = Sec*1000;
+    addTraffic(Sec+1);                                   // one second ahead so the packets are in the air in time order
+    addTxPackets(); }
+}
+
+// ===================================================================================================
+
+static uint8_t TraceDump[RF_Trace::Size*8+32];        // Ctrl-E output captured here
+static int     TraceLen=0;
+static void TraceWrite(char Byte) { if(TraceLen<(int)sizeof(TraceDump)) TraceDump[TraceLen++]=Byte; }
+
+int main(int argc, char *argv[])
+{ bool Verbose = argc>1;
+  Serial.Enable = Verbose;
+  Parameters.setDefault(getUniqueAddress());
+  Parameters.Verbose = 1;
+  GPS_TimeSync.UTC=UTC0; GPS_TimeSync.sysTime=0;
+  Random.Word = 0x0123456789ABCDEF;
+  Sim_Clock.addHook(PPS);
+  Sim_Clock.usEnd = (uint64_t)SimTime*1000000;
+  try { Radio_Task(0); } catch(SimEnd) { }
+
+  SecondStats Avg; memset(&Avg, 0, sizeof(Avg));
+  float MaxConfig=0; int Count=0;
+  for(int Sec=SkipTime; Sec<SimTime-1; Sec++)
+  { const SecondStats &Stat=Second[Sec];
+    if(Verbose) printf("%3ds: Rx:%5.1f%% Config:%5.1fms Tx:%4.1fms Reconfig:%d Wakeups:%d\n",
+                        Sec, 100*Stat.RxFrac, Stat.msConfig, Stat.msTx, Stat.Reconfig, Stat.Wakeups);
+    Avg.RxFrac+=Stat.RxFrac; Avg.msConfig+=Stat.msConfig; Avg.msTx+=Stat.msTx; Avg.Reconfig+=Stat.Reconfig; Avg.Wakeups+=Stat.Wakeups;
+    if(Stat.msConfig>MaxConfig) MaxConfig=Stat.msConfig;
+    Count++; }
+  Avg.RxFrac/=Count; Avg.msConfig/=Count; Avg.msTx/=Count;
+  float Reconfig = (float)Avg.Reconfig/Count;
+  float Wakeups  = (float)Avg.Wakeups/Count;
+
+  int Injected[8], Received[8];
+  for(int Tag=0; Tag<8; Tag++) { Injected[Tag]=0; Received[Tag]=0; }
+  for(int Idx=0; Idx<SimRadio::AirLen; Idx++)
+  { const SimAirPacket &Pkt=SimRadio::Air[Idx];
+    if(Pkt.usStart<(uint64_t)SkipTime*1000000 || Pkt.usEnd()>=(uint64_t)(SimTime-1)*1000000) continue;
+    Injected[Pkt.Tag]++; if(Pkt.State==1) Received[Pkt.Tag]++; }
+
+  const SimRadioStats &Stats=Sim_Radio->Stats;
+  printf("Radio_Task on simulated %s, %ds, %d aircraft per system\n", Radio_ChipType, SimTime, Aircraft);
+  printf("Calls: %d, config. calls: %d, TX: %d packets, RX: %d packets, %d overrun, %d lost\n",
+         Stats.Calls, Stats.ConfigCalls, Stats.TxPackets, Stats.RxPackets, Stats.RxOverrun, Stats.RxLost);
+  printf("Queued: FLR:%d OGN:%d ADL:%d LDR:%d FNT:%d\n",
+         RxSysCount[Radio_SysID_FLR], RxSysCount[Radio_SysID_OGN], RxSysCount[Radio_SysID_ADSL],
+         RxSysCount[Radio_SysID_LDR], RxSysCount[Radio_SysID_FNT]);
+  float usIRQdelay = Stats.IRQreads ? (float)Stats.usIRQdelay/Stats.IRQreads : 0;
+  printf("IRQ to read-out: %d packets, %3.0fus average, %dus max.\n", Stats.IRQreads, usIRQdelay, Stats.usIRQdelayMax);
+  const uint8_t Tags[5] = { Tag_FLR, Tag_OGN, Tag_ADSL, Tag_LDR, Tag_FNT };
+  for(int Idx=0; Idx<5; Idx++)
+  { uint8_t Tag=Tags[Idx];
+    printf("Coverage %s: %3d/%3d = %5.1f%%\n", FSK_RxPacket::SysName(Tag), Received[Tag], Injected[Tag],
+           Injected[Tag] ? 100.0*Received[Tag]/Injected[Tag] : 0.0); }
+
+  static RF_TraceEvent Event[RF_Trace::Size];
+  TraceLen=0; Radio_Trace.WriteDump(TraceWrite);
+  int DumpLen=TraceLen;
+  int Events=RF_Trace::ReadDump(Event, RF_Trace::Size, TraceDump, DumpLen);
+  uint32_t usTraceIRQ=0; int TraceReads=0, TraceSlots=0, TraceTx=0; uint32_t usIRQ=0;
+  for(int Idx=0; Idx<Events; Idx++)                    // pair every IRQ with the read-out that follows
+  { const RF_TraceEvent &Ev=Event[Idx];
+         if(Ev.Type==RF_Trace::IRQ) usIRQ=Ev.usTime;
+    else if(Ev.Type==RF_Trace::Read && usIRQ) { usTraceIRQ+=Ev.usTime-usIRQ; TraceReads++; usIRQ=0; }
+    else if(Ev.Type==RF_Trace::Slot) TraceSlots++;
+    else if(Ev.Type==RF_Trace::TxStart) TraceTx++; }
+  printf("Trace: %d events, %d slots, %d TX, %d reads, %3.0fus IRQ to read-out\n",
+         Events, TraceSlots, TraceTx, TraceReads, TraceReads ? (float)usTraceIRQ/TraceReads : 0.0);
+
+  // regression bounds: tighten when the radio timing improves
+  Check("RX time [fraction]",          Avg.RxFrac,   0.87, 1.00);
+  Check("config. time [ms/s]",         Avg.msConfig, 0.0, 110.0);
+  Check("max. config. time [ms/s]",    MaxConfig,    0.0, 150.0);
+  Check("TX time [ms/s]",              Avg.msTx,     5.0, 20.0);
+  Check("RX restarts [1/s]",           Reconfig,     0.0, 6.0);
+  Check("task wakeups [1/s]",          Wakeups,      0.0, 150.0);
+  Check("IRQ to read-out [us]",        usIRQdelay,   0.0, 400.0);
+  Check("OGN coverage [fraction]",     Injected[Tag_OGN]  ? (float)Received[Tag_OGN] /Injected[Tag_OGN]  : 0, 0.40, 1.0);
+  Check("ADS-L coverage [fraction]",   Injected[Tag_ADSL] ? (float)Received[Tag_ADSL]/Injected[Tag_ADSL] : 0, 0.25, 1.0);
+  Check("FANET coverage [fraction]",   Injected[Tag_FNT]  ? (float)Received[Tag_FNT] /Injected[Tag_FNT]  : 0, 0.08, 1.0);
+  uint32_t usCharged = Radio_Duty.Band[DutyCycle::Band_M].Sum+Radio_Duty.Band[DutyCycle::Band_O].Sum; // FANET is within the M-band
+  Check("duty-cycle charged/TX time",  Stats.usTx ? (float)usCharged/Stats.usTx : 0, 0.9, 1.1);
+  Check("trace events [ring size]",    (float)Events/RF_Trace::Size, 1.0, 1.0);
+  Check("trace IRQ to read-out [us]",  TraceReads ? (float)usTraceIRQ/TraceReads : 0, usIRQdelay, 1000.0); // includes RSSI and the decode
+  return CheckResult(); }
@@ -0,0 +1,262 @@
+// Relay_PrioQueue of relay-queue.h: the Fenwick tree, the tournament tree and the ID hash against a walk through the slots
+// after every step of random traffic, for queue sizes 16..256. Then the relay selection against the calcRelayRank() weights:
+// chi-square of many draws, and the same per-aircraft frequencies as the former linear queue.
+// Then the cost per received packet (getNew, addNew, one relay pick) at realistic fill levels, former queue against new.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ogn.h"
+#include "check.h"
+
+typedef OGN_RxPacket<OGN1_Packet> RxPacket;
+
+// ===================================================================================================
+// the former queue, loops widened to int to allow 256 slots: the reference for the statistics and the benchmark
+
+template<class PacketType, int Size=16>
+ class Linear_PrioQueue
+{ public:
+   PacketType           Packet[Size];
+   uint16_t             Sum;
+   uint8_t              Low, LowIdx;
+
+  public:
+   void Clear(void)
+   { for(int Idx=0; Idx<Size; Idx++) Packet[Idx].Clear();
+     Sum=0; Low=0; LowIdx=0; }
+
+   PacketType * operator [](uint8_t Idx) { return Packet+Idx; }
+
+   uint8_t getNew(void)
+   { Sum-=Packet[LowIdx].Rank; Packet[LowIdx].Rank=0; Low=0; return LowIdx; }
+
+   PacketType *addNew(uint8_t NewIdx)
+   { PacketType *Prev = 0;
+     Packet[NewIdx].Alloc=1;
+     uint32_t AddressAndType = Packet[NewIdx].Packet.getAddressAndType();
+     for(int Idx=0; Idx<Size; Idx++)
+     { if(Idx==NewIdx) continue;
+       if(Packet[Idx].Packet.getAddressAndType() == AddressAndType)
+       { Prev=Packet+Idx; clean(Idx); }
+     }
+     uint8_t Rank=Packet[NewIdx].Rank; Sum+=Rank;
+     if(NewIdx==LowIdx) reCalc();
+     else { if(Rank<Low) { Low=Rank; LowIdx=NewIdx; } }
+     return Prev; }
+
+   uint8_t getRand(uint32_t Rand) const
+   { if(Sum==0) return Rand%Size;
+     uint16_t RankIdx = Rand%Sum;
+     int Idx; uint16_t RankSum=0;
+     for(Idx=0; Idx<Size; Idx++)
+     { if(Packet[Idx].Alloc==0) continue;
+       uint8_t Rank=Packet[Idx].Rank; if(Rank==0) continue;
+       RankSum+=Rank; if(RankSum>RankIdx) return Idx; }
+     return Rand%Size; }
+
+   void reCalc(void)
+   { Sum=Low=Packet[0].Rank; LowIdx=0;
+     for(int Idx=1; Idx<Size; Idx++)
+     { if(Packet[Idx].Alloc==0) { Low=0; LowIdx=Idx; continue; }
+       uint8_t Rank=Packet[Idx].Rank;
+       Sum+=Rank;
+       if(Rank<Low) { Low=Rank; LowIdx=Idx; }
+     }
+   }
+
+   void cleanTime(uint8_t Time)
+   { for(int Idx=0; Idx<Size; Idx++)
+     { if(Packet[Idx].Alloc==0) continue;
+       uint8_t PktTime=Packet[Idx].PosTime();
+       if( PktTime==Time || PktTime>=60) clean(Idx);
+     }
+   }
+
+   void clean(uint8_t Idx)
+   { Sum-=Packet[Idx].Rank; Packet[Idx].Rank=0; Packet[Idx].Alloc=0; Low=0; LowIdx=Idx; }
+
+   void decrRank(uint8_t Idx, uint8_t Decr=1)
+   { uint8_t Rank=Packet[Idx].Rank; if(Rank==0) return;
+     if(Decr>Rank) Decr=Rank;
+     Rank-=Decr; Sum-=Decr;
+     if(Rank<Low) { Low=Rank; LowIdx=Idx; }
+     Packet[Idx].Rank=Rank; }
+} ;
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x13579BDF;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int32_t RxAltitude = 1000;                     // [m] our altitude
+
+class Aircraft                                       // the traffic: one ID, altitude, climb and signal each
+{ public:
+   uint32_t Address;
+   uint8_t  AddrType;
+   int32_t  Altitude;                                // [m]
+   int16_t  Climb;                                   // [0.1m/s]
+   uint8_t  RSSI;                                    // [-0.5dBm]
+
+  public:
+   void Random(void)
+   { Address=getRand()&0xFFFFFF; AddrType=1+getRand()%3;
+     Altitude=getRand()%3000; Climb=(int16_t)(getRand()%101)-50; RSSI=128+getRand()%100; }
+
+   void Write(RxPacket &Pkt, uint8_t Time) const     // a position packet as decoded: what calcRelayRank() looks at
+   { Pkt.Packet.Clear();
+     Pkt.Packet.Header.Address=Address; Pkt.Packet.Header.AddrType=AddrType;
+     Pkt.Packet.Position.Time=Time;
+     Pkt.Packet.EncodeAltitude(Altitude); Pkt.Packet.EncodeClimbRate(Climb);
+     Pkt.RxRSSI=RSSI; }
+} ;
+
+const int MaxAcft = 512;
+static Aircraft Acft[MaxAcft];
+static RxPacket AcftPkt[MaxAcft];                    // the packet of each aircraft as decoded, with its rank
+
+static void Fleet(int Count)
+{ for(int Idx=0; Idx<Count; Idx++)
+  { Acft[Idx].Random(); Acft[Idx].Write(AcftPkt[Idx], 10); AcftPkt[Idx].calcRelayRank(RxAltitude); }
+}
+
+template <class Queue>
+ static uint8_t Receive(Queue &Q, const RxPacket &Pkt) // as DecodeRxOGN() and ProcessRxOGN()
+{ uint8_t Idx=Q.getNew();
+  *Q[Idx]=Pkt;
+  Q.addNew(Idx);
+  return Idx; }
+
+template <class Queue>
+ static void Relay(Queue &Q)                         // as GetRelayPacket()
+{ if(Q.Sum==0) return;
+  uint8_t Idx=Q.getRand(getRand());
+  if(Q.Packet[Idx].Rank) Q.decrRank(Idx); }
+
+// ===================================================================================================
+// the state of the new queue against a walk through its slots
+
+template <uint16_t Size>
+ static bool Consistent(Relay_PrioQueue<RxPacket, Size> &Q)
+{ uint16_t Sum=0, LowKey=0xFFFF;
+  for(int Idx=0; Idx<Size; Idx++)
+  { const RxPacket &P=Q.Packet[Idx];
+    if(!P.Alloc) { if(P.Rank) return 0; LowKey=0; continue; }
+    Sum+=P.Rank; if(P.Rank+1<LowKey) LowKey=P.Rank+1;
+    for(int Other=Idx+1; Other<Size; Other++)          // no duplicate IDs among the allocated
+      if(Q.Packet[Other].Alloc && Q.Packet[Other].Packet.getAddressAndType()==P.Packet.getAddressAndType()) return 0; }
+  if(Sum!=Q.Sum) return 0;
+  const RxPacket &Low=Q.Packet[Q.getLow()];
+  if((Low.Alloc ? Low.Rank+1:0)!=LowKey) return 0;
+  for(int Test=0; Test<8; Test++)
+  { uint32_t R=getRand(); if(Sum==0) break;
+    uint16_t RankIdx=R%Sum, RankSum=0; int Pick=-1;
+    for(int Idx=0; Idx<Size; Idx++)
+    { if(Q.Packet[Idx].Alloc==0 || Q.Packet[Idx].Rank==0) continue;
+      RankSum+=Q.Packet[Idx].Rank; if(RankSum>RankIdx) { Pick=Idx; break; } }
+    if(Q.getRand(R)!=Pick) return 0; }
+  return 1; }
+
+template <uint16_t Size>
+ static void Test_Consistent(void)
+{ static Relay_PrioQueue<RxPacket, Size> Q; Q.Clear();
+  const int Acfts = Size+Size/2;                     // more aircraft than slots
+  Fleet(Acfts);
+  int Bad=0, Prev=0;
+  for(int Step=0; Step<40*Size; Step++)
+  { uint8_t Time=(Step/Size)%60;
+    const Aircraft &A=Acft[getRand()%Acfts];
+    uint8_t Idx=Q.getNew();
+    bool Dup=0;                                      // is the ID in the queue already ?
+    for(int Other=0; Other<Size; Other++)
+      if(Q.Packet[Other].Alloc && Q.Packet[Other].Packet.getAddressAndType()==((uint32_t)A.AddrType<<24|A.Address)) Dup=1;
+    A.Write(*Q[Idx], Time);
+    if(getRand()%8==0) { Bad+=!Consistent(Q); continue; }  // failed decode: the slot is not added
+    Q[Idx]->calcRelayRank(RxAltitude);
+    RxPacket *PrevPkt=Q.addNew(Idx);
+    if(Dup && PrevPkt==0) Prev++;                    // the previous packet of the ID must be found
+    if(getRand()%2) Relay(Q);
+    if(Step%Size==Size-1) Q.cleanTime((Time+60-12)%60);
+    Bad+=!Consistent(Q); }
+  char Name[64]; sprintf(Name, "queue of %3d: trees and hash as a walk", Size);
+  Check(Name, Bad==0 && Prev==0); }
+
+// ===================================================================================================
+// the relay pick against the calcRelayRank() weights
+
+template <uint16_t Size>
+ static void Test_Distribution(void)
+{ static Relay_PrioQueue<RxPacket, Size> Q;   Q.Clear();
+  static Linear_PrioQueue<RxPacket, Size> L;  L.Clear();
+  Fleet(Size);
+  for(int Idx=0; Idx<Size; Idx++) { Receive(Q, AcftPkt[Idx]); Receive(L, AcftPkt[Idx]); }
+  static uint32_t Count[Size], RefCount[Size];
+  memset(Count, 0, sizeof(Count)); memset(RefCount, 0, sizeof(RefCount));
+  const int Draws = 2000000;
+  for(int Draw=0; Draw<Draws; Draw++)
+  { uint32_t R=getRand();
+    Count[Q.getRand(R)]++; RefCount[L.getRand(R)]++; }
+  double Chi2=0; int DoF=-1; int Mismatch=0;
+  for(int Idx=0; Idx<Size; Idx++)
+  { const RxPacket &P=Q.Packet[Idx];
+    if(P.Rank==0) { Mismatch+=Count[Idx]!=0; continue; }
+    double Expect=(double)Draws*P.Rank/Q.Sum;
+    Chi2+=(Count[Idx]-Expect)*(Count[Idx]-Expect)/Expect; DoF++;
+    for(int Ref=0; Ref<Size; Ref++)                  // the same aircraft in the former queue: drawn as often
+      if(L.Packet[Ref].Packet.getAddressAndType()==P.Packet.getAddressAndType())
+      { if(fabs((double)RefCount[Ref]-Count[Idx])>5*sqrt(Expect)+1) Mismatch++; }
+  }
+  double Limit=DoF+5*sqrt(2.0*DoF);
+  printf("queue of %3d: %d candidates, rank sum %d, chi2 %.1f for %d DoF\n", Size, DoF+1, Q.Sum, Chi2, DoF);
+  char Name[64];
+  sprintf(Name, "queue of %3d: picks follow the ranks", Size);         Check(Name, Chi2<Limit && Q.Sum==L.Sum);
+  sprintf(Name, "queue of %3d: picks as the former queue", Size);      Check(Name, Mismatch==0); }
+
+// ===================================================================================================
+// the cost per received packet at fill levels: aircraft in the air per queue slot
+
+static uint16_t Order[4096];                         // which aircraft is received: drawn before the timing
+
+template <class Queue>
+ static double Cost(Queue &Q)                        // [ns] per packet
+{ Q.Clear();
+  int Packets=0; double Start=getTime(), Time;
+  do
+  { for(int Loop=0; Loop<4096; Loop++, Packets++)
+    { Receive(Q, AcftPkt[Order[Loop]]);
+      Relay(Q); }
+    Time=getTime()-Start; } while(Time<0.1);
+  return 1e9*Time/Packets; }
+
+template <uint16_t Size>
+ static void Benchmark(void)
+{ static Linear_PrioQueue<RxPacket, Size> L;
+  static Relay_PrioQueue<RxPacket, Size>  Q;
+  const int Fill[3] = { 50, 100, 200 };              // [%] aircraft per slot: 200% is a competition start
+  for(int Idx=0; Idx<3; Idx++)
+  { int Acfts=Size*Fill[Idx]/100;
+    Fleet(Acfts);
+    for(int Pkt=0; Pkt<4096; Pkt++) Order[Pkt]=getRand()%Acfts;
+    double Old=Cost(L), New=Cost(Q);
+    printf("queue of %3d, %3d aircraft [ns/pkt]: linear %7.1f  Fenwick %6.1f  x%4.1f\n", Size, Acfts, Old, New, Old/New); }
+}
+
+int main(int argc, char *argv[])
+{ Test_Consistent<16>();
+  Test_Consistent<32>();
+  Test_Consistent<128>();
+  Test_Consistent<256>();
+  Test_Distribution<32>();
+  Test_Distribution<256>();
+  Benchmark<32>();
+  Benchmark<128>();
+  Benchmark<256>();
+  return CheckResult(); }
@@ -0,0 +1,113 @@
+// RF_Stats of rf-stats.h: time bins, cell reuse, the binary snapshot layout and CRC, the JSON output.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rf-stats.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint8_t Snap[4096];
+static int     SnapLen=0;
+static void SnapWrite(char Byte) { if(SnapLen<(int)sizeof(Snap)) Snap[SnapLen++]=Byte; }
+
+static uint16_t get16(const uint8_t *Data) { return Data[0] | (uint16_t)Data[1]<<8; }
+static uint32_t get32(const uint8_t *Data) { return get16(Data) | (uint32_t)get16(Data+2)<<16; }
+
+
+static RF_Stats Stats;
+
+static void TestBins(void)
+{ Stats.Clear();
+  uint32_t Now=1000;
+  for(int Sec=0; Sec<30; Sec++)                            // three bins of 10 packets each, one failed per bin
+  { Stats.addRx(1, 1, -90.0f, Now+Sec, Sec%10==0);
+    if(Sec%10) Stats.addDecode(1, 1, Sec&1); }
+  RF_StatCell *Stat=Stats.Find(1, 1);
+  Check("cell created", Stat!=0);
+  if(!Stat) return;
+  Check("rx summed over the bins", Stat->getSum(RF_StatCell::Rx)==30);
+  Check("decoded/corrected/failed", Stat->getSum(RF_StatCell::Decoded)==27 && Stat->getSum(RF_StatCell::Corrected)==15 && Stat->getSum(RF_StatCell::Failed)==3);
+  Check("RSSI histogram bin", Stat->RSSI[RF_StatCell::HistIdx(-90.0f, RF_StatCell::RSSImin, RF_StatCell::RSSIstep)]==30);
+  Stats.addRx(1, 1, -90.0f, Now+45);                       // 15 sec later: one more bin, the oldest is still there
+  Check("ring keeps a minute", Stat->getSum(RF_StatCell::Rx)==31);
+  Stats.addRx(1, 1, -90.0f, Now+75);                       // the first two bins dropped
+  Check("old bins dropped", Stat->getSum(RF_StatCell::Rx)==12);
+  Stats.addRx(1, 1, -90.0f, Now+500);                      // long gap: all bins cleared
+  Check("long gap clears all bins", Stat->getSum(RF_StatCell::Rx)==1);
+  Check("histograms kept", Stat->RSSI[RF_StatCell::HistIdx(-90.0f, RF_StatCell::RSSImin, RF_StatCell::RSSIstep)]==33);
+  Check("histogram edges", RF_StatCell::HistIdx(-130.0f, RF_StatCell::RSSImin, RF_StatCell::RSSIstep)==0 &&
+                           RF_StatCell::HistIdx(-120.0f, RF_StatCell::RSSImin, RF_StatCell::RSSIstep)==1 &&
+                           RF_StatCell::HistIdx(-30.0f,  RF_StatCell::RSSImin, RF_StatCell::RSSIstep)==RF_StatCell::HistBins-1); }
+
+static void TestReuse(void)
+{ Stats.Clear();
+  for(int Chan=0; Chan<RF_Stats::Cells; Chan++) Stats.addNoise(Chan, 0, -105.0f, 100+Chan);
+  Check("all cells used", Stats.Used()==RF_Stats::Cells);
+  Stats.addLBT(1, 0, 200);                                 // touch channel #1: channel #0 is now the least recently used
+  Stats.addLBT(99, 2, 201);                                // a new pair takes over the least recently used cell
+  Check("least recently used cell taken over", Stats.Find(0, 0)==0 && Stats.Find(1, 0)!=0 && Stats.Find(99, 2)!=0);
+  Stats.addDecode(98, 2, 0);                               // decode result for an unknown pair: not counted, no new cell
+  Check("decode result does not create cells", Stats.Find(98, 2)==0); }
+
+static void TestSnapshot(void)
+{ Stats.Clear();
+  Stats.addRx(0, 8, -80.0f, 3000);  Stats.addDecode(0, 8, 2);
+  Stats.addNoise(2, 5, -101.0f, 3003);
+  Stats.addLBT(0, 2, 3011);
+  SnapLen=0;
+  int Len=Stats.WriteSnapshot(SnapWrite, 3012);
+  Check("snapshot length", Len==SnapLen && Len==RF_Stats::SnapshotLen(3));
+  Check("snapshot magic and version", memcmp(Snap, "RFS", 3)==0 && Snap[3]==RF_Stats::SnapVersion && get32(Snap+4)==3012);
+  Check("snapshot CRC", crc1021(0xFFFF, Snap, SnapLen-2)==get16(Snap+SnapLen-2));
+  const uint8_t *Layout=Snap+8;
+  int Bins=Layout[1], Counts=Layout[2], HistBins=Layout[3];
+  Check("snapshot layout", Layout[0]==RF_StatCell::BinSec && Bins==RF_StatCell::Bins && Counts==RF_StatCell::Counts &&
+                           HistBins==RF_StatCell::HistBins && (int8_t)Layout[4]==RF_StatCell::RSSImin && Layout[8]==3);
+  const uint8_t *Cell=Layout+9;
+  int CellLen=2+4+2*Bins*Counts+4*HistBins;
+  bool OK=1;
+  for(int Idx=0; Idx<3; Idx++, Cell+=CellLen)              // decode the cells as a reader would
+  { uint8_t Chan=Cell[0], SysID=Cell[1];
+    const uint8_t *Newest=Cell+6+2*Counts*(Bins-1);        // bins oldest first: the last one is the current
+    if(Chan==0 && SysID==8) OK &= get16(Newest+2*RF_StatCell::Rx)==1 && get16(Newest+2*RF_StatCell::Corrected)==1;
+    else if(Chan==2 && SysID==5)
+    { const uint8_t *Noise=Cell+6+2*Bins*Counts+2*HistBins;
+      OK &= get16(Noise+2*RF_StatCell::HistIdx(-101.0f, RF_StatCell::NoiseMin, RF_StatCell::NoiseStep))==1; }
+    else if(Chan==0 && SysID==2) OK &= get16(Newest+2*RF_StatCell::LBT)==1 && get32(Cell+2)==3010;
+    else OK=0; }
+  Check("snapshot cells decoded", OK); }
+
+static void TestJSON(void)
+{ char Out[4096]; int Len=Stats.WriteJSONhead(Out, 3012);
+  int MaxCell=0;
+  for(int Idx=0; Idx<RF_Stats::Cells; Idx++)
+  { RF_StatCell Stat; if(!Stats.getCell(Stat, Idx)) continue;     // the reader path of the firmware: a copy of the cell
+    if(Out[Len-1]!='[') Out[Len++]=',';
+    int CellLen=Stat.WriteJSON(Out+Len); if(CellLen>MaxCell) MaxCell=CellLen;
+    Len+=CellLen; }
+  Len+=Stats.WriteJSONtail(Out+Len); Out[Len]=0;
+  int Depth=0, MinDepth=0; bool Plus=0;
+  for(int Idx=0; Idx<Len; Idx++)
+  { char Ch=Out[Idx];
+    if(Ch=='{' || Ch=='[') Depth++;
+    if(Ch=='}' || Ch==']') { Depth--; if(Depth<MinDepth) MinDepth=Depth; }
+    if(Ch=='+') Plus=1; }
+  Check("JSON brackets balanced", Depth==0 && MinDepth==0);
+  Check("JSON numbers without '+'", !Plus);
+  Check("JSON content", strstr(Out, "\"rssi_min\":-120")!=0 && strstr(Out, "{\"chan\":0,\"sys\":8,")!=0);
+  printf("%s\n", Out);
+  RF_StatCell Full; Full.Init(64, 9, 0xFFFFFFF0);                    // the longest cell: all counts at their maximum
+  for(int Bin=0; Bin<RF_StatCell::Bins; Bin++) for(int Cnt=0; Cnt<RF_StatCell::Counts; Cnt++) Full.Count[Bin][Cnt]=0xFFFF;
+  for(int Bin=0; Bin<RF_StatCell::HistBins; Bin++) { Full.RSSI[Bin]=0xFFFF; Full.Noise[Bin]=0xFFFF; }
+  Check("JSON cell fits RF_Stats::MaxJSON", Full.WriteJSON(Out)<RF_Stats::MaxJSON); }
+
+int main(int argc, char *argv[])
+{ TestBins();
+  TestReuse();
+  TestSnapshot();
+  TestJSON();
+  printf("%d cells x %d bytes = %d bytes of RAM\n", RF_Stats::Cells, (int)sizeof(RF_StatCell), (int)sizeof(RF_Stats));
+  return CheckResult(); }
@@ -0,0 +1,158 @@
+#ifndef __SIM_ARDUINO_H__
+#define __SIM_ARDUINO_H__
+
+// Host stand-in for the parts of Arduino-ESP32 and FreeRTOS used by the radio code.
+// All time functions run on a virtual microsecond clock, thus the RF timing can be measured on a PC.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+typedef uint32_t TickType_t;
+typedef void    *SemaphoreHandle_t;
+typedef void    *QueueHandle_t;
+typedef void    *TaskHandle_t;
+typedef int      BaseType_t;
+
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdTRUE  1
+#define pdFALSE 0
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0x01
+#define OUTPUT 0x03
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define IRAM_ATTR
+
+// =======================================================================================================
+
+class SimEnd { } ;                                 // thrown when the virtual time reaches the end of the simulation
+
+class SimClock                                     // virtual time: advances only when the code waits
+{ public:                                          // no constructor: zero-initialized before any static object uses it
+   static const int MaxHooks = 4;
+   uint64_t usTime;                                // [usec] virtual time since start
+   uint64_t usEnd;                                 // [usec] end of the simulation, zero => no end
+   void   (*Hook[MaxHooks])(uint64_t usTime);      // called whenever the time advances: radio model, PPS, traffic, ...
+   int      Hooks;
+   uint64_t usNext;                                // [usec] next event announced by the models, zero => none
+   uint32_t Notify;                                // task notifications given by the interrupts and not yet taken
+   uint32_t NotifyBits;                            // notification value set by xTaskNotify(eSetBits) and not yet taken
+   uint32_t Wakeups;                               // [count] times the task woke up: vTaskDelay() and ulTaskNotifyTake()
+
+  public:
+   void addHook(void (*Call)(uint64_t usTime)) { if(Hooks<MaxHooks) Hook[Hooks++]=Call; }
+
+   void Wake(uint64_t usAt)                        // a model announces it has something to do at the given time
+   { if(usAt>usTime && (usNext==0 || usAt<usNext)) usNext=usAt; }
+
+   void Advance(uint64_t usDelta)                  // move the time forward and let the models catch up
+   { usTime+=usDelta;
+     for(int Idx=0; Idx<Hooks; Idx++) (*Hook[Idx])(usTime);
+     if(usEnd && usTime>=usEnd) throw SimEnd(); }
+
+   void Sleep(uint64_t usTimeout, const uint32_t &Pending) // sleep till Pending is set by a model or timeout
+   { uint64_t usStop=usTime+usTimeout;
+     while(!Pending && usTime<usStop)
+     { uint64_t usStep=usStop-usTime;
+       if(usStep>1000) usStep=1000;                // not longer than a tick, thus the PPS and traffic hooks keep their resolution
+       if(usNext>usTime && usNext-usTime<usStep) usStep=usNext-usTime;
+       usNext=0;
+       Advance(usStep); }
+     Wakeups++; }
+
+   uint32_t WaitNotify(uint64_t usTimeout)         // sleep till notified or timeout: jump from one model event to the next
+   { Sleep(usTimeout, Notify);
+     uint32_t Count=Notify; Notify=0;
+     return Count; }
+
+   uint32_t WaitNotifyBits(uint64_t usTimeout)     // the same for the notification value: returns and clears the bits
+   { Sleep(usTimeout, NotifyBits);
+     uint32_t Bits=NotifyBits; NotifyBits=0;
+     return Bits; }
+
+} ;
+
+extern SimClock Sim_Clock;
+
+inline uint32_t millis(void) { return Sim_Clock.usTime/1000; }
+inline uint32_t micros(void) { return Sim_Clock.usTime; }
+
+inline void delay(uint32_t ms)               { Sim_Clock.Advance((uint64_t)ms*1000); }
+inline void delayMicroseconds(uint32_t us)   { Sim_Clock.Advance(us); }
+inline void vTaskDelay(TickType_t Ticks)     { Sim_Clock.Advance((uint64_t)Ticks*1000); Sim_Clock.Wakeups++; } // 1 tick = 1 ms
+inline void taskYIELD(void)                  { Sim_Clock.Advance(20); }                    // a context switch is not free
+
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle(void) { return (TaskHandle_t)&Sim_Clock; } // only one task: any non-NULL handle
+
+inline uint32_t ulTaskNotifyTake(BaseType_t Clear, TickType_t Ticks) { return Sim_Clock.WaitNotify((uint64_t)Ticks*1000); }
+
+inline void vTaskNotifyGiveFromISR(TaskHandle_t Task, BaseType_t *Woken) { Sim_Clock.Notify++; if(Woken) *Woken=pdTRUE; }
+
+enum eNotifyAction { eNoAction, eSetBits, eIncrement, eSetValueWithOverwrite, eSetValueWithoutOverwrite } ;
+
+inline BaseType_t xTaskNotify(TaskHandle_t Task, uint32_t Value, eNotifyAction Action)  // only eSetBits is modelled
+{ if(Action==eSetBits) Sim_Clock.NotifyBits|=Value; return pdTRUE; }
+
+inline BaseType_t xTaskNotifyWait(uint32_t ClearOnEntry, uint32_t ClearOnExit, uint32_t *Value, TickType_t Ticks)
+{ Sim_Clock.NotifyBits&=~ClearOnEntry;
+  uint32_t Bits=Sim_Clock.WaitNotifyBits((uint64_t)Ticks*1000);
+  if(Value) *Value=Bits;
+  return Bits ? pdTRUE:pdFALSE; }
+
+#define portYIELD_FROM_ISR()
+
+// =======================================================================================================
+
+extern int (*Sim_digitalRead)(uint8_t Pin);        // set by the radio model to present its IRQ lines
+
+inline int  digitalRead(uint8_t Pin)                { return Sim_digitalRead ? (*Sim_digitalRead)(Pin) : LOW; }
+inline void digitalWrite(uint8_t Pin, uint8_t Level) { }
+inline void pinMode(uint8_t Pin, uint8_t Mode)      { }
+
+extern void (*Sim_ISR[64])(void);                  // interrupt routines attached to the pins
+
+#define digitalPinToInterrupt(Pin) (Pin)
+
+inline void attachInterrupt(uint8_t Pin, void (*ISR)(void), int Mode) { if(Pin<64) Sim_ISR[Pin]=ISR; }
+inline void detachInterrupt(uint8_t Pin)                              { if(Pin<64) Sim_ISR[Pin]=0; }
+
+inline void Sim_PinRise(uint8_t Pin) { if(Pin<64 && Sim_ISR[Pin]) (*Sim_ISR[Pin])(); } // a model raises a line
+
+class SimSerial                                    // console: printed only when requested
+{ public:
+   bool Enable;
+
+  public:
+   int printf(const char *Format, ...)
+   { if(!Enable) return 0;
+     va_list Args; va_start(Args, Format); int Len=vprintf(Format, Args); va_end(Args); return Len; }
+   int println(const char *Line) { return printf("%s\n", Line); }
+} ;
+
+extern SimSerial Serial;
+
+class SPIClass
+{ public:
+   void begin(int8_t SCK=-1, int8_t MISO=-1, int8_t MOSI=-1, int8_t SS=-1) { }
+   void setFrequency(uint32_t Freq) { }
+} ;
+
+extern SPIClass SPI;
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t Sem, TickType_t Ticks) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t Sem)                   { return pdTRUE; }
+
+inline uint32_t uxTaskGetStackHighWaterMark(TaskHandle_t Task) { return 0; }
+
+#endif // __SIM_ARDUINO_H__
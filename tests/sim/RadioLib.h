@@ -0,0 +1,275 @@
+#ifndef __SIM_RADIOLIB_H__
+#define __SIM_RADIOLIB_H__
+
+// Host stand-in for RadioLib: SX1262 and SX1276 models which cost virtual time on every call,
+// transmit for the real time-on-air and receive packets injected into the simulated air.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Arduino.h"
+
+#define RADIOLIB_ERR_NONE                              0
+#define RADIOLIB_ERR_UNKNOWN                          -1
+#define RADIOLIB_ERR_CHIP_NOT_FOUND                   -2
+#define RADIOLIB_ERR_WRONG_MODEM                     -20
+
+#define RADIOLIB_SHAPING_NONE                       0x00
+#define RADIOLIB_SHAPING_0_3                        0x01
+#define RADIOLIB_SHAPING_0_5                        0x02
+#define RADIOLIB_SHAPING_0_7                        0x03
+#define RADIOLIB_SHAPING_1_0                        0x04
+#define RADIOLIB_ENCODING_NRZ                       0x00
+
+#define RADIOLIB_SX126X_PACKET_TYPE_GFSK            0x00
+#define RADIOLIB_SX126X_PACKET_TYPE_LORA            0x01
+#define RADIOLIB_SX126X_LORA_BW_125_0               0x04
+#define RADIOLIB_SX126X_LORA_BW_250_0               0x05
+#define RADIOLIB_SX126X_LORA_CRC_OFF                0x00
+#define RADIOLIB_SX126X_LORA_CRC_ON                 0x01
+#define RADIOLIB_SX126X_LORA_HEADER_EXPLICIT        0x00
+#define RADIOLIB_SX126X_LORA_IQ_STANDARD            0x00
+#define RADIOLIB_SX126X_LORA_IQ_INVERTED            0x01
+#define RADIOLIB_SX126X_LORA_LOW_DATA_RATE_OPTIMIZE_OFF 0x00
+
+#define RADIOLIB_SX127X_FSK_OOK                     0x00
+#define RADIOLIB_SX127X_LORA                        0x80
+#define RADIOLIB_SX127X_REG_RSSI_VALUE_FSK          0x11
+#define RADIOLIB_SX127X_REG_SYNC_CONFIG             0x27
+#define RADIOLIB_SX127X_REG_PACKET_CONFIG_1         0x30
+#define RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK      0x32
+#define RADIOLIB_SX127X_REG_DIO_MAPPING_1           0x40
+#define RADIOLIB_SX127X_PREAMBLE_POLARITY_AA        0x00
+#define RADIOLIB_SX127X_PREAMBLE_POLARITY_55        0x20
+#define RADIOLIB_SX127X_RX_TRIGGER_PREAMBLE_DETECT  0x06
+#define RADIOLIB_SX127X_CLEAR_IRQ_FLAG_TX_DONE      0x0008
+#define RADIOLIB_SX127X_FLAGS_ALL                   0xFFFF
+
+// =======================================================================================================
+
+class SimAirPacket                                 // a packet transmitted by someone else into the simulated air
+{ public:
+   static const int MaxBits = 1024;
+   uint64_t usStart;                               // [usec] start of the transmission (first preamble bit)
+   uint32_t Freq;                                  // [Hz]   carrier frequency
+   float    RSSI;                                  // [dBm]  signal level at our receiver
+   bool     LoRa;                                  // LoRa or FSK modulation
+   float    BitRate;                               // [kbps] FSK bit rate
+   uint8_t  SF;                                    // LoRa spreading factor
+   float    BW;                                    // [kHz]  LoRa bandwidth
+   uint8_t  CR;                                    // LoRa coding rate: 5..8
+   uint8_t  SyncWord;                              // LoRa SYNC word: 0xF1 = FANET, 0x34 = LoRaWAN
+   uint8_t  Preamble;                              // [symbols] LoRa preamble
+   uint8_t  Tag;                                   // test label: which system produced it
+   uint8_t  State;                                 // 0 = on air or pending, 1 = received, 2 = lost
+   uint16_t Bits;                                  // [bits] FSK: preamble+SYNC+payload, LoRa: payload
+   uint8_t  Data[MaxBits/8];                       // bits as they go on air, MSB first
+
+  public:
+   uint64_t usTime(void) const;                    // [usec] time-on-air
+   uint64_t usEnd(void) const { return usStart+usTime(); }
+   uint32_t getBits(int Pos, int Len) const;       // get up to 32 bits starting at given bit position
+   void setFSK(uint64_t Start, uint32_t Freq, float BitRate, int PreambleBits, const uint8_t *Bytes, int Len);
+   void setLoRa(uint64_t Start, uint32_t Freq, uint8_t SF, float BW, uint8_t CR, uint8_t SyncWord, uint8_t Preamble, const uint8_t *Bytes, int Len);
+} ;
+
+class SimRadioStats                                // what the radio model has measured
+{ public:
+   uint64_t usRx;                                  // [usec] time in receive mode
+   uint64_t usTx;                                  // [usec] time transmitting
+   uint64_t usIdle;                                // [usec] time in standby
+   uint64_t usConfig;                              // [usec] time spent on configuration calls
+   uint64_t usRead;                                // [usec] time spent on reading status and data
+   uint32_t Calls;                                 // number of calls to the radio
+   uint32_t ConfigCalls;                           // number of calls which change the configuration
+   uint32_t Reconfig;                              // number of times the receiver had to be stopped and started again
+   uint32_t TxPackets;                             // transmitted packets
+   uint32_t RxPackets;                             // packets delivered with IRQ
+   uint32_t RxOverrun;                             // packets overwritten before the code read them
+   uint32_t RxLost;                                // packets on our frequency and modulation but missed
+   uint32_t IRQreads;                              // [count] packets read out after the IRQ
+   uint64_t usIRQdelay;                            // [usec] sum of the delays from the IRQ to reading the packet
+   uint32_t usIRQdelayMax;                         // [usec] the longest of the delays
+
+  public:
+   void Clear(void) { memset(this, 0, sizeof(SimRadioStats)); }
+   uint64_t usTotal(void) const { return usRx+usTx+usIdle; }
+} ;
+
+class SimTxRecord                                  // a record of our own transmission
+{ public:
+   uint64_t usStart;                               // [usec]
+   uint32_t usTime;                                // [usec] time-on-air
+   uint32_t Freq;                                  // [Hz]
+   float    Power;                                 // [dBm]
+   bool     LoRa;
+   uint8_t  Len;                                  // [bytes]
+   uint8_t  Data[8];                               // first bytes of the packet
+} ;
+
+class Module
+{ public:
+   uint8_t Reg[128];                               // SX127x registers touched directly by the code
+   int     PinIRQ;                                 // the IRQ line the model drives
+
+  public:
+   Module(int CS, int IRQ, int RST, int Busy) { memset(Reg, 0, sizeof(Reg)); PinIRQ=IRQ; }
+   int16_t SPIsetRegValue(uint8_t Addr, uint8_t Value, uint8_t MSB=7, uint8_t LSB=0);
+   int16_t SPIgetRegValue(uint8_t Addr, uint8_t MSB=7, uint8_t LSB=0);
+   uint8_t SPIreadRegister(uint8_t Addr);
+} ;
+
+class SimRadio                                     // common model of both chips
+{ public:
+   static const uint8_t Mode_Idle = 0;
+   static const uint8_t Mode_Rx   = 1;
+   static const uint8_t Mode_Tx   = 2;
+
+   Module  *mod;
+   bool     isSX1262;                              // SX1262 or SX1276 flavour of the API and of the timing
+
+   // configuration
+   bool     LoRa;                                  // current modem
+   uint32_t Freq;                                  // [Hz]
+   float    BitRate;                               // [kbps]
+   float    FreqDev;                               // [kHz]
+   float    RxBW;                                  // [kHz]
+   uint8_t  Shaping;
+   uint16_t Preamble;                              // [bits] FSK or [symbols] LoRa
+   uint8_t  SyncLen;                               // [bytes]
+   uint8_t  Sync[8];
+   uint8_t  PktLen;                                // [bytes] fixed packet length
+   float    TxPower;                               // [dBm]
+   uint8_t  SF;
+   float    BW;                                    // [kHz]
+   uint8_t  CR;
+   uint8_t  LoRaSync;
+   bool     InvertIQ;
+
+   // state
+   uint8_t  Mode;
+   uint32_t Epoch;                                 // incremented whenever reception is interrupted
+   uint64_t usRxStart;                             // [usec] when the current reception started
+   uint64_t usBusy;                                // [usec] receiver demodulates a packet till this time
+   uint64_t usLast;                                // [usec] time already accounted in the stats
+   bool     IRQ;                                   // state of the IRQ line
+   uint64_t usIRQ;                                 // [usec] when the IRQ went up
+   uint64_t usTxEnd;                               // [usec] end of the current startTransmit()
+   uint8_t  RxLen;
+   uint8_t  RxBuf[256];
+   float    RxRSSI;                                // [dBm] of the last packet
+   int      PendIdx;                               // packet being demodulated (index in Air[]) or -1
+   uint64_t usPendEnd;                             // [usec] when it will be completely received
+   uint32_t PendEpoch;
+   uint16_t PendPos;                               // [bit] where the payload starts
+   int      AirFirst;                              // first packet in Air[] not yet resolved
+   float    Noise;                                 // [dBm] noise floor
+   uint32_t Seed;                                  // for noise bits and RSSI jitter
+
+   SimRadioStats Stats;
+
+   static const int MaxTxLog = 1024;
+   SimTxRecord TxLog[MaxTxLog];
+   int         TxLogLen;
+
+  public:
+   SimRadio(Module *Mod, bool SX1262);
+
+   // the simulated air
+   static const int MaxAir = 4096;
+   static SimAirPacket Air[MaxAir];
+   static int AirLen;
+   static SimAirPacket *addAir(void) { return AirLen<MaxAir ? Air+(AirLen++) : 0; }
+
+   void     Update(uint64_t usNow);                // process the air up to given time
+   static void Clock(uint64_t usNow);              // hook for the simulation clock
+
+   // call costs
+   void     Call(uint32_t usCost, bool Config=0, bool Stop=1);
+   void     Stop(void);                            // stop reception (due to reconfiguration or transmission)
+   bool     Match(const SimAirPacket &Pkt) const;  // can this packet be received with the current setup ?
+   void     Evaluate(int Idx, uint64_t usNow);     // check if a given packet can be picked by the receiver
+   void     Deliver(uint64_t usNow);               // complete packet being demodulated
+   void     RaiseIRQ(uint64_t usAt);               // IRQ line goes up: call the attached interrupt
+   static int ReadPin(uint8_t Pin);
+
+   uint32_t FreqTol(void) const { return LoRa ? BW*500 : RxBW*500; } // [Hz] how far off the packet can be
+   uint32_t getTimeOnAir(size_t Len);              // [usec]
+   float    liveRSSI(void);                        // [dBm]
+
+   // FSK and common API
+   int16_t  beginFSK(float Freq, float BR, float FreqDev, float RxBW, int8_t Power, uint16_t Preamble, float TCXO=0, bool LDO=0);
+   int16_t  standby(void);
+   int16_t  startReceive(void);
+   int16_t  transmit(const uint8_t *Data, size_t Len);
+   int16_t  transmit(uint8_t *Data, size_t Len) { return transmit((const uint8_t *)Data, Len); }
+   int16_t  startTransmit(const uint8_t *Data, size_t Len);
+   int16_t  finishTransmit(void)          { Call(100, 0); return standby(); }
+   int16_t  readData(uint8_t *Data, size_t Len);
+   size_t   getPacketLength(bool Update=true) { Call(100, 0, 0); return RxLen; }
+   float    getRSSI(bool Packet=true, bool SkipReceive=false);
+   float    getSNR(void)                  { Call(100, 0, 0); return 10.0f; }
+   float    getFrequencyError(void)       { Call(100, 0, 0); return 0.0f; }
+   float    getAFCError(void)             { Call(100, 0, 0); return 0.0f; }
+   int16_t  setFrequency(float MHz, bool Calibrate=false);
+   int16_t  setBitRate(float BR)          { Call(Setter(), 1); BitRate=BR; return 0; }
+   int16_t  setFrequencyDeviation(float Dev) { Call(Setter(), 1); FreqDev=Dev; return 0; }
+   int16_t  setRxBandwidth(float BW)      { Call(Setter(), 1); RxBW=BW; return 0; }
+   int16_t  setDataShaping(uint8_t Sh)    { Call(Setter(), 1); Shaping=Sh; return 0; }
+   int16_t  setPreambleLength(uint16_t Len) { Call(Setter(), 1); Preamble=Len; return 0; }
+   int16_t  setSyncWord(uint8_t *Word, size_t Len);
+   int16_t  setSyncWord(uint8_t Word, uint8_t Ctrl=0x44) { Call(Setter(), 1); LoRaSync=Word; return 0; }
+   int16_t  setEncoding(uint8_t Enc)      { Call(Setter(), 1); return 0; }
+   int16_t  setCRC(uint8_t Len, uint16_t Init=0x1D0F) { Call(Setter(), 1); return 0; }
+   int16_t  fixedPacketLengthMode(uint8_t Len) { Call(Setter(), 1); PktLen=Len; return 0; }
+   int16_t  variablePacketLengthMode(uint8_t Max=0xFF) { Call(Setter(), 1); PktLen=Max; return 0; }
+   int16_t  setOutputPower(float Power)   { Call(Setter(), 1, 0); TxPower=Power; return 0; }
+   int16_t  setCurrentLimit(float mA)     { Call(Setter(), 1, 0); return 0; }
+   int16_t  setRxBoostedGainMode(bool On) { Call(Setter(), 1); return 0; }
+   int16_t  setTCXO(float Volt)           { Call(Setter(), 1); return 0; }
+   int16_t  setDio2AsRfSwitch(bool On=true) { Call(Setter(), 1); return 0; }
+   int16_t  disableAddressFiltering(void) { Call(Setter(), 1); return 0; }
+   int16_t  setRSSIConfig(uint8_t Smooth, int8_t Ofs=0) { Call(Setter(), 1); return 0; }
+   int16_t  setAFC(bool On)               { Call(Setter(), 1); return 0; }
+   int16_t  setAFCBandwidth(float BW)     { Call(Setter(), 1); return 0; }
+   int16_t  setAFCAGCTrigger(uint8_t Trig) { Call(Setter(), 1); return 0; }
+   int16_t  invertPreamble(bool Inv)      { Call(Setter(), 1); return 0; }
+   int16_t  clearIrqFlags(uint16_t Flags) { Call(100, 0, 0); IRQ=0; return 0; }
+   int16_t  clearIRQFlags(void)           { Call(100, 0, 0); IRQ=0; return 0; }
+   uint16_t getIRQFlags(void)             { Call(100, 0, 0); return IRQ; }
+
+   // LoRa API
+   int16_t  explicitHeader(void)          { Call(Setter(), 1); return 0; }
+   int16_t  setBandwidth(float bw)        { Call(Setter(), 1); BW=bw; return 0; }
+   int16_t  setSpreadingFactor(uint8_t sf) { Call(Setter(), 1); SF=sf; return 0; }
+   int16_t  setCodingRate(uint8_t cr)     { Call(Setter(), 1); CR=cr; return 0; }
+   int16_t  invertIQ(bool Inv)            { Call(Setter(), 1); InvertIQ=Inv; return 0; }
+
+   uint32_t Setter(void) const { return isSX1262 ? 1700 : 1200; } // [usec] typical cost of a configuration call
+} ;
+
+extern SimRadio *Sim_Radio;                        // the radio instance created by the code under test
+
+class SX1262 : public SimRadio
+{ public:
+   SX1262(Module *Mod) : SimRadio(Mod, 1) { }
+   int16_t  config(uint8_t Type)      { Call(Setter(), 1); LoRa = Type==RADIOLIB_SX126X_PACKET_TYPE_LORA; return 0; }
+   uint8_t  getPacketType(void)       { Call(100, 0, 0); return LoRa ? RADIOLIB_SX126X_PACKET_TYPE_LORA : RADIOLIB_SX126X_PACKET_TYPE_GFSK; }
+   uint32_t getPacketStatus(void);
+   int16_t  setModulationParams(uint8_t sf, uint8_t bw, uint8_t cr, uint8_t ldro)
+   { Call(Setter(), 1); SF=sf; BW = bw==RADIOLIB_SX126X_LORA_BW_250_0 ? 250.0 : 125.0; CR=cr; return 0; }
+   int16_t  setPacketParams(uint16_t Pre, uint8_t CRC, uint8_t Len, uint8_t Hdr, uint8_t IQ)
+   { Call(Setter(), 1); Preamble=Pre; InvertIQ = IQ==RADIOLIB_SX126X_LORA_IQ_INVERTED; return 0; }
+   uint8_t  getChipVersion(void)      { return 0x00; }
+} ;
+
+class SX1276 : public SimRadio
+{ public:
+   SX1276(Module *Mod) : SimRadio(Mod, 0) { }
+   int16_t  setActiveModem(uint8_t Modem) { Call(Setter(), 1); LoRa = Modem==RADIOLIB_SX127X_LORA; return 0; }
+   int16_t  getActiveModem(void)      { Call(100, 0, 0); return LoRa ? RADIOLIB_SX127X_LORA : RADIOLIB_SX127X_FSK_OOK; }
+   uint8_t  getChipVersion(void)      { return 0x12; }
+   int8_t   getTempRaw(void)          { Call(100, 0, 0); return 20; }
+} ;
+
+#endif // __SIM_RADIOLIB_H__
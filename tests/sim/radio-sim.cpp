@@ -0,0 +1,287 @@
+// Host model of the SX1262/SX1276 radio as seen through RadioLib: costs of the calls, time-on-air,
+// sync-word detection on injected packets, IRQ line and the reception statistics.
+
+#include "RadioLib.h"
+
+SimClock   Sim_Clock;
+SimSerial  Serial;
+SPIClass   SPI;
+int      (*Sim_digitalRead)(uint8_t Pin) = 0;
+void     (*Sim_ISR[64])(void);
+SimRadio  *Sim_Radio = 0;
+
+SimAirPacket SimRadio::Air[SimRadio::MaxAir];
+int          SimRadio::AirLen = 0;
+
+// =======================================================================================================
+
+static uint64_t LoRaTime(uint8_t SF, float BW, uint8_t CR, uint16_t Preamble, int Len)  // [usec] LoRa time-on-air, explicit header, CRC on
+{ float usSymb = (float)(1<<SF)*1000.0f/BW;
+  int Num = 8*Len-4*SF+28+16;
+  int Symb = 8;
+  if(Num>0) Symb += ((Num+4*SF-1)/(4*SF))*CR;
+  return (uint64_t)((Preamble+4.25f+Symb)*usSymb); }
+
+uint64_t SimAirPacket::usTime(void) const
+{ if(LoRa) return LoRaTime(SF, BW, CR, Preamble, Bits/8);
+  return (uint64_t)(Bits*1000.0f/BitRate); }
+
+uint32_t SimAirPacket::getBits(int Pos, int Len) const
+{ uint32_t Word=0;
+  for(int Idx=0; Idx<Len; Idx++, Pos++)
+  { Word<<=1;
+    if(Pos<Bits) Word |= (Data[Pos>>3]>>(7-(Pos&7)))&1; }
+  return Word; }
+
+void SimAirPacket::setFSK(uint64_t Start, uint32_t Freq, float BitRate, int PreambleBits, const uint8_t *Bytes, int Len)
+{ memset(this, 0, sizeof(SimAirPacket));
+  usStart=Start; this->Freq=Freq; this->BitRate=BitRate; LoRa=0;
+  uint8_t First = Bytes[0]>>7;                           // make the preamble alternate into the first SYNC bit
+  uint16_t Pos=0;
+  for( ; Pos<PreambleBits; Pos++)
+  { uint8_t Bit = (First ^ (PreambleBits-Pos)) & 1;
+    Data[Pos>>3] |= Bit<<(7-(Pos&7)); }
+  for(int Idx=0; Idx<Len*8 && Pos<MaxBits; Idx++, Pos++)
+  { uint8_t Bit = (Bytes[Idx>>3]>>(7-(Idx&7)))&1;
+    Data[Pos>>3] |= Bit<<(7-(Pos&7)); }
+  Bits=Pos; }
+
+void SimAirPacket::setLoRa(uint64_t Start, uint32_t Freq, uint8_t SF, float BW, uint8_t CR, uint8_t SyncWord, uint8_t Preamble,
+                           const uint8_t *Bytes, int Len)
+{ memset(this, 0, sizeof(SimAirPacket));
+  usStart=Start; this->Freq=Freq; LoRa=1;
+  this->SF=SF; this->BW=BW; this->CR=CR; this->SyncWord=SyncWord; this->Preamble=Preamble;
+  if(Len>MaxBits/8) Len=MaxBits/8;
+  memcpy(Data, Bytes, Len); Bits=Len*8; }
+
+// =======================================================================================================
+
+int16_t Module::SPIsetRegValue(uint8_t Addr, uint8_t Value, uint8_t MSB, uint8_t LSB)
+{ if(Sim_Radio) Sim_Radio->Call(200, 1);
+  uint8_t Mask = (0xFF<<LSB) & (0xFF>>(7-MSB));
+  Reg[Addr&0x7F] = (Reg[Addr&0x7F]&(~Mask)) | (Value&Mask);
+  return RADIOLIB_ERR_NONE; }
+
+int16_t Module::SPIgetRegValue(uint8_t Addr, uint8_t MSB, uint8_t LSB)
+{ if(Sim_Radio) Sim_Radio->Call(100, 0, 0);
+  if(Addr==RADIOLIB_SX127X_REG_RSSI_VALUE_FSK && Sim_Radio) return (uint8_t)(-2*Sim_Radio->RxRSSI);
+  uint8_t Mask = (0xFF<<LSB) & (0xFF>>(7-MSB));
+  return Reg[Addr&0x7F]&Mask; }
+
+uint8_t Module::SPIreadRegister(uint8_t Addr) { return SPIgetRegValue(Addr); }
+
+// =======================================================================================================
+
+SimRadio::SimRadio(Module *Mod, bool SX1262)
+{ mod=Mod; isSX1262=SX1262;
+  LoRa=0; Freq=868200000; BitRate=100.0; FreqDev=50.0; RxBW=234.3; Shaping=0;
+  Preamble=16; SyncLen=0; memset(Sync, 0, sizeof(Sync)); PktLen=0; TxPower=0;
+  SF=7; BW=250.0; CR=5; LoRaSync=0x12; InvertIQ=0;
+  Mode=Mode_Idle; Epoch=0; usRxStart=0; usBusy=0; usLast=Sim_Clock.usTime;
+  IRQ=0; usIRQ=0; usTxEnd=0; RxLen=0; RxRSSI=-120.0; Noise=-110.0; Seed=0x12345678;
+  PendIdx=(-1); usPendEnd=0; PendEpoch=0; PendPos=0; AirFirst=0;
+  Stats.Clear(); TxLogLen=0;
+  Sim_Radio=this;
+  Sim_digitalRead=ReadPin;
+  Sim_Clock.addHook(Clock); }
+
+int SimRadio::ReadPin(uint8_t Pin) { return Sim_Radio && Pin==Sim_Radio->mod->PinIRQ && Sim_Radio->IRQ; }
+
+void SimRadio::RaiseIRQ(uint64_t usAt)
+{ bool Edge = !IRQ;
+  IRQ=1; usIRQ=usAt;
+  if(!Edge) return;
+  uint64_t usNow=Sim_Clock.usTime;                               // the interrupt runs at the time of the edge
+  Sim_Clock.usTime=usAt;
+  Sim_PinRise(mod->PinIRQ);
+  Sim_Clock.usTime=usNow; }
+
+void SimRadio::Clock(uint64_t usNow) { if(Sim_Radio) Sim_Radio->Update(usNow); }
+
+void SimRadio::Call(uint32_t usCost, bool Config, bool StopRx)
+{ Update(Sim_Clock.usTime);
+  Stats.Calls++;
+  if(Config) { Stats.ConfigCalls++; Stats.usConfig+=usCost; }
+        else { Stats.usRead+=usCost; }
+  if(StopRx) Stop();
+  Sim_Clock.Advance(usCost); }
+
+void SimRadio::Stop(void)
+{ if(Mode==Mode_Rx) Stats.Reconfig++;
+  if(Mode!=Mode_Tx) Mode=Mode_Idle;
+  Epoch++; }
+
+void SimRadio::Update(uint64_t usNow)
+{ if(usTxEnd && usNow>=usTxEnd)                                  // end of transmission started with startTransmit()
+  { if(usTxEnd>usLast) { Stats.usTx+=usTxEnd-usLast; usLast=usTxEnd; }
+    Mode=Mode_Idle; RaiseIRQ(usTxEnd); usTxEnd=0; }
+  if(usNow>usLast)                                               // account the time spent in the current mode
+  { uint64_t usDelta=usNow-usLast;
+         if(Mode==Mode_Rx) Stats.usRx+=usDelta;
+    else if(Mode==Mode_Tx) Stats.usTx+=usDelta;
+    else                   Stats.usIdle+=usDelta;
+    usLast=usNow; }
+  Deliver(usNow);
+  for(int Idx=AirFirst; Idx<AirLen; Idx++)                       // go through packets on the air
+  { SimAirPacket &Pkt=Air[Idx];
+    if(Pkt.usStart>usNow) break;                                 // packets are injected in the time order
+    Evaluate(Idx, usNow);
+    Deliver(usNow); }
+  for( ; AirFirst<AirLen && Air[AirFirst].State && Air[AirFirst].State!=3; AirFirst++);
+  if(usTxEnd) Sim_Clock.Wake(usTxEnd);                           // announce the next events, so a sleeping task wakes up exactly
+  if(PendIdx>=0) Sim_Clock.Wake(usPendEnd);
+  for(int Idx=AirFirst; Idx<AirLen; Idx++)                       // the next packet to appear on the air
+  { const SimAirPacket &Pkt=Air[Idx];
+    if(Pkt.usStart>usNow) { Sim_Clock.Wake(Pkt.usStart); break; } }
+}
+
+bool SimRadio::Match(const SimAirPacket &Pkt) const
+{ if(Mode!=Mode_Rx) return 0;
+  if(Pkt.LoRa!=LoRa) return 0;
+  int32_t FreqErr = (int32_t)(Pkt.Freq-Freq);
+  if(FreqErr<0) FreqErr=(-FreqErr);
+  if((uint32_t)FreqErr>FreqTol()) return 0;
+  if(LoRa) return Pkt.SF==SF && Pkt.BW==BW && Pkt.SyncWord==LoRaSync && !InvertIQ;
+  return fabsf(Pkt.BitRate-BitRate)<0.01f*BitRate; }
+
+void SimRadio::Evaluate(int Idx, uint64_t usNow)
+{ SimAirPacket &Pkt=Air[Idx];
+  if(Pkt.State) return;                                          // already resolved
+  uint64_t usEnd = Pkt.usEnd();
+  if(!Match(Pkt) || PendIdx>=0)                                  // wrong setup or receiver busy with another packet
+  { if(usNow>=usEnd) { Pkt.State=2; Stats.RxLost++; }           // lost when completely on the air
+    return; }
+  if(LoRa)
+  { if(usRxStart>Pkt.usStart || usBusy>Pkt.usStart)             // receiver must be on from the preamble
+    { if(usNow>=usEnd) { Pkt.State=2; Stats.RxLost++; }
+      return; }
+    PendIdx=Idx; usPendEnd=usEnd; PendEpoch=Epoch; PendPos=0; Pkt.State=3; usBusy=usEnd; return; }
+  float usBit = 1000.0f/BitRate;                                 // [usec] per bit
+  int SyncBits = SyncLen*8;
+  uint32_t SyncH = 0, SyncL = 0;                                 // SYNC split into two 32-bit words
+  for(int Bit=0; Bit<SyncBits; Bit++)
+  { uint8_t Val=(Sync[Bit>>3]>>(7-(Bit&7)))&1;
+    if(Bit<32) SyncH=(SyncH<<1)|Val; else SyncL=(SyncL<<1)|Val; }
+  int BitsH = SyncBits<32 ? SyncBits : 32;
+  for(int Pos=0; Pos+SyncBits<=Pkt.Bits; Pos++)                 // search the SYNC in the packet bits
+  { uint64_t usSync = Pkt.usStart + (uint64_t)(Pos*usBit);      // when the SYNC starts
+    if(usSync<usRxStart || usSync<usBusy) continue;              // receiver must listen from the start of the SYNC
+    if(Pkt.getBits(Pos, BitsH)!=SyncH) continue;
+    if(SyncBits>32 && Pkt.getBits(Pos+32, SyncBits-32)!=SyncL) continue;
+    uint64_t usSyncEnd = Pkt.usStart + (uint64_t)((Pos+SyncBits)*usBit);
+    if(usSyncEnd>usNow) { Sim_Clock.Wake(usSyncEnd); return; }    // SYNC not yet completely received: wait
+    PendIdx=Idx; PendEpoch=Epoch; PendPos=Pos+SyncBits; Pkt.State=3;
+    usPendEnd = usSyncEnd + (uint64_t)(PktLen*8*usBit);
+    usBusy=usPendEnd; return; }
+  if(usNow>=usEnd) { Pkt.State=2; Stats.RxLost++; } }
+
+void SimRadio::Deliver(uint64_t usNow)
+{ if(PendIdx<0) return;
+  SimAirPacket &Pkt=Air[PendIdx];
+  if(PendEpoch!=Epoch) { Pkt.State=2; Stats.RxLost++; PendIdx=(-1); usBusy=0; return; } // reception interrupted
+  if(usNow<usPendEnd) return;
+  if(IRQ) Stats.RxOverrun++;                                     // previous packet not read yet: overwritten
+  if(LoRa)
+  { RxLen=Pkt.Bits/8; memcpy(RxBuf, Pkt.Data, RxLen); }
+  else
+  { RxLen=PktLen;
+    for(int Idx=0; Idx<PktLen; Idx++)
+    { int Pos=PendPos+Idx*8;
+      uint8_t Byte=Pkt.getBits(Pos, 8);
+      if(Pos+8>Pkt.Bits)                                         // beyond the end of the packet: noise
+      { Seed=Seed*1103515245+12345;
+        uint8_t Mask = Pos>=Pkt.Bits ? 0xFF : 0xFF>>(Pkt.Bits-Pos);
+        Byte = (Byte&(~Mask)) | ((Seed>>16)&Mask); }
+      RxBuf[Idx]=Byte; }
+  }
+  RxRSSI=Pkt.RSSI; RaiseIRQ(usPendEnd);
+  Pkt.State=1; Stats.RxPackets++;
+  PendIdx=(-1); }
+
+float SimRadio::liveRSSI(void)
+{ uint64_t usNow=Sim_Clock.usTime;
+  Seed=Seed*1103515245+12345;
+  float RSSI = Noise + 0.1f*((Seed>>16)%21) - 1.0f;             // noise with +/-1dB jitter
+  for(int Idx=AirFirst; Idx<AirLen; Idx++)
+  { const SimAirPacket &Pkt=Air[Idx];
+    if(Pkt.usStart>usNow) break;
+    if(Pkt.usEnd()<=usNow) continue;
+    int32_t FreqErr = (int32_t)(Pkt.Freq-Freq); if(FreqErr<0) FreqErr=(-FreqErr);
+    if((uint32_t)FreqErr>FreqTol()) continue;
+    if(Pkt.RSSI>RSSI) RSSI=Pkt.RSSI; }
+  return RSSI; }
+
+uint32_t SimRadio::getTimeOnAir(size_t Len)
+{ if(LoRa) return LoRaTime(SF, BW, CR, Preamble, Len);
+  return (uint32_t)((Preamble+SyncLen*8+Len*8)*1000.0f/BitRate); }
+
+// =======================================================================================================
+
+int16_t SimRadio::beginFSK(float MHz, float BR, float Dev, float BW, int8_t Power, uint16_t Pre, float TCXO, bool LDO)
+{ Call(20000, 1);
+  LoRa=0; Freq=(uint32_t)floorf(MHz*1e6f+0.5f); BitRate=BR; FreqDev=Dev; RxBW=BW; TxPower=Power; Preamble=Pre;
+  return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::standby(void)
+{ Call(200, 1);
+  IRQ=0; return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::startReceive(void)
+{ Call(300, 1);
+  Mode=Mode_Rx; usRxStart=Sim_Clock.usTime; usBusy=0; IRQ=0;
+  return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::setFrequency(float MHz, bool Calibrate)
+{ Call(Setter()+(Calibrate?3000:0), 1);
+  Freq=(uint32_t)floorf(MHz*1e6f+0.5f);
+  return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::setSyncWord(uint8_t *Word, size_t Len)
+{ Call(Setter(), 1);
+  if(Len>8) Len=8;
+  SyncLen=Len; memcpy(Sync, Word, Len);
+  return RADIOLIB_ERR_NONE; }
+
+static void Log(SimRadio &Radio, const uint8_t *Data, size_t Len, uint32_t usTime)
+{ if(Radio.TxLogLen>=Radio.MaxTxLog) return;
+  SimTxRecord &Rec = Radio.TxLog[Radio.TxLogLen++];
+  Rec.usStart=Sim_Clock.usTime; Rec.usTime=usTime; Rec.Freq=Radio.Freq; Rec.Power=Radio.TxPower; Rec.LoRa=Radio.LoRa;
+  Rec.Len=Len; memset(Rec.Data, 0, 8); memcpy(Rec.Data, Data, Len<8?Len:8); }
+
+int16_t SimRadio::transmit(const uint8_t *Data, size_t Len)   // blocking transmission: as measured on SX1262, 10ms on top of the time-on-air
+{ uint32_t usTime=getTimeOnAir(Len);
+  Call(2000, 1);                                                 // write the FIFO and start
+  Mode=Mode_Tx; Stats.TxPackets++;
+  Log(*this, Data, Len, usTime);
+  Sim_Clock.Advance(usTime);
+  Mode=Mode_Idle; RaiseIRQ(Sim_Clock.usTime);                    // TX-done IRQ: RadioLib waits for it
+  Stats.usConfig+=8000;                                          // RadioLib waits, clears the IRQ and returns to standby
+  Sim_Clock.Advance(8000);
+  IRQ=0; return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::startTransmit(const uint8_t *Data, size_t Len)
+{ uint32_t usTime=getTimeOnAir(Len);
+  Call(1500, 1);
+  Mode=Mode_Tx; usTxEnd=Sim_Clock.usTime+usTime; IRQ=0; Stats.TxPackets++;
+  Log(*this, Data, Len, usTime);
+  return RADIOLIB_ERR_NONE; }
+
+int16_t SimRadio::readData(uint8_t *Data, size_t Len)
+{ if(IRQ && Sim_Clock.usTime>=usIRQ)                             // how long the packet waited in the chip
+  { uint32_t usDelay=Sim_Clock.usTime-usIRQ;
+    Stats.IRQreads++; Stats.usIRQdelay+=usDelay;
+    if(usDelay>Stats.usIRQdelayMax) Stats.usIRQdelayMax=usDelay; }
+  Call(100+8*Len, 0, 0);                                         // SPI at about 1MHz
+  if(Len>RxLen) Len=RxLen;
+  memcpy(Data, RxBuf, Len);
+  IRQ=0; return RADIOLIB_ERR_NONE; }
+
+float SimRadio::getRSSI(bool Packet, bool SkipReceive)
+{ Call(100, 0, 0);
+  if(Packet) return RxRSSI;
+  return liveRSSI(); }
+
+uint32_t SX1262::getPacketStatus(void)
+{ Call(100, 0, 0);
+  uint8_t RSSI = (uint8_t)(-2*RxRSSI);
+  return ((uint32_t)RSSI<<8) | RSSI; }
@@ -0,0 +1,119 @@
+// Radio_SlotPlan of slot-plan.h: the tables against the former hand-written slot logic of Radio_Task()
+// and the reception coverage per protocol over a day of frequency hopping.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "slot-plan.h"
+#include "check.h"
+
+// ===================================================================================================
+
+
+static const uint32_t UTC0 = 1700000000;               // [sec] start of the day simulated
+static const int      Day  = 86400;                    // [sec]
+
+static FreqPlan Plan;
+
+// the Europe/Africa slot decision as it was coded in Radio_Task(): channel, TX system, RX system and power offset per half-slot
+static void RefEU(uint32_t UTC, uint8_t Chan[2], uint8_t TxSysID[2], uint8_t RxSysID[2], int8_t TxPwr[2])
+{ uint32_t Hash=Radio_SlotPlan::Hash(UTC);
+  uint8_t TxChan = Hash%3;
+  for(int Slot=0; Slot<2; Slot++)
+  { uint8_t FLR_Chan = Plan.getChannel(UTC, Slot, 0);
+    uint8_t OGN_Chan = Plan.getChannel(UTC, Slot, 1);
+    if(Slot && TxChan==2) TxChan=0;
+    TxPwr[Slot]=0; Chan[Slot]=TxChan;
+         if(TxChan==FLR_Chan) { TxSysID[Slot]=Radio_SysID_ADSL; RxSysID[Slot]=Radio_SysID_FLR_ADSL; }
+    else if(TxChan==OGN_Chan) { TxSysID[Slot]=Radio_SysID_OGN;  RxSysID[Slot]=Radio_SysID_OGN_ADSL; }
+    else { TxPwr[Slot]=13;      TxSysID[Slot]=Radio_SysID_LDR;  RxSysID[Slot]=Radio_SysID_LDR; }
+  }
+}
+
+static void TestReference(void)
+{ Plan.setPlan(1);
+  Radio_SlotPlan SlotPlan = Radio_SlotPlan::get(Plan.Plan);
+  int Diff=0;
+  for(int Sec=0; Sec<Day; Sec++)
+  { uint32_t UTC=UTC0+Sec;
+    uint8_t Chan[2], TxSysID[2], RxSysID[2]; int8_t TxPwr[2];
+    RefEU(UTC, Chan, TxSysID, RxSysID, TxPwr);
+    const Radio_SlotRule *Rule=SlotPlan.getVariant(UTC);
+    for(int Slot=0; Slot<Radio_HalfSlots; Slot++)
+      if(Rule[Slot].getChannel(Plan, UTC, Slot)!=Chan[Slot] || Rule[Slot].TxSysID!=TxSysID[Slot] ||
+         Rule[Slot].RxSysID!=RxSysID[Slot] || Rule[Slot].TxPwr!=TxPwr[Slot]) Diff++; }
+  Check("EU table same as the former slot logic", Diff==0); }
+
+static bool Valid(const Radio_SlotPlan &SlotPlan, bool EU)   // table consistency
+{ for(int Var=0; Var<SlotPlan.Variants; Var++)
+  { uint16_t msPrev=400;
+    for(int Slot=0; Slot<Radio_HalfSlots; Slot++)
+    { const Radio_SlotRule &Rule=SlotPlan.Variant[Var][Slot];
+      if(Rule.msStart!=msPrev || Rule.msEnd<=Rule.msStart || Rule.msMaxLen()<Rule.msMinLen()) return 0; // contiguous time windows
+      msPrev=Rule.msEnd;
+      bool OBand = Rule.Chan==Radio_SlotRule::Chan_OBAND;
+      if(OBand != (Rule.TxSysID==Radio_SysID_LDR)) return 0;                            // LDR only on the O-band
+      if(OBand != (Rule.RxSysID==Radio_SysID_LDR)) return 0;
+      if(!EU && (OBand || Rule.TxSysID==Radio_SysID_ADSL || Rule.RxSysID>=8)) return 0; // no O-band, no ADS-L outside Europe
+      if(Rule.TxPwr>(OBand||!EU?13:0)) return 0; }                                     // +13dB only on the O-band or outside Europe
+  }
+  return 1; }
+
+// ===================================================================================================
+// coverage: which fraction of each protocol's airtime we listen to on the right channel with the right SYNC.
+// FLARM and ADS-L transmit on the FLARM hopping channel, OGN on the OGN one, LDR on the O-band all the time.
+
+static bool Accepts(uint8_t RxSysID, uint8_t SysID)
+{ if(RxSysID==SysID) return 1;
+  if(RxSysID==Radio_SysID_FLR_ADSL) return SysID==Radio_SysID_FLR || SysID==Radio_SysID_ADSL;
+  if(RxSysID==Radio_SysID_OGN_ADSL) return SysID==Radio_SysID_OGN || SysID==Radio_SysID_ADSL;
+  return 0; }
+
+static const int Protocols = 4;
+static const uint8_t Protocol[Protocols] = { Radio_SysID_FLR, Radio_SysID_OGN, Radio_SysID_ADSL, Radio_SysID_LDR } ;
+
+static void Coverage(uint8_t PlanID, float Cover[Protocols], float TxShare[Protocols])
+{ Plan.setPlan(PlanID);
+  Radio_SlotPlan SlotPlan = Radio_SlotPlan::get(Plan.Plan);
+  uint64_t Listen[Protocols], Air[Protocols]; int Tx[Protocols], HalfSlots=0;
+  for(int Prot=0; Prot<Protocols; Prot++) { Listen[Prot]=0; Air[Prot]=0; Tx[Prot]=0; }
+  for(int Sec=0; Sec<Day; Sec++)
+  { uint32_t UTC=UTC0+Sec;
+    const Radio_SlotRule *Rule=SlotPlan.getVariant(UTC);
+    for(int Slot=0; Slot<Radio_HalfSlots; Slot++, HalfSlots++)
+    { uint16_t msLen = Rule[Slot].msEnd-Rule[Slot].msStart;
+      uint8_t Chan = Rule[Slot].getChannel(Plan, UTC, Slot);
+      for(int Prot=0; Prot<Protocols; Prot++)
+      { uint8_t SysID=Protocol[Prot];
+        uint8_t ProtChan;
+        if(SysID==Radio_SysID_LDR) { if(!Plan.getFreqOBAND()) continue; ProtChan=Plan.Channels; }
+        else if(SysID==Radio_SysID_ADSL) { if(Plan.Plan>1) continue; ProtChan=Plan.getChannel(UTC, Slot, 0); }
+        else ProtChan=Plan.getChannel(UTC, Slot, SysID==Radio_SysID_OGN);
+        Air[Prot]+=msLen;
+        if(Chan==ProtChan && Accepts(Rule[Slot].RxSysID, SysID)) Listen[Prot]+=msLen;
+        if(Rule[Slot].TxSysID==SysID) Tx[Prot]++; }
+    }
+  }
+  for(int Prot=0; Prot<Protocols; Prot++)
+  { Cover[Prot]   = Air[Prot] ? (float)Listen[Prot]/Air[Prot] : 0;
+    TxShare[Prot] = (float)Tx[Prot]/HalfSlots; }
+}
+
+static bool Near(float Value, float Expect) { return Value>=Expect-0.01 && Value<=Expect+0.01; }
+
+int main(int argc, char *argv[])
+{ TestReference();
+  Check("EU table valid",      Valid(Radio_SlotPlan::get(1), 1));
+  Check("hopping table valid", Valid(Radio_SlotPlan::get(2), 0));
+  printf("Plan                FLR    OGN   ADS-L   LDR   (coverage: fraction of the airtime listened to)\n");
+  const uint8_t Plans[6] = { 1, 2, 3, 4, 5, 6 } ;
+  for(int Idx=0; Idx<6; Idx++)
+  { float Cover[Protocols], TxShare[Protocols];
+    Coverage(Plans[Idx], Cover, TxShare);
+    printf("%-16s  %5.3f  %5.3f  %5.3f  %5.3f   TX share: %4.2f %4.2f %4.2f %4.2f\n", FreqPlan::getPlanName(Plans[Idx]),
+           Cover[0], Cover[1], Cover[2], Cover[3], TxShare[0], TxShare[1], TxShare[2], TxShare[3]);
+    if(Plans[Idx]==1)
+      Check("EU coverage", Near(Cover[0], 1.0/3) && Near(Cover[1], 1.0/2) && Near(Cover[2], 1.0/3) && Near(Cover[3], 1.0/6));
+    else if(Plans[Idx]==2)
+      Check("USA coverage", Near(Cover[0], 0.5) && Near(Cover[1], 0.5)); }
+  return CheckResult(); }
@@ -0,0 +1,140 @@
+// FSK_RxPacket::DecodeSysID() with the FSK_SyncSignTable classifier: a corpus of packets received
+// with the multi-system SYNCs (FLR+ADSL, OGN+ADSL) and the LDR SYNC, nominal, shifted by some bits
+// and with bit errors in the signature, plus random noise for the false-match rate.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "rx-pkt.h"
+#include "manchester.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x2468ACE1;
+static uint32_t getRand(uint32_t Range) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand%Range; }
+
+static void setBit(uint8_t *Data, int Pos, bool Bit)
+{ uint8_t Mask = 0x80>>(Pos&7);
+  if(Bit) Data[Pos>>3] |= Mask; else Data[Pos>>3] &= ~Mask; }
+
+static bool getBit(const uint8_t *Data, int Pos) { return (Data[Pos>>3]>>(7-(Pos&7)))&1; }
+
+static int findBits(const uint8_t *Air, int AirBits, const uint8_t *SYNC, int SyncBits) // where the RF chip detects its SYNC
+{ for(int Pos=0; Pos+SyncBits<=AirBits; Pos++)
+  { int Bit=0;
+    for( ; Bit<SyncBits; Bit++) if(getBit(Air, Pos+Bit)!=getBit(SYNC, Bit)) break;
+    if(Bit==SyncBits) return Pos+SyncBits; }
+  return -1; }
+
+// the receiver side: detect the short SYNC on the air, take the packet after it and possibly Manchester-decode it
+static bool Receive(FSK_RxPacket &Pkt, const uint8_t *Air, int AirBits, uint8_t RxSysID, int Shift)
+{ const uint8_t *SYNC; uint8_t PktLen;
+  int SyncLen=FSK_RxPacket::SysSYNC(SYNC, PktLen, RxSysID);
+  bool Manch = RxSysID!=Radio_SysID_LDR;
+  if(!Manch) PktLen+=9;                                     // as the RF chip is set up for LDR reception
+  int Start = findBits(Air, AirBits, SYNC, 8*SyncLen);
+  if(Start<0) return 0;
+  uint8_t Chips[2*FSK_RxPacket::MaxBytes];
+  int Len = Manch ? 2*PktLen : PktLen;
+  Start -= (Manch?2:1)*Shift;                               // simulate the packet arriving later (+) or earlier (-) by the given number of bits
+  memset(Chips, 0, sizeof(Chips));
+  for(int Bit=0; Bit<8*Len; Bit++)
+  { int Pos=Start+Bit;
+    setBit(Chips, Bit, Pos>=0 && Pos<AirBits ? getBit(Air, Pos) : getRand(2)); }
+  Pkt.SysID=RxSysID; Pkt.Bytes=PktLen;
+  if(Manch) Manchester_Decode(Pkt.Data, Pkt.Err, Chips, PktLen);
+       else { memcpy(Pkt.Data, Chips, PktLen); memset(Pkt.Err, 0, PktLen); }
+  return 1; }
+
+static int makeAir(uint8_t *Air, uint8_t SysID, const uint8_t *Data, int Shift) // what the system transmits
+{ const uint8_t *SYNC; uint8_t PktLen;
+  int SyncLen=FSK_RxPacket::SysSYNC(SYNC, PktLen, SysID);
+  int Len=0;
+  const int Pre = 4+(Shift>0?2*Shift:0);                  // preamble, longer when we shift the packet to appear later
+  for(int Idx=0; Idx<Pre; Idx++) Air[Len++] = SysID==Radio_SysID_LDR ? 0xAA : 0x55;
+  memcpy(Air+Len, SYNC, SysID==Radio_SysID_LDR?8:SyncLen); Len += SysID==Radio_SysID_LDR?8:SyncLen;
+  if(SysID==Radio_SysID_LDR) { memcpy(Air+Len, Data, PktLen+1); Len+=PktLen+1; }
+                        else Len+=Manchester_Encode(Air+Len, Data, PktLen);
+  for(int Idx=0; Idx<8; Idx++) Air[Len++]=getRand(256);    // noise after the packet
+  return Len*8; }
+
+// ===================================================================================================
+
+static int Cases=0, Resolved=0, Wrong=0;
+
+static void TestCase(uint8_t SysID, uint8_t RxSysID, int Shift, int Flips, bool MustResolve)
+{ const uint8_t *SYNC; uint8_t PktLen;
+  FSK_RxPacket::SysSYNC(SYNC, PktLen, SysID);
+  if(SysID==Radio_SysID_LDR) PktLen+=1;                    // LDR carries an external CRC byte
+  uint8_t Data[32]; for(int Idx=0; Idx<PktLen; Idx++) Data[Idx]=getRand(256);
+  uint8_t Air[128];
+  int AirBits=makeAir(Air, SysID, Data, Shift);
+  FSK_RxPacket Pkt;
+  if(!Receive(Pkt, Air, AirBits, RxSysID, Shift)) { printf("%s in %s: SYNC not found\n", FSK_RxPacket::SysName(SysID), FSK_RxPacket::SysName(RxSysID)); Wrong++; return; }
+  int SignBits=0;
+  for(int Idx=0; Idx<FSK_SyncSigns; Idx++)
+    if(FSK_SyncSignTable[Idx].RxSysID==RxSysID && FSK_SyncSignTable[Idx].SysID==SysID) SignBits=FSK_SyncSignTable[Idx].Bits;
+  int Start = Shift>0 ? Shift:0;                           // corrupt bits in the signature part still in the Data
+  int Len = SignBits+Shift-Start;
+  for(int Flip=0; Flip<Flips && Len>0; Flip++)
+  { int Bit=Start+getRand(Len); Pkt.Data[Bit>>3]^=0x80>>(Bit&7); }
+  Cases++;
+  uint8_t Sys=Pkt.DecodeSysID();
+  bool OK = Sys==SysID && Pkt.Bytes==PktLen && memcmp(Pkt.Data, Data, PktLen)==0;
+  if(OK) Resolved++;
+  else if(Sys<8) Wrong++;                                  // resolved, but into the wrong system or alignment
+  if(MustResolve && !OK)
+    printf("%s in %s: shift %+d, %d flips => %s [%d] not resolved\n",
+           FSK_RxPacket::SysName(SysID), FSK_RxPacket::SysName(RxSysID), Shift, Flips, FSK_RxPacket::SysName(Sys), Pkt.Bytes); }
+
+static int Noise(uint8_t RxSysID, int Count)               // random data: how often a system is (falsely) resolved
+{ const uint8_t *SYNC; uint8_t PktLen;
+  FSK_RxPacket::SysSYNC(SYNC, PktLen, RxSysID);
+  if(RxSysID==Radio_SysID_LDR) PktLen+=9;
+  int Match=0;
+  FSK_RxPacket Pkt;
+  for(int Idx=0; Idx<Count; Idx++)
+  { for(int Byte=0; Byte<PktLen; Byte++) { Pkt.Data[Byte]=getRand(256); Pkt.Err[Byte]=0; }
+    Pkt.SysID=RxSysID; Pkt.Bytes=PktLen;
+    if(Pkt.DecodeSysID()<8 && RxSysID>=8) Match++;
+    else if(RxSysID==Radio_SysID_LDR && Pkt.Bytes==PktLen-8) Match++; }
+  return Match; }
+
+int main(int argc, char *argv[])
+{ const uint8_t Mix[4][2] = { { Radio_SysID_ADSL, Radio_SysID_OGN_ADSL }, { Radio_SysID_OGN, Radio_SysID_OGN_ADSL },
+                              { Radio_SysID_ADSL, Radio_SysID_FLR_ADSL }, { Radio_SysID_FLR, Radio_SysID_FLR_ADSL } } ;
+  int Fail=0;
+  for(int Idx=0; Idx<4; Idx++)
+  { uint8_t SysID=Mix[Idx][0], RxSysID=Mix[Idx][1];
+    int Before=Resolved, CaseBefore=Cases;
+    for(int Rep=0; Rep<200; Rep++)
+    { TestCase(SysID, RxSysID, 0, 0, 1);                   // nominal
+      TestCase(SysID, RxSysID, 0, 1, 1);                   // one bit error in the signature
+      TestCase(SysID, RxSysID,-1, 0, 1);                   // packet one bit earlier
+      TestCase(SysID, RxSysID,+1, 0, 1); }                 // packet one bit later
+    int Must = Resolved-Before, MustCases = Cases-CaseBefore;
+    Fail += Must!=MustCases;
+    for(int Rep=0; Rep<200; Rep++)
+    { TestCase(SysID, RxSysID,-2, 0, 0);                   // not always: near the limits of the search or of the packet length
+      TestCase(SysID, RxSysID,+2, 0, 0);
+      TestCase(SysID, RxSysID, 0, 2, 0); }
+    printf("%s in %s: %d/%d must-resolve cases, %d/%d in total\n", FSK_RxPacket::SysName(SysID), FSK_RxPacket::SysName(RxSysID),
+           Must, MustCases, Resolved-Before, Cases-CaseBefore); }
+  { int Before=Resolved, CaseBefore=Cases;
+    for(int Rep=0; Rep<200; Rep++)
+    { TestCase(Radio_SysID_LDR, Radio_SysID_LDR, 0, 0, 1);
+      TestCase(Radio_SysID_LDR, Radio_SysID_LDR, 0, 2, 1);
+      for(int Shift=-16; Shift<=16; Shift+=getRand(3)+1)  // extra or missing preamble bits
+        TestCase(Radio_SysID_LDR, Radio_SysID_LDR, Shift, 0, 1); }
+    Fail += Resolved-Before!=Cases-CaseBefore;
+    printf("LDR: %d/%d resolved with up to 16 bit offset\n", Resolved-Before, Cases-CaseBefore); }
+  printf("Resolved into a wrong system or alignment: %d\n", Wrong);
+  Fail += Wrong>Cases/1000;
+  const int NoiseCount=100000;
+  int FalseFA = Noise(Radio_SysID_FLR_ADSL, NoiseCount);
+  int FalseOA = Noise(Radio_SysID_OGN_ADSL, NoiseCount);
+  int FalseLDR= Noise(Radio_SysID_LDR, NoiseCount);
+  printf("False matches on noise: F+A %d, O+A %d, LDR %d out of %d\n", FalseFA, FalseOA, FalseLDR, NoiseCount);
+  Fail += FalseFA>NoiseCount/100 || FalseOA>NoiseCount/100 || FalseLDR>0;
+  printf("%s\n", Fail?"FAIL":"OK");
+  return Fail ? 1 : 0; }
@@ -0,0 +1,112 @@
+// TEA_Batch of tea-batch.h against TEA_Encrypt_Key0()/XXTEA_Encrypt_Key0() of ognconv.cpp: bit-exact on random blocks
+// and packets for every batch size up to a few groups, every round count and packet length, encryption and decryption.
+// Then OGN whitening (both TEA blocks of the position) and ADS-L scrambling (XXTEA over 5 words) of a relay-sized
+// corpus in packets per second: packet by packet with the scalar functions against the batch.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ognconv.h"
+#include "tea-batch.h"
+#include "check.h"
+
+// ===================================================================================================
+
+static uint32_t Rand = 0x1F2E3D4C;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+
+const int MaxPackets = 3*TEA_Batch::Lanes+3;           // full groups and a partial one
+const int MaxWords   = TEA_Batch::MaxWords;
+
+static uint32_t Data[MaxPackets][MaxWords], Ref[MaxPackets][MaxWords];
+static uint32_t *Ptr[MaxPackets];
+
+static void Fill(int Packets, int Words)
+{ for(int Pkt=0; Pkt<Packets; Pkt++)
+  { for(int Word=0; Word<Words; Word++) Data[Pkt][Word]=Ref[Pkt][Word]=getRand();
+    Ptr[Pkt]=Data[Pkt]; }
+}
+
+static bool Same(int Packets, int Words)
+{ for(int Pkt=0; Pkt<Packets; Pkt++)
+    if(memcmp(Data[Pkt], Ref[Pkt], Words*sizeof(uint32_t))) return 0;
+  return 1; }
+
+static void Test_Exact(void)
+{ int Diff[4]={0,0,0,0};
+  for(int Packets=0; Packets<=MaxPackets; Packets++)
+  { for(int Loops=1; Loops<=16; Loops++)
+    { Fill(Packets, 2);
+      TEA_Batch::Encrypt_Key0(Ptr, Packets, Loops);
+      for(int Pkt=0; Pkt<Packets; Pkt++) TEA_Encrypt_Key0(Ref[Pkt], Loops);
+      Diff[0]+=!Same(Packets, 2);
+      TEA_Batch::Decrypt_Key0(Ptr, Packets, Loops);
+      for(int Pkt=0; Pkt<Packets; Pkt++) TEA_Decrypt_Key0(Ref[Pkt], Loops);
+      Diff[1]+=!Same(Packets, 2);
+      for(int Words=2; Words<=MaxWords; Words++)
+      { Fill(Packets, Words);
+        TEA_Batch::XXTEA_Encrypt_Key0(Ptr, Packets, Words, Loops);
+        for(int Pkt=0; Pkt<Packets; Pkt++) XXTEA_Encrypt_Key0(Ref[Pkt], Words, Loops);
+        Diff[2]+=!Same(Packets, Words);
+        TEA_Batch::XXTEA_Decrypt_Key0(Ptr, Packets, Words, Loops);
+        for(int Pkt=0; Pkt<Packets; Pkt++) XXTEA_Decrypt_Key0(Ref[Pkt], Words, Loops);
+        Diff[3]+=!Same(Packets, Words); }
+    }
+  }
+  Check("TEA encrypt, batch as scalar", Diff[0]==0);
+  Check("TEA decrypt, batch as scalar", Diff[1]==0);
+  Check("XXTEA encrypt, batch as scalar", Diff[2]==0);
+  Check("XXTEA decrypt, batch as scalar", Diff[3]==0);
+
+  int Pair=0;
+  for(int Test=0; Test<10000; Test++)                  // the two blocks of OGN1_Packet::Whiten() at once
+  { uint32_t Pos[4], Pos2[4];
+    for(int Idx=0; Idx<4; Idx++) Pos[Idx]=Pos2[Idx]=getRand();
+    TEA_Encrypt_Key0(Pos, Pos+2, 8); TEA_Encrypt_Key0(Pos2, 8); TEA_Encrypt_Key0(Pos2+2, 8);
+    if(memcmp(Pos, Pos2, sizeof(Pos))) Pair++;
+    TEA_Decrypt_Key0(Pos, Pos+2, 8); TEA_Decrypt_Key0(Pos2, 8); TEA_Decrypt_Key0(Pos2+2, 8);
+    if(memcmp(Pos, Pos2, sizeof(Pos))) Pair++; }
+  Check("TEA on two blocks as on each", Pair==0); }
+
+// ---------------------------------------------------------------------------------------------------
+
+const int Corpus = 4096;                               // packets
+static uint32_t Packet[Corpus][5];
+static uint32_t *Block[2*Corpus], *Whole[Corpus];
+static uint32_t Sink=0;
+
+template <class Func>
+ static double Rate(Func Run)                          // [packets/sec]
+{ int Rounds=0; double Start=getTime(), Time;
+  do { Run(); Rounds++; Time=getTime()-Start; } while(Time<0.2);
+  for(int Pkt=0; Pkt<Corpus; Pkt++) Sink+=Packet[Pkt][0];
+  return (double)Rounds*Corpus/Time; }
+
+static void Benchmark(void)
+{ for(int Pkt=0; Pkt<Corpus; Pkt++)
+  { for(int Word=0; Word<5; Word++) Packet[Pkt][Word]=getRand();
+    Block[2*Pkt]=Packet[Pkt]+1; Block[2*Pkt+1]=Packet[Pkt]+3;   // OGN: the position after the header, two TEA blocks
+    Whole[Pkt]=Packet[Pkt]; }                                    // ADS-L: XXTEA over 5 words
+  double OGN[2], ADSL[2];
+  OGN[0]  = Rate([]() { for(int Pkt=0; Pkt<Corpus; Pkt++) { TEA_Encrypt_Key0(Packet[Pkt]+1, 8); TEA_Encrypt_Key0(Packet[Pkt]+3, 8); } } );
+  OGN[1]  = Rate([]() { TEA_Batch::Encrypt_Key0(Block, 2*Corpus, 8); } );
+  ADSL[0] = Rate([]() { for(int Pkt=0; Pkt<Corpus; Pkt++) XXTEA_Encrypt_Key0(Packet[Pkt], 5, 6); } );
+  ADSL[1] = Rate([]() { TEA_Batch::XXTEA_Encrypt_Key0(Whole, Corpus, 5, 6); } );
+#ifdef TEA_BATCH_VECTOR
+  printf("batch: %d lanes, vector registers of %d lanes\n", TEA_Batch::Lanes, TEA_Batch::PartLanes);
+#else
+  printf("batch: %d lanes, scalar\n", TEA_Batch::Lanes);
+#endif
+  printf("OGN whitening    [Mpkt/s] scalar %6.2f  batch %6.2f  x%4.1f\n", 1e-6*OGN[0],  1e-6*OGN[1],  OGN[1]/OGN[0]);
+  printf("ADS-L scrambling [Mpkt/s] scalar %6.2f  batch %6.2f  x%4.1f\n", 1e-6*ADSL[0], 1e-6*ADSL[1], ADSL[1]/ADSL[0]); }
+
+int main(int argc, char *argv[])
+{ Test_Exact();
+  Benchmark();
+  return CheckResult(); }
@@ -0,0 +1,72 @@
+// Generate src/adsl.cpp: the perfect hash of the ADS-L PI syndromes of all 1-bit and 2-bit error patterns for ADSL_Packet::FindCRCpattern().
+// adsl_syndrome_gen > ../src/adsl.cpp
+// Takes CRCsyndrome(), SyndromeHash(), SyndromeDispMul, SyndromeBuckets and SyndromeSlots from adsl.h: regenerate after changing any of them,
+// tests/adsl_syndrome_test compares the output against src/adsl.cpp.
+// Hash-and-displace: the syndromes go into buckets by the top bits of SyndromeHash(), the largest buckets are placed first
+// (equal sizes in bucket order), the displacement of a bucket is the first one which puts all its syndromes into free slots.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "adsl.h"
+
+const int Bits    = (ADSL_Packet::TxBytes-3)*8;         // 192 bits of the packet under the PI
+const int Buckets = ADSL_Packet::SyndromeBuckets;
+const int Slots   = ADSL_Packet::SyndromeSlots;
+
+static int BucketBits(void) { int Bits=0; while((1<<Bits)<Buckets) Bits++; return Bits; }
+
+static int Slot(uint32_t Syndr, uint16_t Disp)
+{ return ADSL_Packet::SyndromeHash(Syndr^(Disp*ADSL_Packet::SyndromeDispMul))%Slots; }
+
+static void Print(const char *Name, const char *Size, const std::vector<uint16_t> &Table)
+{ printf("const uint16_t %s[ADSL_Packet::%s] = {\n", Name, Size);
+  for(size_t Idx=0; Idx<Table.size(); Idx++)
+    printf(" 0x%04X%s", Table[Idx], Idx+1==Table.size() ? " } ;\n" : (Idx%12==11 ? ",\n":",")); }
+
+int main(int argc, char *argv[])
+{ std::vector<uint32_t> Key; std::vector<uint16_t> Pattern;  // syndrome => (Bit1<<8)|Bit2, Bit2=0xFF for a single bit
+  for(int Bit1=0; Bit1<Bits; Bit1++)
+  { Key.push_back(ADSL_Packet::CRCsyndrome(Bit1)); Pattern.push_back((Bit1<<8)|0xFF); }
+  for(int Bit1=0; Bit1<Bits; Bit1++)
+    for(int Bit2=Bit1+1; Bit2<Bits; Bit2++)
+    { Key.push_back(ADSL_Packet::CRCsyndrome(Bit1)^ADSL_Packet::CRCsyndrome(Bit2)); Pattern.push_back((Bit1<<8)|Bit2); }
+  if((int)Key.size()!=Slots)
+  { fprintf(stderr, "%d patterns for %d slots\n", (int)Key.size(), Slots); return 1; }
+
+  std::vector< std::vector<int> > Bucket(Buckets);
+  int Shift=32-BucketBits();
+  for(size_t Idx=0; Idx<Key.size(); Idx++) Bucket[ADSL_Packet::SyndromeHash(Key[Idx])>>Shift].push_back(Idx);
+  std::vector<int> Order(Buckets); for(int Idx=0; Idx<Buckets; Idx++) Order[Idx]=Idx;
+  std::stable_sort(Order.begin(), Order.end(), [&](int A, int B) { return Bucket[A].size()>Bucket[B].size(); } );
+
+  std::vector<uint16_t> Table(Slots, 0xFFFF), Disp(Buckets, 0);
+  for(int Idx=0; Idx<Buckets; Idx++)
+  { const std::vector<int> &Keys=Bucket[Order[Idx]]; if(Keys.empty()) break;
+    uint32_t Try;
+    for(Try=0; Try<0x10000; Try++)                      // the first displacement which puts all keys of the bucket into free slots
+    { std::vector<int> Used;
+      for(int Ent: Keys)
+      { int Pos=Slot(Key[Ent], Try);
+        if(Table[Pos]!=0xFFFF || std::find(Used.begin(), Used.end(), Pos)!=Used.end()) break;
+        Used.push_back(Pos); }
+      if(Used.size()==Keys.size()) break; }
+    if(Try>=0x10000) { fprintf(stderr, "No displacement for bucket #%d of %d keys\n", Order[Idx], (int)Keys.size()); return 1; }
+    Disp[Order[Idx]]=Try;
+    for(int Ent: Keys) Table[Slot(Key[Ent], Try)]=Pattern[Ent]; }
+
+  printf("#include <stdio.h>\n#include <stdint.h>\n\n#include \"adsl.h\"\n\n");
+  printf("// Minimal perfect hash of the PI syndromes of all 1-bit and 2-bit error patterns over the 24 bytes of an ADS-L packet:\n");
+  printf("// 192 single plus 18336 double bit patterns, all syndromes distinct as the 24-bit PI has a Hamming distance of 6 over this length.\n");
+  printf("// Syndrome => Bucket = SyndromeHash(Syndr)>>%d, Slot = SyndromeHash(Syndr^(Disp[Bucket]*0x%08X))%%%d,\n",
+         Shift, ADSL_Packet::SyndromeDispMul, Slots);
+  printf("// the slot holds the bit indices: (Bit1<<8)|Bit2, Bit2=0xFF for a single bit error. Generated with hash-and-displace,\n");
+  printf("// the largest buckets first, the displacement is the first seed which puts all syndromes of the bucket into free slots.\n");
+  printf("// Generated by utils/adsl_syndrome_gen from adsl.h: do not edit, regenerate after a change of the PI or of the hash.\n\n");
+  Print("ADSL_SyndromeDisp", "SyndromeBuckets", Disp); printf("\n");
+  Print("ADSL_SyndromeHash", "SyndromeSlots", Table);
+  return 0; }
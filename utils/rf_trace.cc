@@ -0,0 +1,161 @@
+// Decode the RF event trace (Ctrl-E on the tracker console, see src/rf-trace.h) into a per-slot timeline and latency statistics.
+// rf_trace <dump-file>                 read a dump captured before
+// rf_trace /dev/ttyUSB0[:baud]         send Ctrl-E to the tracker and read the dump from the console
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#include "serial.h"
+#include "rf-trace.h"
+
+static const char *SysName(uint8_t SysID)
+{ static const char *Name[16] = { "FLR", "OGN", "ADL", "RID", "FNT", "LDR", "HDR", "---",
+                                  "F+A", "O+A", "---", "---", "---", "---", "---", "---" } ;
+  if(SysID==RF_Trace::SysWAN) return "WAN";
+  if(SysID==0xFF) return "-";
+  return SysID<16 ? Name[SysID]:"???"; }
+
+static const char *BandName(uint8_t Band)
+{ static const char *Name[3] = { "M", "O", "FNT" } ;
+  return Band<3 ? Name[Band]:"?"; }
+
+static double getTime(void)
+{ struct timespec now; clock_gettime(CLOCK_MONOTONIC, &now); return now.tv_sec + 1e-9*now.tv_nsec; }
+
+static uint8_t Data[RF_Trace::Size*8+64];               // the raw dump
+static RF_TraceEvent Event[RF_Trace::Size];
+
+static int FindDump(int Len)                            // offset of the "RFT" header or -1
+{ for(int Ofs=0; Ofs+4<=Len; Ofs++)
+    if(memcmp(Data+Ofs, "RFT", 3)==0 && Data[Ofs+3]==RF_Trace::Version) return Ofs;
+  return -1; }
+
+static int Capture(SerialPort &Port, bool Serial)       // read till a complete dump is found, return its offset
+{ int Len=0; double Start=getTime();
+  for( ; ; )
+  { if(Len==(int)sizeof(Data)) { memmove(Data, Data+sizeof(Data)/2, sizeof(Data)/2); Len-=sizeof(Data)/2; }
+    int Bytes=Port.Read((char *)Data+Len, sizeof(Data)-Len);
+    if(Bytes>0) Len+=Bytes;
+    int Ofs=FindDump(Len);
+    if(Ofs>=0 && Len-Ofs>=14)
+    { uint32_t Events=RF_Trace::get32(Data+Ofs+10)-RF_Trace::get32(Data+Ofs+6);
+      if(Events>RF_Trace::get16(Data+Ofs+4)) { Data[Ofs]=0; continue; }            // not a real header: skip it
+      if(Len-Ofs>=RF_Trace::DumpLen(Events)) return Ofs; }
+    if(Bytes>0) continue;
+    if(!Serial) return -1;                                                          // end of file
+    if(getTime()-Start>5.0) return -1;                                              // no dump from the tracker
+    usleep(1000); }
+}
+
+class SlotInfo                                          // what happened in one slot
+{ public:
+   uint32_t usStart, usEnd;
+   uint8_t  Chan, RxSysID, TxSysID;
+   uint32_t usConfig;                                   // [usec] time spent in configuring the RF chip
+   uint32_t usTx;                                       // [usec] time spent transmitting
+   uint16_t LBT, Reads, Fails, FIFOfull;
+   uint32_t usIRQsum, usIRQmax;                         // [usec] IRQ to read-out
+} ;
+
+static void PrintSlot(const SlotInfo &Slot, uint32_t usRef)
+{ printf("%9.3f %6.1f  %3d  %-3s %-3s %6.2f %6.2f %3d %4d %4d %7.0f %6d %3d\n",
+         1e-3*(Slot.usStart-usRef), 1e-3*(Slot.usEnd-Slot.usStart), Slot.Chan, SysName(Slot.RxSysID), SysName(Slot.TxSysID),
+         1e-3*Slot.usConfig, 1e-3*Slot.usTx, Slot.LBT, Slot.Reads, Slot.Fails,
+         Slot.Reads ? (double)Slot.usIRQsum/Slot.Reads : 0.0, Slot.usIRQmax, Slot.FIFOfull); }
+
+class Stat                                              // average/max/percentile of a latency
+{ public:
+   uint32_t *Value; int Count, Max;
+   Stat(int Max) : Count(0), Max(Max) { Value = new uint32_t[Max]; }
+  ~Stat() { delete [] Value; }
+   void Add(uint32_t Val) { if(Count<Max) Value[Count++]=Val; }
+   void Print(const char *Name)
+   { if(Count==0) { printf("%-24s      -\n", Name); return; }
+     std::sort(Value, Value+Count);
+     double Sum=0; for(int Idx=0; Idx<Count; Idx++) Sum+=Value[Idx];
+     printf("%-24s %6d  %8.1f %8d %8d\n", Name, Count, Sum/Count, Value[(Count*95)/100], Value[Count-1]); }
+} ;
+
+int main(int argc, char *argv[])
+{ if(argc<2) { printf("usage: %s <dump-file> | <serial-port>[:baud]\n", argv[0]); return -1; }
+
+  SerialPort Port;
+  char *Name = argv[1];
+  bool Serial = strncmp(Name, "/dev/", 5)==0;
+  if(Serial)
+  { int BaudRate=115200;
+    char *Colon = strchr(Name, ':');
+    if(Colon) { Colon[0]=0; BaudRate=atoi(Colon+1); }
+    if(Port.Open(Name, BaudRate)<0) { printf("Can't open %s at %dbps\n", Name, BaudRate); return -1; }
+    Port.Write((char)('E'-'@')); }                                                  // Ctrl-E: request the trace dump
+  else if(Port.OpenFileForRead(Name)<0) { printf("Can't open %s\n", Name); return -1; }
+
+  int Ofs=Capture(Port, Serial);
+  Port.Close();
+  if(Ofs<0) { printf("No RF trace found in %s\n", Name); return -1; }
+  int Len=sizeof(Data)-Ofs;
+  int Events=RF_Trace::ReadDump(Event, RF_Trace::Size, Data+Ofs, Len);
+  if(Events==-2) { printf("RF trace: CRC error\n"); return -1; }
+  if(Events<0)   { printf("RF trace: format error\n"); return -1; }
+  if(Events==0)  { printf("RF trace: empty\n"); return 0; }
+
+  uint32_t usRef=Event[0].usTime;
+  printf("%d events over %5.3fs\n", Events, 1e-6*(Event[Events-1].usTime-usRef));
+  printf(" start[ms] len[ms] chan RX  TX  conf[ms] TX[ms] LBT read fail IRQ[us] max[us] full\n");
+
+  Stat Config(Events), IRQ(Events), TxTime(Events);
+  int LBT=0, FIFOfull=0, Slots=0, WANrx=0;
+  SlotInfo Slot; bool inSlot=0;
+  uint32_t usConfig=0, usTx=0, usIRQ=0; bool Configuring=0, Transmitting=0, IRQpending=0;
+  for(int Idx=0; Idx<Events; Idx++)
+  { const RF_TraceEvent &Ev=Event[Idx];
+    switch(Ev.Type)
+    { case RF_Trace::Slot:
+        if(inSlot) { Slot.usEnd=Ev.usTime; PrintSlot(Slot, usRef); }                 // no SlotEnd: the next slot closes it
+        memset(&Slot, 0, sizeof(Slot)); inSlot=1; Slots++;
+        Slot.usStart=Ev.usTime; Slot.Chan=Ev.Arg; Slot.RxSysID=Ev.Val&0xFF; Slot.TxSysID=Ev.Val>>8;
+        break;
+      case RF_Trace::SlotEnd:
+        if(inSlot) { Slot.usEnd=Ev.usTime; PrintSlot(Slot, usRef); inSlot=0; }
+        break;
+      case RF_Trace::ConfigStart: usConfig=Ev.usTime; Configuring=1; break;
+      case RF_Trace::ConfigEnd:
+        if(Configuring) { uint32_t usTime=Ev.usTime-usConfig; Config.Add(usTime); Slot.usConfig+=usTime; Configuring=0; }
+        break;
+      case RF_Trace::RxStart: break;
+      case RF_Trace::IRQ: usIRQ=Ev.usTime; IRQpending=1; break;
+      case RF_Trace::Read:
+        if(IRQpending)
+        { uint32_t usTime=Ev.usTime-usIRQ; IRQ.Add(usTime); IRQpending=0;
+          Slot.usIRQsum+=usTime; if(usTime>Slot.usIRQmax) Slot.usIRQmax=usTime; }
+        Slot.Reads++; if(Ev.Arg==0xFF) Slot.Fails++;
+        break;
+      case RF_Trace::TxStart: usTx=Ev.usTime; Transmitting=1; break;
+      case RF_Trace::TxEnd:
+        if(Transmitting)
+        { uint32_t usTime=Ev.usTime-usTx; TxTime.Add(usTime); Slot.usTx+=usTime; Transmitting=0;
+          if(!inSlot) printf("%9.3f         TX %s band %5.2fms\n", 1e-3*(usTx-usRef), BandName(Ev.Arg), 1e-3*usTime); }
+        break;
+      case RF_Trace::FIFOfull: Slot.FIFOfull++; FIFOfull++; break;
+      case RF_Trace::LBT:      Slot.LBT++; LBT++; break;
+      case RF_Trace::WANrx:
+        printf("%9.3f         WAN RX chan %d: %d bytes\n", 1e-3*(Ev.usTime-usRef), Ev.Arg, Ev.Val); WANrx++;
+        break;
+      default:
+        printf("%9.3f         %s ?\n", 1e-3*(Ev.usTime-usRef), RF_Trace::TypeName(Ev.Type));
+        break;
+    }
+  }
+  if(inSlot) { Slot.usEnd=Event[Events-1].usTime; PrintSlot(Slot, usRef); }
+
+  printf("\n%d slots, %d LBT deferrals, %d FIFO overflows, %d LoRaWAN receptions\n", Slots, LBT, FIFOfull, WANrx);
+  printf("                          count   avg[us]  p95[us]  max[us]\n");
+  Config.Print("RF chip config.");
+  IRQ.Print("IRQ to read-out");
+  TxTime.Print("transmission");
+  return 0; }